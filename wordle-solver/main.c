@@ -9,12 +9,27 @@
 #include <string.h>
 #include <stdlib.h>
 #include <time.h>
-#include <ctype.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <unistd.h>
 
 #include "wordle-solver.h"
-#include "wordle-words.h"
+#include "wordle-dictionary.h"
+#include "wordle-multi.h"
+#include "wordle-absurdle.h"
+#include "wordle-stats.h"
+#include "wordle-trace.h"
+#include "wordle-output.h"
+#include "wordle-tables.h"
+#include "wordle-query.h"
+#include "wordle-tournament.h"
+#include "wordle-matrix.h"
+#include "wordle-stream.h"
+#include "wordle-tree.h"
+#include "wordle-verify.h"
+#include "wordle-replay.h"
+#include "wordle-cache.h"
+#include "wordle-alphabet.h"
 
 #define GAME_MODE_UNSET             -1
 
@@ -30,17 +45,34 @@
 // play against every word in input dictionary, modifying start word
 #define GAME_MODE_START_OPTIMIZE    3
 
+// most words -hints will list
+#define MAX_HINTS                   100
+
 // used in dictionary validation
 #define MAX_WORD_SIZE               100
 
+/*
+ *  seconds elapsed since start, used for reporting simulation throughput
+ */
+static double elapsed_seconds(const struct timespec *start)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)(now.tv_sec - start->tv_sec) + (double)(now.tv_nsec - start->tv_nsec)/1e9;
+}
+
 /*
  *  scan entire dictionary to find the best start word
  */
-void find_optimal_word(char dictionary[MAX_DICTIONARY_SIZE][WORDLE_WORD_SIZE+1],
-                       int  dictionary_entries,
-                       bool verbose)
+void find_optimal_word(const s_wordle_dictionary *dictionary,
+                       bool                      hard_mode,
+                       const s_search_budget     *search_budget,
+                       const uint8_t             *cached_counts,
+                       bool                      quiet,
+                       bool                      verbose)
 {
-    int i_best_starting_word_wins, i_best_average_score;
+    int dictionary_entries = dictionary->entries;
+    int i_best_starting_word_wins = 0, i_best_average_score = 0;
     float best_average_score = 100.0f;
     int best_starting_word_wins = 0;
 
@@ -48,10 +80,17 @@ void find_optimal_word(char dictionary[MAX_DICTIONARY_SIZE][WORDLE_WORD_SIZE+1],
     
     for(int i=0; i<dictionary_entries; i++)
     {
-        char target_word[WORDLE_WORD_SIZE+1];
+        struct timespec start_time;
+        clock_gettime(CLOCK_MONOTONIC, &start_time);
+        
+        char start_word[WORDLE_WORD_SIZE+1];
         int game_count = 0, tot_games = dictionary_entries, min_guess = 10000, max_guess = 0, total_guess = 0;
         int six_or_less = 0;
-        char min_guess_word[WORDLE_WORD_SIZE+1], max_guess_word[WORDLE_WORD_SIZE+1];
+        uint32_t min_guess_word = 0, max_guess_word = 0;
+        char min_guess_text[WORDLE_WORD_SIZE+1], max_guess_text[WORDLE_WORD_SIZE+1];
+        char text[WS_ALPHABET_TEXT_SIZE];
+        
+        ws_word_decode(dictionary->words[i], start_word);
         
         int guesses_per_win[20] = {0};
         
@@ -59,24 +98,36 @@ void find_optimal_word(char dictionary[MAX_DICTIONARY_SIZE][WORDLE_WORD_SIZE+1],
 
         for(int j=0; j<dictionary_entries; j++)
         {
-            strcpy(target_word, &dictionary[j][0]);
-            
-            ws_init(&wordle_state, &dictionary[i][0]);
-            
-            ws_debug_print(verbose, "playing with starting word %s\n", wordle_state.starting_word);
-
+            uint32_t target_word = dictionary->words[j];
             int guess_count = 0;
-            int ret;
-            do
-            {
-                ret = ws_make_guess(&wordle_state,
-                                    target_word,
-                                    dictionary,
-                                    dictionary_entries,
-                                    verbose);
-                guess_count++;
+            
+            // games already played on a cached run are only counted
+            if(cached_counts != NULL)
+            {
+                guess_count = cached_counts[(size_t)i*dictionary_entries + j];
+            }
+            else
+            {
+                ws_init(&wordle_state, start_word, hard_mode);
+                wordle_state.search_budget = *search_budget;
                 
-            } while(!ret);
+                ws_debug_print(verbose, "playing with starting word %s\n", wordle_state.starting_word);
+                WS_TRACE_EVENT(false, WS_TRACE_GAME_BEGIN, target_word);
+                
+                int ret;
+                do
+                {
+                    ret = ws_make_guess(&wordle_state,
+                                        target_word,
+                                        dictionary,
+                                        verbose);
+                    guess_count++;
+                    
+                } while(!ret);
+                
+                WS_TRACE_EVENT(verbose, WS_TRACE_GAME_END, (uint32_t)guess_count);
+                ws_output_game(start_word, target_word, guess_count, &wordle_state);
+            }
             
             if(guess_count < 20)
             {
@@ -86,18 +137,16 @@ void find_optimal_word(char dictionary[MAX_DICTIONARY_SIZE][WORDLE_WORD_SIZE+1],
             {
                 ws_debug_print(verbose, "whoa something went south here\n");
             }
-            
-            ws_debug_print(verbose, "found word in %d tries\n", guess_count);
             game_count++;
             if(guess_count > max_guess)
             {
                 max_guess = guess_count;
-                strcpy(max_guess_word, target_word);
+                max_guess_word = target_word;
             }
             if(guess_count < min_guess)
             {
                 min_guess = guess_count;
-                strcpy(min_guess_word, target_word);
+                min_guess_word = target_word;
             }
             total_guess += guess_count;
             
@@ -106,28 +155,517 @@ void find_optimal_word(char dictionary[MAX_DICTIONARY_SIZE][WORDLE_WORD_SIZE+1],
                 six_or_less++;
             }
         }
-        for(int i=1; i<20; i++)
+        ws_word_decode(max_guess_word, max_guess_text);
+        ws_word_decode(min_guess_word, min_guess_text);
+        ws_output_start_word(start_word, game_count, ((float)total_guess)/(float)game_count, max_guess, max_guess_text, six_or_less);
+        if(!quiet)
         {
-            printf("%d found in %d guesses\n", guesses_per_win[i], i);
+            for(int i=1; i<20; i++)
+            {
+                printf("%d found in %d guesses\n", guesses_per_win[i], i);
+            }
+            printf("maximum guesses %d for word %s\n", max_guess, ws_alphabet_text(max_guess_text, text));
+            printf("minimum guesses %d for word %s\n", min_guess, ws_alphabet_text(min_guess_text, text));
+            printf("average guesses %f\n", ((float)total_guess)/(float)game_count);
+            printf("won the wordle %2.2f%% of the time, fear the future\n", 100.0*((float)six_or_less/(float)tot_games));
+            if(cached_counts != NULL)
+            {
+                // nothing was played, so there's no throughput to report
+                printf("counted %d games from the cache\n", game_count);
+            }
+            else
+            {
+                double seconds = elapsed_seconds(&start_time);
+                printf("played %d games in %2.3f seconds (%.0f games/second)\n", game_count, seconds,
+                       (double)game_count/seconds);
+            }
         }
-        printf("maximum guesses %d for word %s\n", max_guess, max_guess_word);
-        printf("minimum guesses %d for word %s\n", min_guess, min_guess_word);
-        printf("average guesses %f\n", ((float)total_guess)/(float)game_count);
-        printf("won the wordle %2.2f%% of the time, fear the future\n", 100.0*((float)six_or_less/(float)tot_games));
     
         if(((float)total_guess)/(float)game_count < best_average_score)
         {
             i_best_average_score = i;
             best_average_score = ((float)total_guess)/(float)game_count;
-            printf("new best average score %2.2f%% with %s\n", best_average_score, &dictionary[i][0]);
+            if(!quiet)
+            {
+                printf("new best average score %2.2f%% with %s\n", best_average_score, ws_alphabet_text(start_word, text));
+            }
         }
         if(six_or_less > best_starting_word_wins)
         {
             best_starting_word_wins = six_or_less;
             i_best_starting_word_wins = i;
-            printf("new best most wins %d with word %s\n", best_starting_word_wins, &dictionary[i][0]);
+            if(!quiet)
+            {
+                printf("new best most wins %d with word %s\n", best_starting_word_wins, ws_alphabet_text(start_word, text));
+            }
+        }
+    }
+    
+    char best_word[WORDLE_WORD_SIZE+1], text[WS_ALPHABET_TEXT_SIZE];
+    ws_word_decode(dictionary->words[i_best_average_score], best_word);
+    printf("best average score %2.2f with %s\n", best_average_score, ws_alphabet_text(best_word, text));
+    ws_word_decode(dictionary->words[i_best_starting_word_wins], best_word);
+    printf("best most wins %d with word %s\n", best_starting_word_wins, ws_alphabet_text(best_word, text));
+}
+
+/*
+ *  play multi-board games (Dordle, Quordle, Octordle...), either random or cycling every word through every board.
+ *  targets is the word list in its own order, dictionary the one guesses come from, which may be reordered.
+ */
+void play_multi_board(const s_wordle_dictionary *dictionary,
+                      const s_wordle_dictionary *targets,
+                      int                       boards,
+                      int                       game_mode,
+                      int                       num_games,
+                      char                      *start_word,
+                      bool                      verbose)
+{
+    int dictionary_entries = dictionary->entries;
+    int tot_games = (game_mode == GAME_MODE_RAND) ? num_games : dictionary_entries;
+    int max_guesses_allowed = boards + WORDLE_WORD_SIZE;  // 7 for Dordle, 9 for Quordle, 13 for Octordle
+    int min_guess = 10000, max_guess = 0, total_guess = 0, wins = 0;
+    int guesses_per_win[30] = {0};
+    
+    srand((unsigned int)time(NULL));
+    
+    struct timespec start_time;
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    
+    for(int game_count=0; game_count<tot_games; game_count++)
+    {
+        uint32_t target_words[WS_MAX_BOARDS];
+        
+        for(int b=0; b<boards; b++)
+        {
+            if(game_mode == GAME_MODE_FULL_DICT)
+            {
+                // offset each board so every word shows up once on every board
+                target_words[b] = targets->words[(game_count + b*(dictionary_entries/boards)) % dictionary_entries];
+            }
+            else
+            {
+                target_words[b] = targets->words[targets->answers[rand()%targets->answer_entries]];
+            }
         }
+        
+        s_multi_wordle_state multi_state;
+        ws_multi_init(&multi_state, boards, start_word);
+        
+        if(verbose)
+        {
+            char first_word[WORDLE_WORD_SIZE+1];
+            ws_word_decode(target_words[0], first_word);
+            ws_debug_printf("searching for %d words starting with %s\n", boards, first_word);
+        }
+        WS_TRACE_EVENT(false, WS_TRACE_GAME_BEGIN, target_words[0]);
+        
+        int guess_count = 0;
+        int ret;
+        do
+        {
+            ret = ws_multi_make_guess(&multi_state,
+                                      target_words,
+                                      dictionary,
+                                      verbose);
+            guess_count++;
+        } while(!ret && guess_count < 29);
+        
+        WS_TRACE_EVENT(false, WS_TRACE_GAME_END, (uint32_t)guess_count);
+        if(!ret)
+        {
+            printf("whoa something went south here\n");
+        }
+        guesses_per_win[guess_count]++;
+        if(guess_count > max_guess)
+        {
+            max_guess = guess_count;
+        }
+        if(guess_count < min_guess)
+        {
+            min_guess = guess_count;
+        }
+        total_guess += guess_count;
+        if(guess_count <= max_guesses_allowed)
+        {
+            wins++;
+        }
+    }
+    
+    for(int i=boards; i<30; i++)
+    {
+        if(guesses_per_win[i])
+        {
+            printf("%d found in %d guesses\n", guesses_per_win[i], i);
+        }
+    }
+    printf("maximum guesses %d\n", max_guess);
+    printf("minimum guesses %d\n", min_guess);
+    printf("average guesses %f\n", ((float)total_guess)/(float)tot_games);
+    printf("won %2.2f%% of %d board games in %d guesses or less\n", 100.0*((float)wins/(float)tot_games), boards, max_guesses_allowed);
+    double seconds = elapsed_seconds(&start_time);
+    printf("played %d games in %2.3f seconds (%.0f games/second)\n", tot_games, seconds, (double)tot_games/seconds);
+}
+
+/*
+ *  play against the adversarial host, either once with the chosen start word or ranking every start word
+ *  by the most guesses the host can force
+ */
+void play_absurdle(const s_wordle_dictionary *dictionary,
+                   char                      *start_word,
+                   bool                      find_start_word,
+                   bool                      hard_mode,
+                   int                       threads,
+                   bool                      verbose)
+{
+    int dictionary_entries = dictionary->entries;
+    struct timespec start_time;
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    
+    if(!find_start_word)
+    {
+        s_wordle_state wordle_state;
+        s_absurdle_result result;
+        char worst_text[WS_ALPHABET_TEXT_SIZE], start_text[WS_ALPHABET_TEXT_SIZE];
+        
+        ws_init(&wordle_state, start_word, hard_mode);
+        ws_absurdle_play(&wordle_state, dictionary, &result, verbose);
+        printf("host can force %d guesses starting with %s (first with %s), %f on average over %d answers\n",
+               result.worst_case, ws_alphabet_text(start_word, start_text), ws_alphabet_text(result.worst_word, worst_text),
+               result.answers ? (double)result.total_guesses/result.answers : 0.0, result.answers);
+        double seconds = elapsed_seconds(&start_time);
+        printf("walked the game tree in %2.3f seconds\n", seconds);
+        return;
+    }
+    
+    static int worst_case[MAX_DICTIONARY_SIZE];
+    int guesses_per_start[WS_ABSURDLE_MAX_GUESSES+1] = {0};
+    int best = WS_ABSURDLE_MAX_GUESSES;
+    
+    printf("ranking %d start words against %d answers on %d threads\n", dictionary_entries, dictionary->answer_entries, threads);
+    ws_absurdle_rank_start_words(dictionary, hard_mode, threads, worst_case);
+    
+    for(int i=0; i<dictionary_entries; i++)
+    {
+        guesses_per_start[worst_case[i]]++;
+        if(worst_case[i] < best)
+        {
+            best = worst_case[i];
+        }
+    }
+    for(int i=1; i<=WS_ABSURDLE_MAX_GUESSES; i++)
+    {
+        if(guesses_per_start[i])
+        {
+            printf("%d start words guarantee a win in %d guesses\n", guesses_per_start[i], i);
+        }
+    }
+    printf("best guaranteed worst case is %d guesses with:", best);
+    for(int i=0, shown=0; i<dictionary_entries && shown<20; i++)
+    {
+        if(worst_case[i] == best)
+        {
+            char word[WORDLE_WORD_SIZE+1], text[WS_ALPHABET_TEXT_SIZE];
+            ws_word_decode(dictionary->words[i], word);
+            printf(" %s", ws_alphabet_text(word, text));
+            shown++;
+        }
+    }
+    printf("\n");
+    double seconds = elapsed_seconds(&start_time);
+    printf("played %d games in %2.3f seconds (%.0f games/second)\n", dictionary_entries, seconds, (double)dictionary_entries/seconds);
+}
+
+#if WS_STATS
+/*
+ *  merge the main thread's counters and print the totals, registered with atexit() by -stats
+ */
+static void print_stats(void)
+{
+    ws_stats_flush();
+    printf("\n");
+    ws_stats_report(stdout);
+}
+#endif
+
+#if WS_TRACE
+static const char *trace_path = NULL;
+
+/*
+ *  dump the trace rings, registered with atexit() by -trace
+ */
+static void write_trace(void)
+{
+    ws_trace_write(trace_path);
+}
+#endif
+
+/*
+ *  play the same targets with every listed strategy and compare them, either random or every word once
+ */
+int play_tournament(const s_wordle_dictionary *dictionary,
+                    const char                *strategy_list,
+                    int                       game_mode,
+                    int                       num_games,
+                    const char                *start_word,
+                    bool                      hard_mode,
+                    const s_search_budget     *search_budget,
+                    int                       threads)
+{
+    const s_wordle_strategy *strategies[WS_MAX_STRATEGIES];
+    int strategy_count = 0;
+    char name[64];
+    
+    // comma separated names, the first is the one the rest are paired against
+    for(const char *next=strategy_list; *next; )
+    {
+        size_t length = strcspn(next, ",");
+        if(length >= sizeof(name) || strategy_count == WS_MAX_STRATEGIES)
+        {
+            printf("too many strategies or name too long; exiting...\n");
+            return 1;
+        }
+        memcpy(name, next, length);
+        name[length] = 0;
+        next += length + (next[length] == ',');
+        
+        strategies[strategy_count] = ws_strategy_find(name);
+        if(strategies[strategy_count] == NULL)
+        {
+            printf("unknown strategy '%s', choose from:\n", name);
+            for(int i=0; i<ws_strategy_count; i++)
+            {
+                printf("    %-12s %s\n", ws_strategies[i]->name, ws_strategies[i]->description);
+            }
+            printf("exiting...\n");
+            return 1;
+        }
+        strategy_count++;
+    }
+    if(strategy_count == 0)
+    {
+        printf("no strategies given; exiting...\n");
+        return 1;
+    }
+    
+    int games = (game_mode == GAME_MODE_RAND) ? num_games : dictionary->entries;
+    uint32_t *targets = malloc(sizeof(uint32_t)*(size_t)(games > 0 ? games : 1));
+    if(targets == NULL)
+    {
+        printf("out of memory; exiting...\n");
+        return 1;
+    }
+    srand((unsigned int)time(NULL));
+    for(int g=0; g<games; g++)
+    {
+        targets[g] = (game_mode == GAME_MODE_RAND) ? dictionary->words[dictionary->answers[rand()%dictionary->answer_entries]] :
+                                                     dictionary->words[g];
+    }
+    
+    struct timespec start_time;
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    
+    s_tournament_result results[WS_MAX_STRATEGIES];
+    int ret = ws_tournament_run(strategies, strategy_count, targets, games, dictionary, start_word, hard_mode, search_budget,
+                                threads, results);
+    free(targets);
+    if(ret)
+    {
+        printf("out of memory; exiting...\n");
+        return 1;
+    }
+    ws_tournament_report(stdout, results, strategy_count);
+    printf("played %d games in %.3f seconds\n", games*strategy_count, elapsed_seconds(&start_time));
+    return 0;
+}
+
+/*
+ *  how a cache was brought up to date with the word list
+ */
+static void print_cache_report(const s_cache_report *report,
+                               const char           *path,
+                               const char           *cells)
+{
+    double seconds = (double)report->ns/1e9;
+    if(report->reused)
+    {
+        printf("%s matches the word list, reused %lld %s in %.3f seconds\n", path, (long long)report->reused_cells,
+               cells, seconds);
+    }
+    else if(report->delta)
+    {
+        printf("updated %s for %d added and %d removed words, reused %lld %s, patched %lld and recomputed %lld in %.3f seconds\n",
+               path, report->added, report->removed, (long long)report->reused_cells, cells,
+               (long long)report->patched_cells, (long long)report->computed_cells, seconds);
+    }
+    else
+    {
+        printf("recomputed %lld %s in %.3f seconds for %s, %s\n", (long long)report->computed_cells, cells, seconds,
+               path, report->rebuilt);
+    }
+}
+
+/*
+ *  rank every word as a guess by how many answers it leaves on average, using streamed bucket counts so it
+ *  works for lists whose pattern matrix wouldn't fit
+ */
+int rank_all_guesses(const s_wordle_dictionary *dictionary,
+                     const s_stream_options    *options,
+                     const char                *cache_path)
+{
+    s_bucket_table table;
+    if(cache_path != NULL)
+    {
+        s_cache_report report;
+        if(ws_cache_buckets(&table, dictionary, options, cache_path, &report))
+        {
+            printf("couldn't prepare bucket counts; exiting...\n");
+            return 1;
+        }
+        print_cache_report(&report, cache_path, "guesses");
+    }
+    else
+    {
+        if(ws_stream_buckets(&table, dictionary, options))
+        {
+            printf("couldn't stream bucket counts; exiting...\n");
+            return 1;
+        }
+        
+        double pairs = (double)table.guesses*(double)table.answers, seconds = (double)table.build_ns/1e9;
+        printf("counted %d x %d feedback patterns in %.3f seconds (%d block%s, counts %s), %.1fM pairs/second\n",
+               table.guesses, table.answers, seconds, table.blocks, table.blocks == 1 ? "" : "s",
+               table.mapped ? "in scratch file" : "in memory", seconds > 0.0 ? pairs/seconds/1e6 : 0.0);
+    }
+    
+    // best few by expected answers left, sum of squared bucket sizes over answers
+    #define RANKED_GUESSES          10
+    int best[RANKED_GUESSES];
+    double best_expected[RANKED_GUESSES];
+    int ranked = 0;
+    for(int g=0; g<table.guesses; g++)
+    {
+        const uint32_t *counts = ws_bucket_counts(&table, g);
+        double sum = 0.0;
+        for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+        {
+            sum += (double)counts[p]*counts[p];
+        }
+        double expected = table.answers ? sum/table.answers : 0.0;
+        
+        if((g+1) % table.block_guesses == 0)
+        {
+            ws_bucket_drop(&table, g+1 - table.block_guesses, g+1);
+        }
+        
+        int i = ranked < RANKED_GUESSES ? ranked++ : RANKED_GUESSES;
+        for(; i>0 && best_expected[i-1] > expected; i--)
+        {
+            if(i < RANKED_GUESSES)
+            {
+                best[i] = best[i-1];
+                best_expected[i] = best_expected[i-1];
+            }
+        }
+        if(i < RANKED_GUESSES)
+        {
+            best[i] = g;
+            best_expected[i] = expected;
+        }
+    }
+    for(int i=0; i<ranked; i++)
+    {
+        char word[WORDLE_WORD_SIZE+1], text[WS_ALPHABET_TEXT_SIZE];
+        ws_word_decode(dictionary->words[best[i]], word);
+        printf("    %2d %s leaves %.2f answers on average\n", i+1, ws_alphabet_text(word, text), best_expected[i]);
+    }
+    #undef RANKED_GUESSES
+    
+    ws_bucket_release(&table);
+    return 0;
+}
+
+/*
+ *  build the greedy decision tree over every answer and report how it plays and what its indexes cost
+ */
+int build_decision_tree(const s_wordle_dictionary *dictionary,
+                        int                       threads)
+{
+    s_tree_result result;
+    if(ws_tree_build(dictionary, threads, &result))
+    {
+        printf("out of memory for the decision tree; exiting...\n");
+        return 1;
+    }
+    
+    char word[WORDLE_WORD_SIZE+1], text[WS_ALPHABET_TEXT_SIZE];
+    ws_word_decode(dictionary->words[result.root_guess], word);
+    double dense_size = (double)dictionary->entries*(double)dictionary->answer_entries;
+    printf("built decision tree over %d answers in %.3f seconds, root %s (%.3f bits)\n",
+           result.answers, (double)result.build_ns/1e9, ws_alphabet_text(word, text), result.root_entropy);
+    printf("average guesses %f, worst case %d, %d nodes of which %d indexed\n",
+           result.answers ? (double)result.total_guesses/result.answers : 0.0, result.max_guesses,
+           result.nodes, result.indexed_nodes);
+    printf("small nodes scored %lld guesses and dropped %lld as duplicates\n",
+           (long long)result.scored, (long long)result.deduplicated);
+    printf("answer indexes peaked at %.1f MB, dense pattern matrix %.1f MB\n",
+           (double)result.peak_index_bytes/(1024.0*1024.0), dense_size/(1024.0*1024.0));
+    return 0;
+}
+
+/*
+ *  replay a log of played games and report how the players did against the solver
+ */
+int replay_game_log(const s_wordle_dictionary *dictionary,
+                    const char                *log_path,
+                    const char                *results_path,
+                    int                       results_format,
+                    bool                      hard_mode,
+                    int                       threads)
+{
+    s_replay_options options = {results_path, results_format, threads, hard_mode};
+    s_replay_summary summary;
+    if(ws_replay_log(dictionary, log_path, &options, &summary))
+    {
+        return 1;
+    }
+    
+    double seconds = (double)summary.ns/1e9, moves = summary.moves ? (double)summary.moves : 1.0;
+    printf("replayed %lld games (%lld moves, %lld lines skipped) in %.3f seconds on %d thread%s\n",
+           (long long)summary.games, (long long)summary.moves, (long long)summary.skipped, seconds, threads,
+           threads == 1 ? "" : "s");
+    if(summary.contradicted)
+    {
+        printf("error: %lld game%s had feedback no word in the dictionary fits and %s left out\n",
+               (long long)summary.contradicted, summary.contradicted == 1 ? "" : "s",
+               summary.contradicted == 1 ? "was" : "were");
+    }
+    printf("%.0f games/second, %.1fM games/hour, %.0f moves/second\n",
+           seconds > 0.0 ? summary.games/seconds : 0.0, seconds > 0.0 ? summary.games/seconds*3600.0/1e6 : 0.0,
+           seconds > 0.0 ? summary.moves/seconds : 0.0);
+    printf("players left %.2f candidates per move on average, the solver %.2f; %.1f%% of moves honored every hint, "
+           "%.1f%% matched the solver\n", summary.player_expected/moves, summary.solver_expected/moves,
+           100.0*summary.consistent_moves/moves, 100.0*summary.solver_moves/moves);
+    return 0;
+}
+
+/*
+ *  words still possible after a guess, best first
+ */
+static void print_hints(s_wordle_state            *wordle_state,
+                        const s_wordle_dictionary *dictionary,
+                        int                       hints)
+{
+    s_query_word page[MAX_HINTS];
+    int count = ws_query_count(wordle_state, dictionary);
+    int shown = ws_query_page(wordle_state, dictionary, WS_QUERY_RANKED, 0, hints, page);
+    
+    printf("%d word%s left:", count, count == 1 ? "" : "s");
+    for(int i=0; i<shown; i++)
+    {
+        char text[WS_ALPHABET_TEXT_SIZE];
+        printf(" %s", ws_alphabet_text(page[i].word, text));
     }
+    printf("%s\n", shown < count ? " ..." : "");
 }
 
 void print_help(void)
@@ -138,12 +676,30 @@ void print_help(void)
     printf("\n");
     printf("    -help                           print help\n");
     printf("    -v                              verbose output\n");
+    printf("    -hard                           hard mode, score letters over the remaining candidates (guesses honor the hints either way)\n");
+    printf("    -reorder                        group the dictionary by feedback against the start word so candidates stay contiguous\n");
+    printf("    -stats                          print hot path counters and phase timings on exit\n");
+    printf("    -counters                       -stats plus hardware counters per phase (Linux perf_event_open)\n");
+    printf("    -trace=/path/to/trace.bin       record solver trace events and write them on exit\n");
+    printf("    -trace-decode=/path/to/trace    print a recorded trace as text\n");
+    printf("    -trace-json=/path/to/trace      print a recorded trace as Chrome trace JSON\n");
+    printf("    -results=/path/to/results       write per game and per start word results to a file\n");
+    printf("    -format=csv|jsonl               format for -results (default csv)\n");
+    printf("    -quiet                          only print final summaries\n");
+    printf("    -threads=n                      number of threads for parallel searches (default all cores)\n");
+    printf("    -hints=n                        after each guess print how many words are left and the n best\n");
+    printf("    -budget-us=n                    search up to n microseconds per guess for a better split (single board)\n");
+    printf("    -budget-work=n                  search up to n feedback evaluations per guess, repeatable unlike -budget-us\n");
     printf("\n");
     printf("Dictionary Configuration\n");
     printf("\n");
-    printf("    -dictionary=/path/to/dict.txt   load a dictionary file (ASCII, single word per line)\n");
+    printf("    -dictionary=/path/to/dict.txt   load a dictionary file (UTF-8, single word per line)\n");
+    printf("    -alphabet=letters               letters words are spelled with, up to %d in UTF-8 (default a-z)\n", WS_WORD_LETTERS);
     printf("    -wordle-dictionary              play against the Wordle dictionary\n");
+    printf("    -compiled-dictionary=/path      load a dictionary compiled with -compile-dictionary\n");
+    printf("    -compile-dictionary=/path       compile the loaded dictionary to a file and exit\n");
     printf("    -start-word=word                set word for first guess\n");
+    printf("    -boards=n                       play n boards at once (2-%d), with -rand or -full-dictionary\n", WS_MAX_BOARDS);
     printf("\n");
     printf("Game Modes\n");
     printf("\n");
@@ -151,18 +707,84 @@ void print_help(void)
     printf("    -full-dictionary                play against every word in the dictionary\n");
     printf("    -rand=n                         play n random games\n");
     printf("    -find-start-word                try every start word against full dictionary\n");
+    printf("    -absurdle                       play against an adversarial host, alone or with -find-start-word\n");
+    printf("    -pattern-matrix                 build the guess x answer feedback matrix and report its throughput\n");
+    printf("    -rank-guesses                   rank every word as a first guess by the answers it leaves on average\n");
+    printf("    -memory-cap=mb                  memory for -rank-guesses and -pattern-matrix before spilling (default %llu)\n",
+           WS_STREAM_DEFAULT_CAP/(1024*1024));
+    printf("    -scratch=/path/to/file          scratch file for counts over the memory cap (default a temporary file)\n");
+    printf("    -cache=/path/to/file            keep -rank-guesses or -find-start-word results keyed by word list, an edited list\n");
+    printf("                                    only recomputes what its changed words touch\n");
+    printf("    -decision-tree                  build a greedy decision tree over every answer using per guess answer indexes\n");
+    printf("    -fuzz=n                         check the optimized engines against reference code on n random dictionaries\n");
+    printf("    -fuzz-seed=n                    seed for -fuzz (default the time)\n");
+    printf("    -golden=/path/to/file           record every target's guess count in normal and hard mode\n");
+    printf("    -check-golden=/path/to/file     replay a -golden file and report any target whose guess count changed\n");
+    printf("    -replay=/path/to/log            replay logged games (guess:feedback per move, one game per line) against the solver,\n");
+    printf("                                    per move results go to -results\n");
+    printf("    -tournament=a,b,...             compare strategies on the same targets, with -rand or -full-dictionary\n");
 }
 
 int main(int argc, const char * argv[])
 {
     int dictionary_entries = 0;
-    char dictionary[MAX_DICTIONARY_SIZE][WORDLE_WORD_SIZE+1];
-    char target_word[WORDLE_WORD_SIZE+1];
+    char dictionary_words[MAX_DICTIONARY_SIZE][WORDLE_WORD_SIZE+1];
+    s_wordle_dictionary wordle_dictionary;
+    const s_wordle_dictionary *dictionary = &wordle_dictionary;
+    const char *compiled_dictionary_path = NULL;
+    const char *compile_dictionary_path = NULL;
+    uint32_t target_word = 0;
+    char target_text[WORDLE_WORD_SIZE+1];
+    char word_text[WS_ALPHABET_TEXT_SIZE];
     int game_mode = GAME_MODE_UNSET;
     bool verbose = false;
     int num_games = 0;
     char start_word[WORDLE_WORD_SIZE+1] = "tromp";
     bool using_wordle_dictionary = false;
+    bool hard_mode = false;
+    int boards = 1;
+    bool absurdle = false;
+    bool quiet = false;
+    const char *results_path = NULL;
+    int results_format = WS_OUTPUT_CSV;
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    s_search_budget search_budget = {0};
+    int hints = 0;
+    const char *tournament = NULL;
+    bool pattern_matrix = false;
+    bool rank_guesses = false;
+    bool decision_tree = false;
+    bool reorder = false;
+    int fuzz_rounds = 0;
+    unsigned int fuzz_seed = (unsigned int)time(NULL);
+    const char *golden_path = NULL;
+    const char *check_golden_path = NULL;
+    const char *replay_path = NULL;
+    const char *cache_path = NULL;
+    s_stream_options stream_options = {WS_STREAM_DEFAULT_CAP, NULL, 1};
+    
+    // the alphabet decides how every other word on the command line reads, so it's set before they're parsed
+    const char *alphabet_spec = WS_ALPHABET_ENGLISH;
+    for(int i=1; i<argc; i++)
+    {
+        if(!strncmp(argv[i], "-alphabet=", strlen("-alphabet=")))
+        {
+            alphabet_spec = &argv[i][strlen("-alphabet=")];
+        }
+    }
+    s_wordle_alphabet alphabet;
+    if(ws_alphabet_parse(&alphabet, alphabet_spec))
+    {
+        printf("invalid alphabet; exiting...\n");
+        return 1;
+    }
+    ws_alphabet_set(&alphabet);
+    if(!alphabet.english)
+    {
+        // "tromp" was picked for English, other word lists start with the heuristic's own first guess
+        start_word[0] = 0;
+        printf("alphabet is %s (%d letters)\n", alphabet.spec, alphabet.letters);
+    }
     
     int i_argv = 1;
     while(argv[i_argv] != NULL)
@@ -176,13 +798,15 @@ int main(int argc, const char * argv[])
         {
             if(game_mode == GAME_MODE_UNSET)
             {
-                if(strlen(argv[i_argv]) != strlen("-single=")+WORDLE_WORD_SIZE)
+                const char *single_word = &argv[i_argv][strlen("-single=")];
+                char single_text[WORDLE_WORD_SIZE+1];
+                if(ws_alphabet_word(single_word, strlen(single_word), single_text))
                 {
                     printf("invalid input word; exiting...\n");
                     return 1;
                 }
-                strcpy(target_word, &argv[i_argv][strlen("-single=")]);
-                printf("target word is %s\n", target_word);
+                target_word = ws_word_encode(single_text);
+                printf("target word is %s\n", single_word);
                 game_mode = GAME_MODE_SINGLE;
             }
             else
@@ -193,13 +817,13 @@ int main(int argc, const char * argv[])
         }
         else if(!strncmp(argv[i_argv], "-start-word=", strlen("-start-word=")))
         {
-            if(strlen(argv[i_argv]) != strlen("-start-word=")+WORDLE_WORD_SIZE)
+            const char *start_text = &argv[i_argv][strlen("-start-word=")];
+            if(ws_alphabet_word(start_text, strlen(start_text), start_word))
             {
                 printf("invalid start word; exiting...\n");
                 return 1;
             }
-            strcpy(start_word, &argv[i_argv][strlen("-start-word=")]);
-            printf("start word is %s\n", start_word);
+            printf("start word is %s\n", start_text);
         }
         else if(!strncmp(argv[i_argv], "-find-start-word", strlen("-find-start-word")))
         {
@@ -223,17 +847,200 @@ int main(int argc, const char * argv[])
                 return 1;
             }
         }
+        else if(!strncmp(argv[i_argv], "-boards=", strlen("-boards=")))
+        {
+            boards = atoi(&argv[i_argv][strlen("-boards=")]);
+            if(boards < 1 || boards > WS_MAX_BOARDS)
+            {
+                printf("invalid number of boards; exiting...\n");
+                return 1;
+            }
+            printf("playing %d boards at once\n", boards);
+        }
+        else if(!strncmp(argv[i_argv], "-stats", strlen("-stats")))
+        {
+#if WS_STATS
+            if(!ws_stats_enabled)
+            {
+                ws_stats_enabled = true;
+                atexit(print_stats);
+            }
+#else
+            printf("statistics were compiled out (WS_STATS=0), ignoring -stats\n");
+#endif
+        }
+        else if(!strncmp(argv[i_argv], "-counters", strlen("-counters")))
+        {
+#if WS_STATS
+            if(!ws_stats_enabled)
+            {
+                ws_stats_enabled = true;
+                atexit(print_stats);
+            }
+            ws_counters_enabled = true;
+#else
+            printf("statistics were compiled out (WS_STATS=0), ignoring -counters\n");
+#endif
+        }
+        else if(!strncmp(argv[i_argv], "-trace-decode=", strlen("-trace-decode=")))
+        {
+            return ws_trace_decode(&argv[i_argv][strlen("-trace-decode=")], false, stdout);
+        }
+        else if(!strncmp(argv[i_argv], "-trace-json=", strlen("-trace-json=")))
+        {
+            return ws_trace_decode(&argv[i_argv][strlen("-trace-json=")], true, stdout);
+        }
+        else if(!strncmp(argv[i_argv], "-trace=", strlen("-trace=")))
+        {
+#if WS_TRACE
+            trace_path = &argv[i_argv][strlen("-trace=")];
+            ws_trace_enabled = true;
+            atexit(write_trace);
+#else
+            printf("tracing was compiled out (WS_TRACE=0), ignoring -trace\n");
+#endif
+        }
+        else if(!strncmp(argv[i_argv], "-results=", strlen("-results=")))
+        {
+            results_path = &argv[i_argv][strlen("-results=")];
+        }
+        else if(!strncmp(argv[i_argv], "-format=", strlen("-format=")))
+        {
+            if(!strcmp(&argv[i_argv][strlen("-format=")], "csv"))
+            {
+                results_format = WS_OUTPUT_CSV;
+            }
+            else if(!strcmp(&argv[i_argv][strlen("-format=")], "jsonl"))
+            {
+                results_format = WS_OUTPUT_JSONL;
+            }
+            else
+            {
+                printf("unknown results format; exiting...\n");
+                return 1;
+            }
+        }
+        else if(!strncmp(argv[i_argv], "-quiet", strlen("-quiet")))
+        {
+            quiet = true;
+        }
+        else if(!strncmp(argv[i_argv], "-threads=", strlen("-threads=")))
+        {
+            threads = atoi(&argv[i_argv][strlen("-threads=")]);
+            if(threads < 1)
+            {
+                printf("invalid number of threads; exiting...\n");
+                return 1;
+            }
+        }
+        else if(!strncmp(argv[i_argv], "-rank-guesses", strlen("-rank-guesses")))
+        {
+            rank_guesses = true;
+        }
+        else if(!strncmp(argv[i_argv], "-memory-cap=", strlen("-memory-cap=")))
+        {
+            long long megabytes = atoll(&argv[i_argv][strlen("-memory-cap=")]);
+            if(megabytes < 0)
+            {
+                printf("invalid memory cap; exiting...\n");
+                return 1;
+            }
+            stream_options.memory_cap = (uint64_t)megabytes*1024*1024;
+        }
+        else if(!strncmp(argv[i_argv], "-scratch=", strlen("-scratch=")))
+        {
+            stream_options.scratch_path = &argv[i_argv][strlen("-scratch=")];
+        }
+        else if(!strncmp(argv[i_argv], "-pattern-matrix", strlen("-pattern-matrix")))
+        {
+            pattern_matrix = true;
+        }
+        else if(!strncmp(argv[i_argv], "-fuzz=", strlen("-fuzz=")))
+        {
+            fuzz_rounds = atoi(&argv[i_argv][strlen("-fuzz=")]);
+            if(fuzz_rounds < 1)
+            {
+                printf("invalid number of fuzz rounds; exiting...\n");
+                return 1;
+            }
+        }
+        else if(!strncmp(argv[i_argv], "-fuzz-seed=", strlen("-fuzz-seed=")))
+        {
+            fuzz_seed = (unsigned int)strtoul(&argv[i_argv][strlen("-fuzz-seed=")], NULL, 10);
+        }
+        else if(!strncmp(argv[i_argv], "-golden=", strlen("-golden=")))
+        {
+            golden_path = &argv[i_argv][strlen("-golden=")];
+        }
+        else if(!strncmp(argv[i_argv], "-check-golden=", strlen("-check-golden=")))
+        {
+            check_golden_path = &argv[i_argv][strlen("-check-golden=")];
+        }
+        else if(!strncmp(argv[i_argv], "-reorder", strlen("-reorder")))
+        {
+            reorder = true;
+        }
+        else if(!strncmp(argv[i_argv], "-decision-tree", strlen("-decision-tree")))
+        {
+            decision_tree = true;
+        }
+        else if(!strncmp(argv[i_argv], "-cache=", strlen("-cache=")))
+        {
+            cache_path = &argv[i_argv][strlen("-cache=")];
+        }
+        else if(!strncmp(argv[i_argv], "-replay=", strlen("-replay=")))
+        {
+            replay_path = &argv[i_argv][strlen("-replay=")];
+        }
+        else if(!strncmp(argv[i_argv], "-tournament=", strlen("-tournament=")))
+        {
+            tournament = &argv[i_argv][strlen("-tournament=")];
+        }
+        else if(!strncmp(argv[i_argv], "-hints=", strlen("-hints=")))
+        {
+            hints = atoi(&argv[i_argv][strlen("-hints=")]);
+            if(hints < 1 || hints > MAX_HINTS)
+            {
+                printf("number of hints must be 1-%d; exiting...\n", MAX_HINTS);
+                return 1;
+            }
+        }
+        else if(!strncmp(argv[i_argv], "-budget-us=", strlen("-budget-us=")))
+        {
+            long long budget = atoll(&argv[i_argv][strlen("-budget-us=")]);
+            if(budget < 1)
+            {
+                printf("invalid search time budget; exiting...\n");
+                return 1;
+            }
+            search_budget.time_ns = (uint64_t)budget*1000;
+        }
+        else if(!strncmp(argv[i_argv], "-budget-work=", strlen("-budget-work=")))
+        {
+            long long budget = atoll(&argv[i_argv][strlen("-budget-work=")]);
+            if(budget < 1)
+            {
+                printf("invalid search work budget; exiting...\n");
+                return 1;
+            }
+            search_budget.work = (uint64_t)budget;
+        }
+        else if(!strncmp(argv[i_argv], "-absurdle", strlen("-absurdle")))
+        {
+            printf("playing against adversarial host\n");
+            absurdle = true;
+        }
+        else if(!strncmp(argv[i_argv], "-hard", strlen("-hard")))
+        {
+            printf("playing in hard mode\n");
+            hard_mode = true;
+        }
         else if(!strncmp(argv[i_argv], "-v", strlen("-v")))
         {
             verbose = true;
         }
         else if(!strncmp(argv[i_argv], "-wordle-dictionary", strlen("-wordle-dictionary")))
         {
-            for(int i=0; i<LEN_WORDLE_DICTIONARY; i++)
-            {
-                strcpy(dictionary[i], wordle_full_dictionary[i]);
-            }
-            dictionary_entries = LEN_WORDLE_DICTIONARY;
             using_wordle_dictionary = true;
         }
         else if(!strncmp(argv[i_argv], "-rand=", strlen("-rand=")))
@@ -251,6 +1058,14 @@ int main(int argc, const char * argv[])
                 return 1;
             }
         }
+        else if(!strncmp(argv[i_argv], "-compiled-dictionary=", strlen("-compiled-dictionary=")))
+        {
+            compiled_dictionary_path = &argv[i_argv][strlen("-compiled-dictionary=")];
+        }
+        else if(!strncmp(argv[i_argv], "-compile-dictionary=", strlen("-compile-dictionary=")))
+        {
+            compile_dictionary_path = &argv[i_argv][strlen("-compile-dictionary=")];
+        }
         else if(!strncmp(argv[i_argv], "-file=", strlen("-file=")))
         {
             if(using_wordle_dictionary)
@@ -261,6 +1076,7 @@ int main(int argc, const char * argv[])
             else
             {
                 printf("attempting to load dictionary %s\n", &argv[i_argv][strlen("-file=")]);
+                WS_STAT_TIMER(load_start);
                 FILE *fp;
                 fp = fopen(&argv[i_argv][strlen("-file=")], "r");
                 if(!fp)
@@ -269,55 +1085,253 @@ int main(int argc, const char * argv[])
                     return 1;
                 }
                 
-                char word[MAX_WORD_SIZE];
+                char line[MAX_WORD_SIZE];
+                int dropped_words = 0;
                 
                 // scan dictionary to determine how much space to allocate
-                while(!feof(fp) && dictionary_entries < MAX_DICTIONARY_SIZE)
+                while(!feof(fp))
                 {
-                    if(fgets(word, MAX_WORD_SIZE, fp) != NULL)
+                    if(fgets(line, MAX_WORD_SIZE, fp) != NULL)
                     {
-                        if(word[strlen(word)-1] == '\n')
+                        size_t length = strcspn(line, "\r\n");
+                        
+                        // only words of exactly five letters in the alphabet make it in, anything else (punctuation,
+                        // letters of another alphabet, bytes that aren't UTF-8) skips the word
+                        char word[WORDLE_WORD_SIZE+1];
+                        if(ws_alphabet_word(line, length, word))
                         {
-                            word[strlen(word)-1] = 0;
+                            continue;
                         }
-                        if(strlen(word) == WORDLE_WORD_SIZE)
+                        if(dictionary_entries == MAX_DICTIONARY_SIZE)
                         {
-                            // protect against adding words with punctuation
-                            int skip_word = 0;
-                            for(int i=0; i<WORDLE_WORD_SIZE; i++)
-                            {
-                                if(!isalpha(word[i]))
-                                {
-                                    skip_word = 1;
-                                    break;
-                                }
-                            }
-                            strcpy(&dictionary[dictionary_entries][0], word);
+                            dropped_words++;
+                        }
+                        else
+                        {
+                            strcpy(&dictionary_words[dictionary_entries][0], word);
                             dictionary_entries++;
                         }
                     }
                 }
                 
-                if(dictionary_entries >= MAX_DICTIONARY_SIZE)
+                fclose(fp);
+                
+                // a list past the limit is still usable, just not all of it
+                if(dropped_words)
                 {
-                    printf("dictionary is too large, exiting...\n");
-                    return 1;
+                    printf("dictionary has more than %d words, ignoring the last %d\n", MAX_DICTIONARY_SIZE, dropped_words);
                 }
+                WS_STAT_PHASE(load_start, WS_PHASE_LOAD);
             }
         }
         i_argv++;
     }
     
-    if(dictionary_entries == 0)
+    WS_STAT_TIMER(prepare_start);
+    if(compiled_dictionary_path != NULL)
     {
-        printf("no dictionary loaded; exiting...\n");
-        return 1;
+        if(dictionary_entries != 0 || using_wordle_dictionary)
+        {
+            printf("should not be loading more than one dictionary; exiting...\n");
+            return 1;
+        }
+        if(ws_dictionary_map(&wordle_dictionary, alphabet.spec, compiled_dictionary_path))
+        {
+            return 1;
+        }
+        printf("loaded %d words (%d answers) from %s\n", dictionary->entries, dictionary->answer_entries, compiled_dictionary_path);
+    }
+    else if(using_wordle_dictionary)
+    {
+        if(!alphabet.english)
+        {
+            printf("the Wordle dictionary is English, it can't be read with another alphabet; exiting...\n");
+            return 1;
+        }
+        
+        // generated tables are used in place, only the index has to be built
+        wordle_dictionary = wordle_builtin_dictionary;
+        if(ws_index_build(&wordle_dictionary.index, wordle_dictionary.words, wordle_dictionary.entries))
+        {
+            printf("couldn't prepare dictionary; exiting...\n");
+            return 1;
+        }
+    }
+    else
+    {
+        if(dictionary_entries == 0)
+        {
+            printf("no dictionary loaded; exiting...\n");
+            return 1;
+        }
+        if(ws_dictionary_build(&wordle_dictionary, dictionary_words, dictionary_entries, NULL, 0))
+        {
+            printf("couldn't prepare dictionary; exiting...\n");
+            return 1;
+        }
+    }
+    WS_STAT_PHASE(prepare_start, WS_PHASE_LOAD);
+    
+    if(start_word[0] == 0)
+    {
+        static s_wordle_state opening_state;
+        ws_init(&opening_state, NULL, hard_mode);
+        ws_choose_guess(&opening_state, dictionary, start_word, false);
+        printf("start word is %s\n", ws_alphabet_text(start_word, word_text));
+    }
+    
+    if(compile_dictionary_path != NULL)
+    {
+        if(ws_dictionary_compile(dictionary, alphabet.spec, compile_dictionary_path))
+        {
+            return 1;
+        }
+        printf("compiled %d words (%d answers) to %s\n", dictionary->entries, dictionary->answer_entries, compile_dictionary_path);
+        return 0;
+    }
+    
+    // targets always come from the word list in its own order, so a reordered dictionary plays the same games
+    const s_wordle_dictionary *targets = dictionary;
+    s_wordle_dictionary reordered_dictionary;
+    if(reorder)
+    {
+        WS_STAT_TIMER(reorder_start);
+        if(ws_dictionary_reorder(&reordered_dictionary, dictionary, ws_word_encode(start_word)))
+        {
+            printf("couldn't reorder dictionary; exiting...\n");
+            return 1;
+        }
+        WS_STAT_PHASE(reorder_start, WS_PHASE_LOAD);
+        dictionary = &reordered_dictionary;
     }
 
+    if(threads < 1)
+    {
+        threads = 1;
+    }
+    
+    // replay writes its own per move results, in parallel, so it doesn't go through the game results writer
+    if(replay_path != NULL)
+    {
+        return replay_game_log(dictionary, replay_path, results_path, results_format, hard_mode, threads);
+    }
+    
+    if(results_path != NULL)
+    {
+        if(ws_output_open(results_path, results_format))
+        {
+            return 1;
+        }
+        atexit(ws_output_close);
+    }
+    
+    stream_options.threads = threads;
+    if(rank_guesses)
+    {
+        return rank_all_guesses(cache_path ? targets : dictionary, &stream_options, cache_path);
+    }
+    
+    uint64_t matrix_size = (uint64_t)dictionary->entries*(uint64_t)dictionary->answer_entries;
+    if(pattern_matrix && stream_options.memory_cap && matrix_size > stream_options.memory_cap)
+    {
+        printf("pattern matrix needs %.1f MB, over the %.1f MB cap, streaming bucket counts instead\n",
+               (double)matrix_size/(1024.0*1024.0), (double)stream_options.memory_cap/(1024.0*1024.0));
+        return rank_all_guesses(cache_path ? targets : dictionary, &stream_options, cache_path);
+    }
+    if(pattern_matrix)
+    {
+        s_pattern_matrix matrix;
+        if(ws_matrix_build(&matrix, dictionary, threads))
+        {
+            printf("out of memory for the pattern matrix; exiting...\n");
+            return 1;
+        }
+        double pairs = (double)matrix.guesses*(double)matrix.answers, seconds = (double)matrix.build_ns/1e9;
+        printf("built %d x %d pattern matrix (%.1f MB) in %.3f seconds on %d thread%s, %.1fM pairs/second\n", matrix.guesses,
+               matrix.answers, pairs/(1024.0*1024.0), seconds, matrix.threads, matrix.threads == 1 ? "" : "s",
+               seconds > 0.0 ? pairs/seconds/1e6 : 0.0);
+        ws_matrix_release(&matrix);
+        return 0;
+    }
+    if(decision_tree)
+    {
+        return build_decision_tree(dictionary, threads);
+    }
+    if(fuzz_rounds)
+    {
+        return ws_verify_fuzz(dictionary, fuzz_rounds, fuzz_seed, verbose);
+    }
+    if(golden_path != NULL)
+    {
+        return ws_golden_write(dictionary, start_word, golden_path);
+    }
+    if(check_golden_path != NULL)
+    {
+        return ws_golden_check(dictionary, check_golden_path);
+    }
+    
+    if(absurdle)
+    {
+        if(game_mode != GAME_MODE_UNSET && game_mode != GAME_MODE_START_OPTIMIZE)
+        {
+            printf("adversarial host only works alone or with -find-start-word; exiting...\n");
+            return 1;
+        }
+        play_absurdle(dictionary, start_word, game_mode == GAME_MODE_START_OPTIMIZE, hard_mode, threads, verbose);
+        return 0;
+    }
+    
+    if(tournament != NULL)
+    {
+        if(game_mode != GAME_MODE_RAND && game_mode != GAME_MODE_FULL_DICT)
+        {
+            printf("tournaments only work with -rand or -full-dictionary; exiting...\n");
+            return 1;
+        }
+        return play_tournament(dictionary, tournament, game_mode, num_games, start_word, hard_mode, &search_budget, threads);
+    }
+    
     // this one's too different so it gets it's own function
     if(game_mode == GAME_MODE_START_OPTIMIZE)
     {
-        find_optimal_word(dictionary, dictionary_entries, verbose);
+        if(cache_path != NULL)
+        {
+            // cached games were played without a search, and caches are kept in word list order
+            if(search_budget.time_ns || search_budget.work)
+            {
+                printf("cached start word results are played without a search budget; exiting...\n");
+                return 1;
+            }
+            uint8_t *counts;
+            s_cache_report report;
+            if(ws_cache_start_words(&counts, targets, hard_mode, threads, cache_path, &report))
+            {
+                printf("couldn't prepare start word results; exiting...\n");
+                free(counts);
+                return 1;
+            }
+            print_cache_report(&report, cache_path, "games");
+            find_optimal_word(targets, hard_mode, &search_budget, counts, quiet, verbose);
+            free(counts);
+            return 0;
+        }
+        find_optimal_word(dictionary, hard_mode, &search_budget, NULL, quiet, verbose);
+        return 0;
+    }
+    
+    if(boards > 1)
+    {
+        if(game_mode != GAME_MODE_RAND && game_mode != GAME_MODE_FULL_DICT)
+        {
+            printf("multiple boards only work with -rand or -full-dictionary; exiting...\n");
+            return 1;
+        }
+        if(hard_mode)
+        {
+            printf("hard mode is not supported with multiple boards; exiting...\n");
+            return 1;
+        }
+        play_multi_board(dictionary, targets, boards, game_mode, num_games, start_word, verbose);
         return 0;
     }
     
@@ -325,9 +1339,12 @@ int main(int argc, const char * argv[])
     
     int game_count = 0, tot_games = 0, min_guess = 10000, max_guess = 0, total_guess = 0;
     int six_or_less = 0;
-    char min_guess_word[WORDLE_WORD_SIZE+1], max_guess_word[WORDLE_WORD_SIZE+1];
+    uint32_t min_guess_word = 0, max_guess_word = 0;
     
     int guesses_per_win[20] = {0};
+    
+    struct timespec start_time;
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
         
     switch(game_mode)
     {
@@ -336,7 +1353,7 @@ int main(int argc, const char * argv[])
             break;
         
         case GAME_MODE_FULL_DICT:
-            tot_games = dictionary_entries;
+            tot_games = dictionary->entries;
             break;
             
         case GAME_MODE_RAND:
@@ -353,26 +1370,25 @@ int main(int argc, const char * argv[])
                 break;
             
             case GAME_MODE_FULL_DICT:
-                strcpy(target_word, &dictionary[game_count][0]);
+                target_word = targets->words[game_count];
                 break;
                 
             case GAME_MODE_RAND:
-                if(using_wordle_dictionary)
-                {
-                    strcpy(target_word, &wordle_target_words[rand()%LEN_WORDLE_TARGET_WORDS][0]);
-                }
-                else
-                {
-                    strcpy(target_word, &dictionary[rand()%dictionary_entries][0]);
-                }
+                target_word = targets->words[targets->answers[rand()%targets->answer_entries]];
                 break;
         }
 
         s_wordle_state wordle_state;
 
-        ws_init(&wordle_state, start_word);
+        ws_init(&wordle_state, start_word, hard_mode);
+        wordle_state.search_budget = search_budget;
         
-        printf("searching for word %s\n", target_word);
+        if(!quiet)
+        {
+            ws_word_decode(target_word, target_text);
+            printf("searching for word %s\n", ws_alphabet_text(target_text, word_text));
+        }
+        WS_TRACE_EVENT(false, WS_TRACE_GAME_BEGIN, target_word);
 
         int guess_count = 0;
         int ret;
@@ -381,9 +1397,13 @@ int main(int argc, const char * argv[])
             ret = ws_make_guess(&wordle_state,
                                  target_word,
                                  dictionary,
-                                 dictionary_entries,
                                  verbose);
             guess_count++;
+            
+            if(!ret && hints && !quiet)
+            {
+                print_hints(&wordle_state, dictionary, hints);
+            }
         } while(!ret);
         
         if(guess_count < 20)
@@ -395,19 +1415,24 @@ int main(int argc, const char * argv[])
             printf("whoa something went south here\n");
         }
         
-        printf("found word in %d tries\n", guess_count);
+        if(!quiet)
+        {
+            printf("found word in %d tries\n", guess_count);
+        }
+        WS_TRACE_EVENT(false, WS_TRACE_GAME_END, (uint32_t)guess_count);
+        ws_output_game(start_word, target_word, guess_count, &wordle_state);
         game_count++;
         
         // capture max/min and winning stats
         if(guess_count > max_guess)
         {
             max_guess = guess_count;
-            strcpy(max_guess_word, target_word);
+            max_guess_word = target_word;
         }
         if(guess_count < min_guess)
         {
             min_guess = guess_count;
-            strcpy(min_guess_word, target_word);
+            min_guess_word = target_word;
         }
         total_guess += guess_count;
         
@@ -425,14 +1450,19 @@ int main(int argc, const char * argv[])
             {
                 printf("%d found in %d guesses\n", guesses_per_win[i], i);
             }
-            printf("maximum guesses %d for word %s\n", max_guess, max_guess_word);
-            printf("minimum guesses %d for word %s\n", min_guess, min_guess_word);
+            ws_word_decode(max_guess_word, target_text);
+            printf("maximum guesses %d for word %s\n", max_guess, ws_alphabet_text(target_text, word_text));
+            ws_word_decode(min_guess_word, target_text);
+            printf("minimum guesses %d for word %s\n", min_guess, ws_alphabet_text(target_text, word_text));
             printf("average guesses %f\n", ((float)total_guess)/(float)tot_games);
             printf("won the wordle %2.2f%% of the time, fear the future\n", 100.0*((float)six_or_less/(float)tot_games));
+            double seconds = elapsed_seconds(&start_time);
+            printf("played %d games in %2.3f seconds (%.0f games/second)\n", tot_games, seconds, (double)tot_games/seconds);
             break;
             
         case GAME_MODE_SINGLE:
-            printf("found %s in %d guesses\n", target_word, min_guess);
+            ws_word_decode(target_word, target_text);
+            printf("found %s in %d guesses\n", ws_alphabet_text(target_text, word_text), min_guess);
             break;
     }
     
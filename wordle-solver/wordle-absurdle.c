@@ -0,0 +1,218 @@
+//
+//  wordle-absurdle.c
+//  wordle-solver
+//
+//  Adversarial host (Absurdle), see wordle-absurdle.h.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#include "wordle-absurdle.h"
+
+/*
+ *  split the host's answers by the feedback the guess would get.  sorted gets the answers grouped by pattern,
+ *  in their original order within a group, and bucket p is sorted[bucket_start[p]] up to bucket_start[p+1].
+ */
+void ws_absurdle_buckets(const char                *guess,
+                         const s_wordle_dictionary *dictionary,
+                         const uint32_t            *host_candidates,
+                         int                       host_count,
+                         uint32_t                  *sorted,
+                         int                       bucket_start[WS_FEEDBACK_PATTERNS+1])
+{
+    uint32_t packed_guess = ws_word_encode(guess);
+    uint8_t patterns[MAX_DICTIONARY_SIZE];
+    int next[WS_FEEDBACK_PATTERNS];
+    
+    memset(bucket_start, 0, sizeof(int)*(WS_FEEDBACK_PATTERNS+1));
+    for(int i=0; i<host_count; i++)
+    {
+        patterns[i] = (uint8_t)ws_entry_feedback(packed_guess, dictionary, (int)host_candidates[i]);
+        bucket_start[patterns[i]+1]++;
+    }
+    for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+    {
+        bucket_start[p+1] += bucket_start[p];
+        next[p] = bucket_start[p];
+    }
+    for(int i=0; i<host_count; i++)
+    {
+        sorted[next[patterns[i]]++] = host_candidates[i];
+    }
+}
+
+typedef struct s_absurdle_walk
+{
+    const s_wordle_dictionary *dictionary;
+    s_absurdle_result         *result;
+    bool                      verbose;
+} s_absurdle_walk;
+
+/*
+ *  every answer left ends the game after guesses guesses
+ */
+static void absurdle_leaf(s_absurdle_walk *walk,
+                          const uint32_t  *answers,
+                          int             count,
+                          int             guesses)
+{
+    s_absurdle_result *result = walk->result;
+    result->answers += count;
+    result->total_guesses += (int64_t)guesses*count;
+    if(guesses > result->worst_case)
+    {
+        result->worst_case = guesses;
+        ws_word_decode(walk->dictionary->words[answers[0]], result->worst_word);
+    }
+}
+
+/*
+ *  play the solver's guess from this state and follow every bucket of answers it could be told, wordle_state
+ *  is the caller's copy and gets used up.  guesses is how many were played to get here.
+ */
+static void absurdle_walk(s_absurdle_walk *walk,
+                          s_wordle_state  *wordle_state,
+                          const uint32_t  *answers,
+                          int             count,
+                          int             guesses)
+{
+    char guess[WORDLE_WORD_SIZE+1] = {0};
+    
+    guesses++;
+    if(guesses >= WS_ABSURDLE_MAX_GUESSES || ws_choose_guess(wordle_state, walk->dictionary, guess, walk->verbose))
+    {
+        absurdle_leaf(walk, answers, count, guesses);
+        return;
+    }
+    
+    uint32_t *sorted = malloc(sizeof(uint32_t)*(size_t)count);
+    if(sorted == NULL)
+    {
+        // count this branch as lost rather than pretend it was short
+        absurdle_leaf(walk, answers, count, WS_ABSURDLE_MAX_GUESSES);
+        return;
+    }
+    int bucket_start[WS_FEEDBACK_PATTERNS+1];
+    ws_absurdle_buckets(guess, walk->dictionary, answers, count, sorted, bucket_start);
+    
+    for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+    {
+        int bucket_count = bucket_start[p+1] - bucket_start[p];
+        if(bucket_count == 0)
+        {
+            continue;
+        }
+        WS_TRACE_EVENT(walk->verbose, WS_TRACE_HOST_KEEPS, (uint32_t)bucket_count);
+        if(p == WS_FEEDBACK_SOLVED)
+        {
+            absurdle_leaf(walk, &sorted[bucket_start[p]], bucket_count, guesses);
+            continue;
+        }
+        s_wordle_state next_state = *wordle_state;
+        ws_apply_feedback(&next_state, guess, p, walk->verbose);
+        absurdle_walk(walk, &next_state, &sorted[bucket_start[p]], bucket_count, guesses);
+    }
+    free(sorted);
+}
+
+/*
+ *  play the solver against the adversarial host from wordle_state, returns the most guesses the host can force
+ *  (WS_ABSURDLE_MAX_GUESSES if the solver gets stuck).  the host starts with every answer in the dictionary,
+ *  and result also gets the answer that takes the longest and the guesses summed over every answer.
+ */
+int ws_absurdle_play(s_wordle_state            *wordle_state,
+                     const s_wordle_dictionary *dictionary,
+                     s_absurdle_result         *result,
+                     bool                      verbose)
+{
+    s_absurdle_walk walk = {dictionary, result, verbose};
+    memset(result, 0, sizeof(s_absurdle_result));
+    if(dictionary->answer_entries > 0)
+    {
+        absurdle_walk(&walk, wordle_state, dictionary->answers, dictionary->answer_entries, 0);
+    }
+    return result->worst_case;
+}
+
+typedef struct s_absurdle_job
+{
+    const s_wordle_dictionary *dictionary;
+    bool                      hard_mode;
+    int                       thread;
+    int                       threads;
+    int                       *worst_case;
+} s_absurdle_job;
+
+static void *absurdle_rank_thread(void *arg)
+{
+    s_absurdle_job *job = arg;
+    
+    // interleave start words across threads so slow and fast words spread evenly
+    for(int i=job->thread; i<job->dictionary->entries; i+=job->threads)
+    {
+        s_wordle_state wordle_state;
+        s_absurdle_result result;
+        char start_word[WORDLE_WORD_SIZE+1];
+        ws_word_decode(job->dictionary->words[i], start_word);
+        ws_init(&wordle_state, start_word, job->hard_mode);
+        WS_TRACE_EVENT(false, WS_TRACE_GAME_BEGIN, job->dictionary->words[i]);
+        job->worst_case[i] = ws_absurdle_play(&wordle_state,
+                                              job->dictionary,
+                                              &result,
+                                              false);
+        WS_TRACE_EVENT(false, WS_TRACE_GAME_END, (uint32_t)job->worst_case[i]);
+    }
+    ws_stats_flush();
+    return NULL;
+}
+
+/*
+ *  play every dictionary word as a start word against the adversarial host, spread across threads.
+ *  worst_case[i] gets the most guesses any answer takes when starting with dictionary->words[i].
+ */
+void ws_absurdle_rank_start_words(const s_wordle_dictionary *dictionary,
+                                  bool                      hard_mode,
+                                  int                       threads,
+                                  int                       worst_case[MAX_DICTIONARY_SIZE])
+{
+    pthread_t thread_ids[threads];
+    s_absurdle_job jobs[threads];
+    bool started[threads];
+    
+    for(int t=0; t<threads; t++)
+    {
+        jobs[t] = (s_absurdle_job){dictionary, hard_mode, t, threads, worst_case};
+    }
+    
+    // thread stacks need room for the host's candidate lists
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, 4*1024*1024);
+    for(int t=1; t<threads; t++)
+    {
+        started[t] = pthread_create(&thread_ids[t], &attr, absurdle_rank_thread, &jobs[t]) == 0;
+    }
+    pthread_attr_destroy(&attr);
+    
+    // a thread that couldn't be started leaves its share to this one
+    absurdle_rank_thread(&jobs[0]);
+    for(int t=1; t<threads; t++)
+    {
+        if(!started[t])
+        {
+            absurdle_rank_thread(&jobs[t]);
+        }
+    }
+    
+    for(int t=1; t<threads; t++)
+    {
+        if(started[t])
+        {
+            pthread_join(thread_ids[t], NULL);
+        }
+    }
+}
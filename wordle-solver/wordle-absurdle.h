@@ -0,0 +1,44 @@
+//
+//  wordle-absurdle.h
+//  wordle-solver
+//
+//  Adversarial host (Absurdle): instead of committing to a target the host may switch to any answer consistent
+//  with the feedback so far.  The solver is deterministic, so the most guesses such a host can force is the
+//  deepest branch of the solver's game tree over the answers.  Every branch is walked, splitting the answers
+//  by the feedback each guess gets, so the worst case is exact rather than what a greedy host happens to find.
+//
+
+#ifndef wordle_absurdle_h
+#define wordle_absurdle_h
+
+#include "wordle-solver.h"
+
+// give up on a game well past anything a sane strategy needs
+#define WS_ABSURDLE_MAX_GUESSES     50
+
+typedef struct s_absurdle_result
+{
+    int     worst_case;                     // most guesses any answer takes
+    char    worst_word[WORDLE_WORD_SIZE+1]; // first answer (in feedback order) that takes them
+    int     answers;
+    int64_t total_guesses;                  // summed over every answer
+} s_absurdle_result;
+
+void ws_absurdle_buckets(const char                *guess,
+                         const s_wordle_dictionary *dictionary,
+                         const uint32_t            *host_candidates,
+                         int                       host_count,
+                         uint32_t                  *sorted,
+                         int                       bucket_start[WS_FEEDBACK_PATTERNS+1]);
+
+int ws_absurdle_play(s_wordle_state            *wordle_state,
+                     const s_wordle_dictionary *dictionary,
+                     s_absurdle_result         *result,
+                     bool                      verbose);
+
+void ws_absurdle_rank_start_words(const s_wordle_dictionary *dictionary,
+                                  bool                      hard_mode,
+                                  int                       threads,
+                                  int                       worst_case[MAX_DICTIONARY_SIZE]);
+
+#endif /* wordle_absurdle_h */
@@ -0,0 +1,301 @@
+//
+//  wordle-alphabet.c
+//  wordle-solver
+//
+//  Alphabets and the mapping between UTF-8 words and solver text, see wordle-alphabet.h.
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "wordle-alphabet.h"
+
+static s_wordle_alphabet current_alphabet;
+static bool current_alphabet_set = false;
+
+/*
+ *  decode one UTF-8 code point, returns its length in bytes or 0 if the bytes aren't well formed (overlong
+ *  forms, surrogates and anything past U+10FFFF included)
+ */
+static int decode_symbol(const unsigned char *text,
+                         size_t              length,
+                         uint32_t            *symbol)
+{
+    if(length == 0)
+    {
+        return 0;
+    }
+    if(text[0] < 0x80)
+    {
+        *symbol = text[0];
+        return 1;
+    }
+    
+    int size = text[0] >= 0xf0 ? 4 : text[0] >= 0xe0 ? 3 : 2;
+    static const uint32_t minimum[5] = {0, 0, 0x80, 0x800, 0x10000};
+    if(text[0] < 0xc0 || text[0] >= 0xf8 || (size_t)size > length)
+    {
+        return 0;
+    }
+    uint32_t value = text[0] & (0x7fu >> size);
+    for(int i=1; i<size; i++)
+    {
+        if((text[i] & 0xc0) != 0x80)
+        {
+            return 0;
+        }
+        value = value << 6 | (text[i] & 0x3fu);
+    }
+    if(value < minimum[size] || value > 0x10ffff || (value >= 0xd800 && value < 0xe000))
+    {
+        return 0;
+    }
+    *symbol = value;
+    return size;
+}
+
+static int encode_symbol(uint32_t symbol,
+                         char     *text)
+{
+    if(symbol < 0x80)
+    {
+        text[0] = (char)symbol;
+        return 1;
+    }
+    if(symbol < 0x800)
+    {
+        text[0] = (char)(0xc0 | symbol >> 6);
+        text[1] = (char)(0x80 | (symbol & 0x3f));
+        return 2;
+    }
+    if(symbol < 0x10000)
+    {
+        text[0] = (char)(0xe0 | symbol >> 12);
+        text[1] = (char)(0x80 | (symbol >> 6 & 0x3f));
+        text[2] = (char)(0x80 | (symbol & 0x3f));
+        return 3;
+    }
+    text[0] = (char)(0xf0 | symbol >> 18);
+    text[1] = (char)(0x80 | (symbol >> 12 & 0x3f));
+    text[2] = (char)(0x80 | (symbol >> 6 & 0x3f));
+    text[3] = (char)(0x80 | (symbol & 0x3f));
+    return 4;
+}
+
+/*
+ *  lower case of the scripts word lists come in, anything else is left as it is
+ */
+static uint32_t fold_case(uint32_t symbol)
+{
+    if((symbol >= 'A' && symbol <= 'Z') ||
+       (symbol >= 0xc0 && symbol <= 0xde && symbol != 0xd7) ||         // Latin-1 À-Þ except ×
+       (symbol >= 0x391 && symbol <= 0x3a9 && symbol != 0x3a2) ||      // Greek Α-Ω
+       (symbol >= 0x410 && symbol <= 0x42f))                           // Cyrillic А-Я
+    {
+        return symbol + 0x20;
+    }
+    if(symbol >= 0x400 && symbol <= 0x40f)                             // Cyrillic Ѐ-Џ
+    {
+        return symbol + 0x50;
+    }
+    if(symbol == 0x178)                                                 // Ÿ
+    {
+        return 0xff;
+    }
+    
+    // Latin Extended-A pairs upper then lower case, on even code points up to ķ and from Ŋ to ŷ and on odd
+    // ones in between and after, with the dotted and dotless Turkish i (İ ı) left alone
+    if((symbol >= 0x100 && symbol <= 0x137 && symbol != 0x130) || (symbol >= 0x14a && symbol <= 0x177))
+    {
+        return symbol | 1;
+    }
+    if((symbol >= 0x139 && symbol <= 0x148) || (symbol >= 0x179 && symbol <= 0x17e))
+    {
+        return symbol & 1 ? symbol + 1 : symbol;
+    }
+    return symbol;
+}
+
+/*
+ *  letter index of a symbol, -1 if it isn't in the alphabet
+ */
+static int symbol_letter(const s_wordle_alphabet *alphabet,
+                         uint32_t                symbol)
+{
+    symbol = fold_case(symbol);
+    if(symbol < 0x80)
+    {
+        return alphabet->ascii[symbol];
+    }
+    for(int l=0; l<alphabet->letters; l++)
+    {
+        if(alphabet->symbols[l] == symbol)
+        {
+            return l;
+        }
+    }
+    return -1;
+}
+
+/*
+ *  read an alphabet from its symbols in letter order.  symbols are folded to lower case, and ASCII ones must
+ *  be letters so words can't clash with the separators in logs and results.  returns nonzero (after saying
+ *  why) if the spec isn't UTF-8, repeats a symbol or has more than WS_WORD_LETTERS.
+ */
+int ws_alphabet_parse(s_wordle_alphabet *alphabet,
+                      const char        *spec)
+{
+    memset(alphabet, 0, sizeof(s_wordle_alphabet));
+    memset(alphabet->ascii, -1, sizeof(alphabet->ascii));
+    
+    const unsigned char *text = (const unsigned char *)spec;
+    size_t length = strlen(spec), used = 0;
+    while(used < length)
+    {
+        uint32_t symbol;
+        int size = decode_symbol(text + used, length - used, &symbol);
+        if(size == 0)
+        {
+            printf("alphabet \"%s\" isn't valid UTF-8 at byte %zu\n", spec, used);
+            return 1;
+        }
+        used += (size_t)size;
+        
+        symbol = fold_case(symbol);
+        if((symbol < 0x80 && (symbol < 'a' || symbol > 'z')) || (symbol >= 0x80 && symbol < 0xa0))
+        {
+            printf("alphabet \"%s\" has a symbol that isn't a letter (U+%04X)\n", spec, symbol);
+            return 1;
+        }
+        if(symbol_letter(alphabet, symbol) >= 0)
+        {
+            printf("alphabet \"%s\" has U+%04X more than once\n", spec, symbol);
+            return 1;
+        }
+        if(alphabet->letters == WS_WORD_LETTERS)
+        {
+            printf("alphabet \"%s\" has more than %d symbols\n", spec, WS_WORD_LETTERS);
+            return 1;
+        }
+        
+        if(symbol < 0x80)
+        {
+            alphabet->ascii[symbol] = (int8_t)alphabet->letters;
+            alphabet->ascii[symbol - 0x20] = (int8_t)alphabet->letters;
+        }
+        alphabet->symbols[alphabet->letters++] = symbol;
+    }
+    if(alphabet->letters == 0)
+    {
+        printf("alphabet is empty\n");
+        return 1;
+    }
+    
+    size_t spec_size = 0;
+    for(int l=0; l<alphabet->letters; l++)
+    {
+        spec_size += (size_t)encode_symbol(alphabet->symbols[l], &alphabet->spec[spec_size]);
+    }
+    alphabet->spec[spec_size] = 0;
+    alphabet->english = !strcmp(alphabet->spec, WS_ALPHABET_ENGLISH);
+    return 0;
+}
+
+/*
+ *  make an alphabet the one words are read and written with, the English one until this is called.  set it
+ *  before starting threads, they only read it.
+ */
+void ws_alphabet_set(const s_wordle_alphabet *alphabet)
+{
+    current_alphabet = *alphabet;
+    current_alphabet_set = true;
+}
+
+const s_wordle_alphabet *ws_alphabet_current(void)
+{
+    if(!current_alphabet_set)
+    {
+        ws_alphabet_parse(&current_alphabet, WS_ALPHABET_ENGLISH);
+        current_alphabet_set = true;
+    }
+    return &current_alphabet;
+}
+
+/*
+ *  map length bytes of UTF-8 onto the current alphabet as solver text, returns nonzero if they aren't
+ *  exactly WORDLE_WORD_SIZE letters of it
+ */
+int ws_alphabet_word(const char *text,
+                     size_t     length,
+                     char       word[WORDLE_WORD_SIZE+1])
+{
+    const s_wordle_alphabet *alphabet = ws_alphabet_current();
+    const unsigned char *bytes = (const unsigned char *)text;
+    int letters = 0;
+    size_t used = 0;
+    while(used < length)
+    {
+        uint32_t symbol;
+        int letter = -1;
+        if(bytes[used] < 0x80)
+        {
+            // most words are ASCII, one table lookup a letter with case already folded
+            letter = alphabet->ascii[bytes[used++]];
+        }
+        else
+        {
+            int size = decode_symbol(bytes + used, length - used, &symbol);
+            if(size == 0)
+            {
+                return 1;
+            }
+            used += (size_t)size;
+            letter = symbol_letter(alphabet, symbol);
+        }
+        if(letter < 0 || letters == WORDLE_WORD_SIZE)
+        {
+            return 1;
+        }
+        word[letters++] = (char)('a' + letter);
+    }
+    word[letters] = 0;
+    return letters != WORDLE_WORD_SIZE;
+}
+
+/*
+ *  solver text as UTF-8 in the current alphabet, returns text
+ */
+const char *ws_alphabet_text(const char *word,
+                             char       text[WS_ALPHABET_TEXT_SIZE])
+{
+    const s_wordle_alphabet *alphabet = ws_alphabet_current();
+    if(alphabet->english)
+    {
+        memcpy(text, word, WORDLE_WORD_SIZE);
+        text[WORDLE_WORD_SIZE] = 0;
+        return text;
+    }
+    
+    size_t size = 0;
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        unsigned letter = (unsigned char)word[j] - (unsigned)'a';
+        size += (size_t)(letter < (unsigned)alphabet->letters ? encode_symbol(alphabet->symbols[letter], &text[size]) :
+                         encode_symbol('?', &text[size]));
+    }
+    text[size] = 0;
+    return text;
+}
+
+/*
+ *  a single solver text letter as UTF-8 in the current alphabet, returns text
+ */
+const char *ws_alphabet_letter(char letter,
+                               char text[WS_ALPHABET_SYMBOL_SIZE])
+{
+    const s_wordle_alphabet *alphabet = ws_alphabet_current();
+    unsigned index = (unsigned char)letter - (unsigned)'a';
+    int size = encode_symbol(index < (unsigned)alphabet->letters ? alphabet->symbols[index] : '?', text);
+    text[size] = 0;
+    return text;
+}
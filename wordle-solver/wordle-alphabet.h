@@ -0,0 +1,56 @@
+//
+//  wordle-alphabet.h
+//  wordle-solver
+//
+//  The letters words are spelled with.  The engine only ever sees letter indices, 0 to the alphabet size
+//  less one, packed five bits each (wordle-word.h) and written as 'a'+index in the solver's text form, so
+//  every table stays the same fixed size whatever the language.  An alphabet is a UTF-8 string of up to
+//  WS_WORD_LETTERS symbols in index order, "abcdefghijklmnopqrstuvwxyz" by default, and word lists, command
+//  line words and game logs are mapped onto it as they come in.  Case is folded for ASCII, Latin-1, Latin
+//  Extended-A, Greek and Cyrillic, and anything outside the alphabet (including bytes that aren't UTF-8)
+//  rejects the word rather than reaching a table.
+//
+
+#ifndef wordle_alphabet_h
+#define wordle_alphabet_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "wordle-word.h"
+
+#define WS_ALPHABET_ENGLISH         "abcdefghijklmnopqrstuvwxyz"
+
+// a symbol is at most 4 bytes of UTF-8
+#define WS_ALPHABET_SPEC_SIZE       (WS_WORD_LETTERS*4+1)
+#define WS_ALPHABET_TEXT_SIZE       (WORDLE_WORD_SIZE*4+1)
+#define WS_ALPHABET_SYMBOL_SIZE     5
+
+typedef struct s_wordle_alphabet
+{
+    int      letters;
+    bool     english;                       // a-z in order, so solver text is already the word
+    uint32_t symbols[WS_WORD_LETTERS];      // code point of each letter index
+    int8_t   ascii[128];                    // letter index of each ASCII byte in either case, -1 if none
+    char     spec[WS_ALPHABET_SPEC_SIZE];   // the symbols as UTF-8
+} s_wordle_alphabet;
+
+int ws_alphabet_parse(s_wordle_alphabet *alphabet,
+                      const char        *spec);
+
+void ws_alphabet_set(const s_wordle_alphabet *alphabet);
+
+const s_wordle_alphabet *ws_alphabet_current(void);
+
+int ws_alphabet_word(const char *text,
+                     size_t     length,
+                     char       word[WORDLE_WORD_SIZE+1]);
+
+const char *ws_alphabet_text(const char *word,
+                             char       text[WS_ALPHABET_TEXT_SIZE]);
+
+const char *ws_alphabet_letter(char letter,
+                               char text[WS_ALPHABET_SYMBOL_SIZE]);
+
+#endif /* wordle_alphabet_h */
@@ -0,0 +1,343 @@
+//
+//  wordle-answer-index.c
+//  wordle-solver
+//
+//  Per guess answer index, see wordle-answer-index.h.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "wordle-answer-index.h"
+#include "wordle-matrix.h"
+
+typedef struct s_answer_index_job
+{
+    s_answer_index            *index;
+    const s_wordle_dictionary *dictionary;
+    const uint16_t            *answers;
+    const uint32_t            *answer_words;
+    const uint32_t            *answer_masks;
+    int                       *next_guess;      // shared, handed out a tile of guesses at a time
+} s_answer_index_job;
+
+typedef struct s_answer_index_split_job
+{
+    const s_answer_index *index;
+    s_answer_index       *children;
+    const uint8_t        *child_of;         // by dictionary entry, position in indexed or indexed_count if none
+    const uint8_t        *indexed;          // buckets that get a child index
+    int                  indexed_count;
+    int                  *next_guess;
+} s_answer_index_split_job;
+
+static void *answer_index_thread(void *arg)
+{
+    s_answer_index_job *job = arg;
+    s_answer_index *index = job->index;
+    static _Thread_local uint8_t patterns[MAX_DICTIONARY_SIZE];
+    
+    // counting sort per guess: patterns, bucket sizes, prefix sums, then scatter the answers into place
+    for(;;)
+    {
+        int guess_start = __atomic_fetch_add(job->next_guess, WS_MATRIX_TILE_GUESSES, __ATOMIC_RELAXED);
+        if(guess_start >= index->guesses)
+        {
+            break;
+        }
+        int guess_end = guess_start + WS_MATRIX_TILE_GUESSES;
+        if(guess_end > index->guesses)
+        {
+            guess_end = index->guesses;
+        }
+        for(int g=guess_start; g<guess_end; g++)
+        {
+            uint16_t *offsets = index->offsets + (size_t)g*WS_ANSWER_INDEX_OFFSETS;
+            uint16_t *members = index->members + (size_t)g*(size_t)index->answers;
+            int counts[WS_FEEDBACK_PATTERNS] = {0};
+            
+            ws_pattern_row(job->dictionary->words[g], job->answer_words, job->answer_masks, index->answers, patterns);
+            for(int a=0; a<index->answers; a++)
+            {
+                counts[patterns[a]]++;
+            }
+            int offset = 0;
+            for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+            {
+                offsets[p] = (uint16_t)offset;
+                offset += counts[p];
+                counts[p] = offsets[p];
+            }
+            offsets[WS_FEEDBACK_PATTERNS] = (uint16_t)offset;
+            for(int a=0; a<index->answers; a++)
+            {
+                members[counts[patterns[a]]++] = job->answers[a];
+            }
+        }
+    }
+    return NULL;
+}
+
+/*
+ *  run thread on job from the calling thread and up to threads-1 more, all sharing the job's guesses, so if
+ *  some can't be started the rest just take longer.  not worth a thread for a handful of answers
+ */
+static void run_threads(void    *(*thread)(void *),
+                        void    *job,
+                        int64_t pairs,
+                        int     threads)
+{
+    if(pairs < 1000000 || threads < 1)
+    {
+        threads = 1;
+    }
+    pthread_t thread_ids[threads];
+    int started = 1;
+    while(started < threads && pthread_create(&thread_ids[started], NULL, thread, job) == 0)
+    {
+        started++;
+    }
+    thread(job);
+    for(int t=1; t<started; t++)
+    {
+        pthread_join(thread_ids[t], NULL);
+    }
+}
+
+/*
+ *  one pass over each guess's row of the parent: its answers are already in pattern order, so dealing them
+ *  out to the children in turn leaves every child's row sorted too.  answers going to no child are dealt to
+ *  a scratch row instead, which keeps the pass free of branches
+ */
+static void *answer_index_split_thread(void *arg)
+{
+    s_answer_index_split_job *job = arg;
+    const s_answer_index *index = job->index;
+    static _Thread_local uint16_t scratch[MAX_DICTIONARY_SIZE];
+    static _Thread_local uint8_t patterns[MAX_DICTIONARY_SIZE];
+    for(;;)
+    {
+        int guess_start = __atomic_fetch_add(job->next_guess, WS_MATRIX_TILE_GUESSES, __ATOMIC_RELAXED);
+        if(guess_start >= index->guesses)
+        {
+            break;
+        }
+        int guess_end = guess_start + WS_MATRIX_TILE_GUESSES;
+        if(guess_end > index->guesses)
+        {
+            guess_end = index->guesses;
+        }
+        for(int g=guess_start; g<guess_end; g++)
+        {
+            const uint16_t *offsets = index->offsets + (size_t)g*WS_ANSWER_INDEX_OFFSETS;
+            const uint16_t *members = index->members + (size_t)g*(size_t)index->answers;
+            uint16_t *child_members[WS_FEEDBACK_PATTERNS+1];
+            uint8_t *child_patterns[WS_FEEDBACK_PATTERNS+1];
+            int cursor[WS_FEEDBACK_PATTERNS+1];
+            
+            // children's patterns go in one scratch buffer, each at the same position as in the parent's split
+            int start = 0;
+            for(int k=0; k<job->indexed_count; k++)
+            {
+                s_answer_index *child = &job->children[job->indexed[k]];
+                child_members[k] = child->members + (size_t)g*(size_t)child->answers;
+                child_patterns[k] = patterns + start;
+                cursor[k] = 0;
+                start += child->answers;
+            }
+            child_members[job->indexed_count] = scratch;
+            child_patterns[job->indexed_count] = patterns + start;
+            cursor[job->indexed_count] = 0;
+            
+            for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+            {
+                for(int a=offsets[p]; a<offsets[p+1]; a++)
+                {
+                    int k = job->child_of[members[a]];
+                    child_members[k][cursor[k]] = members[a];
+                    child_patterns[k][cursor[k]++] = (uint8_t)p;
+                }
+            }
+            
+            // a child's patterns come out in order too, so bucket q starts at its first pattern not below q
+            for(int k=0; k<job->indexed_count; k++)
+            {
+                uint16_t *child_offsets = job->children[job->indexed[k]].offsets + (size_t)g*WS_ANSWER_INDEX_OFFSETS;
+                const uint8_t *child_pattern = child_patterns[k];
+                int q = 0;
+                for(int a=0; a<cursor[k]; a++)
+                {
+                    for(; q<=child_pattern[a]; q++)
+                    {
+                        child_offsets[q] = (uint16_t)a;
+                    }
+                }
+                for(; q<WS_ANSWER_INDEX_OFFSETS; q++)
+                {
+                    child_offsets[q] = (uint16_t)cursor[k];
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+/*
+ *  index every dictionary word as a guess against the given answers (dictionary entries), returns nonzero
+ *  if out of memory
+ */
+int ws_answer_index_build(s_answer_index            *index,
+                          const s_wordle_dictionary *dictionary,
+                          const uint16_t            *answers,
+                          int                       answer_count,
+                          int                       threads)
+{
+    memset(index, 0, sizeof(s_answer_index));
+    index->guesses = dictionary->entries;
+    index->answers = answer_count;
+    
+    size_t offsets_size = sizeof(uint16_t)*(size_t)index->guesses*WS_ANSWER_INDEX_OFFSETS;
+    size_t members_size = sizeof(uint16_t)*(size_t)index->guesses*(size_t)answer_count;
+    index->offsets = malloc(offsets_size);
+    index->members = malloc(members_size ? members_size : 1);
+    uint32_t *answer_words = malloc(sizeof(uint32_t)*(size_t)(answer_count ? answer_count : 1));
+    uint32_t *answer_masks = malloc(sizeof(uint32_t)*(size_t)(answer_count ? answer_count : 1));
+    if(!index->offsets || !index->members || !answer_words || !answer_masks)
+    {
+        free(answer_words);
+        free(answer_masks);
+        ws_answer_index_release(index);
+        return 1;
+    }
+    index->bytes = offsets_size + members_size;
+    for(int a=0; a<answer_count; a++)
+    {
+        answer_words[a] = dictionary->words[answers[a]];
+        answer_masks[a] = dictionary->letter_masks[answers[a]];
+    }
+    
+    int next_guess = 0;
+    s_answer_index_job job = {index, dictionary, answers, answer_words, answer_masks, &next_guess};
+    run_threads(answer_index_thread, &job, (int64_t)index->guesses*answer_count, threads);
+    
+    free(answer_words);
+    free(answer_masks);
+    return 0;
+}
+
+/*
+ *  index the buckets of guess holding at least min_answers answers without scoring a pattern: child p gets
+ *  every guess's answers that gave p for guess, in the same order.  children of the other buckets are left
+ *  empty.  returns nonzero if out of memory, with every child released
+ */
+int ws_answer_index_split(const s_answer_index *index,
+                          int                  guess,
+                          int                  min_answers,
+                          s_answer_index       children[WS_FEEDBACK_PATTERNS],
+                          int                  threads)
+{
+    memset(children, 0, sizeof(s_answer_index)*WS_FEEDBACK_PATTERNS);
+    uint8_t indexed[WS_FEEDBACK_PATTERNS];
+    int indexed_count = 0, failed = 0;
+    for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+    {
+        int size = ws_answer_index_bucket_size(index, guess, p);
+        if(size && size >= min_answers)
+        {
+            indexed[indexed_count++] = (uint8_t)p;
+        }
+    }
+    uint8_t *child_of = malloc((size_t)(index->guesses ? index->guesses : 1));
+    if(!child_of)
+    {
+        return 1;
+    }
+    memset(child_of, indexed_count, (size_t)index->guesses);
+    for(int k=0; k<indexed_count; k++)
+    {
+        s_answer_index *child = &children[indexed[k]];
+        int size = ws_answer_index_bucket_size(index, guess, indexed[k]);
+        size_t offsets_size = sizeof(uint16_t)*(size_t)index->guesses*WS_ANSWER_INDEX_OFFSETS;
+        size_t members_size = sizeof(uint16_t)*(size_t)index->guesses*(size_t)size;
+        child->guesses = index->guesses;
+        child->answers = size;
+        child->offsets = malloc(offsets_size);
+        child->members = malloc(members_size);
+        child->bytes = offsets_size + members_size;
+        if(!child->offsets || !child->members)
+        {
+            failed = 1;
+            break;
+        }
+        const uint16_t *members = ws_answer_index_bucket(index, guess, indexed[k]);
+        for(int a=0; a<size; a++)
+        {
+            child_of[members[a]] = (uint8_t)k;
+        }
+    }
+    
+    if(!failed && indexed_count)
+    {
+        int next_guess = 0;
+        s_answer_index_split_job job = {index, children, child_of, indexed, indexed_count, &next_guess};
+        run_threads(answer_index_split_thread, &job, (int64_t)index->guesses*index->answers, threads);
+    }
+    else
+    {
+        for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+        {
+            ws_answer_index_release(&children[p]);
+        }
+    }
+    free(child_of);
+    return failed;
+}
+
+/*
+ *  sum of squared bucket sizes, the expected number of answers left after the guess times the answer count
+ */
+int64_t ws_answer_index_sum_squares(const s_answer_index *index,
+                                    int                  guess)
+{
+    const uint16_t *offsets = index->offsets + (size_t)guess*WS_ANSWER_INDEX_OFFSETS;
+    int64_t sum = 0;
+    for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+    {
+        int64_t size = offsets[p+1] - offsets[p];
+        sum += size*size;
+    }
+    return sum;
+}
+
+/*
+ *  bits of information the guess's feedback gives about which answer it is
+ */
+double ws_answer_index_entropy(const s_answer_index *index,
+                               int                  guess)
+{
+    const uint16_t *offsets = index->offsets + (size_t)guess*WS_ANSWER_INDEX_OFFSETS;
+    double entropy = 0.0;
+    for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+    {
+        int size = offsets[p+1] - offsets[p];
+        if(size)
+        {
+            double probability = (double)size/index->answers;
+            entropy -= probability*log2(probability);
+        }
+    }
+    return entropy;
+}
+
+void ws_answer_index_release(s_answer_index *index)
+{
+    free(index->offsets);
+    free(index->members);
+    index->offsets = NULL;
+    index->members = NULL;
+    index->guesses = 0;
+    index->answers = 0;
+    index->bytes = 0;
+}
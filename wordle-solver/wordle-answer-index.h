@@ -0,0 +1,69 @@
+//
+//  wordle-answer-index.h
+//  wordle-solver
+//
+//  Per guess answer index: for every guess, a set of answers sorted by the feedback pattern they give with a
+//  WS_FEEDBACK_PATTERNS+1 entry offset table in front.  Bucket sizes are a subtraction and splitting the
+//  answers by a guess is a sequential read, where a dense pattern matrix has to be scanned and counted.  It
+//  can be split by a guess into one index per feedback pattern without scoring anything again, so the
+//  decision tree builder (wordle-tree.h) builds it once over every answer and hands each node's children
+//  theirs.  Over every answer it is bigger than the dense matrix (2 bytes per pair plus the offsets, 63.3 MB
+//  against 28.6 MB on the Wordle lists).  The guess search (wordle-search.h) doesn't use it.
+//
+
+#ifndef wordle_answer_index_h
+#define wordle_answer_index_h
+
+#include "wordle-solver.h"
+
+// answers are stored as 16 bit dictionary entries, which MAX_DICTIONARY_SIZE fits
+#define WS_ANSWER_INDEX_OFFSETS     (WS_FEEDBACK_PATTERNS+1)
+
+typedef struct s_answer_index
+{
+    int      guesses;                       // every dictionary entry
+    int      answers;
+    uint16_t *offsets;                      // guesses*WS_ANSWER_INDEX_OFFSETS, bucket p is [offsets[p], offsets[p+1])
+    uint16_t *members;                      // guesses*answers dictionary entries, sorted by pattern per guess
+    size_t   bytes;
+} s_answer_index;
+
+static inline int ws_answer_index_bucket_size(const s_answer_index *index,
+                                              int                  guess,
+                                              int                  pattern)
+{
+    const uint16_t *offsets = index->offsets + (size_t)guess*WS_ANSWER_INDEX_OFFSETS;
+    return offsets[pattern+1] - offsets[pattern];
+}
+
+/*
+ *  answers giving pattern for guess, ws_answer_index_bucket_size() of them
+ */
+static inline const uint16_t *ws_answer_index_bucket(const s_answer_index *index,
+                                                     int                  guess,
+                                                     int                  pattern)
+{
+    return index->members + (size_t)guess*(size_t)index->answers + index->offsets[(size_t)guess*WS_ANSWER_INDEX_OFFSETS + pattern];
+}
+
+int ws_answer_index_build(s_answer_index            *index,
+                          const s_wordle_dictionary *dictionary,
+                          const uint16_t            *answers,
+                          int                       answer_count,
+                          int                       threads);
+
+int ws_answer_index_split(const s_answer_index *index,
+                          int                  guess,
+                          int                  min_answers,
+                          s_answer_index       children[WS_FEEDBACK_PATTERNS],
+                          int                  threads);
+
+int64_t ws_answer_index_sum_squares(const s_answer_index *index,
+                                    int                  guess);
+
+double ws_answer_index_entropy(const s_answer_index *index,
+                               int                  guess);
+
+void ws_answer_index_release(s_answer_index *index);
+
+#endif /* wordle_answer_index_h */
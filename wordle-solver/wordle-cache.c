@@ -0,0 +1,856 @@
+//
+//  wordle-cache.c
+//  wordle-solver
+//
+//  Derived data cached across runs, see wordle-cache.h.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "wordle-cache.h"
+#include "wordle-dictionary.h"
+#include "wordle-matrix.h"
+
+// sections start on cache line boundaries, like a compiled dictionary
+#define CACHE_ALIGN                 64
+
+_Static_assert(sizeof(s_cache_header) == 128, "cache header layout changed");
+
+typedef struct s_cache_file
+{
+    const s_cache_header *header;
+    const uint32_t       *words;
+    const uint8_t        *flags;
+    const uint8_t        *data;
+    void                 *mapping;
+    size_t               size;
+} s_cache_file;
+
+// how the dictionary's word list differs from the one in a cache
+typedef struct s_cache_delta
+{
+    int32_t  *old_entry;                    // per dictionary entry, its entry in the cache or -1 if it's new
+    uint32_t *changed;                      // words added, then words removed
+    int      added;
+    int      removed;
+    bool     in_order;                      // words in both lists are in the same relative order
+} s_cache_delta;
+
+typedef struct s_start_word_job
+{
+    const s_wordle_dictionary *dictionary;
+    const s_wordle_dictionary *old_dictionary;  // the cache's word list
+    bool                      hard_mode;
+    const s_cache_file        *cache;       // NULL to play every game
+    const s_cache_delta       *delta;
+    uint8_t                   *counts;
+    int                       *next_row;    // shared, start words claimed
+    int64_t                   reused;       // shared
+    int64_t                   played;       // shared
+    bool                      failed;       // shared, out of memory
+} s_start_word_job;
+
+// one start word's games being worked out
+typedef struct s_start_word_row
+{
+    const s_start_word_job *job;
+    uint8_t                *row;
+    const uint8_t          *old_row;        // the same start word's games in the cache
+    const char             *start_word;
+    int64_t                reused;
+    int64_t                played;
+    bool                   failed;
+} s_start_word_row;
+
+static size_t align_up(size_t offset)
+{
+    return (offset + CACHE_ALIGN - 1) & ~(size_t)(CACHE_ALIGN - 1);
+}
+
+/*
+ *  map a cache file and check it holds the right kind of data, row_size 0 for rows as long as the word list.
+ *  returns NULL or why it can't be used.
+ */
+static const char *map_cache(s_cache_file *cache,
+                             const char   *path,
+                             uint32_t     kind,
+                             uint32_t     row_size)
+{
+    memset(cache, 0, sizeof(s_cache_file));
+    int fd = open(path, O_RDONLY);
+    if(fd < 0)
+    {
+        return "there was no cache yet";
+    }
+    struct stat st;
+    if(fstat(fd, &st) || (size_t)st.st_size < sizeof(s_cache_header))
+    {
+        close(fd);
+        return "the cache is not a cache file";
+    }
+    size_t size = (size_t)st.st_size;
+    uint8_t *image = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(image == MAP_FAILED)
+    {
+        return "the cache couldn't be mapped";
+    }
+    
+    const s_cache_header *header = (const s_cache_header *)image;
+    const char *problem = NULL;
+    if(memcmp(header->magic, WS_CACHE_MAGIC, sizeof(header->magic)))
+    {
+        problem = "the cache is not a cache file";
+    }
+    else if(header->version != WS_CACHE_VERSION || header->word_size != WORDLE_WORD_SIZE)
+    {
+        problem = "the cache was written by a different version";
+    }
+    else if(header->kind != kind || header->row_size != (row_size ? row_size : header->entries))
+    {
+        problem = "the cache holds different data";
+    }
+    else if(header->file_size != size || header->entries > MAX_DICTIONARY_SIZE ||
+            header->words_offset + (uint64_t)header->entries*sizeof(uint32_t) > size ||
+            header->flags_offset + (uint64_t)header->entries > size ||
+            header->data_offset + (uint64_t)header->entries*header->row_size > size || header->words_offset % sizeof(uint32_t) ||
+            header->data_offset % sizeof(uint32_t))
+    {
+        problem = "the cache is truncated or malformed";
+    }
+    else
+    {
+        uint64_t hash = ws_dictionary_hash(image + header->words_offset, header->entries*sizeof(uint32_t), 0);
+        hash = ws_dictionary_hash(image + header->flags_offset, header->entries, hash);
+        hash = ws_dictionary_hash(image + header->data_offset, (size_t)header->entries*header->row_size, hash);
+        if(hash != header->hash)
+        {
+            problem = "the cache failed its integrity check";
+        }
+    }
+    
+    if(problem != NULL)
+    {
+        munmap(image, size);
+        return problem;
+    }
+    cache->header = header;
+    cache->words = (const uint32_t *)(image + header->words_offset);
+    cache->flags = image + header->flags_offset;
+    cache->data = image + header->data_offset;
+    cache->mapping = image;
+    cache->size = size;
+    return NULL;
+}
+
+static void unmap_cache(s_cache_file *cache)
+{
+    if(cache->mapping)
+    {
+        munmap(cache->mapping, cache->size);
+    }
+    memset(cache, 0, sizeof(s_cache_file));
+}
+
+/*
+ *  write the dictionary's word list and its data to a cache file, sections one after the other so the data
+ *  is never copied
+ */
+static int write_cache(const char                *path,
+                       uint32_t                  kind,
+                       uint32_t                  settings,
+                       const s_wordle_dictionary *dictionary,
+                       const void                *data,
+                       uint32_t                  row_size)
+{
+    s_cache_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, WS_CACHE_MAGIC, sizeof(header.magic));
+    header.version = WS_CACHE_VERSION;
+    header.word_size = WORDLE_WORD_SIZE;
+    header.kind = kind;
+    header.settings = settings;
+    header.entries = (uint32_t)dictionary->entries;
+    header.row_size = row_size;
+    header.word_list_hash = dictionary->hash;
+    
+    size_t entries = (size_t)dictionary->entries;
+    const void *sections[] = {dictionary->words, dictionary->flags, data};
+    size_t sizes[] = {entries*sizeof(uint32_t), entries, entries*row_size};
+    uint64_t *offsets[] = {&header.words_offset, &header.flags_offset, &header.data_offset};
+    int section_count = sizeof(sizes)/sizeof(sizes[0]);
+    
+    size_t offset = align_up(sizeof(header));
+    for(int i=0; i<section_count; i++)
+    {
+        *offsets[i] = offset;
+        header.hash = ws_dictionary_hash(sections[i], sizes[i], header.hash);
+        offset = align_up(offset + sizes[i]);
+    }
+    header.file_size = offset;
+    
+    FILE *fp = fopen(path, "wb");
+    if(!fp)
+    {
+        printf("couldn't write %s\n", path);
+        return 1;
+    }
+    static const uint8_t padding[CACHE_ALIGN];
+    bool written = fwrite(&header, sizeof(header), 1, fp) == 1;
+    size_t position = sizeof(header);
+    for(int i=0; i<section_count && written; i++)
+    {
+        written = fwrite(padding, 1, *offsets[i] - position, fp) == *offsets[i] - position &&
+                  fwrite(sections[i], 1, sizes[i], fp) == sizes[i];
+        position = *offsets[i] + sizes[i];
+    }
+    written = written && fwrite(padding, 1, offset - position, fp) == offset - position;
+    if(fclose(fp) || !written)
+    {
+        printf("couldn't write %s\n", path);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ *  match the dictionary's words against the cache's by word, returns nonzero if out of memory
+ */
+static int build_delta(const s_cache_file        *cache,
+                       const s_wordle_dictionary *dictionary,
+                       s_cache_delta             *delta)
+{
+    int old_entries = (int)cache->header->entries;
+    uint32_t slots = 1;
+    while(slots < 2u*(uint32_t)old_entries + 1)
+    {
+        slots <<= 1;
+    }
+    uint32_t *keys = calloc(slots, sizeof(uint32_t));
+    int32_t *values = malloc(sizeof(int32_t)*slots);
+    bool *kept = calloc((size_t)old_entries + 1, sizeof(bool));
+    delta->old_entry = malloc(sizeof(int32_t)*(size_t)(dictionary->entries ? dictionary->entries : 1));
+    delta->changed = malloc(sizeof(uint32_t)*(size_t)(dictionary->entries + old_entries + 1));
+    if(!keys || !values || !kept || !delta->old_entry || !delta->changed)
+    {
+        free(keys);
+        free(values);
+        free(kept);
+        free(delta->old_entry);
+        free(delta->changed);
+        return 1;
+    }
+    
+    // packed words plus one so zero marks an empty slot
+    for(int e=0; e<old_entries; e++)
+    {
+        uint32_t slot = ws_word_hash(cache->words[e]) & (slots-1);
+        while(keys[slot])
+        {
+            slot = (slot + 1) & (slots-1);
+        }
+        keys[slot] = cache->words[e] + 1;
+        values[slot] = e;
+    }
+    
+    delta->added = 0;
+    delta->removed = 0;
+    delta->in_order = true;
+    int32_t previous = -1;
+    for(int e=0; e<dictionary->entries; e++)
+    {
+        uint32_t slot = ws_word_hash(dictionary->words[e]) & (slots-1);
+        while(keys[slot] && keys[slot] != dictionary->words[e] + 1)
+        {
+            slot = (slot + 1) & (slots-1);
+        }
+        // a word listed twice pairs with the cache's copies in turn, any extra copy is new
+        while(keys[slot] && kept[values[slot]])
+        {
+            do
+            {
+                slot = (slot + 1) & (slots-1);
+            } while(keys[slot] && keys[slot] != dictionary->words[e] + 1);
+        }
+        delta->old_entry[e] = keys[slot] ? values[slot] : -1;
+        if(delta->old_entry[e] < 0)
+        {
+            delta->changed[delta->added++] = dictionary->words[e];
+            continue;
+        }
+        kept[delta->old_entry[e]] = true;
+        if(delta->old_entry[e] < previous)
+        {
+            delta->in_order = false;
+        }
+        previous = delta->old_entry[e];
+    }
+    for(int e=0; e<old_entries; e++)
+    {
+        if(!kept[e])
+        {
+            delta->changed[delta->added + delta->removed++] = cache->words[e];
+        }
+    }
+    free(keys);
+    free(values);
+    free(kept);
+    return 0;
+}
+
+static void release_delta(s_cache_delta *delta)
+{
+    free(delta->old_entry);
+    free(delta->changed);
+    memset(delta, 0, sizeof(s_cache_delta));
+}
+
+/*
+ *  move a kept guess's bucket counts to the new answers: every answer that's gone comes out of the bucket
+ *  of the pattern it gave, and every new one goes into its own
+ */
+static void patch_bucket_row(uint32_t       guess,
+                             uint32_t       *counts,
+                             const uint32_t *removed,
+                             int            removed_count,
+                             const uint32_t *added,
+                             int            added_count)
+{
+    for(int a=0; a<removed_count; a++)
+    {
+        counts[ws_word_feedback(guess, removed[a], ws_word_letter_mask(removed[a]))]--;
+    }
+    for(int a=0; a<added_count; a++)
+    {
+        counts[ws_word_feedback(guess, added[a], ws_word_letter_mask(added[a]))]++;
+    }
+}
+
+/*
+ *  bucket counts for every guess in the dictionary (see ws_stream_buckets), taken from the cache at path
+ *  when it holds this word list, patched when it holds a slightly different one, and written back
+ */
+int ws_cache_buckets(s_bucket_table            *table,
+                     const s_wordle_dictionary *dictionary,
+                     const s_stream_options    *options,
+                     const char                *path,
+                     s_cache_report            *report)
+{
+    uint64_t start = ws_now_ns();
+    memset(report, 0, sizeof(s_cache_report));
+    if(dictionary->original != NULL)
+    {
+        printf("caches are kept in word list order and can't be used on a reordered dictionary\n");
+        return 1;
+    }
+    
+    uint32_t row_size = WS_FEEDBACK_PATTERNS*sizeof(uint32_t);
+    s_cache_file cache;
+    const char *problem = map_cache(&cache, path, WS_CACHE_BUCKETS, row_size);
+    s_cache_delta delta = {0};
+    uint32_t *removed_answers = NULL, *added_answers = NULL;
+    int removed_count = 0, added_count = 0;
+    if(problem == NULL && cache.header->word_list_hash != dictionary->hash)
+    {
+        // answers are the words flagged as answers, so a kept word can join or leave them too
+        removed_answers = malloc(sizeof(uint32_t)*(size_t)(cache.header->entries + 1));
+        added_answers = malloc(sizeof(uint32_t)*(size_t)(dictionary->entries + 1));
+        if(!removed_answers || !added_answers || build_delta(&cache, dictionary, &delta))
+        {
+            free(removed_answers);
+            free(added_answers);
+            unmap_cache(&cache);
+            return 1;
+        }
+        bool *still_answer = calloc(cache.header->entries + 1, sizeof(bool));
+        if(!still_answer)
+        {
+            free(removed_answers);
+            free(added_answers);
+            release_delta(&delta);
+            unmap_cache(&cache);
+            return 1;
+        }
+        for(int e=0; e<dictionary->entries; e++)
+        {
+            if(dictionary->flags[e] & WS_WORD_ANSWER)
+            {
+                if(delta.old_entry[e] < 0 || !(cache.flags[delta.old_entry[e]] & WS_WORD_ANSWER))
+                {
+                    added_answers[added_count++] = dictionary->words[e];
+                }
+                else
+                {
+                    still_answer[delta.old_entry[e]] = true;
+                }
+            }
+        }
+        for(uint32_t e=0; e<cache.header->entries; e++)
+        {
+            if((cache.flags[e] & WS_WORD_ANSWER) && !still_answer[e])
+            {
+                removed_answers[removed_count++] = cache.words[e];
+            }
+        }
+        free(still_answer);
+        
+        // patching costs a feedback per changed answer against every guess, counting one per answer
+        if(removed_count + added_count >= dictionary->answer_entries)
+        {
+            problem = "most of the answers changed";
+        }
+    }
+    
+    if(problem != NULL)
+    {
+        report->rebuilt = problem;
+        if(ws_stream_buckets(table, dictionary, options))
+        {
+            free(removed_answers);
+            free(added_answers);
+            release_delta(&delta);
+            unmap_cache(&cache);
+            return 1;
+        }
+        report->computed_cells = table->guesses;
+    }
+    else
+    {
+        memset(table, 0, sizeof(s_bucket_table));
+        table->guesses = dictionary->entries;
+        table->answers = dictionary->answer_entries;
+        table->size = (size_t)table->guesses*row_size;
+        table->block_guesses = table->guesses ? table->guesses : 1;
+        table->counts = malloc(table->size ? table->size : 1);
+        if(!table->counts)
+        {
+            free(removed_answers);
+            free(added_answers);
+            release_delta(&delta);
+            unmap_cache(&cache);
+            return 1;
+        }
+        
+        if(cache.header->word_list_hash == dictionary->hash)
+        {
+            memcpy(table->counts, cache.data, table->size);
+            report->reused = true;
+            report->reused_cells = table->guesses;
+        }
+        else
+        {
+            uint32_t *answer_words = malloc(sizeof(uint32_t)*(size_t)(table->answers ? table->answers : 1));
+            uint32_t *answer_masks = malloc(sizeof(uint32_t)*(size_t)(table->answers ? table->answers : 1));
+            uint8_t *patterns = malloc((size_t)(table->answers ? table->answers : 1));
+            if(!answer_words || !answer_masks || !patterns)
+            {
+                free(answer_words);
+                free(answer_masks);
+                free(patterns);
+                free(removed_answers);
+                free(added_answers);
+                release_delta(&delta);
+                unmap_cache(&cache);
+                ws_bucket_release(table);
+                return 1;
+            }
+            for(int a=0; a<table->answers; a++)
+            {
+                answer_words[a] = dictionary->words[dictionary->answers[a]];
+                answer_masks[a] = dictionary->letter_masks[dictionary->answers[a]];
+            }
+            
+            for(int g=0; g<table->guesses; g++)
+            {
+                uint32_t *counts = table->counts + (size_t)g*WS_FEEDBACK_PATTERNS;
+                if(delta.old_entry[g] >= 0)
+                {
+                    memcpy(counts, cache.data + (size_t)delta.old_entry[g]*row_size, row_size);
+                    patch_bucket_row(dictionary->words[g], counts, removed_answers, removed_count, added_answers, added_count);
+                    if(removed_count + added_count)
+                    {
+                        report->patched_cells++;
+                    }
+                    else
+                    {
+                        report->reused_cells++;
+                    }
+                }
+                else
+                {
+                    memset(counts, 0, row_size);
+                    ws_pattern_row(dictionary->words[g], answer_words, answer_masks, table->answers, patterns);
+                    for(int a=0; a<table->answers; a++)
+                    {
+                        counts[patterns[a]]++;
+                    }
+                    report->computed_cells++;
+                }
+            }
+            free(answer_words);
+            free(answer_masks);
+            free(patterns);
+            report->delta = true;
+            report->added = delta.added;
+            report->removed = delta.removed;
+        }
+    }
+    free(removed_answers);
+    free(added_answers);
+    release_delta(&delta);
+    unmap_cache(&cache);
+    
+    int failed = report->reused ? 0 : write_cache(path, WS_CACHE_BUCKETS, 0, dictionary, table->counts, row_size);
+    report->ns = ws_now_ns() - start;
+    table->build_ns = report->ns;
+    return failed;
+}
+
+static int play_game(const s_wordle_dictionary *dictionary,
+                     const char                *start_word,
+                     bool                      hard_mode,
+                     uint32_t                  target_word)
+{
+    s_wordle_state wordle_state;
+    ws_init(&wordle_state, start_word, hard_mode);
+    int guess_count = 0;
+    int ret;
+    do
+    {
+        ret = ws_make_guess(&wordle_state, target_word, dictionary, false);
+        guess_count++;
+    } while(!ret);
+    return guess_count < UINT8_MAX ? guess_count : UINT8_MAX;
+}
+
+/*
+ *  whether any word added or removed is consistent with the hints so far, if none is both lists have the
+ *  same candidates
+ */
+static bool changed_word_fits(const s_cache_delta  *delta,
+                              const s_wordle_state *wordle_state)
+{
+    s_wordle_constraints constraints;
+    ws_build_constraints(wordle_state, &constraints);
+    for(int w=0; w<delta->added + delta->removed; w++)
+    {
+        char word[WORDLE_WORD_SIZE+1];
+        ws_word_decode(delta->changed[w], word);
+        if(ws_word_matches(&constraints, word))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void settle_targets(s_start_word_row *work,
+                           s_wordle_state   *wordle_state,
+                           s_wordle_state   *old_state,
+                           const int        *targets,
+                           int              count,
+                           int              guesses);
+
+/*
+ *  both lists guess the same word here, split the targets by the feedback it gets and follow each branch
+ */
+static void settle_guess(s_start_word_row *work,
+                         s_wordle_state   *wordle_state,
+                         s_wordle_state   *old_state,
+                         const char       *guess,
+                         const int        *targets,
+                         int              count,
+                         int              guesses)
+{
+    const s_wordle_dictionary *dictionary = work->job->dictionary;
+    int *sorted = malloc(sizeof(int)*(size_t)count);
+    int *patterns = malloc(sizeof(int)*(size_t)count);
+    if(!sorted || !patterns)
+    {
+        free(sorted);
+        free(patterns);
+        work->failed = true;
+        return;
+    }
+    int starts[WS_FEEDBACK_PATTERNS+1] = {0};
+    uint32_t packed = ws_word_encode(guess);
+    for(int i=0; i<count; i++)
+    {
+        patterns[i] = ws_entry_feedback(packed, dictionary, targets[i]);
+        starts[patterns[i]+1]++;
+    }
+    for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+    {
+        starts[p+1] += starts[p];
+    }
+    int next[WS_FEEDBACK_PATTERNS];
+    memcpy(next, starts, sizeof(next));
+    for(int i=0; i<count; i++)
+    {
+        sorted[next[patterns[i]]++] = targets[i];
+    }
+    free(patterns);
+    
+    for(int p=0; p<WS_FEEDBACK_PATTERNS && !work->failed; p++)
+    {
+        int branch = starts[p+1] - starts[p];
+        if(branch == 0)
+        {
+            continue;
+        }
+        if(p == WS_FEEDBACK_SOLVED)
+        {
+            work->row[sorted[starts[p]]] = (uint8_t)(guesses + 1);
+            work->reused++;
+            continue;
+        }
+        s_wordle_state branch_state = *wordle_state, old_branch_state = *old_state;
+        ws_apply_feedback(&branch_state, guess, p, false);
+        ws_apply_feedback(&old_branch_state, guess, p, false);
+        settle_targets(work, &branch_state, &old_branch_state, &sorted[starts[p]], branch, guesses + 1);
+    }
+    free(sorted);
+}
+
+/*
+ *  work out the games of the targets that reach this state on both lists.  they're carried over from the
+ *  cache as long as both lists keep picking the same guesses, and only replayed from where they part.
+ */
+static void settle_targets(s_start_word_row *work,
+                           s_wordle_state   *wordle_state,
+                           s_wordle_state   *old_state,
+                           const int        *targets,
+                           int              count,
+                           int              guesses)
+{
+    const s_start_word_job *job = work->job;
+    
+    // hard mode only scores the candidates, so with the same candidates the rest of the games play out the
+    // same
+    if(!changed_word_fits(job->delta, wordle_state))
+    {
+        for(int i=0; i<count; i++)
+        {
+            work->row[targets[i]] = work->old_row[job->delta->old_entry[targets[i]]];
+        }
+        work->reused += count;
+        return;
+    }
+    
+    char guess[WORDLE_WORD_SIZE+1], old_guess[WORDLE_WORD_SIZE+1];
+    bool found = ws_choose_guess(wordle_state, job->dictionary, guess, false);
+    bool old_found = ws_choose_guess(old_state, job->old_dictionary, old_guess, false);
+    if(found != old_found || strcmp(guess, old_guess))
+    {
+        for(int i=0; i<count; i++)
+        {
+            work->row[targets[i]] = (uint8_t)play_game(job->dictionary, work->start_word, job->hard_mode,
+                                                       job->dictionary->words[targets[i]]);
+        }
+        work->played += count;
+        return;
+    }
+    if(found)
+    {
+        // every letter is placed, ws_make_guess() takes a turn to notice
+        for(int i=0; i<count; i++)
+        {
+            work->row[targets[i]] = (uint8_t)(guesses + 1);
+        }
+        work->reused += count;
+        return;
+    }
+    settle_guess(work, wordle_state, old_state, guess, targets, count, guesses);
+}
+
+static void *start_word_thread(void *arg)
+{
+    s_start_word_job *job = arg;
+    const s_wordle_dictionary *dictionary = job->dictionary;
+    size_t entries = (size_t)dictionary->entries;
+    int *targets = malloc(sizeof(int)*(entries ? entries : 1));
+    if(!targets)
+    {
+        __atomic_store_n(&job->failed, true, __ATOMIC_RELAXED);
+        return NULL;
+    }
+    
+    for(;;)
+    {
+        int s = __atomic_fetch_add(job->next_row, 1, __ATOMIC_RELAXED);
+        if(s >= dictionary->entries)
+        {
+            break;
+        }
+        char start_word[WORDLE_WORD_SIZE+1];
+        ws_word_decode(dictionary->words[s], start_word);
+        int32_t old_s = job->cache ? job->delta->old_entry[s] : -1;
+        s_start_word_row work = {job, job->counts + (size_t)s*entries, NULL, start_word, 0, 0, false};
+        
+        // targets new to the list are always played, the others are walked down the start word's game tree
+        int count = 0;
+        for(int t=0; t<dictionary->entries; t++)
+        {
+            if(old_s >= 0 && job->delta->old_entry[t] >= 0)
+            {
+                targets[count++] = t;
+            }
+            else
+            {
+                work.row[t] = (uint8_t)play_game(dictionary, start_word, job->hard_mode, dictionary->words[t]);
+                work.played++;
+            }
+        }
+        if(count)
+        {
+            work.old_row = job->cache->data + (size_t)old_s*job->cache->header->entries;
+            s_wordle_state wordle_state, old_state;
+            ws_init(&wordle_state, NULL, job->hard_mode);
+            ws_init(&old_state, NULL, job->hard_mode);
+            settle_guess(&work, &wordle_state, &old_state, start_word, targets, count, 0);
+        }
+        __atomic_fetch_add(&job->reused, work.reused, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&job->played, work.played, __ATOMIC_RELAXED);
+        if(work.failed)
+        {
+            __atomic_store_n(&job->failed, true, __ATOMIC_RELAXED);
+        }
+    }
+    free(targets);
+    return NULL;
+}
+
+/*
+ *  guesses taken by every start word against every target, row major by start word, as find_optimal_word()
+ *  plays them without a search budget.  taken from the cache at path when it holds this word list, updated
+ *  when it holds a slightly different one (hard mode only) and written back.  *counts is for the caller to
+ *  free.
+ */
+int ws_cache_start_words(uint8_t                   **counts,
+                         const s_wordle_dictionary *dictionary,
+                         bool                      hard_mode,
+                         int                       threads,
+                         const char                *path,
+                         s_cache_report            *report)
+{
+    uint64_t start = ws_now_ns();
+    memset(report, 0, sizeof(s_cache_report));
+    *counts = NULL;
+    if(dictionary->original != NULL)
+    {
+        printf("caches are kept in word list order and can't be used on a reordered dictionary\n");
+        return 1;
+    }
+    
+    uint32_t settings = hard_mode ? WS_CACHE_HARD_MODE : 0;
+    uint32_t row_size = (uint32_t)dictionary->entries;
+    size_t size = (size_t)dictionary->entries*row_size;
+    s_cache_file cache;
+    s_cache_delta delta = {0};
+    const char *problem = map_cache(&cache, path, WS_CACHE_START_WORDS, 0);
+    if(problem == NULL && cache.header->settings != settings)
+    {
+        problem = "the cache was played in the other mode";
+        unmap_cache(&cache);
+    }
+    
+    // the cache's games are compared against guesses picked on its own word list, so it's rebuilt as a
+    // dictionary.  ties between guesses go to the earlier word, so the lists have to agree on word order
+    s_wordle_dictionary old_dictionary = {0};
+    char (*old_words)[WORDLE_WORD_SIZE+1] = NULL;
+    if(problem == NULL && cache.header->word_list_hash != dictionary->hash && !hard_mode)
+    {
+        // walking the game tree works in normal mode too but costs as much as replaying, every node has to
+        // compare picks since any edit moves the letter counts of the whole dictionary
+        problem = "normal mode scores letters over the whole dictionary, so any edit can move any game";
+        unmap_cache(&cache);
+    }
+    if(problem == NULL && cache.header->word_list_hash != dictionary->hash)
+    {
+        old_words = malloc(sizeof(*old_words)*(cache.header->entries + 1));
+        if(!old_words || build_delta(&cache, dictionary, &delta))
+        {
+            free(old_words);
+            unmap_cache(&cache);
+            return 1;
+        }
+        for(uint32_t e=0; e<cache.header->entries; e++)
+        {
+            ws_word_decode(cache.words[e], old_words[e]);
+        }
+        if(!delta.in_order)
+        {
+            problem = "the words were reordered, which changes how ties between guesses go";
+        }
+        else if(ws_dictionary_build(&old_dictionary, old_words, (int)cache.header->entries, NULL, 0))
+        {
+            problem = "the cache's word list couldn't be prepared";
+        }
+        if(problem != NULL)
+        {
+            release_delta(&delta);
+            unmap_cache(&cache);
+        }
+    }
+    free(old_words);
+    
+    *counts = malloc(size ? size : 1);
+    if(!*counts)
+    {
+        ws_dictionary_release(&old_dictionary);
+        release_delta(&delta);
+        unmap_cache(&cache);
+        return 1;
+    }
+    int failed = 0;
+    if(problem == NULL && cache.header->word_list_hash == dictionary->hash)
+    {
+        memcpy(*counts, cache.data, size);
+        report->reused = true;
+        report->reused_cells = (int64_t)size;
+    }
+    else
+    {
+        int next_row = 0;
+        s_start_word_job job = {dictionary, &old_dictionary, hard_mode, problem == NULL ? &cache : NULL, &delta, *counts,
+                                &next_row, 0, 0, false};
+        threads = threads > 0 ? threads : 1;
+        
+        // rows are handed out as threads ask, so if some can't be started the rest just take longer
+        pthread_t thread_ids[threads];
+        int started = 1;
+        while(started < threads && pthread_create(&thread_ids[started], NULL, start_word_thread, &job) == 0)
+        {
+            started++;
+        }
+        start_word_thread(&job);
+        for(int t=1; t<started; t++)
+        {
+            pthread_join(thread_ids[t], NULL);
+        }
+        failed = job.failed;
+        report->reused_cells = job.reused;
+        report->computed_cells = job.played;
+        report->rebuilt = problem;
+        report->delta = problem == NULL;
+        report->added = delta.added;
+        report->removed = delta.removed;
+    }
+    ws_dictionary_release(&old_dictionary);
+    release_delta(&delta);
+    unmap_cache(&cache);
+    
+    if(!failed && !report->reused)
+    {
+        failed = write_cache(path, WS_CACHE_START_WORDS, settings, dictionary, *counts, row_size);
+    }
+    report->ns = ws_now_ns() - start;
+    return failed;
+}
@@ -0,0 +1,80 @@
+//
+//  wordle-cache.h
+//  wordle-solver
+//
+//  Derived data cached across runs and versioned by the word list it came from.  A cache file keeps the word
+//  list next to the data, so when the list changes by a few words only the rows and columns those words touch
+//  are recomputed and everything else is carried over by word.  Bucket counts update exactly: a kept guess's
+//  row loses the removed answers and gains the added ones, and only new guesses are counted from scratch.
+//  Start word results update exactly in hard mode, where a game only depends on the words consistent with
+//  its hints: each start word's game tree is walked on both lists, branches no changed word fits are carried
+//  over whole, and games are only replayed from where the two lists pick different guesses.  Normal mode
+//  scores letters over the whole dictionary, so any edit can move any game: every game is replayed as a full
+//  rebuild, and only an unchanged list is faster than running without a cache.
+//
+
+#ifndef wordle_cache_h
+#define wordle_cache_h
+
+#include "wordle-solver.h"
+#include "wordle-stream.h"
+
+#define WS_CACHE_MAGIC              "WSCACHE\n"
+#define WS_CACHE_VERSION            1
+
+// what a cache file holds, rows and columns are in word list order
+#define WS_CACHE_BUCKETS            1       // uint32_t[entries][WS_FEEDBACK_PATTERNS] answers per pattern by guess
+#define WS_CACHE_START_WORDS        2       // uint8_t[entries][entries] guesses by start word and target
+
+// settings the data depends on
+#define WS_CACHE_HARD_MODE          0x01
+
+/*
+ *  cache file header, followed by the word list (packed words, then flags) and the data, each section on a
+ *  cache line boundary.  all values are native endian.
+ */
+typedef struct s_cache_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t word_size;
+    uint32_t kind;                          // WS_CACHE_BUCKETS or WS_CACHE_START_WORDS
+    uint32_t settings;                      // WS_CACHE_HARD_MODE
+    uint32_t entries;
+    uint32_t row_size;                      // bytes per data row
+    uint64_t words_offset;                  // uint32_t[entries]
+    uint64_t flags_offset;                  // uint8_t[entries]
+    uint64_t data_offset;                   // row_size*entries
+    uint64_t file_size;
+    uint64_t hash;                          // FNV-1a of the words, flags and data
+    uint64_t word_list_hash;                // s_wordle_dictionary hash the data was computed for
+    uint8_t  reserved[48];
+} s_cache_header;
+
+typedef struct s_cache_report
+{
+    bool       reused;                      // the cache matched the word list and was used as is
+    bool       delta;                       // the cache was updated for an edited word list
+    const char *rebuilt;                    // why everything was recomputed, NULL if it wasn't
+    int        added;                       // words in the list but not the cache
+    int        removed;                     // words in the cache but not the list
+    int64_t    reused_cells;                // bucket rows or start word games carried over as they were
+    int64_t    patched_cells;               // bucket rows moved to the new answers
+    int64_t    computed_cells;              // bucket rows counted or start word games played
+    uint64_t   ns;
+} s_cache_report;
+
+int ws_cache_buckets(s_bucket_table            *table,
+                     const s_wordle_dictionary *dictionary,
+                     const s_stream_options    *options,
+                     const char                *path,
+                     s_cache_report            *report);
+
+int ws_cache_start_words(uint8_t                   **counts,
+                         const s_wordle_dictionary *dictionary,
+                         bool                      hard_mode,
+                         int                       threads,
+                         const char                *path,
+                         s_cache_report            *report);
+
+#endif /* wordle_cache_h */
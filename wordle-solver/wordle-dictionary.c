@@ -0,0 +1,404 @@
+//
+//  wordle-dictionary.c
+//  wordle-solver
+//
+//  Builds s_wordle_dictionary from word lists and reads/writes compiled dictionary files.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "wordle-dictionary.h"
+#include "wordle-alphabet.h"
+
+#define FNV_OFFSET_BASIS            0xcbf29ce484222325ull
+#define FNV_PRIME                   0x100000001b3ull
+
+_Static_assert(sizeof(s_dictionary_header) == 128, "dictionary header layout changed");
+
+uint64_t ws_dictionary_hash(const void *data,
+                            size_t     size,
+                            uint64_t   hash)
+{
+    const uint8_t *bytes = data;
+    if(hash == 0)
+    {
+        hash = FNV_OFFSET_BASIS;
+    }
+    for(size_t i=0; i<size; i++)
+    {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static int compare_words(const void *a, const void *b)
+{
+    return strcmp(a, b);
+}
+
+static size_t align_up(size_t offset)
+{
+    return (offset + WS_DICTIONARY_ALIGN - 1) & ~(size_t)(WS_DICTIONARY_ALIGN - 1);
+}
+
+/*
+ *  pack a word list in solver text and precompute its tables.  answers are only used to set flags (NULL means
+ *  every word can be a target).  returns nonzero if a word has anything but letters below WS_WORD_LETTERS in it.
+ */
+int ws_dictionary_build(s_wordle_dictionary *dictionary,
+                        const char          words[][WORDLE_WORD_SIZE+1],
+                        int                 entries,
+                        const char          answers[][WORDLE_WORD_SIZE+1],
+                        int                 answer_entries)
+{
+    memset(dictionary, 0, sizeof(s_wordle_dictionary));
+    
+    size_t table_size = sizeof(uint32_t)*(size_t)entries;
+    uint8_t *storage = malloc(3*table_size + entries + 1);
+    if(!storage)
+    {
+        return 1;
+    }
+    uint32_t *packed_words = (uint32_t *)storage;
+    uint32_t *letter_masks = (uint32_t *)(storage + table_size);
+    uint32_t *answer_list = (uint32_t *)(storage + 2*table_size);
+    uint8_t *flags = storage + 3*table_size;
+    
+    // sorted copy of the answers so each word is a binary search
+    char (*sorted_answers)[WORDLE_WORD_SIZE+1] = NULL;
+    if(answers != NULL)
+    {
+        sorted_answers = malloc(sizeof(*sorted_answers)*(size_t)(answer_entries ? answer_entries : 1));
+        if(!sorted_answers)
+        {
+            free(storage);
+            return 1;
+        }
+        memcpy(sorted_answers, answers, sizeof(*sorted_answers)*(size_t)answer_entries);
+        qsort(sorted_answers, (size_t)answer_entries, sizeof(*sorted_answers), compare_words);
+    }
+    
+    int answer_count = 0;
+    uint64_t hash = 0;
+    for(int i=0; i<entries; i++)
+    {
+        for(int j=0; j<WORDLE_WORD_SIZE; j++)
+        {
+            if((unsigned)(words[i][j] - 'a') >= WS_WORD_LETTERS)
+            {
+                free(sorted_answers);
+                free(storage);
+                return 1;
+            }
+        }
+        packed_words[i] = ws_word_encode(words[i]);
+        letter_masks[i] = ws_word_letter_mask(packed_words[i]);
+        
+        flags[i] = WS_WORD_GUESS;
+        if(sorted_answers == NULL || bsearch(words[i], sorted_answers, (size_t)answer_entries, sizeof(*sorted_answers), compare_words))
+        {
+            flags[i] |= WS_WORD_ANSWER;
+            answer_list[answer_count++] = (uint32_t)i;
+        }
+        hash = ws_dictionary_hash(words[i], WORDLE_WORD_SIZE+1, hash);
+        hash = ws_dictionary_hash(&flags[i], 1, hash);
+    }
+    free(sorted_answers);
+    
+    dictionary->entries = entries;
+    dictionary->answer_entries = answer_count;
+    dictionary->words = packed_words;
+    dictionary->letter_masks = letter_masks;
+    dictionary->flags = flags;
+    dictionary->answers = answer_list;
+    dictionary->hash = hash;
+    dictionary->storage = storage;
+    if(ws_index_build(&dictionary->index, packed_words, entries))
+    {
+        ws_dictionary_release(dictionary);
+        return 1;
+    }
+    return 0;
+}
+
+static int compare_keys(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+/*
+ *  copy of a dictionary with its words grouped by the feedback they give the pivot (the start word), so the
+ *  candidates left after the first guess are one contiguous run of entries, and every later filter only
+ *  touches the few bitset blocks and words that run covers.  words keep their relative order within a group.
+ *  reordered->original maps every entry back to its entry in the source, returns nonzero if out of memory.
+ */
+int ws_dictionary_reorder(s_wordle_dictionary       *reordered,
+                          const s_wordle_dictionary *dictionary,
+                          uint32_t                  pivot)
+{
+    memset(reordered, 0, sizeof(s_wordle_dictionary));
+    
+    int entries = dictionary->entries;
+    size_t table_size = sizeof(uint32_t)*(size_t)entries;
+    uint8_t *storage = malloc(4*table_size + entries + 1);
+    uint64_t *keys = malloc(sizeof(uint64_t)*(size_t)(entries ? entries : 1));
+    if(!storage || !keys)
+    {
+        free(storage);
+        free(keys);
+        return 1;
+    }
+    uint32_t *packed_words = (uint32_t *)storage;
+    uint32_t *letter_masks = (uint32_t *)(storage + table_size);
+    uint32_t *answer_list = (uint32_t *)(storage + 2*table_size);
+    uint32_t *original = (uint32_t *)(storage + 3*table_size);
+    uint8_t *flags = storage + 4*table_size;
+    
+    for(int i=0; i<entries; i++)
+    {
+        keys[i] = (uint64_t)ws_word_feedback(pivot, dictionary->words[i], dictionary->letter_masks[i]) << 32 | (uint64_t)i;
+    }
+    qsort(keys, (size_t)entries, sizeof(uint64_t), compare_keys);
+    
+    int answer_count = 0;
+    for(int i=0; i<entries; i++)
+    {
+        uint32_t source = (uint32_t)keys[i];
+        packed_words[i] = dictionary->words[source];
+        letter_masks[i] = dictionary->letter_masks[source];
+        flags[i] = dictionary->flags[source];
+        original[i] = source;
+        if(flags[i] & WS_WORD_ANSWER)
+        {
+            answer_list[answer_count++] = (uint32_t)i;
+        }
+    }
+    free(keys);
+    
+    reordered->entries = entries;
+    reordered->answer_entries = answer_count;
+    reordered->words = packed_words;
+    reordered->letter_masks = letter_masks;
+    reordered->flags = flags;
+    reordered->answers = answer_list;
+    reordered->original = original;
+    reordered->hash = dictionary->hash;
+    reordered->storage = storage;
+    if(ws_index_build(&reordered->index, packed_words, entries))
+    {
+        ws_dictionary_release(reordered);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ *  write the dictionary and its tables in the compiled layout, along with the alphabet its words are in
+ *  unless that's English (NULL)
+ */
+int ws_dictionary_compile(const s_wordle_dictionary *dictionary,
+                          const char                *alphabet,
+                          const char                *path)
+{
+    if(alphabet != NULL && !strcmp(alphabet, WS_ALPHABET_ENGLISH))
+    {
+        alphabet = NULL;
+    }
+    
+    s_dictionary_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, WS_DICTIONARY_MAGIC, sizeof(header.magic));
+    header.version = WS_DICTIONARY_VERSION;
+    header.word_size = WORDLE_WORD_SIZE;
+    header.entries = (uint32_t)dictionary->entries;
+    header.answer_entries = (uint32_t)dictionary->answer_entries;
+    header.word_list_hash = dictionary->hash;
+    
+    size_t entries = (size_t)dictionary->entries;
+    const void *sections[] = {dictionary->words, dictionary->letter_masks, dictionary->flags, dictionary->answers, alphabet};
+    size_t sizes[] = {entries*sizeof(uint32_t), entries*sizeof(uint32_t), entries, (size_t)dictionary->answer_entries*sizeof(uint32_t),
+                      alphabet ? strlen(alphabet)+1 : 0};
+    uint64_t *offsets[] = {&header.words_offset, &header.letter_masks_offset, &header.flags_offset, &header.answers_offset,
+                           &header.alphabet_offset};
+    int section_count = alphabet ? 5 : 4;
+    
+    size_t offset = align_up(sizeof(header));
+    for(int i=0; i<section_count; i++)
+    {
+        *offsets[i] = offset;
+        offset = align_up(offset + sizes[i]);
+    }
+    header.file_size = offset;
+    
+    uint8_t *image = calloc(1, offset);
+    if(!image)
+    {
+        return 1;
+    }
+    for(int i=0; i<section_count; i++)
+    {
+        memcpy(image + *offsets[i], sections[i], sizes[i]);
+    }
+    header.hash = ws_dictionary_hash(image + sizeof(header), offset - sizeof(header), 0);
+    memcpy(image, &header, sizeof(header));
+    
+    FILE *fp = fopen(path, "wb");
+    if(!fp)
+    {
+        printf("couldn't write %s\n", path);
+        free(image);
+        return 1;
+    }
+    size_t written = fwrite(image, 1, offset, fp);
+    fclose(fp);
+    free(image);
+    
+    if(written != offset)
+    {
+        printf("couldn't write %s\n", path);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ *  map a compiled dictionary read only and point the dictionary straight at its sections.  everything is
+ *  checked before use since the solver indexes tables with these values, and the words have to have been
+ *  read with the same alphabet (NULL for English) since they're only letter indices.
+ */
+int ws_dictionary_map(s_wordle_dictionary *dictionary,
+                      const char          *alphabet,
+                      const char          *path)
+{
+    if(alphabet == NULL)
+    {
+        alphabet = WS_ALPHABET_ENGLISH;
+    }
+    
+    memset(dictionary, 0, sizeof(s_wordle_dictionary));
+    
+    int fd = open(path, O_RDONLY);
+    if(fd < 0)
+    {
+        printf("couldn't load %s\n", path);
+        return 1;
+    }
+    struct stat st;
+    if(fstat(fd, &st) || (size_t)st.st_size < sizeof(s_dictionary_header))
+    {
+        printf("%s is not a compiled dictionary\n", path);
+        close(fd);
+        return 1;
+    }
+    size_t size = (size_t)st.st_size;
+    uint8_t *image = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(image == MAP_FAILED)
+    {
+        printf("couldn't map %s\n", path);
+        return 1;
+    }
+    
+    const s_dictionary_header *header = (const s_dictionary_header *)image;
+    const char *problem = NULL;
+    if(memcmp(header->magic, WS_DICTIONARY_MAGIC, sizeof(header->magic)))
+    {
+        problem = "is not a compiled dictionary";
+    }
+    else if(header->version != WS_DICTIONARY_VERSION || header->word_size != WORDLE_WORD_SIZE)
+    {
+        problem = "was compiled for a different version";
+    }
+    else if(header->file_size != size || header->entries > MAX_DICTIONARY_SIZE || header->answer_entries > header->entries ||
+            header->words_offset + (uint64_t)header->entries*sizeof(uint32_t) > size ||
+            header->letter_masks_offset + (uint64_t)header->entries*sizeof(uint32_t) > size ||
+            header->flags_offset + (uint64_t)header->entries > size ||
+            header->answers_offset + (uint64_t)header->answer_entries*sizeof(uint32_t) > size ||
+            (header->words_offset | header->letter_masks_offset | header->answers_offset) % sizeof(uint32_t))
+    {
+        problem = "is truncated or malformed";
+    }
+    else if(ws_dictionary_hash(image + sizeof(s_dictionary_header), size - sizeof(s_dictionary_header), 0) != header->hash)
+    {
+        problem = "failed its integrity check";
+    }
+    else if(header->alphabet_offset >= size ||
+            (header->alphabet_offset && !memchr(image + header->alphabet_offset, 0, size - header->alphabet_offset)))
+    {
+        problem = "is truncated or malformed";
+    }
+    else if(strcmp(header->alphabet_offset ? (const char *)image + header->alphabet_offset : WS_ALPHABET_ENGLISH, alphabet))
+    {
+        problem = "was compiled for a different alphabet";
+    }
+    
+    if(problem == NULL)
+    {
+        dictionary->entries = (int)header->entries;
+        dictionary->answer_entries = (int)header->answer_entries;
+        dictionary->words = (const uint32_t *)(image + header->words_offset);
+        dictionary->letter_masks = (const uint32_t *)(image + header->letter_masks_offset);
+        dictionary->flags = image + header->flags_offset;
+        dictionary->answers = (const uint32_t *)(image + header->answers_offset);
+        dictionary->hash = header->word_list_hash;
+        
+        // the hash only proves the file is intact, not that whoever wrote it kept indexes in range
+        for(int i=0; i<dictionary->entries && problem == NULL; i++)
+        {
+            if(dictionary->words[i] >> (WS_WORD_LETTER_BITS*WORDLE_WORD_SIZE))
+            {
+                problem = "has a word out of range";
+            }
+            for(int j=0; j<WORDLE_WORD_SIZE; j++)
+            {
+                if(ws_word_letter(dictionary->words[i], j) >= WS_WORD_LETTERS)
+                {
+                    problem = "has a letter out of range";
+                }
+            }
+        }
+        for(int i=0; i<dictionary->answer_entries && problem == NULL; i++)
+        {
+            if(dictionary->answers[i] >= (uint32_t)dictionary->entries)
+            {
+                problem = "has an answer out of range";
+            }
+        }
+    }
+    
+    if(problem != NULL)
+    {
+        printf("%s %s\n", path, problem);
+        munmap(image, size);
+        memset(dictionary, 0, sizeof(s_wordle_dictionary));
+        return 1;
+    }
+    
+    dictionary->mapping = image;
+    dictionary->mapping_size = size;
+    if(ws_index_build(&dictionary->index, dictionary->words, dictionary->entries))
+    {
+        printf("couldn't index %s\n", path);
+        ws_dictionary_release(dictionary);
+        return 1;
+    }
+    return 0;
+}
+
+void ws_dictionary_release(s_wordle_dictionary *dictionary)
+{
+    if(dictionary->mapping != NULL)
+    {
+        munmap(dictionary->mapping, dictionary->mapping_size);
+    }
+    free(dictionary->storage);
+    ws_index_release(&dictionary->index);
+    memset(dictionary, 0, sizeof(s_wordle_dictionary));
+}
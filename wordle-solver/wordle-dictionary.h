@@ -0,0 +1,67 @@
+//
+//  wordle-dictionary.h
+//  wordle-solver
+//
+//  Builds s_wordle_dictionary from word lists and reads/writes compiled dictionary files.  A compiled
+//  dictionary holds the words and the per word tables in the layout the solver uses, so loading one is an
+//  mmap and a checksum with no parsing.  The bitset index isn't stored; it is built from the mapped words
+//  at load.
+//
+
+#ifndef wordle_dictionary_h
+#define wordle_dictionary_h
+
+#include "wordle-solver.h"
+
+#define WS_DICTIONARY_MAGIC         "WSDICT\r\n"
+#define WS_DICTIONARY_VERSION       2
+
+// sections start on cache line boundaries
+#define WS_DICTIONARY_ALIGN         64
+
+/*
+ *  compiled dictionary header, followed by the sections it points to.  all values are native endian.
+ */
+typedef struct s_dictionary_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t word_size;
+    uint32_t entries;
+    uint32_t answer_entries;
+    uint64_t words_offset;                  // uint32_t[entries] packed words
+    uint64_t letter_masks_offset;           // uint32_t[entries]
+    uint64_t flags_offset;                  // uint8_t[entries]
+    uint64_t answers_offset;                // uint32_t[answer_entries]
+    uint64_t file_size;
+    uint64_t hash;                          // FNV-1a of everything after the header
+    uint64_t word_list_hash;                // s_wordle_dictionary hash
+    uint64_t alphabet_offset;               // NUL terminated UTF-8 alphabet the words were read with, 0 for English
+    uint8_t  reserved[40];
+} s_dictionary_header;
+
+uint64_t ws_dictionary_hash(const void *data,
+                            size_t     size,
+                            uint64_t   hash);
+
+int ws_dictionary_build(s_wordle_dictionary *dictionary,
+                        const char          words[][WORDLE_WORD_SIZE+1],
+                        int                 entries,
+                        const char          answers[][WORDLE_WORD_SIZE+1],
+                        int                 answer_entries);
+
+int ws_dictionary_reorder(s_wordle_dictionary       *reordered,
+                          const s_wordle_dictionary *dictionary,
+                          uint32_t                  pivot);
+
+int ws_dictionary_compile(const s_wordle_dictionary *dictionary,
+                          const char                *alphabet,
+                          const char                *path);
+
+int ws_dictionary_map(s_wordle_dictionary *dictionary,
+                      const char          *alphabet,
+                      const char          *path);
+
+void ws_dictionary_release(s_wordle_dictionary *dictionary);
+
+#endif /* wordle_dictionary_h */
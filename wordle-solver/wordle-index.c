@@ -0,0 +1,82 @@
+//
+//  wordle-index.c
+//  wordle-solver
+//
+//  Inverted bitset index over the dictionary, see wordle-index.h.
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "wordle-index.h"
+
+/*
+ *  build every bitset for a list of packed words, returns nonzero if out of memory
+ */
+int ws_index_build(s_wordle_index *index,
+                   const uint32_t *words,
+                   int            entries)
+{
+    memset(index->letter_count, 0, sizeof(index->letter_count));
+    index->blocks = (entries+63)/64;
+    index->bits = calloc((size_t)WS_INDEX_SETS*(size_t)index->blocks, sizeof(uint64_t));
+    if(!index->bits)
+    {
+        index->blocks = 0;
+        return 1;
+    }
+    
+    for(int i=0; i<entries; i++)
+    {
+        int block = i/64;
+        uint64_t bit = 1ull << (i%64);
+        int counts[WS_WORD_LETTERS] = {0};
+        for(int j=0; j<WORDLE_WORD_SIZE; j++)
+        {
+            int letter = ws_word_letter(words[i], j);
+            ((uint64_t *)ws_index_at(index, j, letter))[block] |= bit;
+            index->letter_count[letter][j]++;
+            
+            // a word with the letter n times is in every threshold up to n
+            if(++counts[letter] <= WS_INDEX_MAX_COUNT)
+            {
+                ((uint64_t *)ws_index_at_least(index, letter, counts[letter]))[block] |= bit;
+            }
+        }
+    }
+    return 0;
+}
+
+/*
+ *  letter histogram of a set of entries straight from the bitsets, one AND and popcount per block for every
+ *  (location, letter) pair.  blocks with no entries are skipped, so this beats decoding words once the set
+ *  covers more than a few dozen words per block.
+ */
+void ws_index_histogram(const s_wordle_index *index,
+                        const uint64_t       *entries,
+                        int                  letter_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE])
+{
+    memset(letter_count, 0, sizeof(int)*WS_WORD_LETTERS*WORDLE_WORD_SIZE);
+    for(int b=0; b<index->blocks; b++)
+    {
+        uint64_t bits = entries[b];
+        if(!bits)
+        {
+            continue;
+        }
+        for(int j=0; j<WORDLE_WORD_SIZE; j++)
+        {
+            for(int l=0; l<WS_WORD_LETTERS; l++)
+            {
+                letter_count[l][j] += __builtin_popcountll(bits & ws_index_at(index, j, l)[b]);
+            }
+        }
+    }
+}
+
+void ws_index_release(s_wordle_index *index)
+{
+    free(index->bits);
+    index->bits = NULL;
+    index->blocks = 0;
+}
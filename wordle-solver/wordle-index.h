@@ -0,0 +1,60 @@
+//
+//  wordle-index.h
+//  wordle-solver
+//
+//  Inverted bitset index over the dictionary.  Every (location, letter) pair and every letter count threshold
+//  gets a bitset with one bit per dictionary entry, so the words matching a set of hints are found by ANDing
+//  and masking whole bitsets instead of testing words one at a time.
+//
+
+#ifndef wordle_index_h
+#define wordle_index_h
+
+#include <stdint.h>
+
+#include "wordle-word.h"
+
+// letter count thresholds indexed per letter: at least once, twice and three times
+#define WS_INDEX_MAX_COUNT          3
+
+#define WS_INDEX_AT_SETS            (WORDLE_WORD_SIZE*WS_WORD_LETTERS)
+#define WS_INDEX_SETS               (WS_INDEX_AT_SETS + WS_INDEX_MAX_COUNT*WS_WORD_LETTERS)
+
+typedef struct s_wordle_index
+{
+    int      blocks;                        // uint64_t words per bitset
+    uint64_t *bits;                         // WS_INDEX_SETS bitsets of blocks words each
+    int      letter_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE];    // entries with each letter at each location
+} s_wordle_index;
+
+/*
+ *  entries with letter (an alphabet index) at location
+ */
+static inline const uint64_t *ws_index_at(const s_wordle_index *index,
+                                          int                  location,
+                                          int                  letter)
+{
+    return index->bits + (size_t)(location*WS_WORD_LETTERS + letter)*(size_t)index->blocks;
+}
+
+/*
+ *  entries using letter at least count times, count is 1 to WS_INDEX_MAX_COUNT
+ */
+static inline const uint64_t *ws_index_at_least(const s_wordle_index *index,
+                                                int                  letter,
+                                                int                  count)
+{
+    return index->bits + (size_t)(WS_INDEX_AT_SETS + (count-1)*WS_WORD_LETTERS + letter)*(size_t)index->blocks;
+}
+
+int ws_index_build(s_wordle_index *index,
+                   const uint32_t *words,
+                   int            entries);
+
+void ws_index_histogram(const s_wordle_index *index,
+                        const uint64_t       *entries,
+                        int                  letter_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE]);
+
+void ws_index_release(s_wordle_index *index);
+
+#endif /* wordle_index_h */
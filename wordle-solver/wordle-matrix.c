@@ -0,0 +1,161 @@
+//
+//  wordle-matrix.c
+//  wordle-solver
+//
+//  Tiled feedback pattern matrix builder, see wordle-matrix.h.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "wordle-matrix.h"
+
+typedef struct s_matrix_job
+{
+    s_pattern_matrix          *matrix;
+    const s_wordle_dictionary *dictionary;
+    const uint32_t            *answer_words;    // answers gathered into one contiguous table
+    const uint32_t            *answer_masks;
+    int                       answer_tiles;
+    int                       tiles;
+    int                       *next_tile;       // shared, handed out one tile at a time
+} s_matrix_job;
+
+/*
+ *  one guess against a run of answers, ws_word_feedback() rearranged so the loop over answers vectorizes.
+ *  a placed letter is always in the word too, so a pattern is the sum of 3^location over guess letters found
+ *  anywhere in the answer plus the same sum again over letters in the right place.  xoring the words leaves
+ *  zero letters exactly where they match.
+ */
+void ws_pattern_row(uint32_t       guess,
+                    const uint32_t *answer_words,
+                    const uint32_t *answer_masks,
+                    int            count,
+                    uint8_t        *out)
+{
+    uint32_t letters[WORDLE_WORD_SIZE];
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        letters[j] = (uint32_t)ws_word_letter(guess, j);
+    }
+    
+    for(int a=0; a<count; a++)
+    {
+        uint32_t mask = answer_masks[a], matched = answer_words[a] ^ guess;
+        // written out per location, a loop over locations isn't unrolled and vectorized at -O2
+        #define IN_WORD(j)          ((mask >> letters[j]) & 1)
+        #define PLACED(j)           ((matched & (WS_WORD_LETTER_MASK << (WS_WORD_LETTER_BITS*(j)))) == 0)
+        uint32_t pattern = IN_WORD(0) + PLACED(0) + 3*(IN_WORD(1) + PLACED(1)) + 9*(IN_WORD(2) + PLACED(2)) +
+                           27*(IN_WORD(3) + PLACED(3)) + 81*(IN_WORD(4) + PLACED(4));
+        #undef IN_WORD
+        #undef PLACED
+        out[a] = (uint8_t)pattern;
+    }
+}
+
+static void *matrix_thread(void *arg)
+{
+    s_matrix_job *job = arg;
+    s_pattern_matrix *matrix = job->matrix;
+    
+    // tiles are claimed dynamically so a slow core doesn't hold everyone up at the end.  consecutive tiles walk
+    // the answer tiles of one guess tile first, so a thread's guesses stay put while the answers stream past.
+    for(;;)
+    {
+        int tile = __atomic_fetch_add(job->next_tile, 1, __ATOMIC_RELAXED);
+        if(tile >= job->tiles)
+        {
+            break;
+        }
+        int guess_start = (tile / job->answer_tiles)*WS_MATRIX_TILE_GUESSES;
+        int answer_start = (tile % job->answer_tiles)*WS_MATRIX_TILE_ANSWERS;
+        int guess_end = guess_start + WS_MATRIX_TILE_GUESSES;
+        int answer_count = matrix->answers - answer_start;
+        if(guess_end > matrix->guesses)
+        {
+            guess_end = matrix->guesses;
+        }
+        if(answer_count > WS_MATRIX_TILE_ANSWERS)
+        {
+            answer_count = WS_MATRIX_TILE_ANSWERS;
+        }
+        
+        for(int g=guess_start; g<guess_end; g++)
+        {
+            ws_pattern_row(job->dictionary->words[g],
+                           job->answer_words + answer_start,
+                           job->answer_masks + answer_start,
+                           answer_count,
+                           matrix->patterns + (size_t)g*(size_t)matrix->answers + (size_t)answer_start);
+        }
+    }
+    return NULL;
+}
+
+/*
+ *  build the matrix on up to threads threads, returns nonzero if out of memory
+ */
+int ws_matrix_build(s_pattern_matrix          *matrix,
+                    const s_wordle_dictionary *dictionary,
+                    int                       threads)
+{
+    uint64_t start = ws_now_ns();
+    
+    memset(matrix, 0, sizeof(s_pattern_matrix));
+    matrix->guesses = dictionary->entries;
+    matrix->answers = dictionary->answer_entries;
+    
+    size_t size = (size_t)matrix->guesses*(size_t)matrix->answers;
+    matrix->patterns = malloc(size ? size : 1);
+    uint32_t *answer_words = malloc(sizeof(uint32_t)*(size_t)(matrix->answers ? matrix->answers : 1));
+    uint32_t *answer_masks = malloc(sizeof(uint32_t)*(size_t)(matrix->answers ? matrix->answers : 1));
+    if(!matrix->patterns || !answer_words || !answer_masks)
+    {
+        free(answer_words);
+        free(answer_masks);
+        ws_matrix_release(matrix);
+        return 1;
+    }
+    for(int a=0; a<matrix->answers; a++)
+    {
+        answer_words[a] = dictionary->words[dictionary->answers[a]];
+        answer_masks[a] = dictionary->letter_masks[dictionary->answers[a]];
+    }
+    
+    int guess_tiles = (matrix->guesses + WS_MATRIX_TILE_GUESSES-1)/WS_MATRIX_TILE_GUESSES;
+    int answer_tiles = (matrix->answers + WS_MATRIX_TILE_ANSWERS-1)/WS_MATRIX_TILE_ANSWERS;
+    int next_tile = 0;
+    s_matrix_job job = {matrix, dictionary, answer_words, answer_masks, answer_tiles, guess_tiles*answer_tiles, &next_tile};
+    
+    if(threads > job.tiles)
+    {
+        threads = job.tiles > 0 ? job.tiles : 1;
+    }
+    // tiles are handed out as threads ask, so if some can't be started the rest just take longer
+    pthread_t thread_ids[threads];
+    int started = 1;
+    while(started < threads && pthread_create(&thread_ids[started], NULL, matrix_thread, &job) == 0)
+    {
+        started++;
+    }
+    matrix_thread(&job);
+    for(int t=1; t<started; t++)
+    {
+        pthread_join(thread_ids[t], NULL);
+    }
+    
+    free(answer_words);
+    free(answer_masks);
+    matrix->threads = started;
+    matrix->build_ns = ws_now_ns() - start;
+    return 0;
+}
+
+void ws_matrix_release(s_pattern_matrix *matrix)
+{
+    free(matrix->patterns);
+    matrix->patterns = NULL;
+    matrix->guesses = 0;
+    matrix->answers = 0;
+}
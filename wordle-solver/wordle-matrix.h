@@ -0,0 +1,50 @@
+//
+//  wordle-matrix.h
+//  wordle-solver
+//
+//  Feedback pattern matrix: the ws_feedback() pattern of every dictionary word as a guess against every
+//  answer, one byte each.  Built tile by tile across threads so each tile's answers stay in cache while
+//  every guess in the tile runs over them.
+//
+
+#ifndef wordle_matrix_h
+#define wordle_matrix_h
+
+#include "wordle-solver.h"
+
+// tile shape: answers per tile fit L1 (two uint32_t tables), guesses per tile keep the output tile in L2
+#define WS_MATRIX_TILE_ANSWERS      1024
+#define WS_MATRIX_TILE_GUESSES      64
+
+typedef struct s_pattern_matrix
+{
+    int            guesses;                 // rows, every dictionary entry
+    int            answers;                 // columns, dictionary->answers in order
+    uint8_t        *patterns;               // guesses*answers patterns, row major
+    int            threads;                 // threads the build ran on
+    uint64_t       build_ns;                // wall clock for the build
+} s_pattern_matrix;
+
+/*
+ *  pattern for dictionary entry guess against the answer-th answer
+ */
+static inline int ws_matrix_pattern(const s_pattern_matrix *matrix,
+                                    int                    guess,
+                                    int                    answer)
+{
+    return matrix->patterns[(size_t)guess*(size_t)matrix->answers + (size_t)answer];
+}
+
+void ws_pattern_row(uint32_t       guess,
+                    const uint32_t *answer_words,
+                    const uint32_t *answer_masks,
+                    int            count,
+                    uint8_t        *out);
+
+int ws_matrix_build(s_pattern_matrix          *matrix,
+                    const s_wordle_dictionary *dictionary,
+                    int                       threads);
+
+void ws_matrix_release(s_pattern_matrix *matrix);
+
+#endif /* wordle_matrix_h */
@@ -0,0 +1,145 @@
+//
+//  wordle-multi.c
+//  wordle-solver
+//
+//  Multi-board variants (Dordle/Quordle/Octordle) where every guess is played on all boards at once.
+//
+
+#include <string.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "wordle-multi.h"
+
+void ws_multi_init(s_multi_wordle_state *multi_state,
+                   int                  boards,
+                   const char           *start_guess)
+{
+    multi_state->boards = boards;
+    multi_state->starting_word[0] = 0;
+    if(start_guess != NULL && strlen(start_guess) == WORDLE_WORD_SIZE)
+    {
+        strcpy(multi_state->starting_word, start_guess);
+    }
+    for(int b=0; b<boards; b++)
+    {
+        // every board counts letters over its own candidates, as in hard mode
+        ws_init(&multi_state->board[b], NULL, true);
+        multi_state->solved[b] = false;
+    }
+}
+
+/*
+ *  pick a guess for all unsolved boards and play it, returns 1 once every board is solved.
+ *
+ *  every board's candidates are narrowed through the dictionary index, which keeps each board's letter
+ *  statistics up to date.  the guess comes from the board closest to being solved, scored by how common its
+ *  letters are across all boards, so solving one board still gathers hints for the rest.
+ */
+int ws_multi_make_guess(s_multi_wordle_state      *multi_state,
+                        const uint32_t            target_words[WS_MAX_BOARDS],
+                        const s_wordle_dictionary *dictionary,
+                        bool                      verbose)
+{
+    char guess[WORDLE_WORD_SIZE+1] = {0};
+    int blocks = (dictionary->entries+63)/64;
+    
+    if(strlen(multi_state->starting_word) == WORDLE_WORD_SIZE)
+    {
+        strcpy(guess, multi_state->starting_word);
+        memset(multi_state->starting_word, 0, WORDLE_WORD_SIZE+1);
+    }
+    else
+    {
+        int active[WS_MAX_BOARDS] = {0}, active_boards = 0;
+        
+        // narrow every board's candidates with the index, which also keeps each board's letter histogram current
+        WS_STAT_TIMER(filter_start);
+        WS_TRACE_EVENT(false, WS_TRACE_PHASE_BEGIN, WS_PHASE_FILTER);
+        for(int b=0; b<multi_state->boards; b++)
+        {
+            if(multi_state->solved[b])
+            {
+                continue;
+            }
+            s_wordle_state *board = &multi_state->board[b];
+            s_wordle_constraints constraints;
+            ws_build_constraints(board, &constraints);
+            ws_filter_candidates(board, &constraints, dictionary);
+            active[active_boards++] = b;
+        }
+        WS_TRACE_EVENT(false, WS_TRACE_PHASE_END, WS_PHASE_FILTER);
+        WS_STAT_PHASE(filter_start, WS_PHASE_FILTER);
+        
+        // guess from the most constrained board
+        int focus = 0;
+        for(int b=1; b<active_boards; b++)
+        {
+            if(multi_state->board[active[b]].candidate_count < multi_state->board[active[focus]].candidate_count)
+            {
+                focus = b;
+            }
+        }
+        s_wordle_state *focus_board = &multi_state->board[active[focus]];
+        
+        // score each of its candidates against every board in one go, normalizing by candidate count so
+        // boards with large candidate sets don't drown out the rest
+        WS_STAT_TIMER(score_start);
+        WS_TRACE_EVENT(false, WS_TRACE_PHASE_BEGIN, WS_PHASE_SCORE);
+        int i_guess = -1;
+        double max_score = -1.0;
+        for(int i=0; i<blocks; i++)
+        {
+            uint64_t bits = focus_board->candidates[i];
+            while(bits)
+            {
+                int w = i*64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+                
+                uint32_t word = dictionary->words[w];
+                double score = 0.0;
+                for(int b=0; b<active_boards; b++)
+                {
+                    int count = multi_state->board[active[b]].candidate_count;
+                    if(count == 0)
+                    {
+                        continue;
+                    }
+                    int board_score = 0;
+                    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+                    {
+                        board_score += multi_state->board[active[b]].letter_count[ws_word_letter(word, j)][j];
+                    }
+                    score += (double)board_score/(double)count;
+                }
+                // ties go to the earlier word in the list so a reordered dictionary plays the same game
+                if(score > max_score || (score == max_score &&
+                                         ws_entry_original(dictionary, w) < ws_entry_original(dictionary, i_guess)))
+                {
+                    max_score = score;
+                    i_guess = w;
+                }
+            }
+        }
+        WS_TRACE_EVENT(false, WS_TRACE_PHASE_END, WS_PHASE_SCORE);
+        WS_STAT_PHASE(score_start, WS_PHASE_SCORE);
+        ws_word_decode(dictionary->words[i_guess < 0 ? 0 : i_guess], guess);
+    }
+    
+    WS_TRACE_EVENT(verbose, WS_TRACE_GUESS, ws_word_encode(guess));
+    
+    int boards_solved = 0;
+    for(int b=0; b<multi_state->boards; b++)
+    {
+        if(!multi_state->solved[b])
+        {
+            if(ws_apply_guess(&multi_state->board[b], guess, target_words[b], verbose))
+            {
+                WS_TRACE_EVENT(verbose, WS_TRACE_BOARD_SOLVED, (uint32_t)b);
+                multi_state->solved[b] = true;
+            }
+        }
+        boards_solved += multi_state->solved[b];
+    }
+    return boards_solved == multi_state->boards;
+}
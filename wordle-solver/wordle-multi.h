@@ -0,0 +1,32 @@
+//
+//  wordle-multi.h
+//  wordle-solver
+//
+//  Multi-board variants (Dordle/Quordle/Octordle) where every guess is played on all boards at once.
+//
+
+#ifndef wordle_multi_h
+#define wordle_multi_h
+
+#include "wordle-solver.h"
+
+#define WS_MAX_BOARDS               8
+
+typedef struct s_multi_wordle_state
+{
+    char           starting_word[WORDLE_WORD_SIZE+1];
+    int            boards;
+    bool           solved[WS_MAX_BOARDS];
+    s_wordle_state board[WS_MAX_BOARDS];    // per board hints and candidate sets
+} s_multi_wordle_state;
+
+void ws_multi_init(s_multi_wordle_state *multi_state,
+                   int                  boards,
+                   const char           *start_guess);
+
+int ws_multi_make_guess(s_multi_wordle_state      *multi_state,
+                        const uint32_t            target_words[WS_MAX_BOARDS],
+                        const s_wordle_dictionary *dictionary,
+                        bool                      verbose);
+
+#endif /* wordle_multi_h */
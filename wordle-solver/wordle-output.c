@@ -0,0 +1,294 @@
+//
+//  wordle-output.c
+//  wordle-solver
+//
+//  Machine readable results (-results=file).  Records are formatted into large buffers that a background
+//  thread writes out, so the game loop never waits on the file.  If the thread can't be started the buffers
+//  are written as they fill instead.
+//
+//  CSV rows share one set of columns, the record column says which ones apply:
+//      record,start_word,target,guesses,sequence,games,average,wins
+//  start_word rows put the start word's hardest target and its guess count in the target and guesses columns.
+//  JSON Lines records carry only their own fields.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "wordle-output.h"
+#include "wordle-alphabet.h"
+
+// flush before a record could overrun the buffer, words are up to 4 bytes a letter in UTF-8
+#define WS_OUTPUT_MAX_RECORD        (64 + (WS_MAX_HISTORY+2)*(WS_ALPHABET_TEXT_SIZE+3))
+
+static struct
+{
+    FILE            *fp;
+    int             format;
+    char            *buffers[2];
+    int             active;
+    size_t          used;
+    
+    // handoff to the writer thread, one buffer in flight at a time.  without one, buffers are written in place
+    bool            threaded;
+    pthread_t       writer;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    char            *pending;
+    size_t          pending_size;
+    bool            done;
+} output;
+
+static void *output_writer_thread(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&output.lock);
+    while(true)
+    {
+        while(output.pending == NULL && !output.done)
+        {
+            pthread_cond_wait(&output.cond, &output.lock);
+        }
+        if(output.pending == NULL)
+        {
+            break;
+        }
+        char *buffer = output.pending;
+        size_t size = output.pending_size;
+        pthread_mutex_unlock(&output.lock);
+        
+        fwrite(buffer, 1, size, output.fp);
+        
+        pthread_mutex_lock(&output.lock);
+        output.pending = NULL;
+        pthread_cond_broadcast(&output.cond);
+    }
+    pthread_mutex_unlock(&output.lock);
+    return NULL;
+}
+
+/*
+ *  pass the active buffer to the writer and switch to the other one
+ */
+static void output_submit(void)
+{
+    if(!output.threaded)
+    {
+        fwrite(output.buffers[output.active], 1, output.used, output.fp);
+        output.used = 0;
+        return;
+    }
+    pthread_mutex_lock(&output.lock);
+    while(output.pending != NULL)
+    {
+        pthread_cond_wait(&output.cond, &output.lock);
+    }
+    output.pending = output.buffers[output.active];
+    output.pending_size = output.used;
+    pthread_cond_broadcast(&output.cond);
+    pthread_mutex_unlock(&output.lock);
+    
+    output.active ^= 1;
+    output.used = 0;
+}
+
+static void output_reserve(void)
+{
+    if(output.used + WS_OUTPUT_MAX_RECORD > WS_OUTPUT_BUFFER_SIZE)
+    {
+        output_submit();
+    }
+}
+
+static void output_text(const char *text)
+{
+    size_t length = strlen(text);
+    memcpy(&output.buffers[output.active][output.used], text, length);
+    output.used += length;
+}
+
+static void output_word(const char *word)
+{
+    if(ws_alphabet_current()->english)
+    {
+        memcpy(&output.buffers[output.active][output.used], word, WORDLE_WORD_SIZE);
+        output.used += WORDLE_WORD_SIZE;
+        return;
+    }
+    char text[WS_ALPHABET_TEXT_SIZE];
+    output_text(ws_alphabet_text(word, text));
+}
+
+static void output_number(int value)
+{
+    char digits[12];
+    int count = 0;
+    unsigned int magnitude = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+    do
+    {
+        digits[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while(magnitude);
+    if(value < 0)
+    {
+        digits[count++] = '-';
+    }
+    while(count)
+    {
+        output.buffers[output.active][output.used++] = digits[--count];
+    }
+}
+
+int ws_output_open(const char *path,
+                   int        format)
+{
+    output.fp = fopen(path, "w");
+    if(!output.fp)
+    {
+        printf("couldn't open %s for results\n", path);
+        return 1;
+    }
+    output.format = format;
+    output.buffers[0] = malloc(WS_OUTPUT_BUFFER_SIZE);
+    output.buffers[1] = malloc(WS_OUTPUT_BUFFER_SIZE);
+    if(!output.buffers[0] || !output.buffers[1])
+    {
+        printf("couldn't allocate result buffers\n");
+        fclose(output.fp);
+        output.fp = NULL;
+        return 1;
+    }
+    output.active = 0;
+    output.used = 0;
+    output.pending = NULL;
+    output.done = false;
+    pthread_mutex_init(&output.lock, NULL);
+    pthread_cond_init(&output.cond, NULL);
+    output.threaded = pthread_create(&output.writer, NULL, output_writer_thread, NULL) == 0;
+    
+    if(format == WS_OUTPUT_CSV)
+    {
+        output_text("record,start_word,target,guesses,sequence,games,average,wins\n");
+    }
+    return 0;
+}
+
+bool ws_output_is_open(void)
+{
+    return output.fp != NULL;
+}
+
+void ws_output_game(const char           *start_word,
+                    uint32_t             target_word,
+                    int                  guesses,
+                    const s_wordle_state *wordle_state)
+{
+    if(!output.fp)
+    {
+        return;
+    }
+    output_reserve();
+    
+    char target[WORDLE_WORD_SIZE+1];
+    ws_word_decode(target_word, target);
+    int recorded = wordle_state->turn < WS_MAX_HISTORY ? wordle_state->turn : WS_MAX_HISTORY;
+    if(output.format == WS_OUTPUT_CSV)
+    {
+        output_text("game,");
+        output_word(start_word);
+        output_text(",");
+        output_word(target);
+        output_text(",");
+        output_number(guesses);
+        output_text(",");
+        for(int i=0; i<recorded; i++)
+        {
+            if(i)
+            {
+                output_text(" ");
+            }
+            output_word(wordle_state->history[i]);
+        }
+        output_text(",,,\n");
+    }
+    else
+    {
+        output_text("{\"record\":\"game\",\"start_word\":\"");
+        output_word(start_word);
+        output_text("\",\"target\":\"");
+        output_word(target);
+        output_text("\",\"guesses\":");
+        output_number(guesses);
+        output_text(",\"sequence\":[");
+        for(int i=0; i<recorded; i++)
+        {
+            output_text(i ? ",\"" : "\"");
+            output_word(wordle_state->history[i]);
+            output_text("\"");
+        }
+        output_text("]}\n");
+    }
+}
+
+void ws_output_start_word(const char *start_word,
+                          int        games,
+                          double     average_guesses,
+                          int        max_guesses,
+                          const char *max_guess_word,
+                          int        wins)
+{
+    if(!output.fp)
+    {
+        return;
+    }
+    output_reserve();
+    
+    char *record = &output.buffers[output.active][output.used];
+    size_t room = WS_OUTPUT_BUFFER_SIZE - output.used;
+    char start_text[WS_ALPHABET_TEXT_SIZE], max_guess_text[WS_ALPHABET_TEXT_SIZE];
+    ws_alphabet_text(start_word, start_text);
+    ws_alphabet_text(max_guess_word, max_guess_text);
+    int length;
+    if(output.format == WS_OUTPUT_CSV)
+    {
+        length = snprintf(record, room, "start_word,%s,%s,%d,,%d,%f,%d\n",
+                          start_text, max_guess_text, max_guesses, games, average_guesses, wins);
+    }
+    else
+    {
+        length = snprintf(record, room, "{\"record\":\"start_word\",\"start_word\":\"%s\",\"games\":%d,\"average\":%f,"
+                          "\"max_guesses\":%d,\"max_guess_word\":\"%s\",\"wins\":%d}\n",
+                          start_text, games, average_guesses, max_guesses, max_guess_text, wins);
+    }
+    output.used += (size_t)length;
+}
+
+/*
+ *  write out whatever is buffered and stop the writer
+ */
+void ws_output_close(void)
+{
+    if(!output.fp)
+    {
+        return;
+    }
+    if(output.used)
+    {
+        output_submit();
+    }
+    if(output.threaded)
+    {
+        pthread_mutex_lock(&output.lock);
+        output.done = true;
+        pthread_cond_broadcast(&output.cond);
+        pthread_mutex_unlock(&output.lock);
+        pthread_join(output.writer, NULL);
+    }
+    
+    fclose(output.fp);
+    output.fp = NULL;
+    free(output.buffers[0]);
+    free(output.buffers[1]);
+}
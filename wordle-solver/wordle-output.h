@@ -0,0 +1,41 @@
+//
+//  wordle-output.h
+//  wordle-solver
+//
+//  Machine readable results (-results=file).  Records are formatted into large buffers that a background
+//  thread writes out, so the game loop never waits on the file.
+//
+
+#ifndef wordle_output_h
+#define wordle_output_h
+
+#include <stdbool.h>
+
+#include "wordle-solver.h"
+
+#define WS_OUTPUT_CSV               0
+#define WS_OUTPUT_JSONL             1
+
+// each buffer is handed to the writer once it fills
+#define WS_OUTPUT_BUFFER_SIZE       (1 << 20)
+
+int ws_output_open(const char *path,
+                   int        format);
+
+bool ws_output_is_open(void);
+
+void ws_output_game(const char           *start_word,
+                    uint32_t             target_word,
+                    int                  guesses,
+                    const s_wordle_state *wordle_state);
+
+void ws_output_start_word(const char *start_word,
+                          int        games,
+                          double     average_guesses,
+                          int        max_guesses,
+                          const char *max_guess_word,
+                          int        wins);
+
+void ws_output_close(void);
+
+#endif /* wordle_output_h */
@@ -0,0 +1,44 @@
+//
+//  wordle-partition.c
+//  wordle-solver
+//
+//  Guess deduplication, see wordle-partition.h.
+//
+
+#include <string.h>
+
+#include "wordle-partition.h"
+
+/*
+ *  forget every key, in constant time: the slots of older generations just stop counting.  a table has to be
+ *  cleared once before its first use too.
+ */
+void ws_partition_classes_clear(s_partition_classes *classes)
+{
+    if(++classes->generation == 0)
+    {
+        memset(classes->stamps, 0, sizeof(classes->stamps));
+        classes->generation = 1;
+    }
+}
+
+/*
+ *  add a class key, returns true if it's new since the last clear, false if a guess in its class was
+ *  already added
+ */
+bool ws_partition_classes_add(s_partition_classes *classes,
+                              uint32_t            key)
+{
+    uint32_t slot = ws_word_hash(key) & (WS_PARTITION_SLOTS-1);
+    while(classes->stamps[slot] == classes->generation)
+    {
+        if(classes->keys[slot] == key)
+        {
+            return false;
+        }
+        slot = (slot + 1) & (WS_PARTITION_SLOTS-1);
+    }
+    classes->stamps[slot] = classes->generation;
+    classes->keys[slot] = key;
+    return true;
+}
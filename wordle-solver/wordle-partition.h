@@ -0,0 +1,55 @@
+//
+//  wordle-partition.h
+//  wordle-solver
+//
+//  Guess deduplication by the partition of the candidates they induce.  A guess letter that no candidate uses
+//  always comes back absent, so two guesses that only differ in such letters give every candidate the same
+//  feedback and split the candidates the same way.  Masking those letters out gives a class key worked out
+//  without touching a candidate, and only one guess per key needs scoring.  A key with no letters left is a
+//  guess that tells nothing at all.
+//
+
+#ifndef wordle_partition_h
+#define wordle_partition_h
+
+#include <stdbool.h>
+
+#include "wordle-word.h"
+
+// stands in for letters no candidate uses, outside the WS_WORD_LETTERS letter range
+#define WS_PARTITION_DEAD_LETTER    WS_WORD_LETTER_MASK
+
+// every location masked, guesses that can only come back all absent
+#define WS_PARTITION_NO_INFORMATION 0x1ffffffu
+
+// table slots, twice the most keys a table is asked to hold so probes stay short
+#define WS_PARTITION_SLOTS          65536
+
+typedef struct s_partition_classes
+{
+    uint32_t keys[WS_PARTITION_SLOTS];
+    uint32_t stamps[WS_PARTITION_SLOTS];    // slot holds a key of this generation only if the stamps match
+    uint32_t generation;
+} s_partition_classes;
+
+/*
+ *  the guess with every letter not in live_letters (one bit per letter) masked out
+ */
+static inline uint32_t ws_partition_key(uint32_t word,
+                                        uint32_t live_letters)
+{
+    uint32_t key = 0;
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        uint32_t letter = (uint32_t)ws_word_letter(word, j);
+        key |= ((live_letters >> letter) & 1 ? letter : WS_PARTITION_DEAD_LETTER) << (WS_WORD_LETTER_BITS*j);
+    }
+    return key;
+}
+
+void ws_partition_classes_clear(s_partition_classes *classes);
+
+bool ws_partition_classes_add(s_partition_classes *classes,
+                              uint32_t            key);
+
+#endif /* wordle_partition_h */
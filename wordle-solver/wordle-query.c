@@ -0,0 +1,171 @@
+//
+//  wordle-query.c
+//  wordle-solver
+//
+//  Candidate queries for hints, see wordle-query.h.
+//
+
+#include "wordle-query.h"
+
+typedef struct s_query_rank
+{
+    int      score;
+    int      entry;
+    uint32_t original;      // position in the word list, for ties
+} s_query_rank;
+
+/*
+ *  true if a ranks ahead of b: higher score first, word list order on ties, as ws_choose_guess() breaks them
+ */
+static inline bool ranks_ahead(s_query_rank a,
+                               s_query_rank b)
+{
+    return a.score > b.score || (a.score == b.score && a.original < b.original);
+}
+
+/*
+ *  restore the heap below i, the root is the entry ranked last so it's the one a better entry replaces
+ */
+static void sift_down(s_query_rank *heap,
+                      int          count,
+                      int          i)
+{
+    for(;;)
+    {
+        int last = i, left = 2*i + 1, right = 2*i + 2;
+        if(left < count && ranks_ahead(heap[last], heap[left]))
+        {
+            last = left;
+        }
+        if(right < count && ranks_ahead(heap[last], heap[right]))
+        {
+            last = right;
+        }
+        if(last == i)
+        {
+            return;
+        }
+        s_query_rank swap = heap[i];
+        heap[i] = heap[last];
+        heap[last] = swap;
+        i = last;
+    }
+}
+
+/*
+ *  words still consistent with the hints.  only filters if a guess has been played since the last filter,
+ *  otherwise it's the count the solver keeps anyway.
+ */
+int ws_query_count(s_wordle_state            *wordle_state,
+                   const s_wordle_dictionary *dictionary)
+{
+    return ws_sync_candidates(wordle_state, dictionary);
+}
+
+/*
+ *  copy up to limit candidates starting at offset into page, returns the number copied.  dictionary order
+ *  skips whole blocks by popcount and stops once the page is full.  ranked order scores every candidate the
+ *  way the solver does but only keeps the best offset+limit in a heap, so early pages stay cheap.
+ */
+int ws_query_page(s_wordle_state            *wordle_state,
+                  const s_wordle_dictionary *dictionary,
+                  int                       order,
+                  int                       offset,
+                  int                       limit,
+                  s_query_word              *page)
+{
+    int candidate_count = ws_sync_candidates(wordle_state, dictionary);
+    if(offset < 0 || limit <= 0 || offset >= candidate_count)
+    {
+        return 0;
+    }
+    if(limit > candidate_count - offset)
+    {
+        limit = candidate_count - offset;
+    }
+    
+    const uint64_t *candidates = wordle_state->candidates;
+    int blocks = dictionary->index.blocks;
+    int count = 0;
+    
+    if(order == WS_QUERY_DICTIONARY)
+    {
+        int skip = offset;
+        for(int b=0; b<blocks && count<limit; b++)
+        {
+            uint64_t bits = candidates[b];
+            int bits_count = __builtin_popcountll(bits);
+            if(skip >= bits_count)
+            {
+                skip -= bits_count;
+                continue;
+            }
+            for(; skip>0; skip--)
+            {
+                bits &= bits - 1;
+            }
+            while(bits && count<limit)
+            {
+                int entry = b*64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+                ws_word_decode(dictionary->words[entry], page[count].word);
+                page[count].entry = entry;
+                page[count].score = 0;
+                count++;
+            }
+        }
+        return count;
+    }
+    
+    // the same scores ws_choose_guess() picks by, so the first ranked word is the solver's next guess
+    int letter_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE];
+    ws_letter_scores(wordle_state, dictionary, letter_count);
+    
+    static _Thread_local s_query_rank heap[MAX_DICTIONARY_SIZE];
+    int keep = offset + limit, heap_count = 0;
+    for(int b=0; b<blocks; b++)
+    {
+        uint64_t bits = candidates[b];
+        while(bits)
+        {
+            s_query_rank rank = {0, b*64 + __builtin_ctzll(bits), 0};
+            bits &= bits - 1;
+            rank.score = ws_word_score(letter_count, dictionary->words[rank.entry]);
+            rank.original = ws_entry_original(dictionary, rank.entry);
+            
+            if(heap_count < keep)
+            {
+                // move up while its parent ranks ahead of it, the root stays the entry ranked last
+                int i = heap_count++;
+                while(i > 0 && ranks_ahead(heap[(i-1)/2], rank))
+                {
+                    heap[i] = heap[(i-1)/2];
+                    i = (i-1)/2;
+                }
+                heap[i] = rank;
+            }
+            else if(ranks_ahead(rank, heap[0]))
+            {
+                heap[0] = rank;
+                sift_down(heap, heap_count, 0);
+            }
+        }
+    }
+    
+    // pops come out last ranked first, so the page fills from the back and the best offset entries are skipped
+    for(int i=heap_count-1; i>=0; i--)
+    {
+        s_query_rank rank = heap[0];
+        heap[0] = heap[i];
+        sift_down(heap, i, 0);
+        if(i >= offset)
+        {
+            s_query_word *word = &page[i-offset];
+            ws_word_decode(dictionary->words[rank.entry], word->word);
+            word->entry = rank.entry;
+            word->score = rank.score;
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,36 @@
+//
+//  wordle-query.h
+//  wordle-solver
+//
+//  Read only queries on a game in progress for hints: how many words are still possible and which ones, a
+//  page at a time.  Both run off the candidate bitset and letter histogram the solver already keeps, so
+//  nothing is copied and a query between guesses doesn't slow the next guess down.
+//
+
+#ifndef wordle_query_h
+#define wordle_query_h
+
+#include "wordle-solver.h"
+
+// page orders for ws_query_page()
+#define WS_QUERY_DICTIONARY         0       // dictionary order
+#define WS_QUERY_RANKED             1       // highest letter count score first, the order the solver would pick in
+
+typedef struct s_query_word
+{
+    char word[WORDLE_WORD_SIZE+1];
+    int  entry;                             // dictionary entry
+    int  score;                             // letter count score, 0 in dictionary order
+} s_query_word;
+
+int ws_query_count(s_wordle_state            *wordle_state,
+                   const s_wordle_dictionary *dictionary);
+
+int ws_query_page(s_wordle_state            *wordle_state,
+                  const s_wordle_dictionary *dictionary,
+                  int                       order,
+                  int                       offset,
+                  int                       limit,
+                  s_query_word              *page);
+
+#endif /* wordle_query_h */
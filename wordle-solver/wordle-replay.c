@@ -0,0 +1,723 @@
+//
+//  wordle-replay.c
+//  wordle-solver
+//
+//  Game log analysis, see wordle-replay.h.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "wordle-replay.h"
+#include "wordle-output.h"
+#include "wordle-alphabet.h"
+
+// first guesses whose split of the whole dictionary each thread remembers, openers repeat from game to game
+#define REPLAY_OPENER_SLOTS         1024
+
+// room kept free in a chunk's results for the next record
+#define REPLAY_RECORD_SIZE          256
+
+typedef struct s_replay_move
+{
+    char guess[WORDLE_WORD_SIZE+1];
+    int  pattern;                           // as the host scored it, repeated letters the way Wordle does
+} s_replay_move;
+
+// copies of each letter the feedback so far pins down, which the solver's own hints can't say
+typedef struct s_replay_counts
+{
+    uint8_t minimum[WS_WORD_LETTERS];
+    uint8_t maximum[WS_WORD_LETTERS];
+} s_replay_counts;
+
+// every game starts from the same state, so its numbers are worked out once
+typedef struct s_replay_opening
+{
+    int    candidates;
+    char   solver_guess[WORDLE_WORD_SIZE+1];
+    double solver_expected;
+} s_replay_opening;
+
+typedef struct s_replay_openers
+{
+    uint32_t keys[REPLAY_OPENER_SLOTS];     // packed guess plus one, zero for an empty slot
+    double   expected[REPLAY_OPENER_SLOTS];
+    int      count;
+} s_replay_openers;
+
+// one chunk's results, kept from batch to batch so the buffers are only grown
+typedef struct s_replay_slot
+{
+    char             *data;
+    size_t           used;
+    size_t           capacity;
+    int64_t          first_line;            // line number of the chunk's first line
+    s_replay_summary summary;
+    bool             failed;                // out of memory
+} s_replay_slot;
+
+typedef struct s_replay_job
+{
+    const s_wordle_dictionary *dictionary;
+    const s_replay_options    *options;
+    const s_replay_opening    *opening;
+    const char                *log;
+    size_t                    size;
+    size_t                    first_chunk;  // batch being replayed
+    int                       chunks;
+    s_replay_slot             *slots;
+    int                       *next_chunk;  // shared, chunks claimed within the batch
+} s_replay_job;
+
+typedef struct s_replay_worker
+{
+    s_replay_job     *job;
+    s_replay_openers *openers;
+} s_replay_worker;
+
+/*
+ *  where chunk i starts: the first line that starts at or past its nominal offset, so neighbouring chunks
+ *  agree on their boundary without looking at each other
+ */
+static size_t chunk_start(const char *log,
+                          size_t     size,
+                          size_t     chunk)
+{
+    size_t offset = chunk*WS_REPLAY_CHUNK_SIZE;
+    if(offset == 0)
+    {
+        return 0;
+    }
+    if(offset >= size)
+    {
+        return size;
+    }
+    const char *newline = memchr(log + offset - 1, '\n', size - (offset - 1));
+    return newline ? (size_t)(newline - log) + 1 : size;
+}
+
+static int64_t count_lines(const char *start,
+                           const char *end)
+{
+    int64_t lines = 0;
+    while(start < end && (start = memchr(start, '\n', (size_t)(end - start))) != NULL)
+    {
+        start++;
+        lines++;
+    }
+    return lines;
+}
+
+/*
+ *  feedback letters as a ws_feedback() pattern, -1 if any of them isn't feedback
+ */
+static int parse_feedback(const char *text)
+{
+    int pattern = 0;
+    for(int j=WORDLE_WORD_SIZE-1; j>=0; j--)
+    {
+        int digit;
+        switch(text[j])
+        {
+            case 'G': case 'g': case '2':
+                digit = WS_FEEDBACK_PLACED;
+                break;
+            case 'Y': case 'y': case '1':
+                digit = WS_FEEDBACK_IN_WORD;
+                break;
+            case '.': case '-': case '_': case 'B': case 'b': case 'X': case 'x': case '0':
+                digit = WS_FEEDBACK_ABSENT;
+                break;
+            default:
+                return -1;
+        }
+        pattern = pattern*3 + digit;
+    }
+    return pattern;
+}
+
+/*
+ *  split a line into moves, returns the number of moves, 0 for a line that isn't a game and -1 for one that
+ *  doesn't parse
+ */
+static int parse_game(const char    *line,
+                      const char    *end,
+                      s_replay_move moves[WS_MAX_HISTORY])
+{
+    int count = 0;
+    for(;;)
+    {
+        while(line < end && (*line == ' ' || *line == '\t' || *line == '\r'))
+        {
+            line++;
+        }
+        if(line == end)
+        {
+            return count;
+        }
+        if(*line == '#' && count == 0)
+        {
+            return 0;
+        }
+        
+        // guess:feedback, then the end of the line or a separator.  the guess is UTF-8 in the alphabet, so
+        // letters can be more than a byte
+        const char *colon = memchr(line, ':', (size_t)(end - line));
+        if(colon == NULL || end - colon < WORDLE_WORD_SIZE + 1 || count == WS_MAX_HISTORY ||
+           (count && moves[count-1].pattern == WS_FEEDBACK_SOLVED) ||
+           ws_alphabet_word(line, (size_t)(colon - line), moves[count].guess))
+        {
+            return -1;
+        }
+        moves[count].pattern = parse_feedback(colon + 1);
+        if(moves[count].pattern < 0)
+        {
+            return -1;
+        }
+        count++;
+        line = colon + 1 + WORDLE_WORD_SIZE;
+        if(line < end && *line != ' ' && *line != '\t' && *line != '\r')
+        {
+            return -1;
+        }
+    }
+}
+
+/*
+ *  candidates left on average after the guess, the sum of its bucket sizes squared over the candidates
+ */
+static double split_expected(uint32_t                  guess,
+                             const s_wordle_dictionary *dictionary,
+                             const uint16_t            *candidates,
+                             int                       count)
+{
+    int buckets[WS_FEEDBACK_PATTERNS] = {0};
+    for(int i=0; i<count; i++)
+    {
+        buckets[ws_entry_feedback(guess, dictionary, candidates[i])]++;
+    }
+    uint64_t sum = 0;
+    for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+    {
+        sum += (uint64_t)buckets[p]*(uint64_t)buckets[p];
+    }
+    return count ? (double)sum/count : 0.0;
+}
+
+static int gather_candidates(const s_wordle_state      *wordle_state,
+                             const s_wordle_dictionary *dictionary,
+                             uint16_t                  *candidates)
+{
+    int count = 0;
+    for(int b=0; b<(dictionary->entries+63)/64; b++)
+    {
+        uint64_t bits = wordle_state->candidates[b];
+        while(bits)
+        {
+            candidates[count++] = (uint16_t)(b*64 + __builtin_ctzll(bits));
+            bits &= bits - 1;
+        }
+    }
+    return count;
+}
+
+/*
+ *  Wordle marks a repeated guess letter Y only as often as the target has copies left over from the G ones
+ *  and grays the rest, where the solver's rule (ws_word_feedback) marks every copy Y.  returns the move's
+ *  feedback under the solver's rule, so it can go through ws_apply_feedback(), and adds what it says about
+ *  letter counts to counts: at least as many copies as were marked, and exactly that many if a copy was
+ *  grayed.  counted is set when that's more than the solver's hints say, a repeated letter marked at all.
+ */
+static int solver_pattern(const char      *guess,
+                          int             pattern,
+                          s_replay_counts *counts,
+                          bool            *counted)
+{
+    int marked[WS_WORD_LETTERS] = {0}, grayed[WS_WORD_LETTERS] = {0}, copies[WS_WORD_LETTERS] = {0};
+    int digits[WORDLE_WORD_SIZE];
+    for(int j=0; j<WORDLE_WORD_SIZE; j++, pattern /= 3)
+    {
+        int l = guess[j] - 'a';
+        digits[j] = pattern % 3;
+        marked[l] += digits[j] != WS_FEEDBACK_ABSENT;
+        grayed[l] += digits[j] == WS_FEEDBACK_ABSENT;
+        copies[l]++;
+    }
+    
+    int solver = 0;
+    *counted = false;
+    for(int j=WORDLE_WORD_SIZE-1; j>=0; j--)
+    {
+        int l = guess[j] - 'a';
+        int digit = digits[j] == WS_FEEDBACK_PLACED ? WS_FEEDBACK_PLACED :
+                    marked[l] ? WS_FEEDBACK_IN_WORD : WS_FEEDBACK_ABSENT;
+        solver = solver*3 + digit;
+        
+        // a lone letter says no more than the solver's hints do
+        if(copies[l] > 1 && marked[l])
+        {
+            *counted = true;
+            if(marked[l] > counts->minimum[l])
+            {
+                counts->minimum[l] = (uint8_t)marked[l];
+            }
+            if(grayed[l] && marked[l] < counts->maximum[l])
+            {
+                counts->maximum[l] = (uint8_t)marked[l];
+            }
+        }
+    }
+    return solver;
+}
+
+/*
+ *  drop the candidates that break the letter counts, after ws_sync_candidates() so the next turn's filter
+ *  only sees survivors of both.  returns the number left.
+ */
+static int filter_counts(s_wordle_state            *wordle_state,
+                         const s_wordle_dictionary *dictionary,
+                         const s_replay_counts     *counts)
+{
+    const s_wordle_index *index = &dictionary->index;
+    bool changed = false;
+    for(int l=0; l<WS_WORD_LETTERS; l++)
+    {
+        // the index counts up to WS_INDEX_MAX_COUNT copies, past that the limits are left looser
+        const uint64_t *at_least = counts->minimum[l] > 1 ?
+            ws_index_at_least(index, l, counts->minimum[l] < WS_INDEX_MAX_COUNT ? counts->minimum[l] :
+                                                                                     WS_INDEX_MAX_COUNT) : NULL;
+        const uint64_t *too_many = counts->maximum[l] < WS_INDEX_MAX_COUNT ?
+            ws_index_at_least(index, l, counts->maximum[l] + 1) : NULL;
+        if(!at_least && !too_many)
+        {
+            continue;
+        }
+        for(int b=0; b<index->blocks; b++)
+        {
+            uint64_t keep = wordle_state->candidates[b];
+            keep &= at_least ? at_least[b] : ~0ull;
+            keep &= too_many ? ~too_many[b] : ~0ull;
+            changed |= keep != wordle_state->candidates[b];
+            wordle_state->candidates[b] = keep;
+        }
+    }
+    if(changed)
+    {
+        int candidate_count = 0;
+        for(int b=0; b<index->blocks; b++)
+        {
+            candidate_count += __builtin_popcountll(wordle_state->candidates[b]);
+        }
+        wordle_state->candidate_count = candidate_count;
+        ws_index_histogram(index, wordle_state->candidates, wordle_state->letter_count);
+    }
+    return wordle_state->candidate_count;
+}
+
+static void format_feedback(int  pattern,
+                            char text[WORDLE_WORD_SIZE+1])
+{
+    for(int j=0; j<WORDLE_WORD_SIZE; j++, pattern /= 3)
+    {
+        text[j] = pattern % 3 == WS_FEEDBACK_PLACED ? 'G' : pattern % 3 == WS_FEEDBACK_IN_WORD ? 'Y' : '.';
+    }
+    text[WORDLE_WORD_SIZE] = 0;
+}
+
+static bool slot_reserve(s_replay_slot *slot)
+{
+    if(slot->capacity - slot->used >= REPLAY_RECORD_SIZE)
+    {
+        return true;
+    }
+    size_t capacity = slot->capacity ? slot->capacity*2 : WS_REPLAY_CHUNK_SIZE;
+    char *data = realloc(slot->data, capacity);
+    if(data == NULL)
+    {
+        slot->failed = true;
+        return false;
+    }
+    slot->data = data;
+    slot->capacity = capacity;
+    return true;
+}
+
+/*
+ *  replay one game, appending a record per move.  a game whose feedback no candidate fits (a target missing
+ *  from the dictionary, or a mistyped log) is taken back out and counted as contradicted.
+ */
+static void replay_game(s_replay_worker     *worker,
+                        s_replay_slot       *slot,
+                        int64_t             line_number,
+                        const s_replay_move *moves,
+                        int                 count)
+{
+    static _Thread_local uint16_t candidates[MAX_DICTIONARY_SIZE];
+    const s_wordle_dictionary *dictionary = worker->job->dictionary;
+    const s_replay_options *options = worker->job->options;
+    const s_replay_opening *opening = worker->job->opening;
+    s_wordle_state wordle_state;
+    ws_init(&wordle_state, NULL, options->hard_mode);
+    s_replay_counts counts;
+    memset(counts.minimum, 0, sizeof(counts.minimum));
+    memset(counts.maximum, WORDLE_WORD_SIZE, sizeof(counts.maximum));
+    s_replay_summary game = {0};
+    size_t game_start = slot->used;
+    
+    int before = opening->candidates;
+    for(int m=0; m<count; m++)
+    {
+        uint32_t guess = ws_word_encode(moves[m].guess);
+        char solver_guess[WORDLE_WORD_SIZE+1] = "";
+        double expected = -1.0, solver_expected = 0.0;
+        int gathered = -1;
+        
+        if(m == 0)
+        {
+            // openers come up again and again, so their split of the whole dictionary is remembered
+            strcpy(solver_guess, opening->solver_guess);
+            solver_expected = opening->solver_expected;
+            uint32_t slot_index = ws_word_hash(guess) & (REPLAY_OPENER_SLOTS-1);
+            s_replay_openers *openers = worker->openers;
+            while(openers->keys[slot_index] && openers->keys[slot_index] != guess + 1)
+            {
+                slot_index = (slot_index + 1) & (REPLAY_OPENER_SLOTS-1);
+            }
+            if(openers->keys[slot_index])
+            {
+                expected = openers->expected[slot_index];
+            }
+            else
+            {
+                ws_sync_candidates(&wordle_state, dictionary);
+                gathered = gather_candidates(&wordle_state, dictionary, candidates);
+                expected = split_expected(guess, dictionary, candidates, gathered);
+                
+                // a full table just stops remembering, the probe always has an empty slot to stop at
+                if(openers->count < REPLAY_OPENER_SLOTS/2)
+                {
+                    openers->keys[slot_index] = guess + 1;
+                    openers->expected[slot_index] = expected;
+                    openers->count++;
+                }
+            }
+        }
+        else if(before)
+        {
+            ws_choose_guess(&wordle_state, dictionary, solver_guess, false);
+            gathered = gather_candidates(&wordle_state, dictionary, candidates);
+            solver_expected = split_expected(ws_word_encode(solver_guess), dictionary, candidates, gathered);
+            expected = split_expected(guess, dictionary, candidates, gathered);
+        }
+        else
+        {
+            expected = 0.0;
+        }
+        
+        s_wordle_constraints constraints;
+        ws_build_constraints(&wordle_state, &constraints);
+        bool consistent = before && ws_word_matches(&constraints, moves[m].guess);
+        int copies[WS_WORD_LETTERS] = {0};
+        for(int j=0; j<WORDLE_WORD_SIZE; j++)
+        {
+            copies[moves[m].guess[j]-'a']++;
+        }
+        for(int l=0; l<WS_WORD_LETTERS; l++)
+        {
+            consistent &= copies[l] >= counts.minimum[l];
+        }
+        
+        bool counted;
+        int pattern = solver_pattern(moves[m].guess, moves[m].pattern, &counts, &counted);
+        ws_apply_feedback(&wordle_state, moves[m].guess, pattern, false);
+        
+        // a solved move filters too, down to the guess if the earlier feedback allowed it
+        int after = ws_sync_candidates(&wordle_state, dictionary);
+        if(counted)
+        {
+            after = filter_counts(&wordle_state, dictionary, &counts);
+        }
+        if(after == 0)
+        {
+            slot->used = game_start;
+            slot->summary.contradicted++;
+            return;
+        }
+        
+        game.moves++;
+        game.solver_moves += !strcmp(solver_guess, moves[m].guess);
+        game.consistent_moves += consistent;
+        game.player_expected += expected;
+        game.solver_expected += solver_expected;
+        
+        if(options->results_path != NULL && slot_reserve(slot))
+        {
+            char feedback[WORDLE_WORD_SIZE+1];
+            format_feedback(moves[m].pattern, feedback);
+            char guess_text[WS_ALPHABET_TEXT_SIZE], solver_text[WS_ALPHABET_TEXT_SIZE] = "";
+            ws_alphabet_text(moves[m].guess, guess_text);
+            if(solver_guess[0])
+            {
+                ws_alphabet_text(solver_guess, solver_text);
+            }
+            char *record = &slot->data[slot->used];
+            size_t room = slot->capacity - slot->used;
+            int length;
+            if(options->format == WS_OUTPUT_CSV)
+            {
+                length = snprintf(record, room, "%lld,%d,%s,%s,%d,%d,%d,%.3f,%s,%.3f\n",
+                                  (long long)line_number, m+1, guess_text, feedback, before, after,
+                                  consistent, expected, solver_text, solver_expected);
+            }
+            else
+            {
+                length = snprintf(record, room, "{\"line\":%lld,\"move\":%d,\"guess\":\"%s\",\"feedback\":\"%s\","
+                                  "\"candidates\":%d,\"candidates_after\":%d,\"consistent\":%s,\"expected\":%.3f,"
+                                  "\"solver_guess\":\"%s\",\"solver_expected\":%.3f}\n",
+                                  (long long)line_number, m+1, guess_text, feedback, before, after,
+                                  consistent ? "true" : "false", expected, solver_text, solver_expected);
+            }
+            slot->used += (size_t)length;
+        }
+        before = after;
+    }
+    slot->summary.games++;
+    slot->summary.moves += game.moves;
+    slot->summary.solver_moves += game.solver_moves;
+    slot->summary.consistent_moves += game.consistent_moves;
+    slot->summary.player_expected += game.player_expected;
+    slot->summary.solver_expected += game.solver_expected;
+}
+
+static void *replay_thread(void *arg)
+{
+    s_replay_worker *worker = arg;
+    s_replay_job *job = worker->job;
+    s_replay_move moves[WS_MAX_HISTORY];
+    
+    for(;;)
+    {
+        int c = __atomic_fetch_add(job->next_chunk, 1, __ATOMIC_RELAXED);
+        if(c >= job->chunks)
+        {
+            break;
+        }
+        s_replay_slot *slot = &job->slots[c];
+        const char *line = job->log + chunk_start(job->log, job->size, job->first_chunk + (size_t)c);
+        const char *end = job->log + chunk_start(job->log, job->size, job->first_chunk + (size_t)c + 1);
+        int64_t line_number = slot->first_line;
+        
+        while(line < end)
+        {
+            const char *line_end = memchr(line, '\n', (size_t)(end - line));
+            if(line_end == NULL)
+            {
+                line_end = end;
+            }
+            int count = parse_game(line, line_end, moves);
+            if(count < 0)
+            {
+                slot->summary.skipped++;
+            }
+            else if(count)
+            {
+                replay_game(worker, slot, line_number, moves, count);
+            }
+            line = line_end + 1;
+            line_number++;
+        }
+    }
+    return NULL;
+}
+
+/*
+ *  the state every game starts from, with the solver's opener and its split
+ */
+static void replay_opening(const s_wordle_dictionary *dictionary,
+                           bool                      hard_mode,
+                           s_replay_opening          *opening)
+{
+    static uint16_t candidates[MAX_DICTIONARY_SIZE];
+    s_wordle_state wordle_state;
+    ws_init(&wordle_state, NULL, hard_mode);
+    ws_choose_guess(&wordle_state, dictionary, opening->solver_guess, false);
+    opening->candidates = gather_candidates(&wordle_state, dictionary, candidates);
+    opening->solver_expected = split_expected(ws_word_encode(opening->solver_guess), dictionary, candidates,
+                                              opening->candidates);
+}
+
+/*
+ *  replay every game in the log, writing a record per move to options->results_path in log order
+ */
+int ws_replay_log(const s_wordle_dictionary *dictionary,
+                  const char                *log_path,
+                  const s_replay_options    *options,
+                  s_replay_summary          *summary)
+{
+    memset(summary, 0, sizeof(*summary));
+    int fd = open(log_path, O_RDONLY);
+    if(fd < 0)
+    {
+        printf("couldn't load %s\n", log_path);
+        return 1;
+    }
+    struct stat st;
+    if(fstat(fd, &st))
+    {
+        printf("couldn't load %s\n", log_path);
+        close(fd);
+        return 1;
+    }
+    size_t size = (size_t)st.st_size;
+    const char *log = NULL;
+    if(size)
+    {
+        log = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(log == MAP_FAILED)
+        {
+            printf("couldn't map %s\n", log_path);
+            close(fd);
+            return 1;
+        }
+        madvise((void *)log, size, MADV_SEQUENTIAL);
+    }
+    close(fd);
+    
+    FILE *fp = NULL;
+    if(options->results_path != NULL)
+    {
+        fp = fopen(options->results_path, "w");
+        if(!fp)
+        {
+            printf("couldn't open %s for results\n", options->results_path);
+            if(log)
+            {
+                munmap((void *)log, size);
+            }
+            return 1;
+        }
+        if(options->format == WS_OUTPUT_CSV)
+        {
+            fputs("line,move,guess,feedback,candidates,candidates_after,consistent,expected,solver_guess,solver_expected\n", fp);
+        }
+    }
+    
+    uint64_t start_ns = ws_now_ns();
+    s_replay_opening opening;
+    replay_opening(dictionary, options->hard_mode, &opening);
+    
+    int threads = options->threads < 1 ? 1 : options->threads;
+    int batch = threads*WS_REPLAY_BATCH_CHUNKS;
+    s_replay_slot *slots = calloc((size_t)batch, sizeof(s_replay_slot));
+    s_replay_openers *openers = calloc((size_t)threads, sizeof(s_replay_openers));
+    s_replay_worker *workers = calloc((size_t)threads, sizeof(s_replay_worker));
+    if(!slots || !openers || !workers)
+    {
+        printf("out of memory for the replay\n");
+        free(slots);
+        free(openers);
+        free(workers);
+        if(fp)
+        {
+            fclose(fp);
+        }
+        if(log)
+        {
+            munmap((void *)log, size);
+        }
+        return 1;
+    }
+    
+    // batches of chunks replay in parallel, then the main thread writes their results in order before the
+    // next batch starts, so memory stays bounded by the batch however long the log is
+    int failed = 0;
+    size_t chunks = (size + WS_REPLAY_CHUNK_SIZE - 1)/WS_REPLAY_CHUNK_SIZE;
+    int64_t line_number = 1;
+    for(size_t first_chunk=0; first_chunk<chunks && !failed; first_chunk+=(size_t)batch)
+    {
+        int batch_chunks = chunks - first_chunk < (size_t)batch ? (int)(chunks - first_chunk) : batch;
+        for(int c=0; c<batch_chunks; c++)
+        {
+            slots[c].used = 0;
+            slots[c].first_line = line_number;
+            memset(&slots[c].summary, 0, sizeof(slots[c].summary));
+            line_number += count_lines(log + chunk_start(log, size, first_chunk + (size_t)c),
+                                       log + chunk_start(log, size, first_chunk + (size_t)c + 1));
+        }
+        
+        int next_chunk = 0;
+        s_replay_job job = {dictionary, options, &opening, log, size, first_chunk, batch_chunks, slots, &next_chunk};
+        int batch_threads = batch_chunks < threads ? batch_chunks : threads;
+        pthread_t thread_ids[batch_threads];
+        int started = 0;
+        for(int t=0; t<batch_threads; t++)
+        {
+            workers[t].job = &job;
+            workers[t].openers = &openers[t];
+        }
+        while(started < batch_threads && pthread_create(&thread_ids[started], NULL, replay_thread, &workers[started]) == 0)
+        {
+            started++;
+        }
+        
+        // chunks are handed out as workers ask, so if some can't be started this thread joins in as the next
+        if(started < batch_threads)
+        {
+            replay_thread(&workers[started]);
+        }
+        for(int t=0; t<started; t++)
+        {
+            pthread_join(thread_ids[t], NULL);
+        }
+        
+        for(int c=0; c<batch_chunks; c++)
+        {
+            if(slots[c].failed)
+            {
+                printf("out of memory for replay results\n");
+                failed = 1;
+                break;
+            }
+            if(fp && slots[c].used && fwrite(slots[c].data, 1, slots[c].used, fp) != slots[c].used)
+            {
+                printf("couldn't write %s\n", options->results_path);
+                failed = 1;
+                break;
+            }
+            summary->games += slots[c].summary.games;
+            summary->moves += slots[c].summary.moves;
+            summary->skipped += slots[c].summary.skipped;
+            summary->contradicted += slots[c].summary.contradicted;
+            summary->solver_moves += slots[c].summary.solver_moves;
+            summary->consistent_moves += slots[c].summary.consistent_moves;
+            summary->player_expected += slots[c].summary.player_expected;
+            summary->solver_expected += slots[c].summary.solver_expected;
+        }
+    }
+    summary->ns = ws_now_ns() - start_ns;
+    
+    for(int c=0; c<batch; c++)
+    {
+        free(slots[c].data);
+    }
+    free(slots);
+    free(openers);
+    free(workers);
+    if(fp && fclose(fp) && !failed)
+    {
+        printf("couldn't write %s\n", options->results_path);
+        failed = 1;
+    }
+    if(log)
+    {
+        munmap((void *)log, size);
+    }
+    return failed;
+}
@@ -0,0 +1,53 @@
+//
+//  wordle-replay.h
+//  wordle-solver
+//
+//  Game log analysis.  A log has one game per line, each move a guess and its feedback as guess:feedback
+//  separated by spaces, e.g. "roate:..Y.G lunch:GG---".  Feedback is G (or g, 2) for placed, Y (or y, 1)
+//  for in the word and anything of . - _ B b X x 0 for absent.  Blank lines and lines starting with # are
+//  skipped.  Repeated letters are scored the way Wordle does, a gray copy meaning the target has no more
+//  copies than were marked.  Every game is replayed through ws_apply_feedback(), with those letter counts
+//  filtered on top, and each move gets the candidates before and after it, the solver's own pick from the same state and how many candidates each of the two
+//  guesses would leave on average.  A game whose feedback leaves no candidates is counted as contradicted
+//  instead of being written out.  The log is mapped and split into chunks that threads replay in
+//  parallel, and each batch of chunks is written out in log order.
+//
+
+#ifndef wordle_replay_h
+#define wordle_replay_h
+
+#include "wordle-solver.h"
+
+// bytes of log per work item, chunks start and end on line boundaries
+#define WS_REPLAY_CHUNK_SIZE        (1 << 20)
+
+// chunks per thread in flight, results are held in memory until their whole batch is written
+#define WS_REPLAY_BATCH_CHUNKS      4
+
+typedef struct s_replay_options
+{
+    const char *results_path;               // per move records, NULL for the summary only
+    int        format;                      // WS_OUTPUT_CSV or WS_OUTPUT_JSONL
+    int        threads;
+    bool       hard_mode;                   // the solver scores letters over the candidates
+} s_replay_options;
+
+typedef struct s_replay_summary
+{
+    int64_t  games;
+    int64_t  moves;
+    int64_t  skipped;                       // lines that didn't parse
+    int64_t  contradicted;                  // games whose feedback no candidate fits, left out of the rest
+    int64_t  solver_moves;                  // moves where the player guessed what the solver would have
+    int64_t  consistent_moves;              // moves where the player's guess honored every hint so far
+    double   player_expected;               // summed over moves, candidates left on average after the guess
+    double   solver_expected;               // same for the solver's pick
+    uint64_t ns;
+} s_replay_summary;
+
+int ws_replay_log(const s_wordle_dictionary *dictionary,
+                  const char                *log_path,
+                  const s_replay_options    *options,
+                  s_replay_summary          *summary);
+
+#endif /* wordle_replay_h */
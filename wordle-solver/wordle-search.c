@@ -0,0 +1,318 @@
+//
+//  wordle-search.c
+//  wordle-solver
+//
+//  Anytime guess search, see wordle-search.h.
+//
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "wordle-search.h"
+#include "wordle-partition.h"
+
+typedef struct s_search_order
+{
+    int     entry;
+    int     score;
+    int     rank;                               // position in letter count order, which settles ties
+    int64_t bound;                              // split_score() can't be lower than this
+} s_search_order;
+
+/*
+ *  highest letter count score first, word list order on ties (rank holds the word list entry while sorting) so the
+ *  heuristic's own pick sorts ahead of its equals
+ */
+static int compare_order(const void *a, const void *b)
+{
+    const s_search_order *x = a, *y = b;
+    if(x->score != y->score)
+    {
+        return x->score > y->score ? -1 : 1;
+    }
+    return x->rank - y->rank;
+}
+
+/*
+ *  smallest bound first, letter count order among equals
+ */
+static int compare_bound(const void *a, const void *b)
+{
+    const s_search_order *x = a, *y = b;
+    if(x->bound != y->bound)
+    {
+        return x->bound < y->bound ? -1 : 1;
+    }
+    return x->rank - y->rank;
+}
+
+/*
+ *  least possible sum of squares for count words in at most buckets buckets, as even as they can be
+ */
+static int64_t even_split(int64_t count,
+                          int64_t buckets)
+{
+    int64_t size = count/buckets, larger = count%buckets;
+    return larger*(size+1)*(size+1) + (buckets-larger)*size*size;
+}
+
+/*
+ *  lower bound on split_score() from the candidates' letter histogram (at_count, by location) and how many
+ *  candidates use each letter (word_count).  each location's feedback can only be placed if some candidate has
+ *  the letter there and in word if some candidate has it but not there.  absent needs a candidate without the
+ *  letter at all (candidate_count > word_count), but it's counted whenever some candidate lacks it there
+ *  (candidate_count > placed): that allows more outcomes, so the bound is only looser, and budgeted games depend
+ *  on the order it gives.  the product of the outcomes bounds the buckets.  candidates with none of the guess's
+ *  letters all share the all absent bucket, and there are at least as many of those as the letters' counts
+ *  leave uncovered.
+ */
+static int64_t split_bound(uint32_t  guess,
+                           const int at_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE],
+                           const int word_count[WS_WORD_LETTERS],
+                           int       candidate_count)
+{
+    int64_t patterns = 1;
+    int covered = 0;
+    uint32_t seen = 0;
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        int letter = ws_word_letter(guess, j), placed = at_count[letter][j];
+        patterns *= (placed > 0) + (word_count[letter] > placed) + (candidate_count > placed);
+        if(!(seen & (1u << letter)))
+        {
+            seen |= 1u << letter;
+            covered += word_count[letter];
+        }
+    }
+    int64_t buckets = patterns < candidate_count ? patterns : candidate_count;
+    
+    // a big enough all absent bucket only gets worse as it grows, so its least size gives the bound
+    int64_t absent = candidate_count - covered;
+    if(absent > 0 && buckets > 1 && absent >= (candidate_count - absent + buckets-2)/(buckets-1))
+    {
+        return absent*absent + even_split(candidate_count - absent, buckets-1);
+    }
+    return even_split(candidate_count, buckets);
+}
+
+/*
+ *  sum of squared bucket sizes when the guess splits the candidates by feedback, which is the expected number of
+ *  candidates left times the number of candidates.  lower is better.
+ */
+static int64_t split_score(const s_wordle_dictionary *dictionary,
+                           uint32_t                  guess,
+                           const int                 *candidates,
+                           int                       candidate_count)
+{
+    int bucket_counts[WS_FEEDBACK_PATTERNS] = {0};
+    for(int i=0; i<candidate_count; i++)
+    {
+        bucket_counts[ws_entry_feedback(guess, dictionary, candidates[i])]++;
+    }
+    int64_t score = 0;
+    for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+    {
+        score += (int64_t)bucket_counts[p]*bucket_counts[p];
+    }
+    return score;
+}
+
+/*
+ *  pick the next guess within the budget, returns true if every letter is already known (result->guess holds
+ *  the word).  the letter count heuristic's pick is the fallback, so even a budget too small to score a single
+ *  guess returns something sensible.  hard mode only searches the candidates, otherwise every dictionary word
+ *  can be the guess.
+ */
+bool ws_search_guess(s_wordle_state            *wordle_state,
+                     const s_wordle_dictionary *dictionary,
+                     const s_search_budget     *budget,
+                     s_search_result           *result,
+                     bool                      verbose)
+{
+    uint64_t deadline = budget->time_ns ? ws_now_ns() + budget->time_ns : 0;
+    bool seeded = strlen(wordle_state->starting_word) == WORDLE_WORD_SIZE;
+    
+    memset(result, 0, sizeof(s_search_result));
+    if(ws_choose_guess(wordle_state, dictionary, result->guess, verbose))
+    {
+        result->complete = true;
+        return true;
+    }
+    if(seeded)
+    {
+        // the start word is a choice, not something to search
+        result->complete = true;
+        return false;
+    }
+    
+    // the heuristic has just brought the candidates up to date
+    const uint64_t *matches = wordle_state->candidates;
+    static _Thread_local int candidates[MAX_DICTIONARY_SIZE];
+    int candidate_count = 0;
+    for(int b=0; b<dictionary->index.blocks; b++)
+    {
+        uint64_t bits = matches[b];
+        while(bits)
+        {
+            candidates[candidate_count++] = b*64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+        }
+    }
+    result->candidates = candidate_count;
+    if(candidate_count <= 2)
+    {
+        // any candidate splits one or two words as well as anything can
+        result->complete = true;
+        return false;
+    }
+    
+    // promising first: the heuristic's pick, then by how common each word's letters are among the candidates
+    int letter_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE];
+    memcpy(letter_count, wordle_state->letter_count, sizeof(letter_count));
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        if(wordle_state->word[j].letter != '_')
+        {
+            for(int l=0; l<WS_WORD_LETTERS; l++)
+            {
+                letter_count[l][j] = 0;
+            }
+        }
+    }
+    int word_count[WS_WORD_LETTERS] = {0};
+    uint32_t live_letters = 0;
+    for(int i=0; i<candidate_count; i++)
+    {
+        uint32_t mask = dictionary->letter_masks[candidates[i]];
+        live_letters |= mask;
+        while(mask)
+        {
+            word_count[__builtin_ctz(mask)]++;
+            mask &= mask - 1;
+        }
+    }
+    
+    static _Thread_local s_search_order order[MAX_DICTIONARY_SIZE];
+    int order_count = 0;
+    uint32_t heuristic = ws_word_encode(result->guess);
+    if(wordle_state->hard_mode)
+    {
+        for(int i=0; i<candidate_count; i++)
+        {
+            order[order_count++].entry = candidates[i];
+        }
+    }
+    else
+    {
+        for(int i=0; i<dictionary->entries; i++)
+        {
+            order[order_count++].entry = i;
+        }
+    }
+    for(int i=0; i<order_count; i++)
+    {
+        uint32_t word = dictionary->words[order[i].entry];
+        int score = 0;
+        for(int j=0; j<WORDLE_WORD_SIZE; j++)
+        {
+            score += letter_count[ws_word_letter(word, j)][j];
+        }
+        order[i].score = word == heuristic ? INT32_MAX : score;
+        order[i].rank = (int)ws_entry_original(dictionary, order[i].entry);
+    }
+    qsort(order, (size_t)order_count, sizeof(s_search_order), compare_order);
+    
+    // guesses only differing in letters no candidate uses split the candidates alike and score the same, so
+    // only the one that would win the tie is kept: a candidate (one with no such letters is its own class) or
+    // else the first in letter count order.  the heuristic's pick stays whatever it is.
+    if(!wordle_state->hard_mode)
+    {
+        static _Thread_local s_partition_classes classes;
+        ws_partition_classes_clear(&classes);
+        for(int i=0; i<candidate_count; i++)
+        {
+            ws_partition_classes_add(&classes, dictionary->words[candidates[i]]);
+        }
+        int kept = 1;
+        for(int i=1; i<order_count; i++)
+        {
+            int entry = order[i].entry;
+            uint32_t key = ws_partition_key(dictionary->words[entry], live_letters);
+            if(((matches[entry/64] >> (entry%64)) & 1) ||
+               (key != WS_PARTITION_NO_INFORMATION && ws_partition_classes_add(&classes, key)))
+            {
+                order[kept++] = order[i];
+            }
+        }
+        result->deduplicated = order_count - kept;
+        order_count = kept;
+    }
+    
+    // the heuristic's pick stays first so a tight budget still gets it, the rest go by bound so scoring
+    // can stop as soon as nothing left could beat the best
+    for(int i=0; i<order_count; i++)
+    {
+        order[i].rank = i;
+        order[i].bound = split_bound(dictionary->words[order[i].entry], wordle_state->letter_count, word_count,
+                                     candidate_count);
+    }
+    qsort(order + 1, (size_t)(order_count - 1), sizeof(s_search_order), compare_bound);
+    
+    // lowest score wins, then a candidate since it might just win, then letter count order, which is
+    // exactly what scoring every guess in letter count order would pick
+    int64_t best_score = INT64_MAX;
+    bool best_is_candidate = false;
+    int best_rank = INT32_MAX;
+    uint64_t work = 0;
+    int i_best = -1;
+    result->complete = true;
+    for(int i=0; i<order_count; i++)
+    {
+        int entry = order[i].entry;
+        bool is_candidate = (matches[entry/64] >> (entry%64)) & 1;
+        if(order[i].bound > best_score)
+        {
+            result->pruned += order_count - i;
+            break;
+        }
+        if(order[i].bound == best_score && (best_is_candidate > is_candidate ||
+                                            (best_is_candidate == is_candidate && best_rank < order[i].rank)))
+        {
+            result->pruned++;
+            continue;
+        }
+        if((budget->work && work + (uint64_t)candidate_count > budget->work) || (deadline && ws_now_ns() >= deadline))
+        {
+            result->complete = false;
+            break;
+        }
+        
+        int64_t score = split_score(dictionary, dictionary->words[entry], candidates, candidate_count);
+        work += (uint64_t)candidate_count;
+        result->evaluated++;
+        
+        if(score < best_score || (score == best_score && (is_candidate > best_is_candidate ||
+                                                          (is_candidate == best_is_candidate && order[i].rank < best_rank))))
+        {
+            best_score = score;
+            best_is_candidate = is_candidate;
+            best_rank = order[i].rank;
+            i_best = entry;
+        }
+    }
+    
+    if(i_best >= 0)
+    {
+        ws_word_decode(dictionary->words[i_best], result->guess);
+        result->expected = (double)best_score/(double)candidate_count;
+    }
+    WS_STAT_ADD(searches, 1);
+    WS_STAT_ADD(searches_cut, !result->complete);
+    WS_STAT_ADD(search_guesses, result->evaluated);
+    WS_STAT_ADD(search_pruned, result->pruned);
+    WS_STAT_ADD(search_deduplicated, result->deduplicated);
+    ws_debug_print(verbose, "searched %d of %d guesses (%d pruned, %d duplicates)%s, best is %s leaving %.1f of %d candidates\n", result->evaluated,
+                   order_count, result->pruned, result->deduplicated, result->complete ? "" : " before the budget ran out", result->guess, result->expected, candidate_count);
+    
+    return false;
+}
@@ -0,0 +1,33 @@
+//
+//  wordle-search.h
+//  wordle-solver
+//
+//  Anytime guess search under a time or work budget.  Guesses are scored by how evenly they split the
+//  remaining candidates, starting with the letter count heuristic's own pick, and the best one found so far
+//  is returned when the budget runs out.  The rest are tried in order of a cheap lower bound on their score,
+//  so once the bound passes the best score every guess left is skipped without changing the result.
+//
+
+#ifndef wordle_search_h
+#define wordle_search_h
+
+#include "wordle-solver.h"
+
+typedef struct s_search_result
+{
+    char   guess[WORDLE_WORD_SIZE+1];
+    bool   complete;                        // every guess was scored before the budget ran out
+    int    evaluated;                       // guesses scored
+    int    pruned;                          // guesses skipped since their bound couldn't beat the best
+    int    deduplicated;                    // guesses splitting the candidates just like one kept, see wordle-partition.h
+    int    candidates;                      // words still consistent with the hints
+    double expected;                        // expected candidates left after the guess, 0 if never scored
+} s_search_result;
+
+bool ws_search_guess(s_wordle_state            *wordle_state,
+                     const s_wordle_dictionary *dictionary,
+                     const s_search_budget     *budget,
+                     s_search_result           *result,
+                     bool                      verbose);
+
+#endif /* wordle_search_h */
@@ -11,34 +11,332 @@
 #include <stdio.h>
 
 #include "wordle-solver.h"
+#include "wordle-search.h"
+#include "wordle-alphabet.h"
 
 void ws_init(s_wordle_state *wordle_state,
-             char           *start_guess)
+             const char     *start_guess,
+             bool           hard_mode)
 {
     for(int i=0; i<WORDLE_WORD_SIZE; i++)
     {
         wordle_state->word[i].letter = '_';
-        for(int j=0; j<26; j++)
+        for(int j=0; j<WS_WORD_LETTERS; j++)
         {
             wordle_state->word[i].eliminated_letters[j] = 0;
         }
         wordle_state->letters_in_word[i] = 0;
     }
+    wordle_state->letters_in_word[WORDLE_WORD_SIZE] = 0;
+    wordle_state->starting_word[0] = 0;
     if(start_guess != NULL && strlen(start_guess) == WORDLE_WORD_SIZE)
     {
         strcpy(wordle_state->starting_word, start_guess);
     }
+    wordle_state->hard_mode = hard_mode;
+    wordle_state->turn = 0;
+    wordle_state->search_budget.time_ns = 0;
+    wordle_state->search_budget.work = 0;
+    
+    // candidate bitset is filled lazily on the first filter since we don't know the dictionary yet
+    wordle_state->candidate_count = -1;
+    wordle_state->candidates_turn = -1;
 }
 
-int ws_make_guess(s_wordle_state *wordle_state,
-                  char           *target_word,
-                  char           dictionary[MAX_DICTIONARY_SIZE][WORDLE_WORD_SIZE+1],
-                  int            dictionary_entries,
-                  bool           verbose)
+void ws_build_constraints(const s_wordle_state *wordle_state,
+                          s_wordle_constraints *constraints)
 {
-    char guess[WORDLE_WORD_SIZE+1] = {0};
+    constraints->required = 0;
+    constraints->placed = 0;
+    for(int i=0; i<WORDLE_WORD_SIZE; i++)
+    {
+        uint32_t allowed = (1u << WS_WORD_LETTERS) - 1;
+        if(wordle_state->word[i].letter != '_')
+        {
+            allowed = 1u << (wordle_state->word[i].letter-'a');
+            constraints->placed |= 1u << i;
+        }
+        for(int j=0; j<WS_WORD_LETTERS; j++)
+        {
+            if(wordle_state->word[i].eliminated_letters[j])
+            {
+                allowed &= ~(1u << j);
+            }
+        }
+        constraints->allowed[i] = allowed;
+        
+        if(wordle_state->letters_in_word[i] != 0)
+        {
+            constraints->required |= 1u << (wordle_state->letters_in_word[i]-'a');
+        }
+    }
+}
+
+static void fill_bitset(uint64_t *bits,
+                        int      entries)
+{
+    int blocks = (entries+63)/64;
+    for(int i=0; i<blocks; i++)
+    {
+        bits[i] = ~0ull;
+    }
+    if(entries % 64)
+    {
+        bits[blocks-1] = (1ull << (entries % 64)) - 1;
+    }
+}
+
+/*
+ *  mark every dictionary entry as a candidate
+ */
+void ws_reset_candidates(s_wordle_state            *wordle_state,
+                         const s_wordle_dictionary *dictionary)
+{
+    fill_bitset(wordle_state->candidates, dictionary->entries);
+    wordle_state->candidate_count = dictionary->entries;
+    memcpy(wordle_state->letter_count, dictionary->index.letter_count, sizeof(wordle_state->letter_count));
+}
+
+/*
+ *  clear every entry in a candidate bitset that doesn't match the hints using the dictionary's index,
+ *  returns the number left.  a letter ruled out everywhere drops every word containing it, a placed
+ *  letter keeps only words with it there, and the rest are per location drops and required letters.
+ *  rejected[] gets the survivors under WS_MATCH and the entries each kind of hint removed.
+ */
+int ws_filter_bitset(const s_wordle_constraints *constraints,
+                     const s_wordle_dictionary  *dictionary,
+                     uint64_t                   *candidates,
+                     int                        rejected[WS_REJECT_REASONS])
+{
+    const s_wordle_index *index = &dictionary->index;
+    const uint64_t *placed[WORDLE_WORD_SIZE];
+    const uint64_t *dropped[WS_INDEX_AT_SETS];
+    const uint64_t *required[WS_WORD_LETTERS];
+    int placed_count = 0, dropped_count = 0, required_count = 0;
+    
+    uint32_t all_letters = (1u << WS_WORD_LETTERS) - 1, absent = all_letters, placed_letters = 0;
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        absent &= ~constraints->allowed[j];
+    }
+    for(int l=0; l<WS_WORD_LETTERS; l++)
+    {
+        if(absent & (1u << l))
+        {
+            dropped[dropped_count++] = ws_index_at_least(index, l, 1);
+        }
+    }
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        if(constraints->placed & (1u << j))
+        {
+            int letter = __builtin_ctz(constraints->allowed[j]);
+            placed[placed_count++] = ws_index_at(index, j, letter);
+            placed_letters |= 1u << letter;
+            continue;
+        }
+        uint32_t eliminated = all_letters & ~constraints->allowed[j] & ~absent;
+        while(eliminated)
+        {
+            dropped[dropped_count++] = ws_index_at(index, j, __builtin_ctz(eliminated));
+            eliminated &= eliminated - 1;
+        }
+    }
+    uint32_t unplaced = constraints->required & ~placed_letters;
+    while(unplaced)
+    {
+        required[required_count++] = ws_index_at_least(index, __builtin_ctz(unplaced), 1);
+        unplaced &= unplaced - 1;
+    }
+    
+    int candidate_count = 0;
+    for(int b=0; b<index->blocks; b++)
+    {
+        uint64_t keep = candidates[b];
+        if(!keep)
+        {
+            continue;
+        }
+        int before = __builtin_popcountll(keep);
+        for(int k=0; k<placed_count; k++)
+        {
+            keep &= placed[k][b];
+        }
+        int after_placed = __builtin_popcountll(keep);
+        for(int k=0; k<dropped_count; k++)
+        {
+            keep &= ~dropped[k][b];
+        }
+        int after_dropped = __builtin_popcountll(keep);
+        for(int k=0; k<required_count; k++)
+        {
+            keep &= required[k][b];
+        }
+        int after = __builtin_popcountll(keep);
+        
+        rejected[WS_REJECT_PLACED] += before - after_placed;
+        rejected[WS_REJECT_ELIMINATED] += after_placed - after_dropped;
+        rejected[WS_REJECT_LETTERS_IN_WORD] += after_dropped - after;
+        candidates[b] = keep;
+        candidate_count += after;
+    }
+    rejected[WS_MATCH] += candidate_count;
+    return candidate_count;
+}
+
+/*
+ *  bring the candidate letter histogram back in step after a filter by whichever is cheapest: taking out the
+ *  words that were dropped, recounting the survivors, or the index's bitset histogram over the survivors
+ */
+static void update_letter_count(s_wordle_state            *wordle_state,
+                                const s_wordle_dictionary *dictionary,
+                                const uint64_t            *previous,
+                                int                       previous_count)
+{
+    int removed = previous_count - wordle_state->candidate_count;
+    if(removed == 0)
+    {
+        return;
+    }
+    
+    int occupied_blocks = 0;
+    for(int b=0; b<dictionary->index.blocks; b++)
+    {
+        occupied_blocks += wordle_state->candidates[b] != 0;
+    }
+    
+    // rough costs: a word is a handful of increments, a block is an AND and popcount per (location, letter)
+    int word_cost = 2*WORDLE_WORD_SIZE, block_cost = 2*WS_INDEX_AT_SETS;
+    int subtract_cost = removed*word_cost;
+    int recount_cost = wordle_state->candidate_count*word_cost;
+    int histogram_cost = occupied_blocks*block_cost;
+    
+    if(histogram_cost < subtract_cost && histogram_cost < recount_cost)
+    {
+        ws_index_histogram(&dictionary->index, wordle_state->candidates, wordle_state->letter_count);
+        return;
+    }
+    
+    int sign = -1;
+    if(recount_cost < subtract_cost)
+    {
+        memset(wordle_state->letter_count, 0, sizeof(wordle_state->letter_count));
+        sign = 1;
+    }
+    for(int b=0; b<dictionary->index.blocks; b++)
+    {
+        uint64_t bits = sign < 0 ? previous[b] & ~wordle_state->candidates[b] : wordle_state->candidates[b];
+        while(bits)
+        {
+            uint32_t word = dictionary->words[b*64 + __builtin_ctzll(bits)];
+            bits &= bits - 1;
+            for(int j=0; j<WORDLE_WORD_SIZE; j++)
+            {
+                wordle_state->letter_count[ws_word_letter(word, j)][j] += sign;
+            }
+        }
+    }
+}
+
+/*
+ *  drop every candidate that no longer matches the hints, returns the number left.  hints only ever
+ *  get stricter so each turn only has to look at the survivors of the last one.
+ */
+int ws_filter_candidates(s_wordle_state             *wordle_state,
+                         const s_wordle_constraints *constraints,
+                         const s_wordle_dictionary  *dictionary)
+{
+    if(wordle_state->candidate_count < 0)
+    {
+        ws_reset_candidates(wordle_state, dictionary);
+    }
+    
+    int blocks = dictionary->index.blocks;
+    int previous_count = wordle_state->candidate_count;
+    uint64_t previous[WS_CANDIDATE_BLOCKS];
+    memcpy(previous, wordle_state->candidates, sizeof(uint64_t)*blocks);
+    
+    int rejected[WS_REJECT_REASONS] = {0};
+    int candidate_count = ws_filter_bitset(constraints, dictionary, wordle_state->candidates, rejected);
+    wordle_state->candidate_count = candidate_count;
+    wordle_state->candidates_turn = wordle_state->turn;
+    update_letter_count(wordle_state, dictionary, previous, previous_count);
+    
+    WS_STAT_ADD(words_scanned, rejected[0] + rejected[1] + rejected[2] + rejected[3]);
+    for(int i=0; i<WS_REJECT_REASONS; i++)
+    {
+        WS_STAT_ADD(rejected[i], rejected[i]);
+    }
+    return candidate_count;
+}
+
+/*
+ *  bring the candidates up to date with the hints played so far, returns the number left.  the filter only
+ *  runs once per turn, so asking between guesses costs nothing extra: the next guess picks up its result.
+ */
+int ws_sync_candidates(s_wordle_state            *wordle_state,
+                       const s_wordle_dictionary *dictionary)
+{
+    if(wordle_state->candidate_count >= 0 && wordle_state->candidates_turn == wordle_state->turn)
+    {
+        return wordle_state->candidate_count;
+    }
+    
+    s_wordle_constraints constraints;
+    ws_build_constraints(wordle_state, &constraints);
+    
+    WS_STAT_TIMER(filter_start);
+    WS_TRACE_EVENT(false, WS_TRACE_PHASE_BEGIN, WS_PHASE_FILTER);
+    int candidate_count = ws_filter_candidates(wordle_state, &constraints, dictionary);
+    WS_TRACE_EVENT(false, WS_TRACE_PHASE_END, WS_PHASE_FILTER);
+    WS_STAT_PHASE(filter_start, WS_PHASE_FILTER);
+    return candidate_count;
+}
+
+/*
+ *  the letter scores ws_choose_guess() ranks candidates by, per letter and location.  hard mode takes them from
+ *  the candidates' histogram, which the filter keeps current, and normal mode from the whole dictionary's
+ *  (counted once by the index) without the letters eliminated at each location.  only unknown locations
+ *  count, the rest score zero.
+ */
+void ws_letter_scores(const s_wordle_state      *wordle_state,
+                      const s_wordle_dictionary *dictionary,
+                      int                       letter_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE])
+{
+    memset(letter_count, 0, sizeof(int)*WS_WORD_LETTERS*WORDLE_WORD_SIZE);
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        if(wordle_state->word[j].letter != '_')
+        {
+            continue;
+        }
+        for(int l=0; l<WS_WORD_LETTERS; l++)
+        {
+            if(wordle_state->hard_mode)
+            {
+                letter_count[l][j] = wordle_state->letter_count[l][j];
+            }
+            else if(wordle_state->word[j].eliminated_letters[l] == 0)
+            {
+                letter_count[l][j] = dictionary->index.letter_count[l][j];
+            }
+        }
+    }
+}
+
+/*
+ *  pick the next guess without playing it, returns true if every letter is already known (guess holds the word).
+ *  the guess is always a candidate, in either mode: the one whose letters are most common in their locations.
+ *  normal mode counts letters over the whole dictionary and hard mode over the candidates.
+ */
+bool ws_choose_guess(s_wordle_state            *wordle_state,
+                     const s_wordle_dictionary *dictionary,
+                     char                      guess[WORDLE_WORD_SIZE+1],
+                     bool                      verbose)
+{
+    int dictionary_entries = dictionary->entries;
     bool is_word_known = true;
-    int letter_count[26][WORDLE_WORD_SIZE] = {0};
+    int letter_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE] = {0};
     
     for(int i=0; i<WORDLE_WORD_SIZE; i++)
     {
@@ -52,8 +350,7 @@ int ws_make_guess(s_wordle_state *wordle_state,
     
     if(is_word_known)
     {
-        printf("word found!  it's '%s'\n", guess);
-        return 1;
+        return true;
     }
     
     // on first turn if seeded with starting word use it
@@ -65,178 +362,197 @@ int ws_make_guess(s_wordle_state *wordle_state,
     }
     else
     {
-        // recalculate probabilities based on current state of guesses
-        for(int i=0; i<WORDLE_WORD_SIZE; i++)
-        {
-            if(guess[i] == '_')
-            {
-                for(int j=0; j<dictionary_entries; j++)
-                {
-                    if(wordle_state->word[i].eliminated_letters[dictionary[j][i]-'a'] == 0)
-                    {
-                        letter_count[dictionary[j][i]-'a'][i]++;
-                    }
-                }
-            }
-        }
-        
-        // find word in dictionary that matches these requirements and optimizes likelyhood letters are used
-        // in those locations.
         int i_guess = 0;
         int max_letter_count = 0, curr_letter_count = 0;
-        for(int i=0; i<dictionary_entries; i++)
+        
+        // the guess always comes from the words still consistent with the hints, which shrink every turn
+        ws_sync_candidates(wordle_state, dictionary);
+        WS_STAT_TURN(wordle_state->turn, wordle_state->candidate_count);
+        WS_TRACE_EVENT(verbose, WS_TRACE_CANDIDATES, (uint32_t)wordle_state->candidate_count);
+        
+        WS_STAT_TIMER(score_start);
+        WS_TRACE_EVENT(false, WS_TRACE_PHASE_BEGIN, WS_PHASE_SCORE);
+        ws_letter_scores(wordle_state, dictionary, letter_count);
+        
+        // find the candidate whose letters are most likely in their locations, the earliest in the word list on
+        // ties
+        for(int b=0; b<(dictionary_entries+63)/64; b++)
         {
-            bool possible_match = true;
-            for(int j=0; j<WORDLE_WORD_SIZE; j++)
-            {
-                // if known letter doesn't match current word, skip immediately
-                if(guess[j] != '_')
-                {
-                    if(guess[j] != dictionary[i][j])
-                    {
-                        possible_match = false;
-                        break;
-                    }
-                }
-                
-                // if letter is already eliminated, skip immediately
-                if(wordle_state->word[j].eliminated_letters[(dictionary[i][j]-'a')] == 1)
-                {
-                    possible_match = false;
-                    break;
-                }
-            }
-            
-            if(!possible_match)
+            uint64_t bits = wordle_state->candidates[b];
+            while(bits)
             {
-                continue;
-            }
-            
-            // make sure word contains letters we know are a part of word
-            bool letter_found = true;
-            if(wordle_state->letters_in_word[0] != 0)
-            {
-                int j = 0;
-                while(wordle_state->letters_in_word[j] != 0)
+                int i = b*64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+                curr_letter_count = ws_word_score(letter_count, dictionary->words[i]);
+                if(curr_letter_count > max_letter_count ||
+                   (curr_letter_count == max_letter_count &&
+                    ws_entry_original(dictionary, i) < ws_entry_original(dictionary, i_guess)))
                 {
-                    letter_found = false;
-                    if(wordle_state->letters_in_word[j] != 0)
-                    {
-                        for(int k=0; k<WORDLE_WORD_SIZE; k++)
-                        {
-                            if(dictionary[i][k] == wordle_state->letters_in_word[j])
-                            {
-                                letter_found = true;
-                            }
-                        }
-                        if(!letter_found)
-                        {
-                            break;
-                        }
-                    }
-                    j++;
+                    max_letter_count = curr_letter_count;
+                    i_guess = i;
                 }
             }
-            if(!letter_found)
-            {
-                continue;
-            }
-            
-            // word is candidate, compute how common letters are a part of all valid words
-            curr_letter_count = 0;
-            for(int j=0; j<WORDLE_WORD_SIZE; j++)
-            {
-                curr_letter_count += letter_count[dictionary[i][j]-'a'][j];
-            }
-            if(curr_letter_count > max_letter_count)
-            {
-                max_letter_count = curr_letter_count;
-                i_guess = i;
-            }
         }
-        strcpy(guess, &dictionary[i_guess][0]);
+        WS_TRACE_EVENT(false, WS_TRACE_PHASE_END, WS_PHASE_SCORE);
+        WS_STAT_PHASE(score_start, WS_PHASE_SCORE);
+        ws_word_decode(dictionary->words[i_guess], guess);
     }
 
-    ws_debug_print(verbose, "best guess is %s\n", guess);
+    WS_TRACE_EVENT(verbose, WS_TRACE_GUESS, ws_word_encode(guess));
+    
+    return false;
+}
+
+int ws_make_guess(s_wordle_state            *wordle_state,
+                  uint32_t                  target_word,
+                  const s_wordle_dictionary *dictionary,
+                  bool                      verbose)
+{
+    char guess[WORDLE_WORD_SIZE+1] = {0};
+    bool found;
     
-    if(!strcmp(guess, target_word))
+    if(wordle_state->search_budget.time_ns || wordle_state->search_budget.work)
+    {
+        s_search_result result;
+        found = ws_search_guess(wordle_state, dictionary, &wordle_state->search_budget, &result, verbose);
+        strcpy(guess, result.guess);
+    }
+    else
+    {
+        found = ws_choose_guess(wordle_state, dictionary, guess, verbose);
+    }
+    if(found)
+    {
+        char text[WS_ALPHABET_TEXT_SIZE];
+        printf("word found!  it's '%s'\n", ws_alphabet_text(guess, text));
+        return 1;
+    }
+    
+    return ws_apply_guess(wordle_state, guess, target_word, verbose);
+}
+
+/*
+ *  score a guess against the target, one base 3 digit per location (first letter least significant):
+ *  WS_FEEDBACK_PLACED if the letter matches, WS_FEEDBACK_IN_WORD if it's elsewhere in the word, WS_FEEDBACK_ABSENT otherwise
+ */
+int ws_feedback(const char *guess,
+                const char *target_word)
+{
+    uint32_t target_letters = 0;
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        target_letters |= 1u << ((unsigned)(target_word[j]-'a') & 31);
+    }
+    
+    int pattern = 0;
+    for(int j=WORDLE_WORD_SIZE-1; j>=0; j--)
+    {
+        int digit = WS_FEEDBACK_ABSENT;
+        if(guess[j] == target_word[j])
+        {
+            digit = WS_FEEDBACK_PLACED;
+        }
+        else if(target_letters & (1u << ((unsigned)(guess[j]-'a') & 31)))
+        {
+            digit = WS_FEEDBACK_IN_WORD;
+        }
+        pattern = pattern*3 + digit;
+    }
+    return pattern;
+}
+
+/*
+ *  score a guess against the packed target and fold the result into the hints, returns 1 if the guess was the target
+ */
+int ws_apply_guess(s_wordle_state *wordle_state,
+                   const char     *guess,
+                   uint32_t       target_word,
+                   bool           verbose)
+{
+    int pattern = ws_word_feedback(ws_word_encode(guess), target_word, ws_word_letter_mask(target_word));
+    return ws_apply_feedback(wordle_state, guess, pattern, verbose);
+}
+
+/*
+ *  fold feedback from ws_feedback (or a real game) into the hints, returns 1 if every letter was placed
+ */
+int ws_apply_feedback(s_wordle_state *wordle_state,
+                      const char     *guess,
+                      int            pattern,
+                      bool           verbose)
+{
+    WS_STAT_TIMER(feedback_start);
+    WS_TRACE_EVENT(false, WS_TRACE_PHASE_BEGIN, WS_PHASE_FEEDBACK);
+    if(wordle_state->turn < WS_MAX_HISTORY)
+    {
+        memcpy(wordle_state->history[wordle_state->turn], guess, WORDLE_WORD_SIZE);
+        wordle_state->history[wordle_state->turn][WORDLE_WORD_SIZE] = 0;
+    }
+    wordle_state->turn++;
+    
+    if(pattern == WS_FEEDBACK_SOLVED)
     {
         // found it!
         for(int j=0; j<WORDLE_WORD_SIZE; j++)
         {
             wordle_state->word[j].letter = guess[j];
         }
+        WS_TRACE_EVENT(false, WS_TRACE_PHASE_END, WS_PHASE_FEEDBACK);
+        WS_STAT_PHASE(feedback_start, WS_PHASE_FEEDBACK);
         return 1;
     }
-    else
+    
+    // update eliminated and letters in word states
+    for(int j=0; j<WORDLE_WORD_SIZE; j++, pattern /= 3)
     {
-        // update eliminated and letters in word states
-        for(int j=0; j<WORDLE_WORD_SIZE; j++)
+        if(pattern % 3 == WS_FEEDBACK_PLACED)
         {
-            if(guess[j] == target_word[j])
-            {
-                wordle_state->word[j].letter = guess[j];
-            }
-            else
+            wordle_state->word[j].letter = guess[j];
+        }
+        else if(pattern % 3 == WS_FEEDBACK_IN_WORD)
+        {
+            // letter is in word, just eliminate for where the guess happened
+            wordle_state->word[j].eliminated_letters[guess[j]-'a'] = 1;
+            WS_TRACE_EVENT(verbose, WS_TRACE_ELIMINATE_AT, (uint32_t)guess[j] | (uint32_t)j << 8);
+            int i_letters_in_word = 0;
+            
+            // make sure this letter isn't already maintained in list
+            bool is_letter_known = false;
+            for(int i=0; i<WORDLE_WORD_SIZE; i++)
             {
-                // is this letter anywhere in the word?
-                bool is_letter_in_word = false;
-                for(int k=0; k<WORDLE_WORD_SIZE; k++)
-                {
-                    if(guess[j] == target_word[k])
-                    {
-                        is_letter_in_word = true;
-                    }
-                }
-                // if letter is in word, just eliminate for where the guess happened
-                // otherwise elimiate for all locations
-                if(is_letter_in_word)
+                if(guess[j] == wordle_state->letters_in_word[i])
                 {
-                    wordle_state->word[j].eliminated_letters[guess[j]-'a'] = 1;
-                    ws_debug_print(verbose, "eliminating %c from location %d\n", guess[j], j);
-                    int i_letters_in_word = 0;
-                    
-                    // make sure this letter isn't already maintained in list
-                    bool is_letter_known = false;
-                    for(int i=0; i<WORDLE_WORD_SIZE; i++)
-                    {
-                        if(guess[j] == wordle_state->letters_in_word[i])
-                        {
-                            is_letter_known = true;
-                        }
-                    }
-                    
-                    // save known but misplaced letter in state
-                    if(!is_letter_known)
-                    {
-                        while(wordle_state->letters_in_word[i_letters_in_word] != 0)
-                        {
-                            i_letters_in_word++;
-                        }
-                        wordle_state->letters_in_word[i_letters_in_word] = guess[j];
-                    }
+                    is_letter_known = true;
                 }
-                else
+            }
+            
+            // save known but misplaced letter in state
+            if(!is_letter_known)
+            {
+                while(wordle_state->letters_in_word[i_letters_in_word] != 0)
                 {
-                    for(int i=0; i<WORDLE_WORD_SIZE; i++)
-                    {
-                        wordle_state->word[i].eliminated_letters[guess[j]-'a'] = 1;
-                    }
-                    ws_debug_print(verbose, "eliminating %c from all locations\n", guess[j]);
+                    i_letters_in_word++;
                 }
+                wordle_state->letters_in_word[i_letters_in_word] = guess[j];
+            }
+        }
+        else
+        {
+            // otherwise elimiate for all locations
+            for(int i=0; i<WORDLE_WORD_SIZE; i++)
+            {
+                wordle_state->word[i].eliminated_letters[guess[j]-'a'] = 1;
             }
+            WS_TRACE_EVENT(verbose, WS_TRACE_ELIMINATE_ALL, (uint32_t)guess[j]);
         }
-    }    
+    }
+    WS_TRACE_EVENT(false, WS_TRACE_PHASE_END, WS_PHASE_FEEDBACK);
+    WS_STAT_PHASE(feedback_start, WS_PHASE_FEEDBACK);
     return 0;
 }
 
-void ws_debug_print(bool verbose,
-                    const char *fmt, ...)
+void ws_debug_printf(const char *fmt, ...)
 {
-    if(!verbose)
-    {
-        return;
-    }
     va_list va;
     va_start(va, fmt);
     vfprintf(stderr, fmt, va);
@@ -10,16 +10,40 @@
 
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdint.h>
+
+#include "wordle-word.h"
+#include "wordle-index.h"
+#include "wordle-stats.h"
+#include "wordle-trace.h"
 
 // protect against loading malformed dictionary for nefarious purposes
-#define MAX_DICTIONARY_SIZE         20000
+#define MAX_DICTIONARY_SIZE         32768
+
+// per location feedback digits, see ws_feedback()
+#define WS_FEEDBACK_ABSENT          0
+#define WS_FEEDBACK_IN_WORD         1
+#define WS_FEEDBACK_PLACED          2
+#define WS_FEEDBACK_PATTERNS        243     // 3^WORDLE_WORD_SIZE
+#define WS_FEEDBACK_SOLVED          (WS_FEEDBACK_PATTERNS-1)
+
+// guesses remembered per game for reporting, anything past this is still played but not recorded
+#define WS_MAX_HISTORY              32
 
-#define WORDLE_WORD_SIZE            5
+// candidate words are tracked as a bitset over dictionary entries
+#define WS_CANDIDATE_BLOCKS         ((MAX_DICTIONARY_SIZE+63)/64)
+
+// per guess limits for ws_search_guess(), zero means no limit and both zero means use the letter count heuristic alone
+typedef struct s_search_budget
+{
+    uint64_t time_ns;                       // wall clock time
+    uint64_t work;                          // guess/candidate feedback evaluations
+} s_search_budget;
 
 typedef struct s_letter_guess
 {
     char letter;
-    char eliminated_letters[26];
+    char eliminated_letters[WS_WORD_LETTERS];
 } s_letter_guess;
 
 typedef struct s_wordle_state
@@ -27,18 +51,181 @@ typedef struct s_wordle_state
     char           starting_word[WORDLE_WORD_SIZE+1];
     s_letter_guess word[5];
     char           letters_in_word[WORDLE_WORD_SIZE+1];    // letters we know are in the word but have not been properly placed
+    bool           hard_mode;                              // score letters over the candidates, not the whole dictionary
+    int            turn;                                   // guesses played so far
+    char           history[WS_MAX_HISTORY][WORDLE_WORD_SIZE+1];    // guesses played, oldest first
+    int            candidate_count;                        // words still consistent with hints, -1 until first filter
+    int            candidates_turn;                        // turn the candidates were last filtered on
+    uint64_t       candidates[WS_CANDIDATE_BLOCKS];        // bitset of consistent dictionary entries
+    int            letter_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE];     // letter histogram of the candidates, kept in step with them
+    s_search_budget search_budget;                         // ws_make_guess() searches for a better guess within this
 } s_wordle_state;
 
+// dictionary word flags
+#define WS_WORD_ANSWER              0x01    // can be picked as a target
+#define WS_WORD_GUESS               0x02    // accepted as a guess
+
+/*
+ *  dictionary words plus features precomputed once at load time.  built in memory from a word list
+ *  (ws_dictionary_build) or mapped straight from a compiled dictionary file (ws_dictionary_map), see
+ *  wordle-dictionary.h.  every letter is guaranteed to be an index below WS_WORD_LETTERS, and the solver
+ *  needs the index built.
+ */
+typedef struct s_wordle_dictionary
+{
+    int            entries;
+    int            answer_entries;
+    const uint32_t *words;                                  // packed words, see wordle-word.h
+    const uint32_t *letter_masks;                           // letters used by each word, one bit per letter
+    const uint8_t  *flags;                                  // WS_WORD_*
+    const uint32_t *answers;                                // entries that can be targets, in dictionary order
+    const uint32_t *original;                               // entry in the word list, NULL unless reordered
+    uint64_t       hash;                                    // identifies the word list
+    s_wordle_index index;                                   // bitsets for filtering, see wordle-index.h
+    
+    void           *storage;                                // tables allocated by ws_dictionary_build
+    void           *mapping;                                // file mapped by ws_dictionary_map
+    size_t         mapping_size;
+} s_wordle_dictionary;
+
+// compact form of the hints in s_wordle_state, one bit per letter
+typedef struct s_wordle_constraints
+{
+    uint32_t allowed[WORDLE_WORD_SIZE];     // letters still possible at each location
+    uint32_t required;                      // letters known to be somewhere in the word
+    uint32_t placed;                        // locations whose letter is known
+} s_wordle_constraints;
+
+/*
+ *  where a dictionary entry was in its word list, ties between guesses go by this so reordering a dictionary
+ *  (ws_dictionary_reorder) doesn't change which guess wins
+ */
+static inline uint32_t ws_entry_original(const s_wordle_dictionary *dictionary,
+                                         int                       entry)
+{
+    return dictionary->original ? dictionary->original[entry] : (uint32_t)entry;
+}
+
 void ws_init(s_wordle_state *wordle_state,
-             char           *start_guess);
+             const char     *start_guess,
+             bool           hard_mode);
+
+void ws_build_constraints(const s_wordle_state *wordle_state,
+                          s_wordle_constraints *constraints);
+
+/*
+ *  check a dictionary word against the current hints without touching the state, returns WS_MATCH
+ *  or the first reason the word was rejected
+ */
+static inline int ws_word_reject_reason(const s_wordle_constraints *constraints,
+                                        const char                 *word)
+{
+    uint32_t letters = 0;
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        uint32_t letter = 1u << ((unsigned)(word[j]-'a') & 31);
+        if(!(constraints->allowed[j] & letter))
+        {
+            return (constraints->placed & (1u << j)) ? WS_REJECT_PLACED : WS_REJECT_ELIMINATED;
+        }
+        letters |= letter;
+    }
+    return (letters & constraints->required) == constraints->required ? WS_MATCH : WS_REJECT_LETTERS_IN_WORD;
+}
+
+static inline bool ws_word_matches(const s_wordle_constraints *constraints,
+                                   const char                 *word)
+{
+    return ws_word_reject_reason(constraints, word) == WS_MATCH;
+}
+
+/*
+ *  ws_feedback() for packed words, target_mask is ws_word_letter_mask(target)
+ */
+static inline int ws_word_feedback(uint32_t guess,
+                                   uint32_t target,
+                                   uint32_t target_mask)
+{
+    int pattern = 0;
+    for(int j=WORDLE_WORD_SIZE-1; j>=0; j--)
+    {
+        int guess_letter = ws_word_letter(guess, j);
+        int digit = guess_letter == ws_word_letter(target, j) ? WS_FEEDBACK_PLACED :
+                    ((target_mask >> guess_letter) & 1) ? WS_FEEDBACK_IN_WORD : WS_FEEDBACK_ABSENT;
+        pattern = pattern*3 + digit;
+    }
+    return pattern;
+}
+
+/*
+ *  same for a dictionary entry as the target, using its precomputed letter mask
+ */
+static inline int ws_entry_feedback(uint32_t                  guess,
+                                    const s_wordle_dictionary *dictionary,
+                                    int                       entry)
+{
+    return ws_word_feedback(guess, dictionary->words[entry], dictionary->letter_masks[entry]);
+}
+
+void ws_reset_candidates(s_wordle_state            *wordle_state,
+                         const s_wordle_dictionary *dictionary);
+
+int ws_filter_bitset(const s_wordle_constraints *constraints,
+                     const s_wordle_dictionary  *dictionary,
+                     uint64_t                   *candidates,
+                     int                        rejected[WS_REJECT_REASONS]);
+
+int ws_filter_candidates(s_wordle_state             *wordle_state,
+                         const s_wordle_constraints *constraints,
+                         const s_wordle_dictionary  *dictionary);
+
+int ws_sync_candidates(s_wordle_state            *wordle_state,
+                       const s_wordle_dictionary *dictionary);
+
+void ws_letter_scores(const s_wordle_state      *wordle_state,
+                      const s_wordle_dictionary *dictionary,
+                      int                       letter_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE]);
+
+/*
+ *  a word's score under ws_letter_scores()
+ */
+static inline int ws_word_score(const int letter_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE],
+                                uint32_t  word)
+{
+    int score = 0;
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        score += letter_count[ws_word_letter(word, j)][j];
+    }
+    return score;
+}
+
+bool ws_choose_guess(s_wordle_state            *wordle_state,
+                     const s_wordle_dictionary *dictionary,
+                     char                      guess[WORDLE_WORD_SIZE+1],
+                     bool                      verbose);
+
+int ws_make_guess(s_wordle_state            *wordle_state,
+                  uint32_t                  target_word,
+                  const s_wordle_dictionary *dictionary,
+                  bool                      verbose);
+
+int ws_feedback(const char *guess,
+                const char *target_word);
+
+int ws_apply_guess(s_wordle_state *wordle_state,
+                   const char     *guess,
+                   uint32_t       target_word,
+                   bool           verbose);
+
+int ws_apply_feedback(s_wordle_state *wordle_state,
+                      const char     *guess,
+                      int            pattern,
+                      bool           verbose);
 
-int ws_make_guess(s_wordle_state *wordle_state,
-                  char           *target_word,
-                  char           dictionary[MAX_DICTIONARY_SIZE][WORDLE_WORD_SIZE+1],
-                  int            dictionary_entries,
-                  bool           verbose);
+void ws_debug_printf(const char *fmt, ...);
 
-void ws_debug_print(bool verbose,
-                    const char *fmt, ...);
+// only pay for the varargs call when there's something to print
+#define ws_debug_print(verbose, ...)    do { if(verbose) { ws_debug_printf(__VA_ARGS__); } } while(0)
 
 #endif /* wordle_solver_h */
@@ -0,0 +1,334 @@
+//
+//  wordle-stats.c
+//  wordle-solver
+//
+//  Opt-in hot path counters (-stats).  Every thread counts into its own block with plain adds and merges it
+//  into the global totals once when it's done, so the guess loops never touch shared memory.
+//
+
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include "wordle-stats.h"
+
+#if WS_STATS
+
+bool ws_stats_enabled = false;
+bool ws_counters_enabled = false;
+_Thread_local s_wordle_stats ws_thread_stats;
+
+static s_wordle_stats ws_total_stats;
+static pthread_mutex_t ws_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// one counter group per thread, counting that thread only, opened the first time it marks a phase
+typedef struct s_counter_group
+{
+    bool opened;
+    int  count;
+    int  fds[WS_COUNTERS];                  // fds[0] leads the group
+    int  members[WS_COUNTERS];              // counter behind each value of a group read
+} s_counter_group;
+
+static _Thread_local s_counter_group ws_counter_group;
+static uint32_t ws_counters_available;      // bit per counter any thread managed to open
+static int ws_counters_error;               // why the first counter that failed to open failed
+
+#ifdef __linux__
+
+static const struct
+{
+    uint32_t type;
+    uint64_t config;
+} ws_counter_events[WS_COUNTERS] =
+{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+};
+
+/*
+ *  open whichever counters this machine has as one group so a single read gets them all at once
+ */
+static void open_counters(s_counter_group *group)
+{
+    group->opened = true;
+    for(int c=0; c<WS_COUNTERS; c++)
+    {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = ws_counter_events[c].type;
+        attr.config = ws_counter_events[c].config;
+        attr.disabled = group->count == 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, group->count ? group->fds[0] : -1, 0);
+        if(fd < 0)
+        {
+            __atomic_compare_exchange_n(&ws_counters_error, &(int){0}, errno, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+            continue;
+        }
+        group->fds[group->count] = fd;
+        group->members[group->count++] = c;
+        __atomic_fetch_or(&ws_counters_available, 1u << c, __ATOMIC_RELAXED);
+    }
+    if(group->count)
+    {
+        ioctl(group->fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(group->fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+static void read_counters(uint64_t counters[WS_COUNTERS])
+{
+    s_counter_group *group = &ws_counter_group;
+    if(!group->opened)
+    {
+        open_counters(group);
+    }
+    uint64_t values[1+WS_COUNTERS];
+    if(group->count && read(group->fds[0], values, sizeof(uint64_t)*(size_t)(1+group->count)) > 0)
+    {
+        for(int i=0; i<group->count && i<(int)values[0]; i++)
+        {
+            counters[group->members[i]] = values[1+i];
+        }
+    }
+}
+
+static void close_counters(void)
+{
+    s_counter_group *group = &ws_counter_group;
+    for(int i=group->count-1; i>=0; i--)
+    {
+        close(group->fds[i]);
+    }
+    memset(group, 0, sizeof(s_counter_group));
+}
+
+#else
+
+static void read_counters(uint64_t counters[WS_COUNTERS])
+{
+    ws_counters_error = ENOSYS;
+}
+
+static void close_counters(void)
+{
+}
+
+#endif /* __linux__ */
+
+/*
+ *  start timing a phase, counters first so reading them isn't part of the time
+ */
+s_stats_mark ws_stats_mark(void)
+{
+    s_stats_mark mark = {0};
+    if(ws_counters_enabled)
+    {
+        read_counters(mark.counters);
+    }
+    mark.ns = ws_now_ns();
+    return mark;
+}
+
+/*
+ *  add the time and counts since a mark to a phase
+ */
+void ws_stats_phase(const s_stats_mark *start,
+                    int                phase)
+{
+    ws_thread_stats.phase_ns[phase] += ws_now_ns() - start->ns;
+    if(ws_counters_enabled)
+    {
+        uint64_t counters[WS_COUNTERS] = {0};
+        read_counters(counters);
+        for(int c=0; c<WS_COUNTERS; c++)
+        {
+            ws_thread_stats.phase_counters[phase][c] += counters[c] - start->counters[c];
+        }
+    }
+}
+
+/*
+ *  record the candidate set size a guess was picked from
+ */
+void ws_stats_turn(int turn,
+                   int candidate_count)
+{
+    if(turn >= WS_STATS_TURNS)
+    {
+        turn = WS_STATS_TURNS-1;
+    }
+    int bucket = 0;
+    while(bucket < WS_STATS_SIZE_BUCKETS-1 && (1 << bucket) <= candidate_count)
+    {
+        bucket++;
+    }
+    ws_thread_stats.turns++;
+    ws_thread_stats.turn_count[turn]++;
+    ws_thread_stats.turn_candidates[turn] += (uint64_t)candidate_count;
+    ws_thread_stats.candidate_sizes[turn][bucket]++;
+}
+
+/*
+ *  add this thread's counters to the totals, call once per thread when its work is done
+ */
+void ws_stats_flush(void)
+{
+    if(!ws_stats_enabled)
+    {
+        return;
+    }
+    
+    uint64_t *from = (uint64_t *)&ws_thread_stats;
+    uint64_t *to = (uint64_t *)&ws_total_stats;
+    
+    pthread_mutex_lock(&ws_stats_lock);
+    for(size_t i=0; i<sizeof(s_wordle_stats)/sizeof(uint64_t); i++)
+    {
+        to[i] += from[i];
+    }
+    pthread_mutex_unlock(&ws_stats_lock);
+    
+    memset(&ws_thread_stats, 0, sizeof(ws_thread_stats));
+    close_counters();
+}
+
+static void report_counter(FILE           *fp,
+                           const uint64_t *counters,
+                           int            counter,
+                           int            width)
+{
+    if(ws_counters_available & (1u << counter))
+    {
+        fprintf(fp, " %*llu", width, (unsigned long long)counters[counter]);
+    }
+    else
+    {
+        fprintf(fp, " %*s", width, "n/a");
+    }
+}
+
+/*
+ *  counts per phase with instructions per cycle, and the filter's per word scanned since that's the loop
+ *  that runs over the dictionary
+ */
+static void report_counters(FILE                 *fp,
+                            const s_wordle_stats *stats,
+                            const char           *phases[WS_PHASES])
+{
+    if(!ws_counters_available)
+    {
+        fprintf(fp, "hardware counters unavailable (%s), check perf_event_paranoid or run outside a VM\n",
+                strerror(ws_counters_error ? ws_counters_error : ENOENT));
+        return;
+    }
+    
+    fprintf(fp, "hardware counters (summed across threads)\n");
+    fprintf(fp, "    %-12s %14s %14s %6s %12s %12s %13s\n", "", "cycles", "instructions", "IPC", "L1D misses", "LLC misses",
+            "branch misses");
+    for(int i=0; i<WS_PHASES; i++)
+    {
+        const uint64_t *counters = stats->phase_counters[i];
+        fprintf(fp, "    %-12s", phases[i]);
+        report_counter(fp, counters, WS_COUNTER_CYCLES, 14);
+        report_counter(fp, counters, WS_COUNTER_INSTRUCTIONS, 14);
+        if(counters[WS_COUNTER_CYCLES])
+        {
+            fprintf(fp, " %6.2f", (double)counters[WS_COUNTER_INSTRUCTIONS]/(double)counters[WS_COUNTER_CYCLES]);
+        }
+        else
+        {
+            fprintf(fp, " %6s", "n/a");
+        }
+        report_counter(fp, counters, WS_COUNTER_L1D_MISSES, 12);
+        report_counter(fp, counters, WS_COUNTER_LLC_MISSES, 12);
+        report_counter(fp, counters, WS_COUNTER_BRANCH_MISSES, 13);
+        fprintf(fp, "\n");
+    }
+    
+    if(stats->words_scanned)
+    {
+        static const char *names[WS_COUNTERS] = {"cycles", "instructions", "L1D misses", "LLC misses", "branch misses"};
+        const uint64_t *counters = stats->phase_counters[WS_PHASE_FILTER];
+        fprintf(fp, "    filter per word scanned:");
+        for(int c=0; c<WS_COUNTERS; c++)
+        {
+            if(ws_counters_available & (1u << c))
+            {
+                fprintf(fp, " %.4f %s", (double)counters[c]/(double)stats->words_scanned, names[c]);
+            }
+        }
+        fprintf(fp, "\n");
+    }
+}
+
+void ws_stats_report(FILE *fp)
+{
+    static const char *reasons[WS_REJECT_REASONS] = {"matched", "known letter", "eliminated letter", "letters in word"};
+    static const char *phases[WS_PHASES] = {"load", "score", "filter", "feedback"};
+    s_wordle_stats *stats = &ws_total_stats;
+    
+    fprintf(fp, "words scanned %llu\n", (unsigned long long)stats->words_scanned);
+    for(int i=0; i<WS_REJECT_REASONS; i++)
+    {
+        fprintf(fp, "    %-20s %12llu (%2.2f%%)\n", reasons[i], (unsigned long long)stats->rejected[i],
+                stats->words_scanned ? 100.0*(double)stats->rejected[i]/(double)stats->words_scanned : 0.0);
+    }
+    
+    fprintf(fp, "guesses picked %llu\n", (unsigned long long)stats->turns);
+    for(int t=0; t<WS_STATS_TURNS; t++)
+    {
+        if(stats->turn_count[t] == 0)
+        {
+            continue;
+        }
+        fprintf(fp, "    turn %2d%s %10llu guesses, average %9.1f candidates |", t+1, t == WS_STATS_TURNS-1 ? "+" : " ",
+                (unsigned long long)stats->turn_count[t], (double)stats->turn_candidates[t]/(double)stats->turn_count[t]);
+        for(int b=0; b<WS_STATS_SIZE_BUCKETS; b++)
+        {
+            fprintf(fp, " %llu", (unsigned long long)stats->candidate_sizes[t][b]);
+        }
+        fprintf(fp, "\n");
+    }
+    fprintf(fp, "    (candidate set sizes bucketed as 0, 1, 2-3, 4-7, ...)\n");
+    
+    if(stats->searches)
+    {
+        fprintf(fp, "guess searches %llu, %llu cut short by the budget, average %.1f guesses scored, %.1f pruned and %.1f duplicates\n",
+                (unsigned long long)stats->searches, (unsigned long long)stats->searches_cut,
+                (double)stats->search_guesses/(double)stats->searches, (double)stats->search_pruned/(double)stats->searches,
+                (double)stats->search_deduplicated/(double)stats->searches);
+    }
+    
+    uint64_t total_ns = 0;
+    for(int i=0; i<WS_PHASES; i++)
+    {
+        total_ns += stats->phase_ns[i];
+    }
+    fprintf(fp, "phase time (summed across threads)\n");
+    for(int i=0; i<WS_PHASES; i++)
+    {
+        fprintf(fp, "    %-20s %12.3f ms (%2.2f%%)\n", phases[i], (double)stats->phase_ns[i]/1e6,
+                total_ns ? 100.0*(double)stats->phase_ns[i]/(double)total_ns : 0.0);
+    }
+    
+    if(ws_counters_enabled)
+    {
+        report_counters(fp, stats, phases);
+    }
+}
+
+#endif /* WS_STATS */
@@ -0,0 +1,115 @@
+//
+//  wordle-stats.h
+//  wordle-solver
+//
+//  Opt-in hot path counters (-stats).  Every thread counts into its own block with plain adds and merges it
+//  into the global totals once when it's done, so the guess loops never touch shared memory.  On Linux each
+//  phase can also be wrapped with hardware counters (-counters) read through perf_event_open.
+//  Build with WS_STATS=0 to compile every counter out.
+//
+
+#ifndef wordle_stats_h
+#define wordle_stats_h
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifndef WS_STATS
+#define WS_STATS                    1
+#endif
+
+// reasons a dictionary word fails the constraint check, see ws_word_reject_reason()
+#define WS_MATCH                    0
+#define WS_REJECT_PLACED            1       // doesn't have a known letter in its known location
+#define WS_REJECT_ELIMINATED        2       // uses a letter eliminated for that location
+#define WS_REJECT_LETTERS_IN_WORD   3       // missing a letter known to be in the word
+#define WS_REJECT_REASONS           4
+
+#define WS_PHASE_LOAD               0
+#define WS_PHASE_SCORE              1       // letter statistics and picking the best scoring candidate
+#define WS_PHASE_FILTER             2       // narrowing the candidates to the hints
+#define WS_PHASE_FEEDBACK           3
+#define WS_PHASES                   4
+
+// hardware counters per phase, any the kernel or machine doesn't offer read as zero and are reported n/a
+#define WS_COUNTER_CYCLES           0
+#define WS_COUNTER_INSTRUCTIONS     1
+#define WS_COUNTER_L1D_MISSES       2
+#define WS_COUNTER_LLC_MISSES       3
+#define WS_COUNTER_BRANCH_MISSES    4
+#define WS_COUNTERS                 5
+
+#define WS_STATS_TURNS              16      // later turns are lumped into the last one
+#define WS_STATS_SIZE_BUCKETS       16      // candidate set sizes in powers of two
+
+typedef struct s_wordle_stats
+{
+    uint64_t words_scanned;
+    uint64_t rejected[WS_REJECT_REASONS];
+    uint64_t turns;
+    uint64_t turn_count[WS_STATS_TURNS];
+    uint64_t turn_candidates[WS_STATS_TURNS];
+    uint64_t candidate_sizes[WS_STATS_TURNS][WS_STATS_SIZE_BUCKETS];
+    uint64_t phase_ns[WS_PHASES];
+    uint64_t phase_counters[WS_PHASES][WS_COUNTERS];
+    uint64_t searches;                      // budgeted guess searches, see wordle-search.h
+    uint64_t searches_cut;                  // searches stopped by the budget
+    uint64_t search_guesses;                // guesses scored by all searches
+    uint64_t search_pruned;                 // guesses skipped by their bound
+    uint64_t search_deduplicated;           // guesses dropped as splitting the candidates like another
+} s_wordle_stats;
+
+// start of a timed phase
+typedef struct s_stats_mark
+{
+    uint64_t ns;
+    uint64_t counters[WS_COUNTERS];
+} s_stats_mark;
+
+/*
+ *  monotonic clock in nanoseconds, for the phase timers and anything else that times itself
+ */
+static inline uint64_t ws_now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec*1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+#if WS_STATS
+
+extern bool ws_stats_enabled;
+extern bool ws_counters_enabled;
+extern _Thread_local s_wordle_stats ws_thread_stats;
+
+#define WS_STAT_ADD(field, n)       do { if(ws_stats_enabled) { ws_thread_stats.field += (n); } } while(0)
+#define WS_STAT_TIMER(name)         s_stats_mark name = ws_stats_enabled ? ws_stats_mark() : (s_stats_mark){0}
+#define WS_STAT_PHASE(name, phase)  do { if(ws_stats_enabled) { ws_stats_phase(&(name), phase); } } while(0)
+#define WS_STAT_TURN(turn, count)   do { if(ws_stats_enabled) { ws_stats_turn(turn, count); } } while(0)
+
+s_stats_mark ws_stats_mark(void);
+
+void ws_stats_phase(const s_stats_mark *start,
+                    int                phase);
+
+void ws_stats_turn(int turn,
+                   int candidate_count);
+
+void ws_stats_flush(void);
+
+void ws_stats_report(FILE *fp);
+
+#else
+
+#define WS_STAT_ADD(field, n)       do { } while(0)
+#define WS_STAT_TIMER(name)         do { } while(0)
+#define WS_STAT_PHASE(name, phase)  do { } while(0)
+#define WS_STAT_TURN(turn, count)   do { } while(0)
+
+#define ws_stats_flush()            do { } while(0)
+
+#endif /* WS_STATS */
+
+#endif /* wordle_stats_h */
@@ -0,0 +1,152 @@
+//
+//  wordle-strategy.c
+//  wordle-solver
+//
+//  Built in guess strategies, see wordle-strategy.h.
+//
+
+#include <string.h>
+
+#include "wordle-strategy.h"
+#include "wordle-search.h"
+
+// per guess work budget for the search strategy when none was given
+#define SEARCH_DEFAULT_WORK         1000000
+
+static void letters_init(s_wordle_state            *wordle_state,
+                         const s_wordle_dictionary *dictionary,
+                         void                      *scratch)
+{
+    (void)wordle_state;
+    (void)dictionary;
+    (void)scratch;
+}
+
+static bool letters_choose_guess(s_wordle_state            *wordle_state,
+                                 const s_wordle_dictionary *dictionary,
+                                 void                      *scratch,
+                                 char                      guess[WORDLE_WORD_SIZE+1],
+                                 bool                      verbose)
+{
+    (void)scratch;
+    return ws_choose_guess(wordle_state, dictionary, guess, verbose);
+}
+
+static int letters_apply_feedback(s_wordle_state *wordle_state,
+                                  const char     *guess,
+                                  int            pattern,
+                                  void           *scratch,
+                                  bool           verbose)
+{
+    (void)scratch;
+    return ws_apply_feedback(wordle_state, guess, pattern, verbose);
+}
+
+/*
+ *  the letter count heuristic with letters counted over the candidates instead of the whole dictionary, the
+ *  way -hard scores, whether or not the game is in hard mode
+ */
+static void histogram_init(s_wordle_state            *wordle_state,
+                           const s_wordle_dictionary *dictionary,
+                           void                      *scratch)
+{
+    (void)dictionary;
+    (void)scratch;
+    wordle_state->hard_mode = true;
+}
+
+/*
+ *  anytime search for the guess that splits the candidates most evenly, see wordle-search.h
+ */
+static void search_init(s_wordle_state            *wordle_state,
+                        const s_wordle_dictionary *dictionary,
+                        void                      *scratch)
+{
+    (void)dictionary;
+    (void)scratch;
+    if(!wordle_state->search_budget.time_ns && !wordle_state->search_budget.work)
+    {
+        wordle_state->search_budget.work = SEARCH_DEFAULT_WORK;
+    }
+}
+
+static bool search_choose_guess(s_wordle_state            *wordle_state,
+                                const s_wordle_dictionary *dictionary,
+                                void                      *scratch,
+                                char                      guess[WORDLE_WORD_SIZE+1],
+                                bool                      verbose)
+{
+    s_search_result *result = scratch;
+    bool found = ws_search_guess(wordle_state, dictionary, &wordle_state->search_budget, result, verbose);
+    strcpy(guess, result->guess);
+    return found;
+}
+
+static const s_wordle_strategy letters_strategy =
+{
+    "letters", "letter count heuristic over the dictionary, or the candidates with -hard (the default)", 0,
+    letters_init, letters_choose_guess, letters_apply_feedback
+};
+
+static const s_wordle_strategy histogram_strategy =
+{
+    "histogram", "letter count heuristic with letters counted over the candidates (what -hard scores with)", 0,
+    histogram_init, letters_choose_guess, letters_apply_feedback
+};
+
+static const s_wordle_strategy search_strategy =
+{
+    "search", "budgeted search for the most even split (-budget-us/-budget-work, default 1M evaluations)",
+    sizeof(s_search_result),
+    search_init, search_choose_guess, letters_apply_feedback
+};
+
+const s_wordle_strategy *const ws_strategies[] = {&letters_strategy, &histogram_strategy, &search_strategy};
+const int ws_strategy_count = sizeof(ws_strategies)/sizeof(ws_strategies[0]);
+
+const s_wordle_strategy *ws_strategy_find(const char *name)
+{
+    for(int i=0; i<ws_strategy_count; i++)
+    {
+        if(!strcmp(ws_strategies[i]->name, name))
+        {
+            return ws_strategies[i];
+        }
+    }
+    return NULL;
+}
+
+/*
+ *  play one game against a known target with an initialized state, returns the number of guesses or
+ *  WS_STRATEGY_MAX_GUESSES+1 if the strategy gave out.  counts guesses the same way ws_make_guess() does.
+ */
+int ws_strategy_play(const s_wordle_strategy   *strategy,
+                     s_wordle_state            *wordle_state,
+                     const s_wordle_dictionary *dictionary,
+                     uint32_t                  target_word,
+                     void                      *scratch,
+                     bool                      verbose)
+{
+    if(strategy->scratch_size)
+    {
+        memset(scratch, 0, strategy->scratch_size);
+    }
+    strategy->init(wordle_state, dictionary, scratch);
+    
+    uint32_t target_mask = ws_word_letter_mask(target_word);
+    for(int guess_count=1; guess_count<=WS_STRATEGY_MAX_GUESSES; guess_count++)
+    {
+        char guess[WORDLE_WORD_SIZE+1] = {0};
+        if(strategy->choose_guess(wordle_state, dictionary, scratch, guess, verbose))
+        {
+            return guess_count;
+        }
+        
+        int pattern = ws_word_feedback(ws_word_encode(guess), target_word, target_mask);
+        if(strategy->apply_feedback(wordle_state, guess, pattern, scratch, verbose))
+        {
+            return guess_count;
+        }
+    }
+    return WS_STRATEGY_MAX_GUESSES+1;
+}
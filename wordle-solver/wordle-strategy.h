@@ -0,0 +1,47 @@
+//
+//  wordle-strategy.h
+//  wordle-solver
+//
+//  Guess strategies behind one interface so alternatives can be swapped in and compared (see
+//  wordle-tournament.h) without touching the solver.  A strategy owns how guesses are picked and how
+//  feedback is folded in; the hints and candidate sets in s_wordle_state are there for it to use.
+//
+
+#ifndef wordle_strategy_h
+#define wordle_strategy_h
+
+#include "wordle-solver.h"
+
+// a game still going after this many guesses is given up on and counted as lost
+#define WS_STRATEGY_MAX_GUESSES     50
+
+typedef struct s_wordle_strategy
+{
+    const char *name;
+    const char *description;
+    size_t     scratch_size;                // bytes of per game scratch memory handed to every callback
+
+    // set up for a new game, after ws_init().  scratch is zeroed
+    void (*init)(s_wordle_state *wordle_state, const s_wordle_dictionary *dictionary, void *scratch);
+
+    // pick the next guess, returns true if every letter is already known (guess holds the word)
+    bool (*choose_guess)(s_wordle_state *wordle_state, const s_wordle_dictionary *dictionary, void *scratch,
+                         char guess[WORDLE_WORD_SIZE+1], bool verbose);
+
+    // fold feedback for a guess into the state, returns 1 if the guess was the word
+    int (*apply_feedback)(s_wordle_state *wordle_state, const char *guess, int pattern, void *scratch, bool verbose);
+} s_wordle_strategy;
+
+extern const s_wordle_strategy *const ws_strategies[];
+extern const int ws_strategy_count;
+
+const s_wordle_strategy *ws_strategy_find(const char *name);
+
+int ws_strategy_play(const s_wordle_strategy   *strategy,
+                     s_wordle_state            *wordle_state,
+                     const s_wordle_dictionary *dictionary,
+                     uint32_t                  target_word,
+                     void                      *scratch,
+                     bool                      verbose);
+
+#endif /* wordle_strategy_h */
@@ -0,0 +1,224 @@
+//
+//  wordle-stream.c
+//  wordle-solver
+//
+//  Streaming feedback statistics, see wordle-stream.h.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "wordle-stream.h"
+#include "wordle-matrix.h"
+
+typedef struct s_stream_job
+{
+    s_bucket_table            *table;
+    const s_wordle_dictionary *dictionary;
+    const uint32_t            *answer_words;
+    const uint32_t            *answer_masks;
+    int                       first_guess;      // block being counted
+    int                       last_guess;
+    int                       *next_tile;       // shared, tiles of WS_MATRIX_TILE_GUESSES guesses within the block
+} s_stream_job;
+
+static void *stream_thread(void *arg)
+{
+    s_stream_job *job = arg;
+    s_bucket_table *table = job->table;
+    uint8_t patterns[WS_MATRIX_TILE_ANSWERS];
+    
+    // a tile's guesses keep their counts in cache while every answer tile streams past, so the only
+    // patterns ever held are one row of one tile
+    for(;;)
+    {
+        int guess_start = job->first_guess + __atomic_fetch_add(job->next_tile, 1, __ATOMIC_RELAXED)*WS_MATRIX_TILE_GUESSES;
+        if(guess_start >= job->last_guess)
+        {
+            break;
+        }
+        int guess_end = guess_start + WS_MATRIX_TILE_GUESSES;
+        if(guess_end > job->last_guess)
+        {
+            guess_end = job->last_guess;
+        }
+        
+        for(int answer_start=0; answer_start<table->answers; answer_start+=WS_MATRIX_TILE_ANSWERS)
+        {
+            int answer_count = table->answers - answer_start;
+            if(answer_count > WS_MATRIX_TILE_ANSWERS)
+            {
+                answer_count = WS_MATRIX_TILE_ANSWERS;
+            }
+            for(int g=guess_start; g<guess_end; g++)
+            {
+                uint32_t *counts = table->counts + (size_t)g*WS_FEEDBACK_PATTERNS;
+                ws_pattern_row(job->dictionary->words[g],
+                               job->answer_words + answer_start,
+                               job->answer_masks + answer_start,
+                               answer_count,
+                               patterns);
+                for(int a=0; a<answer_count; a++)
+                {
+                    counts[patterns[a]]++;
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+/*
+ *  map a zeroed scratch file big enough for the counts, the file is unlinked right away if it's temporary
+ */
+static uint32_t *map_scratch(const char *path,
+                             size_t     size)
+{
+    char temp_path[] = "/tmp/wordle-stream-XXXXXX";
+    int fd = path ? open(path, O_RDWR | O_CREAT | O_TRUNC, 0644) : mkstemp(temp_path);
+    if(fd < 0)
+    {
+        printf("couldn't create scratch file %s\n", path ? path : temp_path);
+        return NULL;
+    }
+    if(!path)
+    {
+        unlink(temp_path);
+    }
+    if(ftruncate(fd, (off_t)size))
+    {
+        printf("couldn't size scratch file %s\n", path ? path : temp_path);
+        close(fd);
+        return NULL;
+    }
+    void *counts = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if(counts == MAP_FAILED)
+    {
+        printf("couldn't map scratch file %s\n", path ? path : temp_path);
+        return NULL;
+    }
+    return counts;
+}
+
+/*
+ *  count the answers behind every pattern for every guess, returns nonzero on failure.  the counts stay in
+ *  memory if they fit under the cap, otherwise they go to the scratch file in blocks of guesses that fit, and
+ *  each finished block is written back and dropped so resident memory stays at about one block.
+ */
+int ws_stream_buckets(s_bucket_table            *table,
+                      const s_wordle_dictionary *dictionary,
+                      const s_stream_options    *options)
+{
+    uint64_t start = ws_now_ns();
+    
+    memset(table, 0, sizeof(s_bucket_table));
+    table->guesses = dictionary->entries;
+    table->answers = dictionary->answer_entries;
+    table->size = (size_t)table->guesses*WS_FEEDBACK_PATTERNS*sizeof(uint32_t);
+    
+    size_t row_size = WS_FEEDBACK_PATTERNS*sizeof(uint32_t);
+    int block_guesses = table->guesses;
+    if(options->memory_cap && table->size > options->memory_cap)
+    {
+        // whole tiles per block so the threads split it evenly, at least one even if the cap is tiny
+        uint64_t tiles = options->memory_cap/(row_size*WS_MATRIX_TILE_GUESSES);
+        block_guesses = (int)(tiles ? tiles : 1)*WS_MATRIX_TILE_GUESSES;
+        table->counts = map_scratch(options->scratch_path, table->size);
+        table->mapped = true;
+    }
+    else
+    {
+        table->counts = calloc(table->size ? table->size : 1, 1);
+    }
+    table->block_guesses = block_guesses;
+    uint32_t *answer_words = malloc(sizeof(uint32_t)*(size_t)(table->answers ? table->answers : 1));
+    uint32_t *answer_masks = malloc(sizeof(uint32_t)*(size_t)(table->answers ? table->answers : 1));
+    if(!table->counts || !answer_words || !answer_masks)
+    {
+        free(answer_words);
+        free(answer_masks);
+        ws_bucket_release(table);
+        return 1;
+    }
+    for(int a=0; a<table->answers; a++)
+    {
+        answer_words[a] = dictionary->words[dictionary->answers[a]];
+        answer_masks[a] = dictionary->letter_masks[dictionary->answers[a]];
+    }
+    
+    int threads = options->threads > 0 ? options->threads : 1;
+    pthread_t thread_ids[threads];
+    for(int first=0; first<table->guesses; first+=block_guesses)
+    {
+        int next_tile = 0;
+        s_stream_job job = {table, dictionary, answer_words, answer_masks, first,
+                            first + block_guesses < table->guesses ? first + block_guesses : table->guesses, &next_tile};
+        
+        // tiles are handed out as threads ask, so if some can't be started the rest just take longer
+        int started = 1;
+        while(started < threads && pthread_create(&thread_ids[started], NULL, stream_thread, &job) == 0)
+        {
+            started++;
+        }
+        stream_thread(&job);
+        for(int t=1; t<started; t++)
+        {
+            pthread_join(thread_ids[t], NULL);
+        }
+        
+        ws_bucket_drop(table, first, job.last_guess);
+        table->blocks++;
+    }
+    
+    free(answer_words);
+    free(answer_masks);
+    table->build_ns = ws_now_ns() - start;
+    return 0;
+}
+
+/*
+ *  write back and drop the resident pages of a range of guesses' counts, a no-op unless they're in the
+ *  scratch file.  reading them again maps them back in, so readers going through the table in order
+ *  can drop as they go to stay under the cap too.  only whole pages inside the range are dropped.
+ */
+void ws_bucket_drop(const s_bucket_table *table,
+                    int                  first_guess,
+                    int                  last_guess)
+{
+    if(!table->mapped)
+    {
+        return;
+    }
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    uintptr_t begin = ((uintptr_t)ws_bucket_counts(table, first_guess) + page-1) & ~(uintptr_t)(page-1);
+    uintptr_t end = (uintptr_t)ws_bucket_counts(table, last_guess) & ~(uintptr_t)(page-1);
+    if(end > begin)
+    {
+        msync((void *)begin, end - begin, MS_ASYNC);
+        madvise((void *)begin, end - begin, MADV_DONTNEED);
+    }
+}
+
+void ws_bucket_release(s_bucket_table *table)
+{
+    if(table->mapped)
+    {
+        if(table->counts)
+        {
+            munmap(table->counts, table->size);
+        }
+    }
+    else
+    {
+        free(table->counts);
+    }
+    table->counts = NULL;
+    table->guesses = 0;
+    table->answers = 0;
+}
@@ -0,0 +1,56 @@
+//
+//  wordle-stream.h
+//  wordle-solver
+//
+//  Streaming feedback statistics for word lists whose full pattern matrix is too big to keep around.  Patterns
+//  are computed a tile at a time and only folded into per guess bucket counts (how many answers give each
+//  pattern), and when even the counts don't fit under the memory cap they live in a mapped scratch file that
+//  is written out and dropped from memory one block of guesses at a time.
+//
+
+#ifndef wordle_stream_h
+#define wordle_stream_h
+
+#include "wordle-solver.h"
+
+#define WS_STREAM_DEFAULT_CAP       (1024*1024*1024ull)     // bytes
+
+typedef struct s_stream_options
+{
+    uint64_t   memory_cap;                  // bytes the counts may keep resident, 0 for no cap
+    const char *scratch_path;               // scratch file for counts over the cap, NULL for a temporary file
+    int        threads;
+} s_stream_options;
+
+typedef struct s_bucket_table
+{
+    int      guesses;                       // every dictionary entry
+    int      answers;                       // dictionary->answers
+    uint32_t *counts;                       // guesses*WS_FEEDBACK_PATTERNS answer counts, row major
+    bool     mapped;                        // counts are in the scratch file
+    size_t   size;
+    int      blocks;                        // blocks of guesses the table was built in
+    int      block_guesses;                 // guesses per block, what fits under the cap
+    uint64_t build_ns;
+} s_bucket_table;
+
+/*
+ *  answers giving each feedback pattern when guessing dictionary entry guess
+ */
+static inline const uint32_t *ws_bucket_counts(const s_bucket_table *table,
+                                               int                  guess)
+{
+    return table->counts + (size_t)guess*WS_FEEDBACK_PATTERNS;
+}
+
+int ws_stream_buckets(s_bucket_table            *table,
+                      const s_wordle_dictionary *dictionary,
+                      const s_stream_options    *options);
+
+void ws_bucket_drop(const s_bucket_table *table,
+                    int                  first_guess,
+                    int                  last_guess);
+
+void ws_bucket_release(s_bucket_table *table);
+
+#endif /* wordle_stream_h */
@@ -0,0 +1,131 @@
+//
+//  wordle-tables-gen.c
+//  wordle-solver
+//
+//  Build step that turns the word lists in wordle-words.h into wordle-tables.c, a prepared
+//  s_wordle_dictionary whose packed words and tables are all const so they land in read only data.  Only
+//  the bitset index is built at startup.  Not part of the solver itself; the "Generate Tables" build phase
+//  compiles and runs it with
+//
+//      cc -o wordle-tables-gen wordle-tables-gen.c wordle-dictionary.c wordle-index.c
+//      ./wordle-tables-gen wordle-tables.c
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "wordle-dictionary.h"
+#include "wordle-words.h"
+
+#define WORDS_PER_LINE              8
+#define VALUES_PER_LINE             16
+
+static void write_table_end(FILE *fp, int count, int per_line)
+{
+    if(count % per_line)
+    {
+        fprintf(fp, "\n");
+    }
+    fprintf(fp, "};\n\n");
+}
+
+int main(int argc, const char * argv[])
+{
+    if(argc != 2)
+    {
+        printf("usage: %s wordle-tables.c\n", argv[0]);
+        return 1;
+    }
+    
+    s_wordle_dictionary dictionary;
+    if(ws_dictionary_build(&dictionary, wordle_full_dictionary, LEN_WORDLE_DICTIONARY, wordle_target_words, LEN_WORDLE_TARGET_WORDS))
+    {
+        printf("couldn't prepare the Wordle dictionary; exiting...\n");
+        return 1;
+    }
+    
+    FILE *fp = fopen(argv[1], "w");
+    if(!fp)
+    {
+        printf("couldn't write %s; exiting...\n", argv[1]);
+        return 1;
+    }
+    
+    fprintf(fp, "//\n//  wordle-tables.c\n//  wordle-solver\n//\n");
+    fprintf(fp, "//  Generated from wordle-words.h by wordle-tables-gen, do not edit.\n//\n\n");
+    fprintf(fp, "#include \"wordle-tables.h\"\n\n");
+    
+    // packed words, each line followed by the words it holds
+    fprintf(fp, "static const uint32_t wordle_words[%d] = {\n", dictionary.entries);
+    for(int i=0; i<dictionary.entries; i+=WORDS_PER_LINE)
+    {
+        int line_end = i+WORDS_PER_LINE < dictionary.entries ? i+WORDS_PER_LINE : dictionary.entries;
+        fprintf(fp, "\t");
+        for(int j=i; j<line_end; j++)
+        {
+            fprintf(fp, "0x%07x,", dictionary.words[j]);
+        }
+        fprintf(fp, "%*s//", 11*(WORDS_PER_LINE-(line_end-i))+1, "");
+        for(int j=i; j<line_end; j++)
+        {
+            char word[WORDLE_WORD_SIZE+1];
+            ws_word_decode(dictionary.words[j], word);
+            fprintf(fp, " %s", word);
+        }
+        fprintf(fp, "\n");
+    }
+    fprintf(fp, "};\n\n");
+    
+    fprintf(fp, "static const uint32_t wordle_letter_masks[%d] = {\n", dictionary.entries);
+    for(int i=0; i<dictionary.entries; i++)
+    {
+        fprintf(fp, "%s0x%07x,", (i % VALUES_PER_LINE) ? "" : "\t", dictionary.letter_masks[i]);
+        if(i % VALUES_PER_LINE == VALUES_PER_LINE-1)
+        {
+            fprintf(fp, "\n");
+        }
+    }
+    write_table_end(fp, dictionary.entries, VALUES_PER_LINE);
+    
+    fprintf(fp, "static const uint8_t wordle_flags[%d] = {\n", dictionary.entries);
+    for(int i=0; i<dictionary.entries; i++)
+    {
+        fprintf(fp, "%s%d,", (i % VALUES_PER_LINE) ? "" : "\t", dictionary.flags[i]);
+        if(i % VALUES_PER_LINE == VALUES_PER_LINE-1)
+        {
+            fprintf(fp, "\n");
+        }
+    }
+    write_table_end(fp, dictionary.entries, VALUES_PER_LINE);
+    
+    fprintf(fp, "static const uint32_t wordle_answers[%d] = {\n", dictionary.answer_entries);
+    for(int i=0; i<dictionary.answer_entries; i++)
+    {
+        fprintf(fp, "%s%u,", (i % VALUES_PER_LINE) ? "" : "\t", dictionary.answers[i]);
+        if(i % VALUES_PER_LINE == VALUES_PER_LINE-1)
+        {
+            fprintf(fp, "\n");
+        }
+    }
+    write_table_end(fp, dictionary.answer_entries, VALUES_PER_LINE);
+    
+    fprintf(fp, "const s_wordle_dictionary wordle_builtin_dictionary = {\n");
+    fprintf(fp, "\t.entries = %d,\n", dictionary.entries);
+    fprintf(fp, "\t.answer_entries = %d,\n", dictionary.answer_entries);
+    fprintf(fp, "\t.words = wordle_words,\n");
+    fprintf(fp, "\t.letter_masks = wordle_letter_masks,\n");
+    fprintf(fp, "\t.flags = wordle_flags,\n");
+    fprintf(fp, "\t.answers = wordle_answers,\n");
+    fprintf(fp, "\t.hash = 0x%016llxull,\n", (unsigned long long)dictionary.hash);
+    fprintf(fp, "};\n");
+    
+    int failed = ferror(fp);
+    fclose(fp);
+    ws_dictionary_release(&dictionary);
+    if(failed)
+    {
+        printf("couldn't write %s; exiting...\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,3419 @@
+//
+//  wordle-tables.c
+//  wordle-solver
+//
+//  Generated from wordle-words.h by wordle-tables-gen, do not edit.
+//
+
+#include "wordle-tables.h"
+
+static const uint32_t wordle_words[12972] = {
+	0x0321c00,0x0842c00,0x0734400,0x089c400,0x0010020,0x0810020,0x1210020,0x1328020, // aahed aalii aargh aarti abaca abaci abacs abaft
+	0x0050020,0x0f60020,0x0368020,0x0790020,0x0a90020,0x00c0020,0x1200420,0x0320420, // abaka abamp aband abash abask abaya abbas abbed
+	0x1220420,0x0420820,0x0c01020,0x1101020,0x0459020,0x1289020,0x1299020,0x1222020, // abbes abcee abeam abear abele abers abets abies
+	0x1122c20,0x1222c20,0x1322c20,0x1672c20,0x0e3b020,0x0c3b820,0x0b43820,0x0063820, // abler ables ablet ablow abmho abohm aboil aboma
+	0x0d73820,0x038b820,0x048b820,0x0c04420,0x1804420,0x0c44420,0x0d44420,0x1244420, // aboon abord abore abram abray abrim abrin abris
+	0x1824820,0x1344820,0x006d020,0x046d020,0x129d020,0x19cd020,0x1226020,0x0c96020, // absey absit abuna abune abuts abuzz abyes abysm
+	0x1240040,0x0888040,0x1200840,0x1870840,0x0189040,0x1289040,0x0099040,0x1101c40, // acais acari accas accoy acerb acers aceta achar
+	0x0321c40,0x1221c40,0x0e71c40,0x121a040,0x181a040,0x066a040,0x086a040,0x0422840, // ached aches achoo acids acidy acing acini ackee
+	0x1122840,0x1223040,0x0243040,0x0323440,0x1223440,0x0a13840,0x035b840,0x0324440, // acker acmes acmic acned acnes acock acold acred
+	0x1224440,0x1274440,0x0324c40,0x0d44c40,0x0d74c40,0x125e040,0x12b0060,0x12c0060, // acres acros acted actin acton acyls adaws adays
+	0x1370460,0x1700c60,0x0320c60,0x1120c60,0x0e40c60,0x0458c60,0x0c21060,0x0d01c60, // adbot addax added adder addio addle adeem adhan
+	0x1422060,0x1272060,0x129a060,0x0d03060,0x0d23060,0x1743060,0x0e0b860,0x0db3860, // adieu adios adits adman admen admix adobo adown
+	0x04cb860,0x0304460,0x0324460,0x0ca4860,0x0855060,0x026d060,0x1395060,0x1625460, // adoze adrad adred adsum aduki adunc adust advew
+	0x009e060,0x0326460,0x1226460,0x0040880,0x1220c80,0x1241880,0x126b880,0x0444480, // adyta adzed adzes aecia aedes aegis aeons aerie
+	0x1274480,0x1144880,0x03580a0,0x00880a0,0x12880a0,0x11010a0,0x0902ca0,0x048b8a0, // aeros aesir afald afara afars afear aflaj afore
+	0x13444a0,0x12744a0,0x00600c0,0x08600c0,0x12880c0,0x13900c0,0x04a80c0,0x04c80c0, // afrit afros agama agami agars agast agave agaze
+	0x04690c0,0x12890c0,0x11218c0,0x04418c0,0x08898c0,0x0e898c0,0x18898c0,0x1201cc0, // agene agers agger aggie aggri aggro aggry aghas
+	0x005a0c0,0x12720c0,0x0c920c0,0x13920c0,0x009a0c0,0x0422cc0,0x1322cc0,0x1822cc0, // agila agios agism agist agita aglee aglet agley
+	0x0e72cc0,0x12a2cc0,0x12030c0,0x04338c0,0x046b8c0,0x126b8c0,0x03738c0,0x00444c0, // agloo aglus agmas agoge agone agons agood agria
+	0x0d444c0,0x12744c0,0x03250c0,0x12250c0,0x006d0c0,0x089d0c0,0x0f010e0,0x13690e0, // agrin agros agued agues aguna aguti aheap ahent
+	0x07320e0,0x036a0e0,0x066a0e0,0x136a0e0,0x035b8e0,0x0b5d0e0,0x148d0e0,0x1200d00, // ahigh ahind ahing ahint ahold ahull ahuru aidas
+	0x0320d00,0x1220d00,0x0870d00,0x1270d00,0x1889100,0x1201900,0x1339900,0x0322d00, // aided aides aidoi aidos aiery aigas aight ailed
+	0x0323100,0x1123100,0x0423500,0x0033500,0x085b900,0x0324500,0x1124500,0x126c500, // aimed aimer ainee ainga aioli aired airer airns
+	0x079c500,0x129c500,0x0714d00,0x12a4d00,0x1125500,0x0426100,0x045e500,0x1222120, // airth airts aitch aitus aiver aiyee aizle ajies
+	0x00aa120,0x0035120,0x0d05920,0x1221140,0x0059140,0x0469140,0x066a140,0x009a140, // ajiva ajuga ajwan akees akela akene aking akita
+	0x1202940,0x0f00160,0x0a10160,0x0e60160,0x0368160,0x0468160,0x0668160,0x1268160, // akkas alaap alack alamo aland alane alang alans
+	0x1368160,0x0078160,0x1278160,0x1888160,0x0498160,0x12c0160,0x1200560,0x0420560, // alant alapa alaps alary alate alays albas albee
+	0x0340960,0x1270960,0x0020d60,0x1120d60,0x0b70d60,0x0a11160,0x1211160,0x1229160, // alcid alcos aldea alder aldol aleck alecs alefs
+	0x1329160,0x0779160,0x12b1160,0x04c1160,0x1201560,0x0b01960,0x1201960,0x0341960, // aleft aleph alews aleye alfas algal algas algid
+	0x0d41960,0x1171960,0x0ca1960,0x1202160,0x122a160,0x046a160,0x1392160,0x00c2160, // algin algor algum alias alifs aline alist aliya
+	0x0442960,0x1272960,0x03c2960,0x0bc2960,0x0422d60,0x0b22d60,0x1242d60,0x0372d60, // alkie alkos alkyd alkyl allee allel allis allod
+	0x0bc2d60,0x0703160,0x1203160,0x0723160,0x1223160,0x03a3160,0x06a3160,0x121b960, // allyl almah almas almeh almes almud almug alods
+	0x0323960,0x1223960,0x003b960,0x0d43960,0x1273960,0x04b3960,0x0e3cd60,0x1274d60, // aloed aloes aloha aloin aloos alowe altho altos
+	0x005d160,0x1265160,0x048d160,0x1105560,0x1805960,0x1238180,0x0d40180,0x0498180, // alula alums alure alvar alway amahs amain amate
+	0x13a0180,0x0d00580,0x1340580,0x1270580,0x1888580,0x0009180,0x1121180,0x0469180, // amaut amban ambit ambos ambry ameba ameer amene
+	0x1269180,0x1369180,0x1202180,0x0412180,0x0812180,0x041a180,0x0e1a180,0x121a180, // amens ament amias amice amici amide amido amids
+	0x1222180,0x0032180,0x0e32180,0x046a180,0x0e6a180,0x126a180,0x128a180,0x1202d80, // amies amiga amigo amine amino amins amirs amlas
+	0x0d03180,0x0d73180,0x1273180,0x0043580,0x0243580,0x0e43580,0x1253980,0x045b980, // amman ammon ammos amnia amnic amnio amoks amole
+	0x138b980,0x11a3980,0x04ab980,0x13b3980,0x0323d80,0x0ba3d80,0x1344580,0x0a15180, // amort amour amove amowt amped ampul amrit amuck
+	0x125e180,0x00681a0,0x00981a0,0x0e389a0,0x04589a0,0x0d709a0,0x0e88da0,0x11011a0, // amyls anana anata ancho ancle ancon andro anear
+	0x04591a0,0x13691a0,0x12019a0,0x0e599a0,0x07321a0,0x045a1a0,0x125a1a0,0x00621a0, // anele anent angas anglo anigh anile anils anima
+	0x08621a0,0x0d721a0,0x04921a0,0x11229a0,0x123a9a0,0x12a29a0,0x1202da0,0x0b035a0, // animi anion anise anker ankhs ankus anlas annal
+	0x12035a0,0x13035a0,0x12039a0,0x045b9a0,0x18639a0,0x04049a0,0x0404da0,0x1104da0, // annas annat anoas anole anomy ansae antae antar
+	0x1204da0,0x0324da0,0x1224da0,0x1244da0,0x008cda0,0x048cda0,0x1894da0,0x008d1a0, // antas anted antes antis antra antre antsy anura
+	0x0d761a0,0x04101e0,0x04301e0,0x03401e0,0x03c01e0,0x12c01e0,0x0a011e0,0x0a211e0, // anyon apace apage apaid apayd apays apeak apeek
+	0x12891e0,0x13891e0,0x18891e0,0x11019e0,0x1241de0,0x0d021e0,0x0b721e0,0x07921e0, // apers apert apery apgar aphis apian apiol apish
+	0x0c921e0,0x041b9e0,0x121b9e0,0x0f739e0,0x138b9e0,0x0b03de0,0x1803de0,0x0b23de0, // apism apode apods apoop aport appal appay appel
+	0x0e8bde0,0x08a3de0,0x18a3de0,0x12245e0,0x12249e0,0x12449e0,0x12749e0,0x0324de0, // appro appui appuy apres apses apsis apsos apted
+	0x1124de0,0x0405200,0x1205200,0x0008220,0x1250220,0x0460220,0x1288220,0x1200620, // apter aquae aquas araba araks arame arars arbas
+	0x0320a20,0x0838a20,0x1270a20,0x12a0a20,0x0120e20,0x0888e20,0x0301220,0x0401220, // arced archi arcos arcus ardeb ardri aread areae
+	0x0b01220,0x1101220,0x1201220,0x0011220,0x0319220,0x0419220,0x1829220,0x0241220, // areal arear areas areca aredd arede arefy areic
+	0x0469220,0x0079220,0x0489220,0x0499220,0x1299220,0x1399220,0x0b01a20,0x0d01a20, // arene arepa arere arete arets arett argal argan
+	0x0b41a20,0x0459a20,0x0b71a20,0x0d71a20,0x1371a20,0x12a1a20,0x1301e20,0x1202220, // argil argle argol argon argot argus arhat arias
+	0x0b22220,0x0852220,0x125a220,0x1372220,0x0792220,0x0322a20,0x0322e20,0x1222e20, // ariel ariki arils ariot arish arked arled arles
+	0x0323220,0x1123220,0x1323220,0x0b43220,0x1203620,0x13a3620,0x000ba20,0x003ba20, // armed armer armet armil arnas arnut aroba aroha
+	0x0343a20,0x1203e20,0x0d23e20,0x0704620,0x1204620,0x1324620,0x1244620,0x1974620, // aroid arpas arpen arrah arras arret arris arroz
+	0x0324a20,0x1224a20,0x1824a20,0x1244a20,0x0b04e20,0x0b24e20,0x0244e20,0x1244e20, // arsed arses arsey arsis artal artel artic artis
+	0x043d220,0x1265220,0x0b05620,0x0425620,0x1275620,0x125e220,0x0068240,0x0d70a40, // aruhe arums arval arvee arvos aryls asana ascon
+	0x12a0a40,0x0240e40,0x0321e40,0x1221e40,0x1321e40,0x0322a40,0x1122a40,0x0872a40, // ascus asdic ashed ashes ashet asked asker askoi
+	0x1272a40,0x0d23e40,0x1123e40,0x0243e40,0x0443e40,0x1243e40,0x0e8be40,0x0804a40, // askos aspen asper aspic aspie aspis aspro assai
+	0x0c04a40,0x1224a40,0x1924a40,0x1374a40,0x1124e40,0x1144e40,0x0da4e40,0x008d240, // assam asses assez assot aster astir astun asura
+	0x1805a40,0x0c45a40,0x005e240,0x1278260,0x18b8260,0x0832260,0x135a260,0x1862260, // asway aswim asyla ataps ataxy atigi atilt atimy
+	0x1202e60,0x0d03260,0x1203260,0x1273260,0x1213a60,0x0453a60,0x1253a60,0x1263a60, // atlas atman atmas atmos atocs atoke atoks atoms
+	0x1863a60,0x186ba60,0x187ba60,0x0044660,0x0f44660,0x0f04e60,0x1104e60,0x1205260, // atomy atony atopy atria atrip attap attar atuas
+	0x0300e80,0x1121a80,0x1339a80,0x1202e80,0x0242e80,0x0872e80,0x1272e80,0x0b43280, // audad auger aught aulas aulic auloi aulos aumil
+	0x1223680,0x129b680,0x0404680,0x0b04680,0x1104680,0x1204680,0x0824680,0x1224680, // aunes aunts aurae aural aurar auras aurei aures
+	0x0244680,0x1244680,0x0ca4680,0x1274e80,0x0d45e80,0x04582a0,0x13682a0,0x13902a0, // auric auris aurum autos auxin avale avant avast
+	0x12592a0,0x12692a0,0x12892a0,0x1201aa0,0x046a2a0,0x0d722a0,0x04922a0,0x0e922a0, // avels avens avers avgas avine avion avise aviso
+	0x04ca2a0,0x12b3aa0,0x04ce2a0,0x0d882c0,0x0e982c0,0x04a82c0,0x12c02c0,0x1258ec0, // avize avows avyze awarn awato awave aways awdls
+	0x0b212c0,0x0e992c0,0x066a2c0,0x188b2c0,0x03236c0,0x11236c0,0x125bac0,0x0a8bac0, // aweel aweto awing awmry awned awner awols awork
+	0x12592e0,0x045a2e0,0x125a2e0,0x066a2e0,0x049a2e0,0x0322ee0,0x1222ee0,0x0d032e0, // axels axile axils axing axite axled axles axman
+	0x0d232e0,0x0343ae0,0x046bae0,0x126bae0,0x1238300,0x00c0300,0x0f59300,0x0489b00, // axmen axoid axone axons ayahs ayaya ayelp aygre
+	0x126a300,0x136bb00,0x1224700,0x0444700,0x1268320,0x041a320,0x0e1a320,0x046a320, // ayins ayont ayres ayrie azans azide azido azine
+	0x0d72f20,0x0243b20,0x045bb20,0x126bb20,0x049bb20,0x079bb20,0x0855320,0x0d8d320, // azlon azoic azole azons azote azoth azuki azurn
+	0x188d320,0x1836320,0x0466320,0x1266320,0x0320001,0x1258001,0x1200401,0x0b20401, // azury azygy azyme azyms baaed baals babas babel
+	0x1220401,0x0050401,0x0e70401,0x0ba0401,0x12a0401,0x0010801,0x0e10801,0x1810801, // babes babka baboo babul babus bacca bacco baccy
+	0x0038801,0x1238801,0x1250801,0x1818c01,0x1259001,0x1229401,0x1829401,0x1299401, // bacha bachs backs baddy baels baffs baffy bafts
+	0x1239801,0x0441801,0x1299c01,0x12a1c01,0x13a1c01,0x125a001,0x0d8a001,0x0092001, // baghs bagie bahts bahus bahut bails bairn baisa
+	0x079a001,0x129a001,0x00ca001,0x04ca001,0x0d02401,0x008a401,0x088a401,0x12a2401, // baith baits baiza baize bajan bajra bajri bajus
+	0x0322801,0x0d22801,0x1222801,0x008a801,0x1202c01,0x121ac01,0x181ac01,0x0322c01, // baked baken bakes bakra balas balds baldy baled
+	0x1222c01,0x1252c01,0x1852c01,0x125ac01,0x185ac01,0x1262c01,0x0e72c01,0x0092c01, // bales balks balky balls bally balms baloo balsa
+	0x089ac01,0x0da2c01,0x12a2c01,0x080b001,0x0a03401,0x0e13401,0x1213401,0x001b401, // balti balun balus bambi banak banco bancs banda
+	0x071b401,0x121b401,0x181b401,0x0323401,0x1223401,0x1233401,0x0043401,0x1253401, // bandh bands bandy baned banes bangs bania banks
+	0x126b401,0x129b401,0x149b401,0x189b401,0x00c3401,0x12a3c01,0x040c401,0x120c401, // banns bants bantu banty banya bapus barbe barbs
+	0x180c401,0x0014401,0x041c401,0x0e1c401,0x121c401,0x181c401,0x0324401,0x1124401, // barby barca barde bardo bards bardy bared barer
+	0x1224401,0x082c401,0x122c401,0x0244401,0x1254401,0x1854401,0x1264401,0x1864401, // bares barfi barfs baric barks barky barms barmy
+	0x126c401,0x186c401,0x127c401,0x008c401,0x048c401,0x0e8c401,0x188c401,0x04c4401, // barns barny barps barra barre barro barry barye
+	0x0d04801,0x0324801,0x0d24801,0x1124801,0x1224801,0x0e3c801,0x0944801,0x1254801, // basan based basen baser bases basho basij basks
+	0x0d74801,0x0494801,0x0894801,0x0e94801,0x1894801,0x009c801,0x089c801,0x0e9c801, // bason basse bassi basso bassy basta basti basto
+	0x129c801,0x0324c01,0x1224c01,0x123cc01,0x0a44c01,0x009cc01,0x129cc01,0x149cc01, // basts bated bates baths batik batta batts battu
+	0x121d001,0x1255001,0x0a5d001,0x128d001,0x0d45401,0x121d801,0x1255801,0x125d801, // bauds bauks baulk baurs bavin bawds bawks bawls
+	0x126d801,0x128d801,0x189d801,0x0326001,0x1126001,0x1226001,0x045e001,0x129e001, // bawns bawrs bawty bayed bayer bayes bayle bayts
+	0x1106401,0x0e76401,0x1218081,0x1250081,0x1850081,0x1258081,0x1260081,0x1860081, // bazar bazoo beads beaks beaky beals beams beamy
+	0x0e68081,0x1268081,0x1868081,0x0488081,0x1288081,0x0798081,0x1298081,0x1898081, // beano beans beany beare bears beath beats beaty
+	0x12a0081,0x13a0081,0x17a0081,0x0f70481,0x0f00881,0x0450881,0x1250881,0x0300c81, // beaus beaut beaux bebop becap becke becks bedad
+	0x0b20c81,0x1220c81,0x1620c81,0x0c40c81,0x04c0c81,0x0819081,0x1229081,0x1279081, // bedel bedes bedew bedim bedye beedi beefs beeps
+	0x1289081,0x1889081,0x1299081,0x0671481,0x0301881,0x1101881,0x0c21881,0x1371881, // beers beery beets befog begad begar begem begot
+	0x0ca1881,0x0432081,0x1832081,0x126a081,0x0702881,0x0702c81,0x1102c81,0x1802c81, // begum beige beigy beins bekah belah belar belay
+	0x0422c81,0x0032c81,0x125ac81,0x0d72c81,0x129ac81,0x0303081,0x1203081,0x1743081, // belee belga bells belon belts bemad bemas bemix
+	0x03a3081,0x121b481,0x181b481,0x1223481,0x1323481,0x0033481,0x1243481,0x046b481, // bemud bends bendy benes benet benga benis benne
+	0x086b481,0x186b481,0x0e9b481,0x129b481,0x189b481,0x1303c81,0x1804481,0x1224481, // benni benny bento bents benty bepat beray beres
+	0x1234481,0x0e54481,0x1254481,0x0464481,0x1264481,0x0174481,0x0bc4481,0x1304881, // bergs berko berks berme berms berob beryl besat
+	0x1604881,0x0424881,0x1224881,0x1344881,0x0c74881,0x1374881,0x089c881,0x129c881, // besaw besee beses besit besom besot besti bests
+	0x1204c81,0x0324c81,0x1224c81,0x123cc81,0x0344c81,0x0d74c81,0x009cc81,0x189cc81, // betas beted betes beths betid beton betta betty
+	0x1125481,0x1175481,0x04a5481,0x18ad481,0x1325881,0x0645881,0x1226481,0x0b46481, // bever bevor bevue bevvy bewet bewig bezes bezil
+	0x18ce481,0x12400e1,0x08480e1,0x06680e1,0x12980e1,0x12590e1,0x13738e1,0x006d0e1, // bezzy bhais bhaji bhang bhats bhels bhoot bhuna
+	0x129d0e1,0x0710101,0x0858101,0x1858101,0x1208501,0x1220501,0x1810901,0x1220901, // bhuts biach biali bialy bibbs bibes biccy bices
+	0x0320d01,0x1120d01,0x1220d01,0x1320d01,0x1240d01,0x0d70d01,0x0359101,0x1289101, // bided bider bides bidet bidis bidon bield biers
+	0x0e29501,0x1229501,0x1829501,0x0341501,0x0401901,0x1231901,0x1831901,0x0039901, // biffo biffs biffy bifid bigae biggs biggy bigha
+	0x1339901,0x1859901,0x1271901,0x1472501,0x0322901,0x1122901,0x1222901,0x0442901, // bight bigly bigos bijou biked biker bikes bikie
+	0x0e0ad01,0x180ad01,0x0322d01,0x1222d01,0x1832d01,0x1252d01,0x125ad01,0x0703101, // bilbo bilby biled biles bilgy bilks bills bimah
+	0x1203101,0x0e0b101,0x0b03501,0x081b501,0x121b501,0x1123501,0x1223501,0x1233501, // bimas bimbo binal bindi binds biner bines bings
+	0x1833501,0x1343501,0x1253501,0x129b501,0x1233901,0x136b901,0x009b901,0x0323d01, // bingy binit binks bints biogs biont biota biped
+	0x0373d01,0x121c501,0x1254501,0x045c501,0x125c501,0x1274501,0x128c501,0x0494501, // bipod birds birks birle birls biros birrs birse
+	0x1894501,0x1224901,0x1254901,0x0c74901,0x0714d01,0x1124d01,0x1224d01,0x1274d01, // birsy bises bisks bisom bitch biter bites bitos
+	0x1474d01,0x1894d01,0x049cd01,0x129cd01,0x0045501,0x18ad501,0x1226501,0x0ece501, // bitou bitsy bitte bitts bivia bivvy bizes bizzo
+	0x18ce501,0x1208161,0x1218161,0x1818161,0x1120161,0x1220161,0x0528161,0x1230161, // bizzy blabs blads blady blaer blaes blaff blags
+	0x1238161,0x0d40161,0x1260161,0x1388161,0x0490161,0x0790161,0x0498161,0x1298161, // blahs blain blams blart blase blash blate blats
+	0x1398161,0x03a0161,0x0db0161,0x12b0161,0x12c0161,0x1101161,0x1209161,0x0711161, // blatt blaud blawn blaws blays blear blebs blech
+	0x1221161,0x1369161,0x1389161,0x1391161,0x1299161,0x12c1161,0x1862161,0x066a161, // blees blent blert blest blets bleys blimy bling
+	0x086a161,0x126a161,0x186a161,0x127a161,0x1392161,0x049a161,0x129a161,0x04aa161, // blini blins bliny blips blist blite blits blive
+	0x120b961,0x1213961,0x1233961,0x0a73961,0x0f73961,0x048b961,0x129b961,0x12b3961, // blobs blocs blogs blook bloop blore blots blows
+	0x18b3961,0x120d161,0x041d161,0x121d161,0x181d161,0x0325161,0x1225161,0x1325161, // blowy blubs blude bluds bludy blued blues bluet
+	0x1825161,0x0345161,0x0465161,0x0a6d161,0x128d161,0x047e161,0x12081c1,0x12501c1, // bluey bluid blume blunk blurs blype boabs boaks
+	0x12881c1,0x13881c1,0x12981c1,0x02005c1,0x0a005c1,0x12005c1,0x0b705c1,0x12705c1, // boars boart boats bobac bobak bobas bobol bobos
+	0x00109c1,0x04109c1,0x08109c1,0x04389c1,0x12509c1,0x0320dc1,0x1220dc1,0x0430dc1, // bocca bocce bocci boche bocks boded bodes bodge
+	0x0838dc1,0x0458dc1,0x12791c1,0x12991c1,0x05a11c1,0x0e295c1,0x12295c1,0x0d019c1, // bodhi bodle boeps boets boeuf boffo boffs bogan
+	0x18219c1,0x18319c1,0x04419c1,0x04599c1,0x04a19c1,0x12a19c1,0x0021dc1,0x1271dc1, // bogey boggy bogie bogle bogue bogus bohea bohos
+	0x125a1c1,0x066a1c1,0x0a6a1c1,0x049a1c1,0x03229c1,0x07229c1,0x12229c1,0x12729c1, // boils boing boink boite boked bokeh bokes bokos
+	0x1102dc1,0x1202dc1,0x121adc1,0x1222dc1,0x1742dc1,0x125adc1,0x1272dc1,0x129adc1, // bolar bolas bolds boles bolix bolls bolos bolts
+	0x12a2dc1,0x12031c1,0x040b1c1,0x0e0b1c1,0x120b1c1,0x04135c1,0x121b5c1,0x03235c1, // bolus bomas bombe bombo bombs bonce bonds boned
+	0x11235c1,0x12235c1,0x12335c1,0x04435c1,0x12535c1,0x046b5c1,0x186b5c1,0x00cb5c1, // boner bones bongs bonie bonks bonne bonny bonza
+	0x04cb5c1,0x08039c1,0x18039c1,0x120b9c1,0x181b9c1,0x03239c1,0x182b9c1,0x18339c1, // bonze booai booay boobs boody booed boofy boogy
+	0x123b9c1,0x12539c1,0x18539c1,0x125b9c1,0x12639c1,0x18639c1,0x066b9c1,0x126b9c1, // boohs books booky bools booms boomy boong boons
+	0x038b9c1,0x128b9c1,0x04939c1,0x129b9c1,0x187bdc1,0x0a045c1,0x0b045c1,0x12045c1, // boord boors boose boots boppy borak boral boras
+	0x041c5c1,0x121c5c1,0x03245c1,0x04245c1,0x0b245c1,0x11245c1,0x12245c1,0x0e345c1, // borde bords bored boree borel borer bores borgo
+	0x02445c1,0x12545c1,0x12645c1,0x006c5c1,0x0d745c1,0x129c5c1,0x189c5c1,0x199c5c1, // boric borks borms borna boron borts borty bortz
+	0x04449c1,0x12549c1,0x18549c1,0x0d749c1,0x0da49c1,0x1204dc1,0x0b24dc1,0x1224dc1, // bosie bosks bosky boson bosun botas botel botes
+	0x183cdc1,0x049cdc1,0x129cdc1,0x189cdc1,0x04351c1,0x12551c1,0x135d1c1,0x126d1c1, // bothy botte botts botty bouge bouks boult bouns
+	0x038d1c1,0x068d1c1,0x0d8d1c1,0x04951c1,0x18951c1,0x129d1c1,0x03455c1,0x13059c1, // bourd bourg bourn bouse bousy bouts bovid bowat
+	0x03259c1,0x11259c1,0x12259c1,0x13259c1,0x04459c1,0x125d9c1,0x046d9c1,0x128d9c1, // bowed bower bowes bowet bowie bowls bowne bowrs
+	0x04959c1,0x0325dc1,0x0d25dc1,0x1225dc1,0x005ddc1,0x189ddc1,0x11061c1,0x14061c1, // bowse boxed boxen boxes boxla boxty boyar boyau
+	0x03261c1,0x122e1c1,0x12361c1,0x005e1c1,0x12761c1,0x18961c1,0x12765c1,0x0800221, // boyed boyfs boygs boyla boyos boysy bozos braai
+	0x0710221,0x0a10221,0x1310221,0x1218221,0x1220221,0x1230221,0x0b40221,0x1250221, // brach brack bract brads braes brags brail braks
+	0x1850221,0x0460221,0x0468221,0x0a68221,0x1268221,0x1368221,0x1390221,0x1298221, // braky brame brane brank brans brant brast brats
+	0x00a8221,0x08a8221,0x12b0221,0x18b8221,0x12c0221,0x00c8221,0x04c8221,0x0c01221, // brava bravi braws braxy brays braza braze bream
+	0x0419221,0x1219221,0x0c21221,0x1121221,0x1221221,0x0341221,0x1241221,0x0461221, // brede breds breem breer brees breid breis breme
+	0x1269221,0x1369221,0x0489221,0x1289221,0x04a9221,0x12b1221,0x12c1221,0x1122221, // brens brent brere brers breve brews breys brier
+	0x1222221,0x1232221,0x0852221,0x1252221,0x0b5a221,0x1262221,0x126a221,0x1272221, // bries brigs briki briks brill brims brins brios
+	0x0492221,0x1292221,0x079a221,0x129a221,0x139a221,0x04ca221,0x0713a21,0x0a13a21, // brise briss brith brits britt brize broch brock
+	0x121ba21,0x0733a21,0x1233a21,0x0463a21,0x0e63a21,0x026ba21,0x036ba21,0x0b73a21, // brods brogh brogs brome bromo bronc brond brool
+	0x1273a21,0x0493a21,0x1893a21,0x12b3a21,0x0735221,0x0d45221,0x1345221,0x045d221, // broos brose brosy brows brugh bruin bruit brule
+	0x0465221,0x066d221,0x0a95221,0x1395221,0x129d221,0x1298281,0x04c8281,0x0b00681, // brume brung brusk brust bruts buats buaze bubal
+	0x1200681,0x0008681,0x0408681,0x1808681,0x12a0681,0x1438a81,0x0e50a81,0x1250a81, // bubas bubba bubbe bubby bubus buchu bucko bucks
+	0x1450a81,0x1200e81,0x1240e81,0x1270e81,0x0029681,0x0429681,0x0829681,0x0e29681, // bucku budas budis budos buffa buffe buffi buffo
+	0x1229681,0x1829681,0x1271681,0x1899681,0x1259e81,0x1289e81,0x1252281,0x1392281, // buffs buffy bufos bufty buhls buhrs buiks buist
+	0x1222a81,0x120ae81,0x1832e81,0x1252e81,0x005ae81,0x125ae81,0x0492e81,0x0e0b281, // bukes bulbs bulgy bulks bulla bulls bulse bumbo
+	0x122b281,0x077b281,0x127b281,0x187b281,0x1203681,0x0413681,0x0e13681,0x041b681, // bumfs bumph bumps bumpy bunas bunce bunco bunde
+	0x071b681,0x121b681,0x131b681,0x141b681,0x181b681,0x1233681,0x1833681,0x0043681, // bundh bunds bundt bundu bundy bungs bungy bunia
+	0x044b681,0x184b681,0x0e53681,0x1253681,0x126b681,0x129b681,0x189b681,0x00c3681, // bunje bunjy bunko bunks bunns bunts bunty bunya
+	0x12c3a81,0x187be81,0x0d04681,0x1204681,0x120c681,0x121c681,0x1324681,0x082c681, // buoys buppy buran buras burbs burds buret burfi
+	0x0734681,0x1234681,0x0d44681,0x0054681,0x0454681,0x1254681,0x125c681,0x126c681, // burgh burgs burin burka burke burks burls burns
+	0x0e74681,0x127c681,0x0084681,0x0e8c681,0x128c681,0x188c681,0x0094681,0x0494681, // buroo burps burqa burro burrs burry bursa burse
+	0x180ca81,0x1224a81,0x1254a81,0x1854a81,0x1494a81,0x089ca81,0x129ca81,0x189ca81, // busby buses busks busky bussu busti busts busty
+	0x0e24e81,0x1224e81,0x045ce81,0x0774e81,0x129ce81,0x189ce81,0x13a4e81,0x0bc4e81, // buteo butes butle butoh butts butty butut butyl
+	0x18ce681,0x00682c1,0x08c82c1,0x0320f01,0x1220f01,0x0322b01,0x1222b01,0x1224701, // buzzy bwana bwazi byded bydes byked bykes byres
+	0x125c701,0x0894b01,0x1224f01,0x1805b01,0x0320002,0x1200402,0x1120402,0x0170402, // byrls byssi bytes byway caaed cabas caber cabob
+	0x0270402,0x0488402,0x1200802,0x1250802,0x1850802,0x0420c02,0x1220c02,0x0430c02, // caboc cabre cacas cacks cacky cadee cades cadge
+	0x1830c02,0x0440c02,0x1240c02,0x0488c02,0x0011002,0x0491002,0x1221402,0x1229402, // cadgy cadie cadis cadre caeca caese cafes caffs
+	0x0321802,0x1121802,0x1221802,0x1371802,0x1671c02,0x121a002,0x126a002,0x038a002, // caged cager cages cagot cahow caids cains caird
+	0x0d72402,0x0da2402,0x0322802,0x1222802,0x1822802,0x122ac02,0x0342c02,0x0542c02, // cajon cajun caked cakes cakey calfs calid calif
+	0x1742c02,0x1252c02,0x005ac02,0x125ac02,0x1262c02,0x1862c02,0x1272c02,0x007ac02, // calix calks calla calls calms calmy calos calpa
+	0x127ac02,0x04aac02,0x17c2c02,0x0d03002,0x1203002,0x1223002,0x1243002,0x1273002, // calps calve calyx caman camas cames camis camos
+	0x087b002,0x0e7b002,0x127b002,0x187b002,0x12a3002,0x0323402,0x0723402,0x1123402, // campi campo camps campy camus caned caneh caner
+	0x1223402,0x1233402,0x0343402,0x006b402,0x126b402,0x0e93402,0x1393402,0x0e9b402, // canes cangs canid canna canns canso canst canto
+	0x129b402,0x189b402,0x1203c02,0x0323c02,0x1223c02,0x1723c02,0x123bc02,0x1943c02, // cants canty capas caped capes capex caphs capiz
+	0x045bc02,0x0d73c02,0x1273c02,0x1373c02,0x088bc02,0x0ba3c02,0x0f04402,0x0e0c402, // caple capon capos capot capri capul carap carbo
+	0x120c402,0x180c402,0x081c402,0x121c402,0x181c402,0x0324402,0x1124402,0x1224402, // carbs carby cardi cards cardy cared carer cares
+	0x1324402,0x1724402,0x1254402,0x045c402,0x125c402,0x126c402,0x186c402,0x0174402, // caret carex carks carle carls carns carny carob
+	0x0c74402,0x0d74402,0x087c402,0x127c402,0x128c402,0x0494402,0x009c402,0x049c402, // carom caron carpi carps carrs carse carta carte
+	0x129c402,0x18ac402,0x1204802,0x0e14802,0x0324802,0x1224802,0x1254802,0x1854802, // carts carvy casas casco cased cases casks casky
+	0x129c802,0x12a4802,0x1224c02,0x001d002,0x1255002,0x035d002,0x125d002,0x1265002, // casts casus cates cauda cauks cauld cauls caums
+	0x127d002,0x088d002,0x0095002,0x1205402,0x0325402,0x0b25402,0x1125402,0x1225402, // caups cauri causa cavas caved cavel caver caves
+	0x0445402,0x0325802,0x1255802,0x0d75c02,0x04c8082,0x0340482,0x0b00882,0x0ca0882, // cavie cawed cawks caxon ceaze cebid cecal cecum
+	0x0320c82,0x1120c82,0x1220c82,0x1240c82,0x000a082,0x085a082,0x125a082,0x0122c82, // ceded ceder cedes cedis ceiba ceili ceils celeb
+	0x005ac82,0x085ac82,0x125ac82,0x0c72c82,0x129ac82,0x0493482,0x0e9b482,0x129b482, // cella celli cells celom celts cense cento cents
+	0x149b482,0x0b8b882,0x1223c82,0x0814482,0x0324482,0x1224482,0x0434482,0x0044482, // centu ceorl cepes cerci cered ceres cerge ceria
+	0x0244482,0x046c482,0x0274482,0x1274482,0x129c482,0x189c482,0x0494882,0x009c882, // ceric cerne ceroc ceros certs certy cesse cesta
+	0x089c882,0x1224c82,0x0bc4c82,0x04ae482,0x04100e2,0x0a100e2,0x0e100e2,0x0e180e2, // cesti cetes cetyl cezve chace chack chaco chado
+	0x12180e2,0x13280e2,0x12400e2,0x12580e2,0x12600e2,0x00680e2,0x06680e2,0x0a680e2, // chads chaft chais chals chams chana chang chank
+	0x04780e2,0x12780e2,0x13780e2,0x00880e2,0x04880e2,0x0a880e2,0x11880e2,0x12880e2, // chape chaps chapt chara chare chark charr chars
+	0x18880e2,0x12980e2,0x04a80e2,0x12a80e2,0x0ab00e2,0x12b00e2,0x00c00e2,0x12c00e2, // chary chats chave chavs chawk chaws chaya chays
+	0x0f210e2,0x12290e2,0x00510e2,0x00590e2,0x0f590e2,0x0e610e2,0x12610e2,0x04890e2, // cheep chefs cheka chela chelp chemo chems chere
+	0x13890e2,0x07990e2,0x18a90e2,0x12b10e2,0x18b10e2,0x0e020e2,0x12020e2,0x120a0e2, // chert cheth chevy chews chewy chiao chias chibs
+	0x00120e2,0x07120e2,0x0e120e2,0x12120e2,0x0b220e2,0x12520e2,0x045a0e2,0x01620e2, // chica chich chico chics chiel chiks chile chimb
+	0x0e620e2,0x0f620e2,0x046a0e2,0x066a0e2,0x0a6a0e2,0x0e6a0e2,0x126a0e2,0x127a0e2, // chimo chimp chine ching chink chino chins chips
+	0x0a8a0e2,0x0b8a0e2,0x0c8a0e2,0x0e8a0e2,0x118a0e2,0x138a0e2,0x148a0e2,0x129a0e2, // chirk chirl chirm chiro chirr chirt chiru chits
+	0x04aa0e2,0x12aa0e2,0x18aa0e2,0x19ca0e2,0x0e138e2,0x12138e2,0x041b8e2,0x12338e2, // chive chivs chivy chizz choco chocs chode chogs
+	0x0b438e2,0x0e538e2,0x18538e2,0x005b8e2,0x085b8e2,0x0e5b8e2,0x0f638e2,0x126b8e2, // choil choko choky chola choli cholo chomp chons
+	0x05738e2,0x0a738e2,0x0c738e2,0x0d738e2,0x127b8e2,0x009b8e2,0x139b8e2,0x13a38e2, // choof chook choom choon chops chota chott chout
+	0x17a38e2,0x0ab38e2,0x12b38e2,0x120d0e2,0x002d0e2,0x052d0e2,0x12350e2,0x12650e2, // choux chowk chows chubs chufa chuff chugs chums
+	0x0b8d0e2,0x118d0e2,0x04950e2,0x129d0e2,0x045e0e2,0x04660e2,0x036e0e2,0x0b70502, // churl churr chuse chuts chyle chyme chynd cibol
+	0x0320d02,0x1220d02,0x1259102,0x1831902,0x0042d02,0x125ad02,0x1103102,0x1723102, // cided cides ciels ciggy cilia cills cimar cimex
+	0x1313502,0x1223502,0x1283502,0x126b902,0x087bd02,0x1214502,0x1224502,0x125c502, // cinct cines cinqs cions cippi circs cires cirls
+	0x088c502,0x0e14902,0x1894902,0x129c902,0x0b04d02,0x0324d02,0x1124d02,0x1224d02, // cirri cisco cissy cists cital cited citer cites
+	0x1225502,0x1325502,0x0445502,0x18ad502,0x0710162,0x0418162,0x1218162,0x1220162, // cives civet civie civvy clach clade clads claes
+	0x1230162,0x0460162,0x1260162,0x1268162,0x1278162,0x1378162,0x0e88162,0x1388162, // clags clame clams clans claps clapt claro clart
+	0x1888162,0x1390162,0x1298162,0x13a0162,0x04a8162,0x08a8162,0x12b0162,0x12c0162, // clary clast clats claut clave clavi claws clays
+	0x0a11162,0x0a21162,0x0f21162,0x1229162,0x1231162,0x0a41162,0x1261162,0x0479162, // cleck cleek cleep clefs clegs cleik clems clepe
+	0x1379162,0x04a9162,0x12b1162,0x0322162,0x1222162,0x132a162,0x0462162,0x046a162, // clept cleve clews clied clies clift clime cline
+	0x136a162,0x047a162,0x127a162,0x137a162,0x129a162,0x0c03962,0x121b962,0x052b962, // clint clipe clips clipt clits cloam clods cloff
+	0x1233962,0x0453962,0x0163962,0x0f63962,0x0a6b962,0x126b962,0x0f73962,0x1373962, // clogs cloke clomb clomp clonk clons cloop cloot
+	0x127b962,0x049b962,0x129b962,0x11a3962,0x12a3962,0x12b3962,0x04c3962,0x12c3962, // clops clote clots clour clous clows cloye cloys
+	0x04cb962,0x120d162,0x1225162,0x1825162,0x0a6d162,0x047e162,0x001a1a2,0x13101c2, // cloze clubs clues cluey clunk clype cnida coact
+	0x18181c2,0x00581c2,0x12581c2,0x18581c2,0x13781c2,0x01881c2,0x04981c2,0x08981c2, // coady coala coals coaly coapt coarb coate coati
+	0x12981c2,0x12085c2,0x18085c2,0x00405c2,0x04585c2,0x00c85c2,0x12009c2,0x08109c2, // coats cobbs cobby cobia coble cobza cocas cocci
+	0x0e109c2,0x12509c2,0x18509c2,0x12709c2,0x1200dc2,0x0220dc2,0x0320dc2,0x0d20dc2, // cocco cocks cocky cocos codas codec coded coden
+	0x1120dc2,0x1220dc2,0x1720dc2,0x0d70dc2,0x12191c2,0x12295c2,0x04419c2,0x0d719c2, // coder codes codex codon coeds coffs cogie cogon
+	0x04a19c2,0x0101dc2,0x0d21dc2,0x0471dc2,0x0671dc2,0x1271dc2,0x122a1c2,0x0d321c2, // cogue cohab cohen cohoe cohog cohos coifs coign
+	0x125a1c2,0x126a1c2,0x128a1c2,0x129a1c2,0x03229c2,0x12229c2,0x1202dc2,0x180adc2, // coils coins coirs coits coked cokes colas colby
+	0x121adc2,0x0322dc2,0x1222dc2,0x1822dc2,0x0242dc2,0x0d42dc2,0x125adc2,0x185adc2, // colds coled coles coley colic colin colls colly
+	0x0672dc2,0x129adc2,0x00cadc2,0x04031c2,0x0b031c2,0x12031c2,0x040b1c2,0x080b1c2, // colog colts colza comae comal comas combe combi
+	0x0e0b1c2,0x120b1c2,0x180b1c2,0x11231c2,0x12231c2,0x17431c2,0x0e631c2,0x12631c2, // combo combs comby comer comes comix commo comms
+	0x18631c2,0x0e7b1c2,0x127b1c2,0x137b1c2,0x049b1c2,0x12a31c2,0x03235c2,0x12235c2, // commy compo comps compt comte comus coned cones
+	0x18235c2,0x122b5c2,0x00335c2,0x04335c2,0x0e335c2,0x00435c2,0x0d435c2,0x12535c2, // coney confs conga conge congo conia conin conks
+	0x18535c2,0x046b5c2,0x126b5c2,0x049b5c2,0x0e9b5c2,0x12a35c2,0x0eab5c2,0x07139c2, // conky conne conns conte conto conus convo cooch
+	0x03239c2,0x04239c2,0x11239c2,0x18239c2,0x122b9c2,0x12539c2,0x18539c2,0x125b9c2, // cooed cooee cooer cooey coofs cooks cooky cools
+	0x185b9c2,0x01639c2,0x12639c2,0x18639c2,0x126b9c2,0x127b9c2,0x137b9c2,0x13939c2, // cooly coomb cooms coomy coons coops coopt coost
+	0x129b9c2,0x04cb9c2,0x0b03dc2,0x1803dc2,0x0323dc2,0x0d23dc2,0x1123dc2,0x1223dc2, // coots cooze copal copay coped copen coper copes
+	0x187bdc2,0x008bdc2,0x1893dc2,0x08a41c2,0x0c045c2,0x040c5c2,0x180c5c2,0x121c5c2, // coppy copra copsy coqui coram corbe corby cords
+	0x03245c2,0x12245c2,0x18245c2,0x08345c2,0x00445c2,0x12545c2,0x18545c2,0x12645c2, // cored cores corey corgi coria corks corky corms
+	0x086c5c2,0x0e6c5c2,0x126c5c2,0x146c5c2,0x127c5c2,0x04945c2,0x0e945c2,0x02249c2, // corni corno corns cornu corps corse corso cosec
+	0x03249c2,0x12249c2,0x13249c2,0x18249c2,0x04449c2,0x009c9c2,0x049c9c2,0x129c9c2, // cosed coses coset cosey cosie costa coste costs
+	0x0d04dc2,0x0324dc2,0x1224dc2,0x123cdc2,0x009cdc2,0x129cdc2,0x041d1c2,0x127d1c2, // cotan coted cotes coths cotta cotts coude coups
+	0x018d1c2,0x038d1c2,0x048d1c2,0x128d1c2,0x009d1c2,0x079d1c2,0x03255c2,0x12255c2, // courb courd coure cours couta couth coved coves
+	0x0d455c2,0x0b059c2,0x0d059c2,0x03259c2,0x12559c2,0x125d9c2,0x127d9c2,0x188d9c2, // covin cowal cowan cowed cowks cowls cowps cowry
+	0x0405dc2,0x0b05dc2,0x0325dc2,0x1225dc2,0x0145dc2,0x14061c2,0x03261c2,0x11261c2, // coxae coxal coxed coxes coxib coyau coyed coyer
+	0x147e1c2,0x03265c2,0x0d265c2,0x12265c2,0x18265c2,0x04465c2,0x0b00222,0x1208222, // coypu cozed cozen cozes cozey cozie craal crabs
+	0x1230222,0x0240222,0x0640222,0x0450222,0x0460222,0x1260222,0x1268222,0x0478222, // crags craic craig crake crame crams crans crape
+	0x1278222,0x1878222,0x0488222,0x12b0222,0x12c0222,0x1219222,0x0b21222,0x1221222, // craps crapy crare craws crays creds creel crees
+	0x1261222,0x0069222,0x1279222,0x1879222,0x04b1222,0x12b1222,0x1202222,0x120a222, // crems crena creps crepy crewe crews crias cribs
+	0x1222222,0x1262222,0x046a222,0x1272222,0x047a222,0x127a222,0x0492222,0x079a222, // cries crims crine crios cripe crips crise crith
+	0x129a222,0x0813a22,0x1213a22,0x132ba22,0x1233a22,0x0163a22,0x0463a22,0x0a6ba22, // crits croci crocs croft crogs cromb crome cronk
+	0x126ba22,0x0b73a22,0x0d73a22,0x127ba22,0x048ba22,0x1393a22,0x13a3a22,0x12b3a22, // crons crool croon crops crore crost crout crows
+	0x04cba22,0x0a15222,0x0e1d222,0x121d222,0x181d222,0x1225222,0x1325222,0x132d222, // croze cruck crudo cruds crudy crues cruet cruft
+	0x0a6d222,0x1175222,0x008d222,0x0495222,0x1895222,0x04ad222,0x079da22,0x1126222, // crunk cruor crura cruse crusy cruve crwth cryer
+	0x0469262,0x1808682,0x0120682,0x0320682,0x1120682,0x1220682,0x1340682,0x1818e82, // ctene cubby cubeb cubed cuber cubes cubit cuddy
+	0x0e29682,0x1229682,0x122a282,0x066a282,0x0792282,0x129a282,0x1222a82,0x0712e82, // cuffo cuffs cuifs cuing cuish cuits cukes culch
+	0x1322e82,0x1722e82,0x125ae82,0x185ae82,0x1262e82,0x007ae82,0x089ae82,0x129ae82, // culet culex culls cully culms culpa culti cults
+	0x189ae82,0x0223282,0x181b682,0x0823682,0x1343682,0x129b682,0x0b23e82,0x0343e82, // culty cumec cundy cunei cunit cunts cupel cupid
+	0x007be82,0x187be82,0x1304682,0x120c682,0x0714682,0x121c682,0x181c682,0x0324682, // cuppa cuppy curat curbs curch curds curdy cured
+	0x1124682,0x1224682,0x1324682,0x122c682,0x0044682,0x0444682,0x085c682,0x125c682, // curer cures curet curfs curia curie curli curls
+	0x126c682,0x186c682,0x128c682,0x0894682,0x1394682,0x0224a82,0x183ca82,0x1254a82, // curns curny currs cursi curst cusec cushy cusks
+	0x127ca82,0x187ca82,0x0e94a82,0x0ca4a82,0x0714e82,0x1124e82,0x1224e82,0x1824e82, // cusps cuspy cusso cusum cutch cuter cutes cutey
+	0x0d44e82,0x1244e82,0x0e9ce82,0x189ce82,0x0fa4e82,0x0425682,0x1226682,0x0714ec2, // cutin cutis cutto cutty cutup cuvee cuzes cwtch
+	0x0e68302,0x1268302,0x0300b02,0x1200b02,0x0e58b02,0x1120f02,0x1742f02,0x0403302, // cyano cyans cycad cycas cyclo cyder cylix cymae
+	0x1103302,0x1203302,0x1223302,0x0b73302,0x129cb02,0x1224f02,0x0d74f02,0x1288322, // cymar cymas cymes cymol cysts cytes cyton czars
+	0x1258003,0x0008403,0x1220803,0x0038803,0x1250803,0x0700c03,0x1200c03,0x1270c03, // daals dabba daces dacha dacks dadah dadas dados
+	0x1229403,0x1829403,0x0031803,0x1831803,0x1271803,0x1259c03,0x0e52003,0x046a003, // daffs daffy dagga daggy dagos dahls daiko daine
+	0x136a003,0x1122803,0x0322c03,0x1222c03,0x1242c03,0x045ac03,0x129ac03,0x0d03003, // daint daker daled dales dalis dalle dalts daman
+	0x1103003,0x1223003,0x0463003,0x126b003,0x127b003,0x187b003,0x1813403,0x1233403, // damar dames damme damns damps dampy dancy dangs
+	0x0e43403,0x1253403,0x186b403,0x129b403,0x0504403,0x120c403,0x1814403,0x0324403, // danio danks danny dants daraf darbs darcy dared
+	0x1124403,0x1224403,0x0034403,0x1234403,0x0244403,0x1244403,0x1254403,0x1854403, // darer dares darga dargs daric daris darks darky
+	0x126c403,0x048c403,0x129c403,0x08cc403,0x083c803,0x183c803,0x0b04c03,0x0324c03, // darns darre darts darzi dashi dashy datal dated
+	0x1124c03,0x1224c03,0x1274c03,0x0e9cc03,0x040d003,0x120d003,0x180d003,0x121d003, // dater dates datos datto daube daubs dauby dauds
+	0x135d003,0x128d003,0x129d003,0x0d25403,0x1345403,0x0705803,0x121d803,0x0325803, // dault daurs dauts daven davit dawah dawds dawed
+	0x0d25803,0x1255803,0x126d803,0x129d803,0x0d06003,0x0716003,0x136e003,0x0326403, // dawen dawks dawns dawts dayan daych daynt dazed
+	0x1126403,0x1226403,0x1218083,0x1140083,0x1258083,0x1268083,0x0488083,0x0d88083, // dazer dazes deads deair deals deans deare dearn
+	0x1288083,0x1888083,0x0790083,0x04a8083,0x12b0083,0x18b0083,0x0600483,0x1808483, // dears deary deash deave deaws deawy debag debby
+	0x0b20483,0x1220483,0x1298483,0x03a0483,0x11a0483,0x12a0483,0x04c0483,0x0300883, // debel debes debts debud debur debus debye decad
+	0x0500883,0x0d00883,0x0e50883,0x1250883,0x1270883,0x0b00c83,0x1219083,0x1819083, // decaf decan decko decks decos dedal deeds deedy
+	0x1859083,0x1261083,0x1269083,0x1279083,0x0489083,0x1289083,0x1299083,0x04a9083, // deely deems deens deeps deere deers deets deeve
+	0x12a9083,0x1301483,0x0e29483,0x1241483,0x0671483,0x1201883,0x0ca1883,0x12a1883, // deevs defat deffo defis defog degas degum degus
+	0x0412083,0x121a083,0x182a083,0x125a083,0x0c92083,0x1392083,0x0322883,0x1222883, // deice deids deify deils deism deist deked dekes
+	0x0e52883,0x0322c83,0x1222c83,0x122ac83,0x132ac83,0x1242c83,0x125ac83,0x185ac83, // dekko deled deles delfs delft delis dells delly
+	0x1272c83,0x077ac83,0x129ac83,0x0d03083,0x1223083,0x0243083,0x1343083,0x0173083, // delos delph delts deman demes demic demit demob
+	0x0873083,0x1273083,0x137b083,0x1103483,0x1803483,0x0713483,0x1223483,0x1323483, // demoi demos dempt denar denay dench denes denet
+	0x1243483,0x129b483,0x18bb883,0x1304483,0x1804483,0x0324483,0x1224483,0x0644483, // denis dents deoxy derat deray dered deres derig
+	0x0064483,0x1264483,0x126c483,0x186c483,0x1274483,0x0e8c483,0x188c483,0x079c483, // derma derms derns derny deros derro derry derth
+	0x12ac483,0x1724883,0x083c883,0x1244883,0x1254883,0x0494883,0x1205483,0x0b25483, // dervs desex deshi desis desks desse devas devel
+	0x1245483,0x0d75483,0x1275483,0x1375483,0x0d05883,0x1105883,0x1705883,0x0325883, // devis devon devos devot dewan dewar dewax dewed
+	0x1225c83,0x0445c83,0x00080e3,0x12500e3,0x12580e3,0x11520e3,0x080b8e3,0x045b8e3, // dexes dexie dhaba dhaks dhals dhikr dhobi dhole
+	0x0b5b8e3,0x125b8e3,0x089b8e3,0x12b38e3,0x089d0e3,0x1310103,0x1258103,0x0468103, // dholl dhols dhoti dhows dhuti diact dials diane
+	0x0ec8103,0x1208503,0x0320903,0x1120903,0x1220903,0x1338903,0x1250903,0x1850903, // diazo dibbs diced dicer dices dicht dicks dicky
+	0x1370903,0x0098903,0x1298903,0x1898903,0x1818d03,0x0440d03,0x1270d03,0x1390d03, // dicot dicta dicts dicty diddy didie didos didst
+	0x1209103,0x1259103,0x0469103,0x1299103,0x1229503,0x1339903,0x1202903,0x0322903, // diebs diels diene diets diffs dight dikas diked
+	0x1122903,0x1222903,0x1822903,0x0e1ad03,0x085ad03,0x125ad03,0x0e0b103,0x1123103, // diker dikes dikey dildo dilli dills dimbo dimer
+	0x1223103,0x127b103,0x1103503,0x0323503,0x1223503,0x0433503,0x1233503,0x0243503, // dimes dimps dinar dined dines dinge dings dinic
+	0x1253503,0x1853503,0x006b503,0x1273503,0x129b503,0x125b903,0x009b903,0x187bd03, // dinks dinky dinna dinos dints diols diota dippy
+	0x0e93d03,0x0c04503,0x1124503,0x0454503,0x1254503,0x125c503,0x129c503,0x1204903, // dipso diram direr dirke dirks dirls dirts disas
+	0x0814903,0x1214903,0x183c903,0x1254903,0x0464903,0x0b04d03,0x1204d03,0x0324d03, // disci discs dishy disks disme dital ditas dited
+	0x1224d03,0x1894d03,0x129cd03,0x18ccd03,0x0d05503,0x1205503,0x0325503,0x1225503, // dites ditsy ditts ditzy divan divas dived dives
+	0x1245503,0x006d503,0x1275503,0x1375503,0x18ad503,0x0d05903,0x0445d03,0x1345d03, // divis divna divos divot divvy diwan dixie dixit
+	0x1206103,0x0d26503,0x0d6a123,0x126a123,0x12081c3,0x12981c3,0x18085c3,0x12205c3, // diyas dizen djinn djins doabs doats dobby dobes
+	0x04405c3,0x00585c3,0x00885c3,0x0e885c3,0x13389c3,0x12509c3,0x12709c3,0x12a09c3, // dobie dobla dobra dobro docht docks docos docus
+	0x1818dc3,0x1270dc3,0x12511c3,0x12891c3,0x13911c3,0x07991c3,0x12295c3,0x0d019c3, // doddy dodos doeks doers doest doeth doffs dogan
+	0x12219c3,0x18219c3,0x0e319c3,0x18319c3,0x04419c3,0x0ec1dc3,0x135a1c3,0x185a1c3, // doges dogey doggo doggy dogie dohyo doilt doily
+	0x129a1c3,0x12725c3,0x0412dc3,0x0812dc3,0x0322dc3,0x1222dc3,0x0042dc3,0x125adc3, // doits dojos dolce dolci doled doles dolia dolls
+	0x0062dc3,0x1172dc3,0x1272dc3,0x129adc3,0x0b031c3,0x03231c3,0x12231c3,0x02431c3, // dolma dolor dolos dolts domal domed domes domic
+	0x07035c3,0x12035c3,0x04235c3,0x11235c3,0x00335c3,0x12335c3,0x0e535c3,0x006b5c3, // donah donas donee doner donga dongs donko donna
+	0x046b5c3,0x186b5c3,0x18935c3,0x120b9c3,0x04139c3,0x181b9c3,0x12539c3,0x045b9c3, // donne donny donsy doobs dooce doody dooks doole
+	0x125b9c3,0x185b9c3,0x12639c3,0x18639c3,0x006b9c3,0x0d8b9c3,0x128b9c3,0x18cb9c3, // dools dooly dooms doomy doona doorn doors doozy
+	0x1203dc3,0x0323dc3,0x1123dc3,0x1223dc3,0x03045c3,0x000c5c3,0x120c5c3,0x04245c3, // dopas doped doper dopes dorad dorba dorbs doree
+	0x12245c3,0x02445c3,0x12445c3,0x12545c3,0x18545c3,0x12645c3,0x18645c3,0x127c5c3, // dores doric doris dorks dorky dorms dormy dorps
+	0x128c5c3,0x00945c3,0x04945c3,0x129c5c3,0x189c5c3,0x08049c3,0x12049c3,0x03249c3, // dorrs dorsa dorse dorts dorty dosai dosas dosed
+	0x07249c3,0x11249c3,0x12249c3,0x003c9c3,0x0b04dc3,0x0324dc3,0x1124dc3,0x1224dc3, // doseh doser doses dosha dotal doted doter dotes
+	0x189cdc3,0x11051c3,0x04151c3,0x12151c3,0x12551c3,0x005d1c3,0x00651c3,0x12651c3, // dotty douar douce doucs douks doula douma doums
+	0x127d1c3,0x008d1c3,0x04951c3,0x129d1c3,0x03255c3,0x0d255c3,0x11255c3,0x12255c3, // doups doura douse douts doved doven dover doves
+	0x04455c3,0x11059c3,0x121d9c3,0x03259c3,0x11259c3,0x04459c3,0x045d9c3,0x125d9c3, // dovie dowar dowds dowed dower dowie dowle dowls
+	0x185d9c3,0x006d9c3,0x126d9c3,0x127d9c3,0x04959c3,0x129d9c3,0x0325dc3,0x1225dc3, // dowly downa downs dowps dowse dowts doxed doxes
+	0x0445dc3,0x0d261c3,0x185e1c3,0x03265c3,0x11265c3,0x12265c3,0x1208223,0x0a10223, // doxie doyen doyly dozed dozer dozes drabs drack
+	0x0e10223,0x0528223,0x1230223,0x0b40223,0x1260223,0x1368223,0x1278223,0x1298223, // draco draff drags drail drams drant draps drats
+	0x04a8223,0x12b0223,0x12c0223,0x1101223,0x0a11223,0x0321223,0x1121223,0x1221223, // drave draws drays drear dreck dreed dreer drees
+	0x1231223,0x1251223,0x1369223,0x0489223,0x1391223,0x12c1223,0x120a223,0x0412223, // dregs dreks drent drere drest dreys dribs drice
+	0x1222223,0x185a223,0x127a223,0x137a223,0x0343a23,0x0b43a23,0x0453a23,0x045ba23, // dries drily drips dript droid droil droke drole
+	0x0463a23,0x186ba23,0x0173a23,0x0673a23,0x0a73a23,0x127ba23,0x137ba23,0x0aa3a23, // drome drony droob droog drook drops dropt drouk
+	0x12b3a23,0x120d223,0x1235223,0x1265223,0x047d223,0x0495223,0x1895223,0x18bd223, // drows drubs drugs drums drupe druse drusy druxy
+	0x0306223,0x1206223,0x0e0ba43,0x0e63a43,0x1218283,0x1258283,0x1268283,0x1288283, // dryad dryas dsobo dsomo duads duals duans duars
+	0x0e08683,0x0b00a83,0x1300a83,0x1220a83,0x1250a83,0x1850a83,0x1298a83,0x1818e83, // dubbo ducal ducat duces ducks ducky ducts duddy
+	0x0320e83,0x1220e83,0x1259283,0x1299283,0x1399283,0x1229683,0x12a1683,0x066a283, // duded dudes duels duets duett duffs dufus duing
+	0x129a283,0x1202a83,0x0322a83,0x1222a83,0x0052a83,0x0412e83,0x1222e83,0x0042e83, // duits dukas duked dukes dukka dulce dules dulia
+	0x125ae83,0x0492e83,0x1203283,0x0e0b283,0x120b283,0x0053283,0x1853283,0x127b283, // dulls dulse dumas dumbo dumbs dumka dumky dumps
+	0x0c03683,0x0713683,0x1223683,0x1233683,0x1833683,0x1253683,0x0e6b683,0x186b683, // dunam dunch dunes dungs dungy dunks dunno dunny
+	0x0793683,0x129b683,0x0863a83,0x0e63a83,0x0323e83,0x1123e83,0x1223e83,0x045be83, // dunsh dunts duomi duomo duped duper dupes duple
+	0x185be83,0x187be83,0x0b04683,0x1204683,0x0324683,0x1224683,0x1834683,0x126c683, // duply duppy dural duras dured dures durgy durns
+	0x0274683,0x1274683,0x1874683,0x008c683,0x128c683,0x188c683,0x1394683,0x0ca4683, // duroc duros duroy durra durrs durry durst durum
+	0x08cc683,0x1254a83,0x129ca83,0x1225e83,0x0b002c3,0x04582c3,0x0c582c3,0x12602c3, // durzi dusks dusts duxes dwaal dwale dwalm dwams
+	0x06682c3,0x0ca02c3,0x01212c3,0x045a2c3,0x046a2c3,0x1218303,0x1289303,0x0322b03, // dwang dwaum dweeb dwile dwine dyads dyers dyked
+	0x1222b03,0x1822b03,0x0d72b03,0x0b23703,0x1223703,0x1271f23,0x0489804,0x0322c04, // dykes dykey dykon dynel dynes dzhos eagre ealed
+	0x1222c04,0x0323404,0x121c404,0x0324404,0x125c404,0x126c404,0x136c404,0x1394404, // eales eaned eards eared earls earns earnt earst
+	0x0324804,0x1124804,0x1224804,0x045c804,0x129c804,0x043cc04,0x0325404,0x1225404, // eased easer eases easle easts eathe eaved eaves
+	0x0320424,0x1320424,0x126b824,0x0a73824,0x1218044,0x0321c44,0x1221c44,0x1271c44, // ebbed ebbet ebons ebook ecads eched eches echos
+	0x12a4444,0x0061064,0x0321864,0x1121864,0x1221864,0x045a064,0x129a064,0x0415064, // ecrus edema edged edger edges edile edits educe
+	0x1315064,0x1342484,0x1893484,0x0d25484,0x126d484,0x03214a4,0x12180c4,0x12890c4, // educt eejit eensy eeven eevns effed egads egers
+	0x13910c4,0x11018c4,0x03218c4,0x11218c4,0x12030c4,0x066a0e4,0x1120d04,0x1270d04, // egest eggar egged egger egmas ehing eider eidos
+	0x0469904,0x0322904,0x0d72904,0x121ad04,0x0b24904,0x0e1a124,0x1202944,0x0d40164, // eigne eiked eikon eilds eisel ejido ekkas elain
+	0x0368164,0x1268164,0x0838964,0x0d40d64,0x0861164,0x0321564,0x0302164,0x136a164, // eland elans elchi eldin elemi elfed eliad elint
+	0x0d23164,0x0433964,0x1833964,0x0d43964,0x127b964,0x0423d64,0x0d44964,0x049d164, // elmen eloge elogy eloin elops elpee elsin elute
+	0x0d05564,0x0d25564,0x1125564,0x1225564,0x1210184,0x1100584,0x1800584,0x0670584, // elvan elven elver elves emacs embar embay embog
+	0x1670584,0x1770584,0x12a0584,0x1121184,0x0369184,0x0689184,0x1889184,0x12a1184, // embow embox embus emeer emend emerg emery emeus
+	0x1212184,0x128a184,0x129a184,0x1203184,0x1123184,0x1323184,0x1623184,0x12c3184, // emics emirs emits emmas emmer emmet emmew emmys
+	0x084b984,0x066b984,0x049b984,0x04ab984,0x129bd84,0x045d184,0x048d184,0x041e184, // emoji emong emote emove empts emule emure emyde
+	0x121e184,0x0c881a4,0x04981a4,0x0320da4,0x1120da4,0x1620da4,0x04a0da4,0x12b11a4, // emyds enarm enate ended ender endew endue enews
+	0x17415a4,0x02021a4,0x1342da4,0x16231a4,0x06735a4,0x08539a4,0x125b9a4,0x0c8b9a4, // enfix eniac enlit enmew ennog enoki enols enorm
+	0x12b39a4,0x0b745a4,0x16249a4,0x18549a4,0x0044da4,0x048d1a4,0x0d8d1a4,0x08755a4, // enows enrol ensew ensky entia enure enurn envoi
+	0x0cc65a4,0x125c5c4,0x0d449c4,0x13101e4,0x12211e4,0x0701de4,0x1201de4,0x0371de4, // enzym eorls eosin epact epees ephah ephas ephod
+	0x1171de4,0x12121e4,0x041b9e4,0x137b9e4,0x12445e4,0x1225204,0x0345204,0x0040624, // ephor epics epode epopt epris eques equid erbia
+	0x12a9224,0x0d71a24,0x1271a24,0x1371a24,0x12a1e24,0x0012224,0x0a12224,0x1212224, // erevs ergon ergos ergot erhus erica erick erics
+	0x066a224,0x0323624,0x1223624,0x0493a24,0x0324624,0x1224a24,0x1315224,0x0e35224, // ering erned ernes erose erred erses eruct erugo
+	0x12ad224,0x0d25624,0x0b45624,0x1100a44,0x1370a44,0x045a244,0x1102a44,0x1122a44, // eruvs erven ervil escar escot esile eskar esker
+	0x1223644,0x1224a44,0x0274e44,0x0f74e44,0x0e8ce44,0x0430264,0x0478264,0x1298264, // esnes esses estoc estop estro etage etape etats
+	0x1269264,0x0b01e64,0x0469e64,0x0bc1e64,0x1212264,0x1203664,0x0d44e64,0x045ce64, // etens ethal ethne ethyl etics etnas ettin ettle
+	0x1245264,0x0425a64,0x0066264,0x1239a84,0x0322a84,0x0303e84,0x1274684,0x0b74a84, // etuis etwee etyma eughs euked eupad euros eusol
+	0x12692a4,0x13892a4,0x12992a4,0x0471ea4,0x125a2a4,0x049a2a4,0x043baa4,0x12892c4, // evens evert evets evhoe evils evite evohe ewers
+	0x13912c4,0x1671ec4,0x0322ac4,0x12602e4,0x13012e4,0x12112e4,0x0c212e4,0x04612e4, // ewest ewhow ewked exams exeat execs exeem exeme
+	0x0b416e4,0x12222e4,0x046a2e4,0x066a2e4,0x129a2e4,0x041bae4,0x0463ae4,0x126bae4, // exfil exies exine exing exits exode exome exons
+	0x1303ee4,0x1273ee4,0x041d2e4,0x125d2e4,0x018d2e4,0x1290304,0x1289304,0x129bb04, // expat expos exude exuls exurb eyass eyers eyots
+	0x1204704,0x1224704,0x0444704,0x1144704,0x046a324,0x1808405,0x0320805,0x1120805, // eyras eyres eyrie eyrir ezine fabby faced facer
+	0x1220805,0x0040805,0x0098805,0x1298805,0x1818c05,0x0320c05,0x1120c05,0x1220c05, // faces facia facta facts faddy faded fader fades
+	0x0430c05,0x1270c05,0x0069005,0x1889005,0x1229405,0x1829405,0x1831805,0x0d41805, // fadge fados faena faery faffs faffy faggy fagin
+	0x1371805,0x1252005,0x125a005,0x046a005,0x126a005,0x128a005,0x0322805,0x1122805, // fagot faiks fails faine fains fairs faked faker
+	0x1222805,0x1822805,0x0442805,0x1142805,0x0902c05,0x125ac05,0x0323005,0x1223005, // fakes fakey fakie fakir falaj falls famed fames
+	0x0b03405,0x121b405,0x1223405,0x0033405,0x0e33405,0x1233405,0x1253405,0x0d73405, // fanal fands fanes fanga fango fangs fanks fanon
+	0x1273405,0x0ca3405,0x1144005,0x0304405,0x0814405,0x1814405,0x121c405,0x0324405, // fanos fanum faqir farad farci farcy fards fared
+	0x1124405,0x1224405,0x045c405,0x125c405,0x1264405,0x1274405,0x0e8c405,0x0494405, // farer fares farle farls farms faros farro farse
+	0x129c405,0x0814805,0x089c805,0x129c805,0x0324c05,0x1224c05,0x185cc05,0x0e94c05, // farts fasci fasti fasts fated fates fatly fatso
+	0x00b4c05,0x0735005,0x035d005,0x126d005,0x038d005,0x129d005,0x04ad005,0x1205405, // fatwa faugh fauld fauns faurd fauts fauve favas
+	0x0b25405,0x1125405,0x1225405,0x12a5405,0x126d805,0x186d805,0x0325c05,0x1225c05, // favel faver faves favus fawns fawny faxed faxes
+	0x0326005,0x1126005,0x046e005,0x048e005,0x0326405,0x1226405,0x1258085,0x0488085, // fayed fayer fayne fayre fazed fazes feals feare
+	0x1288085,0x1388085,0x0490085,0x1298085,0x04c8085,0x1220885,0x1338885,0x1340885, // fears feart fease feats feaze feces fecht fecit
+	0x1250885,0x1720c85,0x1209085,0x1219085,0x1259085,0x1269085,0x1289085,0x0491085, // fecks fedex feebs feeds feels feens feers feese
+	0x04c9085,0x0461c85,0x136a085,0x1392085,0x0712c85,0x0342c85,0x125ac85,0x185ac85, // feeze fehme feint feist felch felid fells felly
+	0x129ac85,0x189ac85,0x0b03085,0x1223085,0x1863085,0x121b485,0x181b485,0x1243485, // felts felty femal femes femmy fends fendy fenis
+	0x1253485,0x186b485,0x129b485,0x121b885,0x052b885,0x1124485,0x1224485,0x0044485, // fenks fenny fents feods feoff ferer feres feria
+	0x185c485,0x0864485,0x1264485,0x126c485,0x186c485,0x0494885,0x009c885,0x129c885, // ferly fermi ferms ferns ferny fesse festa fests
+	0x189c885,0x1204c85,0x0324c85,0x1224c85,0x1174c85,0x009cc85,0x129cc85,0x00b4c85, // festy fetas feted fetes fetor fetta fetts fetwa
+	0x1105085,0x121d085,0x0325085,0x0326085,0x1126085,0x185e085,0x1226485,0x18ce485, // feuar feuds feued feyed feyer feyly fezes fezzy
+	0x1288105,0x1298105,0x0e88505,0x1220905,0x0438905,0x1438905,0x0d40905,0x1270905, // fiars fiats fibro fices fiche fichu ficin ficos
+	0x1220d05,0x0430d05,0x1270d05,0x1229105,0x1369105,0x0489105,0x1289105,0x1391105, // fides fidge fidos fiefs fient fiere fiers fiest
+	0x0321505,0x1121505,0x1221505,0x1241505,0x1831905,0x1271905,0x0322905,0x1222905, // fifed fifer fifes fifis figgy figos fiked fikes
+	0x1102d05,0x0712d05,0x0322d05,0x1222d05,0x0842d05,0x1252d05,0x045ad05,0x0e5ad05, // filar filch filed files filii filks fille fillo
+	0x125ad05,0x0862d05,0x1262d05,0x1272d05,0x0ca2d05,0x0013505,0x121b505,0x0323505, // fills filmi films filos filum finca finds fined
+	0x1223505,0x1243505,0x1253505,0x186b505,0x1273505,0x038b905,0x123c105,0x04a4105, // fines finis finks finny finos fiord fiqhs fique
+	0x0324505,0x1124505,0x1224505,0x0444505,0x1254505,0x1264505,0x126c505,0x188c505, // fired firer fires firie firks firms firns firry
+	0x079c505,0x1214905,0x1254905,0x129c905,0x189c905,0x0714d05,0x185cd05,0x006cd05, // firth fiscs fisks fists fisty fitch fitly fitna
+	0x049cd05,0x129cd05,0x1125505,0x1225505,0x0325d05,0x1225d05,0x1345d05,0x0359125, // fitte fitts fiver fives fixed fixes fixit fjeld
+	0x1208165,0x0528165,0x1230165,0x1250165,0x0c60165,0x1260165,0x1860165,0x0468165, // flabs flaff flags flaks flamm flams flamy flane
+	0x1268165,0x1278165,0x1888165,0x1298165,0x00a8165,0x0db0165,0x12b0165,0x18b0165, // flans flaps flary flats flava flawn flaws flawy
+	0x18b8165,0x12c0165,0x0c01165,0x1201165,0x0a21165,0x1121165,0x1221165,0x1231165, // flaxy flays fleam fleas fleek fleer flees flegs
+	0x0461165,0x11a1165,0x12b1165,0x08b9165,0x0eb9165,0x12c1165,0x1212165,0x0322165, // fleme fleur flews flexi flexo fleys flics flied
+	0x1222165,0x0f62165,0x1262165,0x127a165,0x128a165,0x0a92165,0x049a165,0x129a165, // flies flimp flims flips flirs flisk flite flits
+	0x139a165,0x120b965,0x1213965,0x1223965,0x1233965,0x066b965,0x127b965,0x128b965, // flitt flobs flocs floes flogs flong flops flors
+	0x188b965,0x0793965,0x009b965,0x049b965,0x12b3965,0x120d165,0x0325165,0x1225165, // flory flosh flota flote flows flubs flued flues
+	0x1825165,0x1855165,0x0f65165,0x1175165,0x118d165,0x189d165,0x13c5165,0x180e165, // fluey fluky flump fluor flurr fluty fluyt flyby
+	0x047e165,0x049e165,0x12581c5,0x12601c5,0x0d391c5,0x18219c5,0x04419c5,0x04599c5, // flype flyte foals foams foehn fogey fogie fogle
+	0x14719c5,0x1269dc5,0x121a1c5,0x125a1c5,0x126a1c5,0x121adc5,0x1822dc5,0x0042dc5, // fogou fohns foids foils foins folds foley folia
+	0x0242dc5,0x0442dc5,0x1252dc5,0x1852dc5,0x12231c5,0x001b5c5,0x121b5c5,0x141b5c5, // folic folie folks folky fomes fonda fonds fondu
+	0x12235c5,0x185b5c5,0x129b5c5,0x121b9c5,0x181b9c5,0x125b9c5,0x129b9c5,0x189b9c5, // fones fonly fonts foods foody fools foots footy
+	0x0c045c5,0x120c5c5,0x180c5c5,0x0e1c5c5,0x121c5c5,0x0b245c5,0x12245c5,0x17245c5, // foram forbs forby fordo fords forel fores forex
+	0x12545c5,0x18545c5,0x04645c5,0x12645c5,0x129c5c5,0x00cc5c5,0x04cc5c5,0x00949c5, // forks forky forme forms forts forza forze fossa
+	0x04949c5,0x13051c5,0x121d1c5,0x11251c5,0x13251c5,0x045d1c5,0x125d1c5,0x136d1c5, // fosse fouat fouds fouer fouet foule fouls fount
+	0x128d1c5,0x079d1c5,0x00255c5,0x125d9c5,0x079d9c5,0x0325dc5,0x1225dc5,0x0445dc5, // fours fouth fovea fowls fowth foxed foxes foxie
+	0x045e1c5,0x046e1c5,0x1208225,0x0a10225,0x1310225,0x1230225,0x0c40225,0x0268225, // foyle foyne frabs frack fract frags fraim franc
+	0x0478225,0x1278225,0x1290225,0x0498225,0x0898225,0x1298225,0x12a0225,0x12c0225, // frape fraps frass frate frati frats fraus frays
+	0x1221225,0x1321225,0x1341225,0x0361225,0x0069225,0x0d71225,0x0489225,0x1299225, // frees freet freit fremd frena freon frere frets
+	0x120a225,0x1122225,0x1222225,0x1232225,0x0492225,0x1392225,0x079a225,0x129a225, // fribs frier fries frigs frise frist frith frits
+	0x139a225,0x04ca225,0x19ca225,0x1223a25,0x1233a25,0x126ba25,0x048ba25,0x0d8ba25, // fritt frize frizz froes frogs frons frore frorn
+	0x188ba25,0x0793a25,0x12b3a25,0x18b3a25,0x1235225,0x0f65225,0x0795225,0x1395225, // frory frosh frows frowy frugs frump frush frust
+	0x1126225,0x1100685,0x1808685,0x1890685,0x1250a85,0x12a0a85,0x1818e85,0x1830e85, // fryer fubar fubby fubsy fucks fucus fuddy fudgy
+	0x1259285,0x0e89285,0x1229685,0x1829685,0x0b01a85,0x1831a85,0x0441a85,0x0e41a85, // fuels fuero fuffs fuffy fugal fuggy fugie fugio
+	0x0459a85,0x1859a85,0x12a1a85,0x1242685,0x125ae85,0x0323285,0x1123285,0x1223285, // fugle fugly fugus fujis fulls fumed fumer fumes
+	0x1323285,0x081b685,0x121b685,0x181b685,0x0e33685,0x1233685,0x1253685,0x0b04685, // fumet fundi funds fundy fungo fungs funks fural
+	0x0d04685,0x0014685,0x125c685,0x0b74685,0x128c685,0x079c685,0x04cc685,0x18cc685, // furan furca furls furol furrs furth furze furzy
+	0x0324a85,0x0424a85,0x0b24a85,0x1224a85,0x0b44a85,0x1254a85,0x129ca85,0x189ca85, // fused fusee fusel fuses fusil fusks fusts fusty
+	0x0d74e85,0x0326685,0x0426685,0x1226685,0x0b46685,0x1220b05,0x0322b05,0x1222b05, // futon fuzed fuzee fuzes fuzil fyces fyked fykes
+	0x1222f05,0x121c705,0x049cf05,0x0008406,0x1808406,0x0458406,0x0818c06,0x1220c06, // fyles fyrds fytte gabba gabby gable gaddi gades
+	0x0430c06,0x0340c06,0x1240c06,0x0448c06,0x0e48c06,0x0e90c06,0x1229406,0x0321806, // gadge gadid gadis gadje gadjo gadso gaffs gaged
+	0x1121806,0x1221806,0x121a006,0x126a006,0x128a006,0x009a006,0x129a006,0x139a006, // gager gages gaids gains gairs gaita gaits gaitt
+	0x1272406,0x0702c06,0x1202c06,0x1702c06,0x0022c06,0x0322c06,0x1222c06,0x125ac06, // gajos galah galas galax galea galed gales galls
+	0x185ac06,0x0f72c06,0x13a2c06,0x0eaac06,0x1203006,0x1803006,0x000b006,0x040b006, // gally galop galut galvo gamas gamay gamba gambe
+	0x0e0b006,0x120b006,0x0323006,0x1223006,0x1823006,0x0243006,0x0d43006,0x0463006, // gambo gambs gamed games gamey gamic gamin gamme
+	0x1863006,0x127b006,0x0713406,0x181b406,0x0523406,0x1523406,0x1233406,0x004b406, // gammy gamps ganch gandy ganef ganev gangs ganja
+	0x0573406,0x129b406,0x125b806,0x0323c06,0x1123c06,0x1223c06,0x1273c06,0x187bc06, // ganof gants gaols gaped gaper gapes gapos gappy
+	0x040c406,0x0e0c406,0x120c406,0x001c406,0x1224406,0x1244406,0x1264406,0x086c406, // garbe garbo garbs garda gares garis garms garni
+	0x048c406,0x079c406,0x0ca4406,0x1224806,0x127c806,0x187c806,0x129c806,0x0714c06, // garre garth garum gases gasps gaspy gasts gatch
+	0x0324c06,0x1124c06,0x1224c06,0x123cc06,0x1174c06,0x0715006,0x1815006,0x121d006, // gated gater gates gaths gator gauch gaucy gauds
+	0x044d006,0x135d006,0x1265006,0x1865006,0x127d006,0x128d006,0x1295006,0x18cd006, // gauje gault gaums gaumy gaups gaurs gauss gauzy
+	0x1375406,0x1815806,0x121d806,0x1255806,0x127d806,0x1895806,0x0b06006,0x0b06406, // gavot gawcy gawds gawks gawps gawsy gayal gazal
+	0x1106406,0x0326406,0x1226406,0x0d76406,0x0e76406,0x1258086,0x1268086,0x0488086, // gazar gazed gazes gazon gazoo geals geans geare
+	0x1288086,0x1298086,0x11a0486,0x1250886,0x1251086,0x1279086,0x1391086,0x1392086, // gears geats gebur gecks geeks geeps geest geist
+	0x129a086,0x121ac86,0x0422c86,0x0342c86,0x185ac86,0x129ac86,0x0b23086,0x0063086, // geits gelds gelee gelid gelly gelts gemel gemma
+	0x1863086,0x1373086,0x0b03486,0x1203486,0x1223486,0x1323486,0x0243486,0x0843486, // gemmy gemot genal genas genes genet genic genii
+	0x0f43486,0x186b486,0x0073486,0x0c73486,0x0e8b486,0x129b486,0x189b486,0x00a3486, // genip genny genoa genom genro gents genty genua
+	0x12a3486,0x041b886,0x0343886,0x0704486,0x040c486,0x1224486,0x045c486,0x1264486, // genus geode geoid gerah gerbe geres gerle germs
+	0x1864486,0x046c486,0x0494886,0x0e94886,0x049c886,0x129c886,0x1204c86,0x0fa4c86, // germy gerne gesse gesso geste gests getas getup
+	0x1265086,0x0d06086,0x1126086,0x13900e6,0x12980e6,0x13a00e6,0x08c80e6,0x12210e6, // geums geyan geyer ghast ghats ghaut ghazi ghees
+	0x13910e6,0x0b5e0e6,0x0320506,0x0b20506,0x1120506,0x1220506,0x0858506,0x12a0506, // ghest ghyll gibed gibel giber gibes gibli gibus
+	0x1299506,0x1201906,0x0439906,0x1371906,0x04a1906,0x1202d06,0x121ad06,0x1322d06, // gifts gigas gighe gigot gigue gilas gilds gilet
+	0x125ad06,0x185ad06,0x187ad06,0x129ad06,0x0b23106,0x0463106,0x127b106,0x187b106, // gills gilly gilpy gilts gimel gimme gimps gimpy
+	0x0713506,0x0433506,0x1233506,0x1253506,0x186b506,0x0ecb506,0x0d73d06,0x0e7bd06, // ginch ginge gings ginks ginny ginzo gipon gippo
+	0x187bd06,0x121c506,0x125c506,0x126c506,0x0d74506,0x1274506,0x128c506,0x0794506, // gippy girds girls girns giron giros girrs girsh
+	0x129c506,0x0e64906,0x1264906,0x129c906,0x0714d06,0x1224d06,0x1395106,0x0325506, // girts gismo gisms gists gitch gites giust gived
+	0x1225506,0x0e66506,0x0410166,0x1218166,0x1818166,0x0a40166,0x1140166,0x1260166, // gives gizmo glace glads glady glaik glair glams
+	0x1268166,0x1888166,0x0ca0166,0x11a0166,0x18c8166,0x0009166,0x0409166,0x1809166, // glans glary glaum glaur glazy gleba glebe gleby
+	0x0419166,0x1219166,0x0321166,0x0a21166,0x1221166,0x1321166,0x1241166,0x1269166, // glede gleds gleed gleek glees gleet gleis glens
+	0x1369166,0x12c1166,0x0b02166,0x1202166,0x120a166,0x052a166,0x132a166,0x0452166, // glent gleys glial glias glibs gliff glift glike
+	0x0462166,0x1262166,0x0a92166,0x129a166,0x199a166,0x0c03966,0x080b966,0x120b966, // glime glims glisk glits glitz gloam globi globs
+	0x180b966,0x041b966,0x0633966,0x1263966,0x0f73966,0x127b966,0x1393966,0x13a3966, // globy glode glogg gloms gloop glops glost glout
+	0x12b3966,0x04cb966,0x0325166,0x1125166,0x1225166,0x1825166,0x1235166,0x0465166, // glows gloze glued gluer glues gluey glugs glume
+	0x1265166,0x0d75166,0x049d166,0x129d166,0x0b881a6,0x11881a6,0x12881a6,0x12981a6, // glums gluon glute gluts gnarl gnarr gnars gnats
+	0x0db01a6,0x12b01a6,0x12b39a6,0x12181c6,0x12281c6,0x12581c6,0x18881c6,0x12981c6, // gnawn gnaws gnows goads goafs goals goary goats
+	0x18981c6,0x0d005c6,0x11005c6,0x08085c6,0x0e085c6,0x18085c6,0x12405c6,0x12705c6, // goaty goban gobar gobbi gobbo gobby gobis gobos
+	0x1320dc6,0x0e90dc6,0x12591c6,0x12891c6,0x13911c6,0x07991c6,0x18991c6,0x11215c6, // godet godso goels goers goest goeth goety gofer
+	0x12295c6,0x00319c6,0x12719c6,0x11221c6,0x12425c6,0x121adc6,0x181adc6,0x1222dc6, // goffs gogga gogos goier gojis golds goldy goles
+	0x122adc6,0x047adc6,0x127adc6,0x0e0b1c6,0x11231c6,0x007b1c6,0x07135c6,0x05235c6, // golfs golpe golps gombo gomer gompa gonch gonef
+	0x12335c6,0x00435c6,0x05435c6,0x12535c6,0x006b5c6,0x05735c6,0x12c35c6,0x0ecb5c6, // gongs gonia gonif gonks gonna gonof gonys gonzo
+	0x180b9c6,0x121b9c6,0x122b9c6,0x12339c6,0x12539c6,0x18539c6,0x035b9c6,0x125b9c6, // gooby goods goofs googs gooks gooky goold gools
+	0x185b9c6,0x126b9c6,0x186b9c6,0x127b9c6,0x187b9c6,0x128b9c6,0x188b9c6,0x18939c6, // gooly goons goony goops goopy goors goory goosy
+	0x0a03dc6,0x0a43dc6,0x0b045c6,0x12045c6,0x03245c6,0x12245c6,0x12445c6,0x12645c6, // gopak gopik goral goras gored gores goris gorms
+	0x18645c6,0x127c5c6,0x04945c6,0x18945c6,0x133c9c6,0x04949c6,0x0714dc6,0x123cdc6, // gormy gorps gorse gorsy gosht gosse gotch goths
+	0x183cdc6,0x009cdc6,0x07151c6,0x12551c6,0x008d1c6,0x129d1c6,0x189d1c6,0x0d059c6, // gothy gotta gouch gouks goura gouts gouty gowan
+	0x121d9c6,0x122d9c6,0x12559c6,0x125d9c6,0x126d9c6,0x1225dc6,0x0c461c6,0x045e1c6, // gowds gowfs gowks gowls gowns goxes goyim goyle
+	0x0b00226,0x1208226,0x1218226,0x0528226,0x0f40226,0x0060226,0x0460226,0x0f60226, // graal grabs grads graff graip grama grame gramp
+	0x1260226,0x0068226,0x1268226,0x1878226,0x12a8226,0x12c0226,0x0409226,0x0e09226, // grams grana grans grapy gravs grays grebe grebo
+	0x0411226,0x0a21226,0x1221226,0x0431226,0x0e31226,0x0d41226,0x1269226,0x0491226, // grece greek grees grege grego grein grens grese
+	0x04a9226,0x12b1226,0x12c1226,0x0412226,0x041a226,0x121a226,0x052a226,0x132a226, // greve grews greys grice gride grids griff grift
+	0x1232226,0x0452226,0x126a226,0x1372226,0x127a226,0x137a226,0x187a226,0x0492226, // grigs grike grins griot grips gript gripy grise
+	0x1392226,0x1892226,0x079a226,0x129a226,0x04ca226,0x1303a26,0x181ba26,0x1233a26, // grist grisy grith grits grize groat grody grogs
+	0x1253a26,0x0063a26,0x046ba26,0x0573a26,0x1993a26,0x129ba26,0x05a3a26,0x18aba26, // groks groma grone groof grosz grots grouf grovy
+	0x12b3a26,0x125c626,0x0b8c626,0x120d226,0x0325226,0x1225226,0x042d226,0x0465226, // grows grrls grrrl grubs grued grues grufe grume
+	0x0f65226,0x036d226,0x0416226,0x041e226,0x0456226,0x047e226,0x137e226,0x0e10286, // grump grund gryce gryde gryke grype grypt guaco
+	0x0068286,0x0e68286,0x1268286,0x1288286,0x1250a86,0x1850a86,0x1220e86,0x1229686, // guana guano guans guars gucks gucky gudes guffs
+	0x1201a86,0x121a286,0x0f62286,0x0e8a286,0x0602e86,0x1102e86,0x1202e86,0x1222e86, // gugas guids guimp guiro gulag gular gulas gules
+	0x1322e86,0x122ae86,0x182ae86,0x125ae86,0x077ae86,0x127ae86,0x187ae86,0x0063286, // gulet gulfs gulfy gulls gulph gulps gulpy gumma
+	0x0863286,0x127b286,0x181b686,0x0433686,0x1833686,0x1253686,0x1853686,0x186b686, // gummi gumps gundy gunge gungy gunks gunky gunny
+	0x0d44286,0x181c686,0x0434686,0x125c686,0x185c686,0x126c686,0x188c686,0x0794686, // guqin gurdy gurge gurls gurly gurns gurry gursh
+	0x12a4686,0x183ca86,0x005ca86,0x045ca86,0x085ca86,0x1894a86,0x129ca86,0x1894e86, // gurus gushy gusla gusle gusli gussy gusts gutsy
+	0x009ce86,0x189ce86,0x0326286,0x045e286,0x1376286,0x0496286,0x046a2c6,0x1258306, // gutta gutty guyed guyle guyot guyse gwine gyals
+	0x1268306,0x0320706,0x1220706,0x0359306,0x127b306,0x0403706,0x0443706,0x186b706, // gyans gybed gybes gyeld gymps gynae gynie gynny
+	0x1273706,0x00cbb06,0x1273f06,0x0e7bf06,0x187bf06,0x0b04706,0x0324706,0x1224706, // gynos gyoza gypos gyppo gyppy gyral gyred gyres
+	0x0d74706,0x1274706,0x12a4706,0x1224f06,0x0325706,0x1225706,0x1228007,0x1288007, // gyron gyros gyrus gytes gyved gyves haafs haars
+	0x0458407,0x12a0407,0x0a20807,0x1250807,0x0b00c07,0x0320c07,0x1220c07,0x0848c07, // hable habus hacek hacks hadal haded hades hadji
+	0x1390c07,0x1261007,0x1299007,0x1229407,0x1941407,0x1299407,0x1231807,0x1201c07, // hadst haems haets haffs hafiz hafts haggs hahas
+	0x0a12007,0x0052007,0x1252007,0x1452007,0x125a007,0x185a007,0x126a007,0x136a007, // haick haika haiks haiku hails haily hains haint
+	0x128a007,0x079a007,0x1222407,0x1242407,0x084a407,0x0c02807,0x1202807,0x0022807, // hairs haith hajes hajis hajji hakam hakas hakea
+	0x1222807,0x0c42807,0x12a2807,0x0b02c07,0x0322c07,0x1122c07,0x1222c07,0x002ac07, // hakes hakim hakus halal haled haler hales halfa
+	0x122ac07,0x0342c07,0x0e5ac07,0x125ac07,0x0062c07,0x1262c07,0x0d72c07,0x1272c07, // halfs halid hallo halls halma halms halon halos
+	0x0492c07,0x129ac07,0x00aac07,0x00b2c07,0x0b03007,0x000b007,0x0323007,0x1223007, // halse halts halva halwa hamal hamba hamed hames
+	0x1863007,0x00cb007,0x0f03407,0x0413407,0x0713407,0x121b407,0x0833407,0x1233407, // hammy hamza hanap hance hanch hands hangi hangs
+	0x1253407,0x1853407,0x0093407,0x0493407,0x129b407,0x045b807,0x0063807,0x1703c07, // hanks hanky hansa hanse hants haole haoma hapax
+	0x185bc07,0x087bc07,0x12a3c07,0x0c04407,0x121c407,0x0324407,0x1224407,0x0c44407, // haply happi hapus haram hards hared hares harim
+	0x1254407,0x125c407,0x1264407,0x126c407,0x1274407,0x127c407,0x129c407,0x183c807, // harks harls harms harns haros harps harts hashy
+	0x1254807,0x127c807,0x009c807,0x0324c07,0x1224c07,0x003cc07,0x121d007,0x122d007, // hasks hasps hasta hated hates hatha hauds haufs
+	0x0735007,0x035d007,0x0c5d007,0x125d007,0x135d007,0x126d007,0x0495007,0x1125407, // haugh hauld haulm hauls hault hauns hause haver
+	0x1225407,0x0325807,0x1255807,0x1265807,0x0495807,0x0326007,0x1126007,0x1826007, // haves hawed hawks hawms hawse hayed hayer hayey
+	0x045e007,0x0d06407,0x0326407,0x1126407,0x1226407,0x1218087,0x0358087,0x1258087, // hayle hazan hazed hazer hazes heads heald heals
+	0x0460087,0x1278087,0x1878087,0x0488087,0x1288087,0x1390087,0x1298087,0x0d20487, // heame heaps heapy heare hears heast heats heben
+	0x1220487,0x1338887,0x1250887,0x1120c87,0x1830c87,0x1219087,0x1819087,0x1259087, // hebes hecht hecks heder hedgy heeds heedy heels
+	0x04c9087,0x0499487,0x1299487,0x121a087,0x0732087,0x125a087,0x128a087,0x0102487, // heeze hefte hefts heids heigh heils heirs hejab
+	0x008a487,0x0322c87,0x1222c87,0x0e42c87,0x125ac87,0x1262c87,0x1272c87,0x1372c87, // hejra heled heles helio hells helms helos helot
+	0x127ac87,0x04aac87,0x0b03087,0x1223087,0x0243087,0x0d43087,0x127b087,0x187b087, // helps helve hemal hemes hemic hemin hemps hempy
+	0x0713487,0x121b487,0x0433487,0x006b487,0x186b487,0x188b487,0x129b487,0x1103c87, // hench hends henge henna henny henry hents hepar
+	0x120c487,0x180c487,0x121c487,0x1224487,0x125c487,0x0064487,0x1264487,0x126c487, // herbs herby herds heres herls herma herms herns
+	0x1274487,0x188c487,0x0494487,0x199c487,0x04c4487,0x127c887,0x129c887,0x1224c87, // heros herry herse hertz herye hesps hests hetes
+	0x123cc87,0x0715087,0x0735087,0x0025487,0x0325887,0x1125887,0x0735887,0x0305c87, // heths heuch heugh hevea hewed hewer hewgh hexad
+	0x0325c87,0x1125c87,0x1225c87,0x0bc5c87,0x0326087,0x1368107,0x1250907,0x0320d07, // hexed hexer hexes hexyl heyed hiant hicks hided
+	0x1120d07,0x1220d07,0x1261107,0x1239907,0x1339907,0x0102507,0x008a507,0x0322907, // hider hides hiems highs hight hijab hijra hiked
+	0x1122907,0x1222907,0x0872907,0x1102d07,0x0712d07,0x0e5ad07,0x125ad07,0x129ad07, // hiker hikes hikoi hilar hilch hillo hills hilts
+	0x0ca2d07,0x12a2d07,0x0e0b107,0x1403507,0x121b507,0x1233507,0x1853507,0x186b507, // hilum hilus himbo hinau hinds hings hinky hinny
+	0x129b507,0x1243907,0x185bd07,0x0324507,0x0424507,0x1124507,0x1224507,0x1894907, // hints hiois hiply hired hiree hirer hires hissy
+	0x129c907,0x043cd07,0x0325507,0x1125507,0x1225507,0x0d26507,0x03201c7,0x18301c7, // hists hithe hived hiver hives hizen hoaed hoagy
+	0x12881c7,0x18881c7,0x13901c7,0x12705c7,0x12509c7,0x12a09c7,0x0300dc7,0x0048dc7, // hoars hoary hoast hobos hocks hocus hodad hodja
+	0x12891c7,0x0d019c7,0x0d219c7,0x12319c7,0x12399c7,0x0321dc7,0x0a121c7,0x03221c7, // hoers hogan hogen hoggs hoghs hohed hoick hoied
+	0x12521c7,0x066a1c7,0x04921c7,0x12029c7,0x03229c7,0x12229c7,0x18229c7,0x12429c7, // hoiks hoing hoise hokas hoked hokes hokey hokis
+	0x14529c7,0x0ca29c7,0x121adc7,0x0322dc7,0x1222dc7,0x1822dc7,0x1252dc7,0x005adc7, // hokku hokum holds holed holes holey holks holla
+	0x0e5adc7,0x0462dc7,0x1262dc7,0x0d72dc7,0x1272dc7,0x129adc7,0x12031c7,0x03231c7, // hollo holme holms holon holos holts homas homed
+	0x12231c7,0x18231c7,0x04431c7,0x04631c7,0x12731c7,0x0d035c7,0x001b5c7,0x121b5c7, // homes homey homie homme homos honan honda honds
+	0x03235c7,0x11235c7,0x12235c7,0x08335c7,0x12335c7,0x12535c7,0x18535c7,0x07139c7, // honed honer hones hongi hongs honks honky hooch
+	0x121b9c7,0x181b9c7,0x18239c7,0x122b9c7,0x00539c7,0x12539c7,0x18539c7,0x185b9c7, // hoods hoody hooey hoofs hooka hooks hooky hooly
+	0x126b9c7,0x127b9c7,0x038b9c7,0x128b9c7,0x07939c7,0x129b9c7,0x189b9c7,0x04ab9c7, // hoons hoops hoord hoors hoosh hoots hooty hoove
+	0x0a03dc7,0x0323dc7,0x1123dc7,0x1223dc7,0x187bdc7,0x07045c7,0x0b045c7,0x12045c7, // hopak hoped hoper hopes hoppy horah horal horas
+	0x12445c7,0x12545c7,0x04645c7,0x126c5c7,0x13945c7,0x18945c7,0x03249c7,0x0b249c7, // horis horks horme horns horst horsy hosed hosel
+	0x0d249c7,0x11249c7,0x12249c7,0x18249c7,0x009c9c7,0x129c9c7,0x0714dc7,0x0d24dc7, // hosen hoser hoses hosey hosta hosts hotch hoten
+	0x189cdc7,0x052d1c7,0x122d1c7,0x07351c7,0x088d1c7,0x128d1c7,0x129d1c7,0x00255c7, // hotty houff houfs hough houri hours houts hovea
+	0x03255c7,0x0d255c7,0x12255c7,0x040d9c7,0x12259c7,0x052d9c7,0x122d9c7,0x12559c7, // hoved hoven hoves howbe howes howff howfs howks
+	0x125d9c7,0x048d9c7,0x0e959c7,0x0325dc7,0x1225dc7,0x12061c7,0x03261c7,0x045e1c7, // howls howre howso hoxed hoxes hoyas hoyed hoyle
+	0x1808687,0x1250a87,0x0068e87,0x03a0e87,0x1289287,0x1229687,0x1829687,0x1121a87, // hubby hucks hudna hudud huers huffs huffy huger
+	0x1831a87,0x12a1e87,0x1202287,0x1202e87,0x1222e87,0x1252e87,0x1852e87,0x0e5ae87, // huggy huhus huias hulas hules hulks hulky hullo
+	0x125ae87,0x185ae87,0x1203287,0x122b287,0x0243287,0x127b287,0x187b287,0x1253687, // hulls hully humas humfs humic humps humpy hunks
+	0x129b687,0x121c687,0x125c687,0x185c687,0x008c687,0x1394687,0x129c687,0x183ca87, // hunts hurds hurls hurly hurra hurst hurts hushy
+	0x1254a87,0x1274a87,0x0044e87,0x00ce687,0x18ce687,0x125e2c7,0x0088f07,0x1269307, // husks husos hutia huzza huzzy hwyls hydra hyens
+	0x0431b07,0x066a307,0x1222b07,0x1202f07,0x0622f07,0x1222f07,0x0242f07,0x126b307, // hygge hying hykes hylas hyleg hyles hylic hymns
+	0x041b707,0x0343b07,0x0323f07,0x1223f07,0x003bf07,0x183bf07,0x1273f07,0x1704707, // hynde hyoid hyped hypes hypha hyphy hypos hyrax
+	0x0d74b07,0x043cf07,0x080b008,0x120b008,0x0a44428,0x1289048,0x0321c48,0x1221c48, // hyson hythe iambi iambs ibrik icers iched iches
+	0x1171c48,0x1122048,0x1122848,0x045a848,0x126b848,0x0b04c48,0x0244c48,0x12a4c48, // ichor icier icker ickle icons ictal ictic ictus
+	0x1368068,0x1201068,0x1221068,0x1369068,0x0322c68,0x1222c68,0x005b868,0x125b868, // idant ideas idees ident idled idles idola idols
+	0x125e068,0x1104ca8,0x0e780c8,0x03218c8,0x12a2cc8,0x0c044e8,0x1268148,0x1298148, // idyls iftar igapo igged iglus ihram ikans ikats
+	0x126b948,0x0201168,0x0b01168,0x0ca1168,0x12a1168,0x0302168,0x0b02168,0x0ca2168, // ikons ileac ileal ileum ileus iliad ilial ilium
+	0x1122d68,0x079ad68,0x0e30188,0x1260188,0x0888188,0x0ca0188,0x1100588,0x0320588, // iller illth imago imams imari imaum imbar imbed
+	0x041a188,0x0e1a188,0x121a188,0x046a188,0x0e6a188,0x1623188,0x1343188,0x1743188, // imide imido imids imine imino immew immit immix
+	0x0323d88,0x1243d88,0x1373d88,0x0e8bd88,0x083c988,0x183c988,0x13781a8,0x0c881a8, // imped impis impot impro imshi imshy inapt inarm
+	0x04c05a8,0x0b209a8,0x04589a8,0x06709a8,0x12a09a8,0x13a09a8,0x1620da8,0x0040da8, // inbye incel incle incog incus incut indew india
+	0x0440da8,0x0b70da8,0x1670da8,0x0888da8,0x04a0da8,0x0c891a8,0x17415a8,0x12715a8, // indie indol indow indri indue inerm infix infos
+	0x00895a8,0x0d019a8,0x04599a8,0x0d721a8,0x03229a8,0x11229a8,0x045a9a8,0x03235a8, // infra ingan ingle inion inked inker inkle inned
+	0x13435a8,0x018b9a8,0x0da45a8,0x13249a8,0x0e7c9a8,0x0b24da8,0x0b44da8,0x1244da8, // innit inorb inrun inset inspo intel intil intis
+	0x008cda8,0x005d1a8,0x048d1a8,0x0d8d1a8,0x13951a8,0x11055a8,0x13459a8,0x0240dc8, // intra inula inure inurn inust invar inwit iodic
+	0x0340dc8,0x0d40dc8,0x1204dc8,0x0d73de8,0x0418228,0x121a228,0x066a228,0x0322a28, // iodid iodin iotas ippon irade irids iring irked
+	0x0e53a28,0x046ba28,0x126ba28,0x1200648,0x1221e48,0x0322e48,0x1222e48,0x0403648, // iroko irone irons isbas ishes isled isles isnae
+	0x0824a48,0x045ce48,0x1261268,0x1121e68,0x03222a8,0x12222a8,0x12022e8,0x18036e8, // issei istle items ither ivied ivies ixias ixnay
+	0x008bae8,0x045cee8,0x0388328,0x1288328,0x1306728,0x1278009,0x1370409,0x0b00809, // ixora ixtle izard izars izzat jaaps jabot jacal
+	0x1250809,0x1850809,0x0320c09,0x1220c09,0x1201409,0x0029409,0x1201809,0x1121809, // jacks jacky jaded jades jafas jaffa jagas jager
+	0x1231809,0x1831809,0x1141809,0x0089809,0x125a009,0x1122809,0x1222809,0x1822809, // jaggs jaggy jagir jagra jails jaker jakes jakey
+	0x0f02c09,0x0f72c09,0x040b009,0x0e0b009,0x120b009,0x140b009,0x1223009,0x1863009, // jalap jalop jambe jambo jambs jambu james jammy
+	0x0d73009,0x1223409,0x126b409,0x186b409,0x189b409,0x0d03c09,0x0323c09,0x1123c09, // jamon janes janns janny janty japan japed japer
+	0x1223c09,0x1254409,0x125c409,0x127c409,0x009c409,0x0ba4409,0x1824809,0x047c809, // japes jarks jarls jarps jarta jarul jasey jaspe
+	0x127c809,0x1274c09,0x1255009,0x127d009,0x1205409,0x0b25409,0x0d05809,0x0325809, // jasps jatos jauks jaups javas javel jawan jawed
+	0x0445c09,0x1268089,0x1298089,0x0b20489,0x1240c89,0x1259089,0x1859089,0x1279089, // jaxie jeans jeats jebel jedis jeels jeely jeeps
+	0x1289089,0x04c9089,0x1221489,0x1229489,0x0301c89,0x12a1c89,0x0102c89,0x0e5ac89, // jeers jeeze jefes jeffs jehad jehus jelab jello
+	0x125ac89,0x040b089,0x1863089,0x186b489,0x126b889,0x0344489,0x1254489,0x188c489, // jells jembe jemmy jenny jeons jerid jerks jerry
+	0x0494889,0x129c889,0x12a4889,0x1224c89,0x0d74c89,0x046d089,0x0325889,0x0445889, // jesse jests jesus jetes jeton jeune jewed jewie
+	0x00580e9,0x1270109,0x0008509,0x1208509,0x0320509,0x1120509,0x1220509,0x1229509, // jhala jiaos jibba jibbs jibed jiber jibes jiffs
+	0x1831909,0x1371909,0x0301d09,0x125ad09,0x129ad09,0x1863109,0x187b109,0x0e33509, // jiggy jigot jihad jills jilts jimmy jimpy jingo
+	0x1253509,0x046b509,0x086b509,0x126b509,0x121c509,0x0034509,0x048c509,0x1264909, // jinks jinne jinni jinns jirds jirga jirre jisms
+	0x0325509,0x1125509,0x1225509,0x1825509,0x00681a9,0x03205c9,0x12205c9,0x0e509c9, // jived jiver jives jivey jnana jobed jobes jocko
+	0x12509c9,0x18509c9,0x12709c9,0x0b20dc9,0x12c11c9,0x1269dc9,0x126a1c9,0x03229c9, // jocks jocky jocos jodel joeys johns joins joked
+	0x12229c9,0x18229c9,0x0b729c9,0x0322dc9,0x1222dc9,0x125adc9,0x129adc9,0x189adc9, // jokes jokey jokol joled joles jolls jolts jolty
+	0x0d731c9,0x12731c9,0x12235c9,0x12335c9,0x189b5c9,0x12539c9,0x0c045c9,0x0ca45c9, // jomon jomos jones jongs jonty jooks joram jorum
+	0x1204dc9,0x189cdc9,0x0da4dc9,0x0b051c9,0x12351c9,0x12551c9,0x045d1c9,0x128d1c9, // jotas jotty jotun joual jougs jouks joule jours
+	0x11059c9,0x03259c9,0x125d9c9,0x185d9c9,0x03261c9,0x1200689,0x1220689,0x1270a89, // jowar jowed jowls jowly joyed jubas jubes jucos
+	0x1200e89,0x1830e89,0x1270e89,0x0b01a89,0x0ca1a89,0x12a2689,0x0322a89,0x1222a89, // judas judgy judos jugal jugum jujus juked jukes
+	0x12a2a89,0x0f22e89,0x1103289,0x180b289,0x127b289,0x0e13689,0x1253689,0x1853689, // jukus julep jumar jumby jumps junco junks junky
+	0x1223e89,0x0d73e89,0x0b04689,0x1304689,0x0b24689,0x1224689,0x129ca89,0x1224e89, // jupes jupon jural jurat jurel jures justs jutes
+	0x189ce89,0x1225689,0x0445689,0x006000a,0x010040a,0x110040a,0x017040a,0x003880a, // jutty juves juvie kaama kabab kabar kabob kacha
+	0x125080a,0x0800c0a,0x1220c0a,0x1240c0a,0x114140a,0x127180a,0x12a180a,0x0b01c0a, // kacks kadai kades kadis kafir kagos kagus kahal
+	0x0a0200a,0x121a00a,0x122200a,0x122a00a,0x005200a,0x125200a,0x125a00a,0x126200a, // kaiak kaids kaies kaifs kaika kaiks kails kaims
+	0x066a00a,0x126a00a,0x120280a,0x124280a,0x0c02c0a,0x1222c0a,0x0542c0a,0x1242c0a, // kaing kains kakas kakis kalam kales kalif kalis
+	0x007ac0a,0x120300a,0x122300a,0x0a4300a,0x124300a,0x046300a,0x040340a,0x120340a, // kalpa kamas kames kamik kamis kamme kanae kanas
+	0x181b40a,0x072340a,0x122340a,0x003340a,0x123340a,0x084b40a,0x129b40a,0x14cb40a, // kandy kaneh kanes kanga kangs kanji kants kanzu
+	0x126b80a,0x1203c0a,0x123bc0a,0x0a73c0a,0x1673c0a,0x12a3c0a,0x13a3c0a,0x120440a, // kaons kapas kaphs kapok kapow kapus kaput karas
+	0x130440a,0x125440a,0x126c40a,0x0e7440a,0x127440a,0x088c40a,0x139440a,0x189440a, // karat karks karns karoo karos karri karst karsy
+	0x129c40a,0x18cc40a,0x003c80a,0x046480a,0x0b04c0a,0x1204c0a,0x1244c0a,0x089cc0a, // karts karzy kasha kasme katal katas katis katti
+	0x073500a,0x088d00a,0x148d00a,0x188d00a,0x0b0540a,0x120540a,0x120580a,0x140580a, // kaugh kauri kauru kaury kaval kavas kawas kawau
+	0x032580a,0x045e00a,0x127600a,0x124640a,0x0e7640a,0x128802a,0x110048a,0x017048a, // kawed kayle kayos kazis kazoo kbars kebar kebob
+	0x125088a,0x0430c8a,0x1830c8a,0x071108a,0x122908a,0x125108a,0x125908a,0x006108a, // kecks kedge kedgy keech keefs keeks keels keema
+	0x0e6908a,0x126908a,0x127908a,0x129908a,0x04a908a,0x114148a,0x00a1c8a,0x128a08a, // keeno keens keeps keets keeve kefir kehua keirs
+	0x0f22c8a,0x0c42c8a,0x125ac8a,0x185ac8a,0x127ac8a,0x187ac8a,0x129ac8a,0x189ac8a, // kelep kelim kells kelly kelps kelpy kelts kelty
+	0x0e0b08a,0x120b08a,0x127b08a,0x137b08a,0x187b08a,0x050348a,0x071348a,0x0e1b48a, // kembo kembs kemps kempt kempy kenaf kench kendo
+	0x127348a,0x049b48a,0x129b48a,0x1243c8a,0x120c48a,0x0b2448a,0x122c48a,0x185448a, // kenos kente kents kepis kerbs kerel kerfs kerky
+	0x006448a,0x046c48a,0x126c48a,0x127448a,0x188c48a,0x04ac48a,0x110488a,0x129c88a, // kerma kerne kerns keros kerry kerve kesar kests
+	0x1204c8a,0x0714c8a,0x1224c8a,0x0b74c8a,0x0b2548a,0x0b4548a,0x1225c8a,0x032608a, // ketas ketch ketes ketol kevel kevil kexes keyed
+	0x112608a,0x08180ea,0x12280ea,0x12680ea,0x07780ea,0x12980ea,0x00c00ea,0x08c80ea, // keyer khadi khafs khans khaph khats khaya khazi
+	0x00190ea,0x07990ea,0x12990ea,0x004b8ea,0x128b8ea,0x0ca38ea,0x121d0ea,0x130010a, // kheda kheth khets khoja khors khoum khuds kiaat
+	0x0a1010a,0x066810a,0x040850a,0x080850a,0x082050a,0x122050a,0x005850a,0x125090a, // kiack kiang kibbe kibbi kibei kibes kibla kicks
+	0x185090a,0x0e18d0a,0x1818d0a,0x0b20d0a,0x0430d0a,0x122910a,0x128910a,0x04a910a, // kicky kiddo kiddy kidel kidge kiefs kiers kieve
+	0x12a910a,0x133990a,0x122290a,0x087290a,0x1822d0a,0x0c42d0a,0x125ad0a,0x126ad0a, // kievs kight kikes kikoi kiley kilim kills kilns
+	0x1272d0a,0x127ad0a,0x129ad0a,0x189ad0a,0x0e0b10a,0x120350a,0x001b50a,0x121b50a, // kilos kilps kilts kilty kimbo kinas kinda kinds
+	0x181b50a,0x122350a,0x123350a,0x0d4350a,0x125350a,0x127350a,0x048b90a,0x1223d0a, // kindy kines kings kinin kinks kinos kiore kipes
+	0x007bd0a,0x127bd0a,0x180c50a,0x125450a,0x126c50a,0x088c50a,0x0d0490a,0x189490a, // kippa kipps kirby kirks kirns kirri kisan kissy
+	0x129c90a,0x0324d0a,0x1124d0a,0x1224d0a,0x043cd0a,0x123cd0a,0x0ba4d0a,0x120550a, // kists kited kiter kites kithe kiths kitul kivas
+	0x124590a,0x066816a,0x127816a,0x139916a,0x0a1216a,0x062216a,0x125216a,0x066b96a, // kiwis klang klaps klett klick klieg kliks klong
+	0x057396a,0x043516a,0x199d16a,0x12301aa,0x12781aa,0x0b881aa,0x12881aa,0x11a01aa, // kloof kluge klutz knags knaps knarl knars knaur
+	0x04b01aa,0x12211aa,0x0b591aa,0x07921aa,0x129a1aa,0x04aa1aa,0x120b9aa,0x127b9aa, // knawe knees knell knish knits knive knobs knops
+	0x0f939aa,0x129b9aa,0x13a39aa,0x04b39aa,0x12b39aa,0x120d1aa,0x0b8d1aa,0x118d1aa, // knosp knots knout knowe knows knubs knurl knurr
+	0x128d1aa,0x129d1aa,0x12681ca,0x12781ca,0x0d005ca,0x12705ca,0x12591ca,0x12295ca, // knurs knuts koans koaps koban kobos koels koffs
+	0x00995ca,0x0b019ca,0x1201dca,0x0d21dca,0x1259dca,0x046a1ca,0x12425ca,0x0c029ca, // kofta kogal kohas kohen kohls koine kojis kokam
+	0x12029ca,0x11229ca,0x008a9ca,0x0ca29ca,0x1202dca,0x1272dca,0x140b1ca,0x140b5ca, // kokas koker kokra kokum kolas kolos kombu konbu
+	0x0e1b5ca,0x12535ca,0x12539ca,0x18539ca,0x088b9ca,0x0a23dca,0x123bdca,0x044bdca, // kondo konks kooks kooky koori kopek kophs kopje
+	0x007bdca,0x08045ca,0x12045ca,0x13045ca,0x12245ca,0x00645ca,0x12745ca,0x0da45ca, // koppa korai koras korat kores korma koros korun
+	0x12a45ca,0x12249ca,0x0714dca,0x1274dca,0x1674dca,0x008d1ca,0x0b0022a,0x120822a, // korus koses kotch kotos kotow koura kraal krabs
+	0x132822a,0x124022a,0x134022a,0x066822a,0x126822a,0x196822a,0x13a022a,0x12c022a, // kraft krais krait krang krans kranz kraut krays
+	0x0f2122a,0x066922a,0x04b122a,0x006ba2a,0x046ba2a,0x0d73a2a,0x080d22a,0x0a6d22a, // kreep kreng krewe krona krone kroon krubi krunk
+	0x128824a,0x044068a,0x1270e8a,0x12a0e8a,0x14c8e8a,0x124168a,0x0b21a8a,0x120228a, // ksars kubie kudos kudus kudzu kufis kugel kuias
+	0x088aa8a,0x12a2a8a,0x0a02e8a,0x0d02e8a,0x1202e8a,0x082ae8a,0x124328a,0x12c328a, // kukri kukus kulak kulan kulas kulfi kumis kumys
+	0x124468a,0x048c68a,0x009c68a,0x12a468a,0x0e94a8a,0x1204e8a,0x0714e8a,0x1244e8a, // kuris kurre kurta kurus kusso kutas kutch kutis
+	0x12a4e8a,0x12a668a,0x12902aa,0x0b592aa,0x00592ca,0x0a1030a,0x125030a,0x066830a, // kutus kuzus kvass kvell kwela kyack kyaks kyang
+	0x128830a,0x129830a,0x127070a,0x1390f0a,0x1222f0a,0x0442f0a,0x0d42f0a,0x1742f0a, // kyars kyats kybos kydst kyles kylie kylin kylix
+	0x0472f0a,0x041b70a,0x121b70a,0x1223f0a,0x044470a,0x1224f0a,0x043cf0a,0x088800b, // kyloe kynde kynds kypes kyrie kytes kythe laari
+	0x001840b,0x004040b,0x124040b,0x008840b,0x032080b,0x112080b,0x122080b,0x132080b, // labda labia labis labra laced lacer laces lacet
+	0x182080b,0x125080b,0x1818c0b,0x0320c0b,0x1120c0b,0x1220c0b,0x128900b,0x0ea900b, // lacey lacks laddy laded lader lades laers laevo
+	0x0d0180b,0x0b01c0b,0x1101c0b,0x071200b,0x121200b,0x121a00b,0x073200b,0x005200b, // lagan lahal lahar laich laics laids laigh laika
+	0x125200b,0x038a00b,0x128a00b,0x188a00b,0x079a00b,0x189a00b,0x032280b,0x112280b, // laiks laird lairs lairy laith laity laked laker
+	0x122280b,0x123a80b,0x0d4280b,0x009280b,0x181ac0b,0x125ac0b,0x120300b,0x120b00b, // lakes lakhs lakin laksa laldy lalls lamas lambs
+	0x180b00b,0x032300b,0x112300b,0x122300b,0x004300b,0x186300b,0x127b00b,0x080340b, // lamby lamed lamer lames lamia lammy lamps lanai
+	0x120340b,0x071340b,0x041b40b,0x121b40b,0x122340b,0x125340b,0x129b40b,0x0d43c0b, // lanas lanch lande lands lanes lanks lants lapin
+	0x1243c0b,0x044bc0b,0x071440b,0x121c40b,0x181c40b,0x042440b,0x122440b,0x0e3440b, // lapis lapje larch lards lardy laree lares largo
+	0x124440b,0x125440b,0x185440b,0x126c40b,0x136c40b,0x0ca440b,0x032480b,0x112480b, // laris larks larky larns larnt larum lased laser
+	0x122480b,0x089480b,0x149480b,0x189480b,0x129c80b,0x0704c0b,0x0324c0b,0x0d24c0b, // lases lassi lassu lassy lasts latah lated laten
+	0x1724c0b,0x083cc0b,0x123cc0b,0x183cc0b,0x0454c0b,0x12a4c0b,0x0d0500b,0x071500b, // latex lathi laths lathy latke latus lauan lauch
+	0x121d00b,0x122d00b,0x036d00b,0x008d00b,0x0b0540b,0x120540b,0x032540b,0x112540b, // lauds laufs laund laura laval lavas laved laver
+	0x122540b,0x008d40b,0x18ad40b,0x032580b,0x112580b,0x0d4580b,0x125580b,0x126d80b, // laves lavra lavvy lawed lawer lawin lawks lawns
+	0x186d80b,0x0325c0b,0x1125c0b,0x1225c0b,0x185dc0b,0x032600b,0x0d4600b,0x0fa600b, // lawny laxed laxer laxes laxly layed layin layup
+	0x110640b,0x032640b,0x122640b,0x127640b,0x08ce40b,0x0ece40b,0x121808b,0x181808b, // lazar lazed lazes lazos lazzi lazzo leads leady
+	0x122808b,0x125008b,0x126008b,0x126808b,0x186808b,0x127808b,0x048808b,0x128808b, // leafs leaks leams leans leany leaps leare lears
+	0x188808b,0x129808b,0x18a808b,0x04c808b,0x0d2048b,0x181088b,0x1220c8b,0x1830c8b, // leary leats leavy leaze leben leccy ledes ledgy
+	0x0ca0c8b,0x110108b,0x125108b,0x127908b,0x128908b,0x049108b,0x129908b,0x04c908b, // ledum leear leeks leeps leers leese leets leeze
+	0x049948b,0x129948b,0x112188b,0x122188b,0x043188b,0x0e3188b,0x134188b,0x1289c8b, // lefte lefts leger leges legge leggo legit lehrs
+	0x00a1c8b,0x128a08b,0x079208b,0x0d0308b,0x032308b,0x0b2308b,0x122308b,0x006308b, // lehua leirs leish leman lemed lemel lemes lemma
+	0x046308b,0x121b48b,0x122348b,0x123348b,0x124348b,0x127348b,0x049348b,0x089b48b, // lemme lends lenes lengs lenis lenos lense lenti
+	0x0e9b48b,0x046b88b,0x0343c8b,0x008bc8b,0x009bc8b,0x032448b,0x122448b,0x127c48b, // lento leone lepid lepra lepta lered leres lerps
+	0x0e0c88b,0x122488b,0x129c88b,0x0714c8b,0x043cc8b,0x0fa4c8b,0x071508b,0x0e1508b, // lesbo leses lests letch lethe letup leuch leuco
+	0x121d08b,0x073508b,0x120548b,0x042548b,0x122548b,0x0d4548b,0x124548b,0x124588b, // leuds leugh levas levee leves levin levis lewis
+	0x1225c8b,0x1245c8b,0x122648b,0x00ce48b,0x18ce48b,0x006810b,0x046810b,0x066810b, // lexes lexis lezes lezza lezzy liana liane liang
+	0x038810b,0x128810b,0x138810b,0x112050b,0x008850b,0x088850b,0x083890b,0x133890b, // liard liars liart liber libra libri lichi licht
+	0x134090b,0x125090b,0x1100d0b,0x1270d0b,0x122910b,0x126910b,0x128910b,0x12a110b, // licit licks lidar lidos liefs liens liers lieus
+	0x04a910b,0x112150b,0x122150b,0x129950b,0x0d0190b,0x112190b,0x043190b,0x046990b, // lieve lifer lifes lifts ligan liger ligge ligne
+	0x032290b,0x112290b,0x122290b,0x0d4290b,0x125ad0b,0x1272d0b,0x129ad0b,0x0d0310b, // liked liker likes likin lills lilos lilts liman
+	0x120310b,0x170310b,0x000b10b,0x080b10b,0x120b10b,0x180b10b,0x032310b,0x0d2310b, // limas limax limba limbi limbs limby limed limen
+	0x122310b,0x182310b,0x006310b,0x126b10b,0x127310b,0x007b10b,0x127b10b,0x020350b, // limes limey limma limns limos limpa limps linac
+	0x071350b,0x121b50b,0x181b50b,0x032350b,0x122350b,0x182350b,0x003350b,0x123350b, // linch linds lindy lined lines liney linga lings
+	0x183350b,0x0d4350b,0x125350b,0x185350b,0x126b50b,0x186b50b,0x127350b,0x129b50b, // lingy linin links linky linns linny linos lints
+	0x189b50b,0x0ca350b,0x17a350b,0x126b90b,0x1203d0b,0x1223d0b,0x0d43d0b,0x1273d0b, // linty linum linux lions lipas lipes lipin lipos
+	0x187bd0b,0x120450b,0x125450b,0x137450b,0x125490b,0x045c90b,0x127c90b,0x129c90b, // lippy liras lirks lirot lisks lisle lisps lists
+	0x0804d0b,0x1204d0b,0x0324d0b,0x1124d0b,0x1224d0b,0x0e3cd0b,0x123cd0b,0x048cd0b, // litai litas lited liter lites litho liths litre
+	0x032550b,0x0d2550b,0x122550b,0x117550b,0x048d50b,0x0e6816b,0x07101cb,0x12181cb, // lived liven lives livor livre llano loach loads
+	0x12281cb,0x12601cb,0x12681cb,0x13901cb,0x04a81cb,0x11005cb,0x03205cb,0x12205cb, // loafs loams loans loast loave lobar lobed lobes
+	0x12705cb,0x12a05cb,0x04389cb,0x12389cb,0x04409cb,0x12409cb,0x12509cb,0x12709cb, // lobos lobus loche lochs locie locis locks locos
+	0x0ca09cb,0x0d20dcb,0x1220dcb,0x12911cb,0x12995cb,0x0d019cb,0x12219cb,0x18319cb, // locum loden lodes loess lofts logan loges loggy
+	0x00419cb,0x04419cb,0x08719cb,0x0d719cb,0x12719cb,0x0d01dcb,0x121a1cb,0x126a1cb, // logia logie logoi logon logos lohan loids loins
+	0x047a1cb,0x128a1cb,0x12229cb,0x125adcb,0x185adcb,0x0672dcb,0x12031cb,0x03231cb, // loipe loirs lokes lolls lolly lolog lomas lomed
+	0x12231cb,0x11235cb,0x00335cb,0x04335cb,0x12335cb,0x180b9cb,0x03239cb,0x18239cb, // lomes loner longa longe longs looby looed looey
+	0x002b9cb,0x122b9cb,0x04439cb,0x12539cb,0x18539cb,0x12639cb,0x126b9cb,0x186b9cb, // loofa loofs looie looks looky looms loons loony
+	0x127b9cb,0x038b9cb,0x129b9cb,0x0323dcb,0x1123dcb,0x1223dcb,0x187bdcb,0x0b045cb, // loops loord loots loped loper lopes loppy loral
+	0x0d045cb,0x121c5cb,0x181c5cb,0x0b245cb,0x12245cb,0x02445cb,0x12445cb,0x03249cb, // loran lords lordy lorel lores loric loris losed
+	0x0b249cb,0x0d249cb,0x12249cb,0x18949cb,0x0704dcb,0x1204dcb,0x1224dcb,0x0244dcb, // losel losen loses lossy lotah lotas lotes lotic
+	0x1274dcb,0x0094dcb,0x009cdcb,0x049cdcb,0x0e9cdcb,0x12a4dcb,0x03251cb,0x07351cb, // lotos lotsa lotta lotte lotto lotus loued lough
+	0x04451cb,0x12451cb,0x00651cb,0x036d1cb,0x126d1cb,0x047d1cb,0x127d1cb,0x048d1cb, // louie louis louma lound louns loupe loups loure
+	0x128d1cb,0x188d1cb,0x129d1cb,0x13055cb,0x03255cb,0x12255cb,0x18255cb,0x04455cb, // lours loury louts lovat loved loves lovey lovie
+	0x0d059cb,0x03259cb,0x12259cb,0x036d9cb,0x046d9cb,0x126d9cb,0x127d9cb,0x188d9cb, // lowan lowed lowes lownd lowne lowns lowps lowry
+	0x04959cb,0x129d9cb,0x0325dcb,0x1225dcb,0x0d265cb,0x071028b,0x12a028b,0x032068b, // lowse lowts loxed loxes lozen luach luaus lubed
+	0x122068b,0x008868b,0x1220a8b,0x1250a8b,0x0488a8b,0x1220e8b,0x0240e8b,0x1270e8b, // lubes lubra luces lucks lucre ludes ludic ludos
+	0x002968b,0x122968b,0x0321a8b,0x1121a8b,0x1221a8b,0x125ae8b,0x12a2e8b,0x120328b, // luffa luffs luged luger luges lulls lulus lumas
+	0x080b28b,0x046328b,0x186328b,0x127b28b,0x120368b,0x122368b,0x132368b,0x083368b, // lumbi lumme lummy lumps lunas lunes lunet lungi
+	0x123368b,0x125368b,0x129b68b,0x0d43e8b,0x032468b,0x112468b,0x122468b,0x172468b, // lungs lunks lunts lupin lured lurer lures lurex
+	0x083468b,0x183468b,0x125468b,0x188c68b,0x04ac68b,0x1124a8b,0x183ca8b,0x1254a8b, // lurgi lurgy lurks lurry lurve luser lushy lusks
+	0x129ca8b,0x12a4a8b,0x0024e8b,0x0324e8b,0x1124e8b,0x1224e8b,0x18ad68b,0x0325e8b, // lusts lusus lutea luted luter lutes luvvy luxed
+	0x1125e8b,0x1225e8b,0x12412cb,0x126030b,0x038830b,0x138830b,0x049030b,0x0020b0b, // luxer luxes lweis lyams lyard lyart lyase lycea
+	0x0420b0b,0x0088b0b,0x122330b,0x122370b,0x122470b,0x0324b0b,0x1224b0b,0x0d44b0b, // lycee lycra lymes lynes lyres lysed lyses lysin
+	0x1244b0b,0x0b74b0b,0x0094b0b,0x0324f0b,0x1224f0b,0x043cf0b,0x0244f0b,0x009cf0b, // lysis lysol lyssa lyted lytes lythe lytic lytta
+	0x032000c,0x048800c,0x128800c,0x122040c,0x120080c,0x032080c,0x112080c,0x122080c, // maaed maare maars mabes macas maced macer maces
+	0x043880c,0x083880c,0x123880c,0x125080c,0x045880c,0x0d7080c,0x0430c0c,0x0340c0c, // mache machi machs macks macle macon madge madid
+	0x0488c0c,0x0b8900c,0x024140c,0x122180c,0x123180c,0x137180c,0x12a180c,0x0471c0c, // madre maerl mafic mages maggs magot magus mahoe
+	0x00a1c0c,0x00b1c0c,0x121a00c,0x0e5200c,0x125200c,0x045a00c,0x0b5a00c,0x125a00c, // mahua mahwa maids maiko maiks maile maill mails
+	0x126200c,0x126a00c,0x048a00c,0x128a00c,0x049200c,0x139200c,0x110280c,0x122280c, // maims mains maire mairs maise maist makar makes
+	0x124280c,0x127280c,0x0c02c0c,0x1102c0c,0x1202c0c,0x1702c0c,0x1222c0c,0x0242c0c, // makis makos malam malar malas malax males malic
+	0x0a42c0c,0x1242c0c,0x125ac0c,0x1262c0c,0x1862c0c,0x129ac0c,0x189ac0c,0x12a2c0c, // malik malis malls malms malmy malts malty malus
+	0x00aac0c,0x00b2c0c,0x120300c,0x000b00c,0x042300c,0x182300c,0x044300c,0x120340c, // malva malwa mamas mamba mamee mamey mamie manas
+	0x130340c,0x081b40c,0x012340c,0x032340c,0x072340c,0x122340c,0x132340c,0x123340c, // manat mandi maneb maned maneh manes manet mangs
+	0x124340c,0x185340c,0x006b40c,0x127340c,0x049340c,0x009b40c,0x0e9b40c,0x189b40c, // manis manky manna manos manse manta manto manty
+	0x0ba340c,0x12a340c,0x1403c0c,0x08a400c,0x040440c,0x070440c,0x120440c,0x121440c, // manul manus mapau maqui marae marah maras marcs
+	0x181c40c,0x122440c,0x043440c,0x123440c,0x004440c,0x034440c,0x005440c,0x125440c, // mardy mares marge margs maria marid marka marks
+	0x045c40c,0x125c40c,0x185c40c,0x126440c,0x0d7440c,0x117440c,0x008c40c,0x088c40c, // marle marls marly marms maron maror marra marri
+	0x049440c,0x129c40c,0x18ac40c,0x120480c,0x032480c,0x112480c,0x122480c,0x183c80c, // marse marts marvy masas mased maser mases mashy
+	0x125480c,0x009480c,0x189480c,0x129c80c,0x189c80c,0x12a480c,0x0804c0c,0x0324c0c, // masks massa massy masts masty masus matai mated
+	0x1124c0c,0x1224c0c,0x123cc0c,0x0d44c0c,0x0e5cc0c,0x049cc0c,0x129cc0c,0x00ccc0c, // mater mates maths matin matlo matte matts matza
+	0x0eccc0c,0x180d00c,0x121d00c,0x125d00c,0x036d00c,0x088d00c,0x189500c,0x129d00c, // matzo mauby mauds mauls maund mauri mausy mauts
+	0x18cd00c,0x0d2540c,0x044540c,0x0d4540c,0x124540c,0x032580c,0x125580c,0x185580c, // mauzy maven mavie mavin mavis mawed mawks mawky
+	0x126d80c,0x128d80c,0x0325c0c,0x1225c0c,0x1245c0c,0x0d0600c,0x120600c,0x032600c, // mawns mawrs maxed maxes maxis mayan mayas mayed
+	0x127600c,0x139600c,0x032640c,0x112640c,0x122640c,0x182640c,0x13a640c,0x008a02c, // mayos mayst mazed mazer mazes mazey mazut mbira
+	0x121808c,0x125808c,0x046808c,0x126808c,0x186808c,0x048808c,0x049008c,0x079808c, // meads meals meane means meany meare mease meath
+	0x129808c,0x127048c,0x123888c,0x125088c,0x0840c8c,0x0458c8c,0x121908c,0x128908c, // meats mebos mechs mecks medii medle meeds meers
+	0x129908c,0x122948c,0x126a08c,0x136a08c,0x186a08c,0x079a08c,0x005288c,0x1202c8c, // meets meffs meins meint meiny meith mekka melas
+	0x000ac8c,0x121ac8c,0x0242c8c,0x0a42c8c,0x125ac8c,0x129ac8c,0x189ac8c,0x122308c, // melba melds melic melik mells melts melty memes
+	0x127308c,0x030348c,0x121b48c,0x032348c,0x122348c,0x043348c,0x123348c,0x009348c, // memos menad mends mened menes menge mengs mensa
+	0x049348c,0x079348c,0x009b48c,0x0e9b48c,0x12a348c,0x12a388c,0x12b388c,0x071448c, // mense mensh menta mento menus meous meows merch
+	0x121448c,0x041c48c,0x032448c,0x0b2448c,0x112448c,0x122448c,0x0b4448c,0x124448c, // mercs merde mered merel merer meres meril meris
+	0x125448c,0x045c48c,0x125c48c,0x049448c,0x0b0488c,0x120488c,0x0b2488c,0x122488c, // merks merle merls merse mesal mesas mesel meses
+	0x183c88c,0x024488c,0x046c88c,0x0d7488c,0x189488c,0x0e9c88c,0x0324c8c,0x1224c8c, // meshy mesic mesne meson messy mesto meted metes
+	0x0e3cc8c,0x123cc8c,0x0244c8c,0x0544c8c,0x1244c8c,0x0b74c8c,0x048cc8c,0x049508c, // metho meths metic metif metis metol metre meuse
+	0x032548c,0x122548c,0x032588c,0x125d88c,0x136e08c,0x122648c,0x04ce48c,0x0ece48c, // meved meves mewed mewls meynt mezes mezze mezzo
+	0x118b8ec,0x147010c,0x167010c,0x0c9010c,0x0ba010c,0x120090c,0x043890c,0x133890c, // mhorr miaou miaow miasm miaul micas miche micht
+	0x125090c,0x185090c,0x127090c,0x008890c,0x1818d0c,0x1830d0c,0x1240d0c,0x126910c, // micks micky micos micra middy midgy midis miens
+	0x04a910c,0x122950c,0x182950c,0x189950c,0x123190c,0x1201d0c,0x1241d0c,0x032290c, // mieve miffs miffy mifty miggs mihas mihis miked
+	0x122290c,0x008a90c,0x00aa90c,0x0712d0c,0x121ad0c,0x1122d0c,0x1222d0c,0x122ad0c, // mikes mikra mikva milch milds miler miles milfs
+	0x0042d0c,0x0e52d0c,0x1252d0c,0x045ad0c,0x125ad0c,0x1172d0c,0x1272d0c,0x007ad0c, // milia milko milks mille mills milor milos milpa
+	0x129ad0c,0x189ad0c,0x199ad0c,0x032310c,0x0e2310c,0x112310c,0x122310c,0x189310c, // milts milty miltz mimed mimeo mimer mimes mimsy
+	0x040350c,0x110350c,0x120350c,0x181350c,0x121b50c,0x032350c,0x122350c,0x043350c, // minae minar minas mincy minds mined mines minge
+	0x123350c,0x183350c,0x124350c,0x045350c,0x125350c,0x186b50c,0x127350c,0x129b50c, // mings mingy minis minke minks minny minos mints
+	0x032450c,0x122450c,0x172450c,0x034450c,0x0d4450c,0x125450c,0x185450c,0x185c50c, // mired mires mirex mirid mirin mirks mirky mirly
+	0x127450c,0x12ac50c,0x00cc50c,0x071490c,0x0e1c90c,0x122490c,0x0e3490c,0x127490c, // miros mirvs mirza misch misdo mises misgo misos
+	0x009490c,0x129c90c,0x189c90c,0x0714d0c,0x1124d0c,0x1224d0c,0x1244d0c,0x048cd0c, // missa mists misty mitch miter mites mitis mitre
+	0x129cd0c,0x0325d0c,0x0d25d0c,0x1125d0c,0x1225d0c,0x049dd0c,0x0fa5d0c,0x0d2650c, // mitts mixed mixen mixer mixes mixte mixup mizen
+	0x18ce50c,0x04611ac,0x12681cc,0x12981cc,0x18085cc,0x12205cc,0x18205cc,0x04405cc, // mizzy mneme moans moats mobby mobes mobey mobie
+	0x04585cc,0x08389cc,0x12389cc,0x18389cc,0x12509cc,0x1120dcc,0x1220dcc,0x0430dcc, // moble mochi mochs mochy mocks moder modes modge
+	0x0840dcc,0x12a0dcc,0x12891cc,0x12715cc,0x18319cc,0x0b21dcc,0x1271dcc,0x1289dcc, // modii modus moers mofos moggy mohel mohos mohrs
+	0x00a1dcc,0x11a1dcc,0x045a1cc,0x125a1cc,0x008a1cc,0x048a1cc,0x129a1cc,0x12725cc, // mohua mohur moile moils moira moire moits mojos
+	0x12229cc,0x12429cc,0x12729cc,0x0b02dcc,0x1202dcc,0x121adcc,0x0322dcc,0x1222dcc, // mokes mokis mokos molal molas molds moled moles
+	0x005adcc,0x125adcc,0x185adcc,0x0e9adcc,0x129adcc,0x12c2dcc,0x12231cc,0x00631cc, // molla molls molly molto molts molys momes momma
+	0x18631cc,0x12a31cc,0x03035cc,0x0b035cc,0x12035cc,0x041b5cc,0x0e1b5cc,0x11235cc, // mommy momus monad monal monas monde mondo moner
+	0x0e335cc,0x12335cc,0x02435cc,0x04435cc,0x12535cc,0x12735cc,0x049b5cc,0x189b5cc, // mongo mongs monic monie monks monos monte monty
+	0x120b9cc,0x07139cc,0x121b9cc,0x03239cc,0x12539cc,0x005b9cc,0x085b9cc,0x125b9cc, // moobs mooch moods mooed mooks moola mooli mools
+	0x185b9cc,0x066b9cc,0x126b9cc,0x186b9cc,0x127b9cc,0x128b9cc,0x188b9cc,0x129b9cc, // mooly moong moons moony moops moors moory moots
+	0x04ab9cc,0x0323dcc,0x1123dcc,0x1223dcc,0x1823dcc,0x187bdcc,0x1893dcc,0x12a3dcc, // moove moped moper mopes mopey moppy mopsy mopus
+	0x04045cc,0x12045cc,0x13045cc,0x18045cc,0x0b245cc,0x12245cc,0x00445cc,0x046c5cc, // morae moras morat moray morel mores moria morne
+	0x126c5cc,0x008c5cc,0x0e8c5cc,0x04945cc,0x129c5cc,0x03249cc,0x12249cc,0x18249cc, // morns morra morro morse morts mosed moses mosey
+	0x12549cc,0x0e949cc,0x049c9cc,0x129c9cc,0x0324dcc,0x0d24dcc,0x1224dcc,0x1324dcc, // mosks mosso moste mosts moted moten motes motet
+	0x1824dcc,0x123cdcc,0x183cdcc,0x1244dcc,0x049cdcc,0x129cdcc,0x189cdcc,0x12a4dcc, // motey moths mothy motis motte motts motty motus
+	0x00ccdcc,0x07151cc,0x12251cc,0x035d1cc,0x125d1cc,0x127d1cc,0x13951cc,0x18951cc, // motza mouch moues mould mouls moups moust mousy
+	0x03255cc,0x12255cc,0x12059cc,0x03259cc,0x008d9cc,0x1205dcc,0x0445dcc,0x12061cc, // moved moves mowas mowed mowra moxas moxie moyas
+	0x045e1cc,0x125e1cc,0x03265cc,0x12265cc,0x12765cc,0x13245ec,0x0e38a8c,0x0240a8c, // moyle moyls mozed mozes mozos mpret mucho mucic
+	0x0340a8c,0x0d40a8c,0x1250a8c,0x1170a8c,0x0e88a8c,0x0430e8c,0x1140e8c,0x0088e8c, // mucid mucin mucks mucor mucro mudge mudir mudra
+	0x122968c,0x089968c,0x0031a8c,0x1231a8c,0x1831a8c,0x1859e8c,0x121a28c,0x125a28c, // muffs mufti mugga muggs muggy muhly muids muils
+	0x128a28c,0x139228c,0x0a4268c,0x1312e8c,0x0322e8c,0x1222e8c,0x1822e8c,0x0032e8c, // muirs muist mujik mulct muled mules muley mulga
+	0x0442e8c,0x005ae8c,0x125ae8c,0x0492e8c,0x0792e8c,0x126328c,0x127b28c,0x189328c, // mulie mulla mulls mulse mulsh mumms mumps mumsy
+	0x12a328c,0x003368c,0x043368c,0x0e3368c,0x123368c,0x124368c,0x129b68c,0x149b68c, // mumus munga munge mungo mungs munis munts muntu
+	0x126ba8c,0x120468c,0x032468c,0x122468c,0x172468c,0x034468c,0x125468c,0x125c68c, // muons muras mured mures murex murid murks murls
+	0x185c68c,0x008c68c,0x048c68c,0x088c68c,0x128c68c,0x188c68c,0x089c68c,0x00ac68c, // murly murra murre murri murrs murry murti murva
+	0x1104a8c,0x0014a8c,0x0324a8c,0x1124a8c,0x1224a8c,0x1324a8c,0x003ca8c,0x1344a8c, // musar musca mused muser muses muset musha musit
+	0x1254a8c,0x1274a8c,0x0494a8c,0x1894a8c,0x079ca8c,0x129ca8c,0x0714e8c,0x0324e8c, // musks musos musse mussy musth musts mutch muted
+	0x1124e8c,0x1224e8c,0x003ce8c,0x1244e8c,0x0d74e8c,0x129ce8c,0x0325e8c,0x1225e8c, // muter mutes mutha mutis muton mutts muxed muxes
+	0x0a0668c,0x18ce68c,0x045d2ac,0x0b5830c,0x1102f0c,0x070370c,0x120370c,0x0343b0c, // muzak muzzy mvule myall mylar mynah mynas myoid
+	0x0063b0c,0x047bb0c,0x127bb0c,0x187bb0c,0x0344b0c,0x083cf0c,0x123cf0c,0x183cf0c, // myoma myope myops myopy mysid mythi myths mythy
+	0x1275f0c,0x122132c,0x126000d,0x126800d,0x122040d,0x124040d,0x125040d,0x005840d, // myxos mzees naams naans nabes nabis nabks nabla
+	0x017040d,0x043880d,0x0e3880d,0x048880d,0x1200c0d,0x04a900d,0x08a900d,0x122940d, // nabob nache nacho nacre nadas naeve naevi naffs
+	0x120180d,0x183180d,0x117180d,0x0b01c0d,0x030200d,0x122a00d,0x125200d,0x125a00d, // nagas naggy nagor nahal naiad naifs naiks nails
+	0x008a00d,0x148a00d,0x032280d,0x112280d,0x002a80d,0x1202c0d,0x0322c0d,0x005ac0d, // naira nairu naked naker nakfa nalas naled nalla
+	0x032300d,0x112300d,0x122300d,0x006300d,0x12a300d,0x120340d,0x041340d,0x181340d, // named namer names namma namus nanas nance nancy
+	0x141b40d,0x006b40d,0x127340d,0x00a340d,0x1203c0d,0x0323c0d,0x1223c0d,0x0e73c0d, // nandu nanna nanos nanua napas naped napes napoo
+	0x007bc0d,0x047bc0d,0x187bc0d,0x120440d,0x0e1440d,0x121440d,0x121c40d,0x122440d, // nappa nappe nappy naras narco narcs nards nares
+	0x024440d,0x124440d,0x125440d,0x185440d,0x048c40d,0x083c80d,0x0714c0d,0x1224c0d, // naric naris narks narky narre nashi natch nates
+	0x1244c0d,0x189cc0d,0x071500d,0x136d00d,0x110540d,0x122540d,0x162540d,0x18ad40d, // natis natty nauch naunt navar naves navew navvy
+	0x010580d,0x122640d,0x114640d,0x124640d,0x004d06d,0x042808d,0x125808d,0x127808d, // nawab nazes nazir nazis nduja neafe neals neaps
+	0x128808d,0x079808d,0x129808d,0x0a2048d,0x0b2048d,0x125088d,0x1818c8d,0x121908d, // nears neath neats nebek nebel necks neddy needs
+	0x035908d,0x045908d,0x016108d,0x126108d,0x127908d,0x049108d,0x04c908d,0x0e8988d, // neeld neele neemb neems neeps neese neeze negro
+	0x12a188d,0x122a08d,0x139208d,0x04aa08d,0x1242c8d,0x185ac8d,0x120308d,0x126b08d, // negus neifs neist neive nelis nelly nemas nemns
+	0x137b08d,0x122348d,0x126b88d,0x1123c8d,0x1343c8d,0x0b0448d,0x121c48d,0x005448d, // nempt nenes neons neper nepit neral nerds nerka
+	0x125448d,0x0b7448d,0x129c48d,0x199c48d,0x18ac48d,0x129c88d,0x1224c8d,0x0f74c8d, // nerks nerol nerts nertz nervy nests netes netop
+	0x129cc8d,0x189cc8d,0x125508d,0x046508d,0x126508d,0x0b2548d,0x122548d,0x12a548d, // netts netty neuks neume neums nevel neves nevus
+	0x120d88d,0x032588d,0x0b2588d,0x044588d,0x189588d,0x129d88d,0x129dc8d,0x12a5c8d, // newbs newed newel newie newsy newts nexts nexus
+	0x0e400cd,0x00680cd,0x08980cd,0x00638cd,0x04258cd,0x030090d,0x133890d,0x125090d, // ngaio ngana ngati ngoma ngwee nicad nicht nicks
+	0x0b7090d,0x0b00d0d,0x0320d0d,0x1220d0d,0x1170d0d,0x12a0d0d,0x122910d,0x04a910d, // nicol nidal nided nides nidor nidus niefs nieve
+	0x122150d,0x122950d,0x182950d,0x189950d,0x112190d,0x123990d,0x0b41d0d,0x010290d, // nifes niffs niffy nifty niger nighs nihil nikab
+	0x070290d,0x140290d,0x125ad0d,0x080b10d,0x120b10d,0x127b10d,0x112350d,0x122350d, // nikah nikau nills nimbi nimbs nimps niner nines
+	0x0d7350d,0x1203d0d,0x187bd0d,0x010410d,0x125c50d,0x185c50d,0x082490d,0x049490d, // ninon nipas nippy niqab nirls nirly nisei nisse
+	0x12a490d,0x1124d0d,0x1224d0d,0x0344d0d,0x0d74d0d,0x048cd0d,0x0e8cd0d,0x188cd0d, // nisus niter nites nitid niton nitre nitro nitry
+	0x189cd0d,0x0b0550d,0x0325d0d,0x1125d0d,0x1225d0d,0x0445d0d,0x0c0650d,0x089394d, // nitty nival nixed nixer nixes nixie nizam nkosi
+	0x12381cd,0x18085cd,0x12509cd,0x0b00dcd,0x1818dcd,0x1220dcd,0x12a0dcd,0x12591cd, // noahs nobby nocks nodal noddy nodes nodus noels
+	0x12319cd,0x1671dcd,0x125a1cd,0x185a1cd,0x136a1cd,0x128a1cd,0x1222dcd,0x125adcd, // noggs nohow noils noily noint noirs noles nolls
+	0x1272dcd,0x12031cd,0x0d231cd,0x12231cd,0x02431cd,0x08731cd,0x12731cd,0x12035cd, // nolos nomas nomen nomes nomic nomoi nomos nonas
+	0x04135cd,0x12235cd,0x13235cd,0x12335cd,0x12435cd,0x186b5cd,0x0bc35cd,0x120b9cd, // nonce nones nonet nongs nonis nonny nonyl noobs
+	0x13439cd,0x12539cd,0x18539cd,0x126b9cd,0x127b9cd,0x0b03dcd,0x00445cd,0x12445cd, // nooit nooks nooky noons noops nopal noria noris
+	0x12545cd,0x00645cd,0x12645cd,0x03249cd,0x11249cd,0x12249cd,0x0b04dcd,0x0324dcd, // norks norma norms nosed noser noses notal noted
+	0x1124dcd,0x1224dcd,0x0ca4dcd,0x035d1cd,0x045d1cd,0x125d1cd,0x126d1cd,0x186d1cd, // noter notes notum nould noule nouls nouns nouny
+	0x127d1cd,0x04055cd,0x12055cd,0x0ca55cd,0x18059cd,0x03259cd,0x125d9cd,0x129d9cd, // noups novae novas novum noway nowed nowls nowts
+	0x189d9cd,0x0b05dcd,0x1225dcd,0x14061cd,0x03261cd,0x12261cd,0x180868d,0x004068d, // nowty noxal noxes noyau noyed noyes nubby nubia
+	0x0038a8d,0x1818e8d,0x1120e8d,0x1220e8d,0x0440e8d,0x07c8e8d,0x122968d,0x0401a8d, // nucha nuddy nuder nudes nudie nudzh nuffs nugae
+	0x0322a8d,0x1222a8d,0x005ae8d,0x125ae8d,0x120b28d,0x0d2328d,0x186328d,0x186b68d, // nuked nukes nulla nulls numbs numen nummy nunny
+	0x121c68d,0x181c68d,0x125c68d,0x128c68d,0x0e94e8d,0x1894e8d,0x052830d,0x005830d, // nurds nurdy nurls nurrs nutso nutsy nyaff nyala
+	0x066a30d,0x0094b0d,0x032280e,0x112280e,0x0ca280e,0x032440e,0x122480e,0x124480e, // nying nyssa oaked oaker oakum oared oases oasis
+	0x129c80e,0x0d24c0e,0x1124c0e,0x123cc0e,0x122540e,0x066802e,0x070102e,0x085902e, // oasts oaten oater oaths oaves obang obeah obeli
+	0x12c102e,0x120202e,0x032202e,0x134202e,0x129a02e,0x132242e,0x122382e,0x045b82e, // obeys obias obied obiit obits objet oboes obole
+	0x085b82e,0x125b82e,0x0c0084e,0x1121c4e,0x1221c4e,0x0489c4e,0x1889c4e,0x112284e, // oboli obols occam ocher oches ochre ochry ocker
+	0x002444e,0x0304c4e,0x0d04c4e,0x1204c4e,0x0bc4c4e,0x085d04e,0x123806e,0x125806e, // ocrea octad octan octas octyl oculi odahs odals
+	0x0d7106e,0x0ca106e,0x0c9206e,0x139206e,0x0ca206e,0x128b86e,0x11a386e,0x045e06e, // odeon odeum odism odist odium odors odour odyle
+	0x125e06e,0x12c00ae,0x03214ae,0x04414ae,0x0602cae,0x1124cae,0x12600ce,0x03210ce, // odyls ofays offed offie oflag ofter ogams ogeed
+	0x12210ce,0x0d418ce,0x0c01cce,0x04aa0ce,0x0322cce,0x1122cce,0x1222cce,0x02430ce, // ogees oggin ogham ogive ogled ogler ogles ogmic
+	0x12244ce,0x12020ee,0x066a0ee,0x02430ee,0x046b8ee,0x0040d0e,0x0322d0e,0x1122d0e, // ogres ohias ohing ohmic ohone oidia oiled oiler
+	0x125350e,0x129b50e,0x046212e,0x087814e,0x12c014e,0x123914e,0x120454e,0x1204d4e, // oinks oints ojime okapi okays okehs okras oktas
+	0x0440d6e,0x024116e,0x0d4116e,0x136916e,0x127116e,0x0ca116e,0x127216e,0x1202d6e, // oldie oleic olein olent oleos oleum olios ollas
+	0x1502d6e,0x1122d6e,0x0442d6e,0x183396e,0x0403d6e,0x1223d6e,0x009018e,0x112058e, // ollav oller ollie ology olpae olpes omasa omber
+	0x12a058e,0x126918e,0x128918e,0x129a18e,0x0702d8e,0x12ab98e,0x070458e,0x11209ae, // ombus omens omers omits omlah omovs omrah oncer
+	0x12209ae,0x13209ae,0x12a09ae,0x18591ae,0x12891ae,0x18891ae,0x0ca21ae,0x12a29ae, // onces oncet oncus onely oners onery onium onkus
+	0x1802dae,0x03235ae,0x0244dae,0x13405ce,0x0321dce,0x077b1ce,0x129b5ce,0x0323dce, // onlay onned ontic oobit oohed oomph oonts ooped
+	0x04445ce,0x12249ce,0x0344dce,0x03265ce,0x12265ce,0x12381ee,0x12581ee,0x12691ee, // oorie ooses ootid oozed oozes opahs opals opens
+	0x04791ee,0x066a1ee,0x1273dee,0x0d449ee,0x0324dee,0x1124dee,0x071022e,0x181022e, // opepe oping oppos opsin opted opter orach oracy
+	0x125822e,0x066822e,0x136822e,0x049822e,0x032062e,0x1200a2e,0x0d40a2e,0x1270e2e, // orals orang orant orate orbed orcas orcin ordos
+	0x030122e,0x122162e,0x0041a2e,0x0241a2e,0x04a1a2e,0x080a22e,0x0b2222e,0x00ba22e, // oread orfes orgia orgic orgue oribi oriel orixa
+	0x1222e2e,0x0d72e2e,0x0f72e2e,0x112322e,0x124362e,0x0d43e2e,0x124462e,0x0e3ce2e, // orles orlon orlop ormer ornis orpin orris ortho
+	0x0b0562e,0x127662e,0x1100a4e,0x0201e4e,0x112224e,0x024324e,0x0b7324e,0x0044a4e, // orval orzos oscar oshac osier osmic osmol ossia
+	0x0044e4e,0x145026e,0x188826e,0x1104e6e,0x1274e6e,0x134068e,0x1338a8e,0x126928e, // ostia otaku otary ottar ottos oubit oucht ouens
+	0x004a28e,0x1252e8e,0x120328e,0x181b68e,0x1203e8e,0x0323e8e,0x043be8e,0x123be8e, // ouija oulks oumas oundy oupas ouped ouphe ouphs
+	0x044468e,0x0b24a8e,0x129ca8e,0x180ce8e,0x0324e8e,0x048ce8e,0x0e8ce8e,0x009ce8e, // ourie ousel ousts outby outed outre outro outta
+	0x0b2668e,0x127668e,0x12582ae,0x12592ae,0x12692ae,0x12892ae,0x13922ae,0x085baae, // ouzel ouzos ovals ovels ovens overs ovist ovoli
+	0x0e5baae,0x045d2ae,0x0438ace,0x12222ce,0x0322ece,0x1122ece,0x1322ece,0x03236ce, // ovolo ovule owche owies owled owler owlet owned
+	0x12246ce,0x04446ce,0x0d24ace,0x16706ee,0x12892ee,0x04c12ee,0x121a2ee,0x12222ee, // owres owrie owsen oxbow oxers oxeye oxids oxies
+	0x04622ee,0x12622ee,0x0f42eee,0x1124eee,0x128930e,0x085132e,0x044672e,0x125800f, // oxime oxims oxlip oxter oyers ozeki ozzie paals
+	0x126800f,0x120080f,0x032080f,0x112080f,0x122080f,0x182080f,0x003880f,0x125080f, // paans pacas paced pacer paces pacey pacha packs
+	0x127080f,0x009880f,0x129880f,0x1240c0f,0x0458c0f,0x0060c0f,0x0488c0f,0x0888c0f, // pacos pacta pacts padis padle padma padre padri
+	0x0d0100f,0x0e1900f,0x0d7100f,0x032180f,0x112180f,0x122180f,0x045980f,0x037180f, // paean paedo paeon paged pager pages pagle pagod
+	0x088980f,0x125200f,0x125a00f,0x126a00f,0x048a00f,0x128a00f,0x009200f,0x049200f, // pagri paiks pails pains paire pairs paisa paise
+	0x005280f,0x1202c0f,0x1802c0f,0x0022c0f,0x0322c0f,0x1222c0f,0x1322c0f,0x1242c0f, // pakka palas palay palea paled pales palet palis
+	0x0852c0f,0x005ac0f,0x125ac0f,0x185ac0f,0x1262c0f,0x1862c0f,0x087ac0f,0x127ac0f, // palki palla palls pally palms palmy palpi palps
+	0x0092c0f,0x007b00f,0x170340f,0x041340f,0x001b40f,0x121b40f,0x181b40f,0x032340f, // palsa pampa panax pance panda pands pandy paned
+	0x122340f,0x003340f,0x123340f,0x0c4340f,0x0e5340f,0x046b40f,0x086b40f,0x0e9b40f, // panes panga pangs panim panko panne panni panto
+	0x129b40f,0x189b40f,0x085b80f,0x0e5b80f,0x1203c0f,0x1603c0f,0x1223c0f,0x087bc0f, // pants panty paoli paolo papas papaw papes pappi
+	0x187bc0f,0x040440f,0x120440f,0x071440f,0x081c40f,0x121c40f,0x181c40f,0x032440f, // pappy parae paras parch pardi pards pardy pared
+	0x0d2440f,0x0e2440f,0x122440f,0x142440f,0x152440f,0x043440f,0x0e3440f,0x124440f, // paren pareo pares pareu parev parge pargo paris
+	0x085440f,0x125440f,0x185440f,0x045c40f,0x185c40f,0x006440f,0x0b7440f,0x127c40f, // parki parks parky parle parly parma parol parps
+	0x008c40f,0x128c40f,0x089c40f,0x129c40f,0x04ac40f,0x0eac40f,0x0e2480f,0x122480f, // parra parrs parti parts parve parvo paseo pases
+	0x003c80f,0x0c3c80f,0x005480f,0x187c80f,0x049480f,0x129c80f,0x0324c0f,0x0d24c0f, // pasha pashm paska paspy passe pasts pated paten
+	0x1124c0f,0x1224c0f,0x123cc0f,0x0d44c0f,0x0054c0f,0x185cc0f,0x049cc0f,0x12a4c0f, // pater pates paths patin patka patly patte patus
+	0x120500f,0x125d00f,0x0d0540f,0x032540f,0x0d2540f,0x112540f,0x122540f,0x034540f, // pauas pauls pavan paved paven paver paves pavid
+	0x0d4540f,0x124540f,0x120580f,0x160580f,0x032580f,0x112580f,0x125580f,0x185580f, // pavin pavis pawas pawaw pawed pawer pawks pawky
+	0x125d80f,0x126d80f,0x1225c0f,0x032600f,0x117600f,0x039600f,0x043008f,0x123008f, // pawls pawns paxes payed payor paysd peage peags
+	0x125008f,0x185008f,0x125808f,0x126808f,0x048808f,0x128808f,0x138808f,0x049008f, // peaks peaky peals peans peare pears peart pease
+	0x129808f,0x189808f,0x18a808f,0x04c808f,0x120048f,0x123888f,0x045088f,0x125088f, // peats peaty peavy peaze pebas pechs pecke pecks
+	0x185088f,0x1220c8f,0x1240c8f,0x0e88c8f,0x041108f,0x125108f,0x125908f,0x126908f, // pecky pedes pedis pedro peece peeks peels peens
+	0x187108f,0x047908f,0x127908f,0x128908f,0x188908f,0x04a908f,0x183188f,0x123988f, // peeoy peepe peeps peers peery peeve peggy peghs
+	0x126a08f,0x049208f,0x04ca08f,0x0d0288f,0x122288f,0x0d4288f,0x047288f,0x1202c8f, // peins peise peize pekan pekes pekin pekoe pelas
+	0x1402c8f,0x1222c8f,0x122ac8f,0x125ac8f,0x0062c8f,0x0d72c8f,0x009ac8f,0x129ac8f, // pelau peles pelfs pells pelma pelon pelta pelts
+	0x121b48f,0x141b48f,0x032348f,0x122348f,0x0e3348f,0x044348f,0x124348f,0x125348f, // pends pendu pened penes pengo penie penis penks
+	0x006b48f,0x086b48f,0x129b48f,0x126b88f,0x186b88f,0x005bc8f,0x1273c8f,0x187bc8f, // penna penni pents peons peony pepla pepos peppy
+	0x0893c8f,0x080448f,0x041448f,0x121448f,0x141c48f,0x181c48f,0x002448f,0x122448f, // pepsi perai perce percs perdu perdy perea peres
+	0x124448f,0x125448f,0x126448f,0x126c48f,0x067448f,0x127c48f,0x188c48f,0x049448f, // peris perks perms perns perog perps perry perse
+	0x139448f,0x129c48f,0x04ac48f,0x0eac48f,0x12ac48f,0x18ac48f,0x127488f,0x129c88f, // perst perts perve pervo pervs pervy pesos pests
+	0x189c88f,0x1104c8f,0x1124c8f,0x1344c8f,0x048cc8f,0x088cc8f,0x089cc8f,0x0e9cc8f, // pesty petar peter petit petre petri petti petto
+	0x042588f,0x134588f,0x049608f,0x04300ef,0x06680ef,0x04880ef,0x0c880ef,0x11210ef, // pewee pewit peyse phage phang phare pharm pheer
+	0x04690ef,0x0d710ef,0x04910ef,0x0b020ef,0x07920ef,0x19ca0ef,0x1772cef,0x00138ef, // phene pheon phese phial phish phizz phlox phoca
+	0x0e6b8ef,0x126b8ef,0x129b8ef,0x133bcef,0x129d0ef,0x005e0ef,0x045e0ef,0x086810f, // phono phons phots phpht phuts phyla phyle piani
+	0x126810f,0x0b0050f,0x0b0090f,0x120090f,0x181090f,0x125090f,0x137090f,0x008890f, // pians pibal pical picas piccy picks picot picra
+	0x0ba090f,0x036910f,0x128910f,0x138910f,0x009910f,0x129910f,0x0ec910f,0x133990f, // picul piend piers piert pieta piets piezo pight
+	0x186190f,0x066a10f,0x120290f,0x140290f,0x032290f,0x112290f,0x122290f,0x182290f, // pigmy piing pikas pikau piked piker pikes pikey
+	0x124290f,0x0ba290f,0x0402d0f,0x0502d0f,0x0e02d0f,0x1102d0f,0x1402d0f,0x1602d0f, // pikis pikul pilae pilaf pilao pilar pilau pilaw
+	0x0712d0f,0x0022d0f,0x0322d0f,0x0822d0f,0x1122d0f,0x1222d0f,0x1242d0f,0x125ad0f, // pilch pilea piled pilei piler piles pilis pills
+	0x1672d0f,0x0ca2d0f,0x12a2d0f,0x120310f,0x127b10f,0x120350f,0x032350f,0x122350f, // pilow pilum pilus pimas pimps pinas pined pines
+	0x0e3350f,0x123350f,0x0e5350f,0x125350f,0x006b50f,0x186b50f,0x0d7350f,0x137350f, // pingo pings pinko pinks pinna pinny pinon pinot
+	0x009b50f,0x129b50f,0x0fa350f,0x126b90f,0x186b90f,0x12a390f,0x04c390f,0x12c390f, // pinta pints pinup pions piony pious pioye pioys
+	0x0b03d0f,0x1203d0f,0x0323d0f,0x1223d0f,0x1323d0f,0x1243d0f,0x1343d0f,0x187bd0f, // pipal pipas piped pipes pipet pipis pipit pippy
+	0x0ba3d0f,0x080450f,0x125c50f,0x126c50f,0x067450f,0x0e1490f,0x122490f,0x185490f, // pipul pirai pirls pirns pirog pisco pises pisky
+	0x127490f,0x189490f,0x049c90f,0x1204d0f,0x123cd0f,0x0d74d0f,0x1374d0f,0x009cd0f, // pisos pissy piste pitas piths piton pitot pitta
+	0x126510f,0x1225d0f,0x032650f,0x122650f,0x120016f,0x0a1016f,0x043016f,0x126816f, // piums pixes pized pizes plaas plack plage plans
+	0x127816f,0x079016f,0x0c9016f,0x139016f,0x129816f,0x139816f,0x189816f,0x00c016f, // plaps plash plasm plast plats platt platy playa
+	0x12c016f,0x120116f,0x040916f,0x120916f,0x006916f,0x0d7116f,0x079116f,0x12b116f, // plays pleas plebe plebs plena pleon plesh plews
+	0x001216f,0x122216f,0x126216f,0x066a16f,0x0a6a16f,0x130396f,0x121b96f,0x066b96f, // plica plies plims pling plink ploat plods plong
+	0x0a6b96f,0x0a7396f,0x127b96f,0x129b96f,0x199b96f,0x0aa396f,0x12b396f,0x04c396f, // plonk plook plops plots plotz plouk plows ploye
+	0x12c396f,0x122516f,0x052d16f,0x123516f,0x126516f,0x186516f,0x137516f,0x0e9d16f, // ploys plues pluff plugs plums plumy pluot pluto
+	0x112616f,0x07101cf,0x00501cf,0x04501cf,0x18705cf,0x12509cf,0x18509cf,0x0b00dcf, // plyer poach poaka poake poboy pocks pocky podal
+	0x1818dcf,0x1720dcf,0x0430dcf,0x1830dcf,0x0040dcf,0x12611cf,0x12791cf,0x12991cf, // poddy podex podge podgy podia poems poeps poets
+	0x18219cf,0x04319cf,0x12719cf,0x0321dcf,0x145a1cf,0x036a1cf,0x0b029cf,0x03229cf, // pogey pogge pogos pohed poilu poind pokal poked
+	0x12229cf,0x18229cf,0x04429cf,0x0322dcf,0x1122dcf,0x1222dcf,0x1822dcf,0x0e42dcf, // pokes pokey pokie poled poler poles poley polio
+	0x1242dcf,0x044adcf,0x1252dcf,0x125adcf,0x185adcf,0x1272dcf,0x129adcf,0x12c2dcf, // polis polje polks polls polly polos polts polys
+	0x040b1cf,0x12231cf,0x18631cf,0x12731cf,0x127b1cf,0x04135cf,0x18135cf,0x121b5cf, // pombe pomes pommy pomos pomps ponce poncy ponds
+	0x12235cf,0x18235cf,0x00335cf,0x0e335cf,0x12335cf,0x18335cf,0x12535cf,0x129b5cf, // pones poney ponga pongo pongs pongy ponks ponts
+	0x189b5cf,0x14cb5cf,0x121b9cf,0x03239cf,0x122b9cf,0x182b9cf,0x123b9cf,0x004b9cf, // ponty ponzu poods pooed poofs poofy poohs pooja
+	0x00539cf,0x12539cf,0x125b9cf,0x126b9cf,0x127b9cf,0x187b9cf,0x088b9cf,0x138b9cf, // pooka pooks pools poons poops poopy poori poort
+	0x129b9cf,0x04ab9cf,0x18ab9cf,0x1223dcf,0x007bdcf,0x1893dcf,0x04045cf,0x0b045cf, // poots poove poovy popes poppa popsy porae poral
+	0x03245cf,0x11245cf,0x12245cf,0x04345cf,0x18345cf,0x0d445cf,0x12545cf,0x18545cf, // pored porer pores porge porgy porin porks porky
+	0x0e6c5cf,0x126c5cf,0x186c5cf,0x009c5cf,0x129c5cf,0x189c5cf,0x03249cf,0x12249cf, // porno porns porny porta ports porty posed poses
+	0x18249cf,0x0e3c9cf,0x129c9cf,0x0404dcf,0x0714dcf,0x0324dcf,0x1224dcf,0x0d44dcf, // posey posho posts potae potch poted potes potin
+	0x0e74dcf,0x1894dcf,0x0e9cdcf,0x129cdcf,0x189cdcf,0x052d1cf,0x122d1cf,0x04551cf, // potoo potsy potto potts potty pouff poufs pouke
+	0x12551cf,0x045d1cf,0x0f5d1cf,0x135d1cf,0x047d1cf,0x137d1cf,0x128d1cf,0x129d1cf, // pouks poule poulp poult poupe poupt pours pouts
+	0x0d059cf,0x0d459cf,0x036d9cf,0x126d9cf,0x186d9cf,0x048d9cf,0x0325dcf,0x1225dcf, // powan powin pownd powns powny powre poxed poxes
+	0x136e1cf,0x14761cf,0x04961cf,0x18ce5cf,0x0c0022f,0x121822f,0x143822f,0x126022f, // poynt poyou poyse pozzy praam prads prahu prams
+	0x006822f,0x066822f,0x127022f,0x049022f,0x049822f,0x129822f,0x139822f,0x189822f, // prana prang praos prase prate prats pratt praty
+	0x12a022f,0x12c022f,0x181922f,0x032122f,0x122122f,0x054122f,0x126122f,0x186122f, // praus prays predy preed prees preif prems premy
+	0x136922f,0x0d7122f,0x0f7122f,0x127922f,0x009122f,0x049122f,0x139122f,0x04a922f, // prent preon preop preps presa prese prest preve
+	0x18b922f,0x12c122f,0x0b0222f,0x181222f,0x052222f,0x112222f,0x122222f,0x123222f, // prexy preys prial pricy prief prier pries prigs
+	0x0b5a22f,0x006222f,0x086222f,0x0f6222f,0x126222f,0x186222f,0x0a6a22f,0x0d7222f, // prill prima primi primp prims primy prink prion
+	0x049222f,0x129222f,0x1203a2f,0x120ba2f,0x121ba2f,0x0c23a2f,0x122ba2f,0x1233a2f, // prise priss proas probs prods proem profs progs
+	0x0d43a2f,0x0453a2f,0x045ba2f,0x0b5ba2f,0x0e63a2f,0x1263a2f,0x0a6ba2f,0x127ba2f, // proin proke prole proll promo proms pronk props
+	0x048ba2f,0x0e93a2f,0x1293a2f,0x1393a2f,0x1893a2f,0x0e9ba2f,0x0ba3a2f,0x12b3a2f, // prore proso pross prost prosy proto proul prows
+	0x0dc3a2f,0x136d22f,0x009d22f,0x112622f,0x049622f,0x03a124f,0x1601e4f,0x0d7224f, // proyn prunt pruta pryer pryse pseud pshaw psion
+	0x0403a4f,0x0803a4f,0x1203a4f,0x008ba4f,0x071624f,0x0f7624f,0x0e1068f,0x122068f, // psoae psoai psoas psora psych psyop pubco pubes
+	0x124068f,0x0d00a8f,0x1120a8f,0x1220a8f,0x0050a8f,0x1250a8f,0x1818e8f,0x0430e8f, // pubis pucan pucer puces pucka pucks puddy pudge
+	0x0240e8f,0x1170e8f,0x1890e8f,0x12a0e8f,0x128928f,0x002968f,0x122968f,0x1831a8f, // pudic pudor pudsy pudus puers puffa puffs puggy
+	0x0b41a8f,0x1201e8f,0x070268f,0x120268f,0x1202a8f,0x0322a8f,0x1122a8f,0x1222a8f, // pugil puhas pujah pujas pukas puked puker pukes
+	0x1822a8f,0x0052a8f,0x12a2a8f,0x0e02e8f,0x1202e8f,0x0322e8f,0x1122e8f,0x1222e8f, // pukey pukka pukus pulao pulas puled puler pules
+	0x0a42e8f,0x1242e8f,0x0052e8f,0x1252e8f,0x085ae8f,0x125ae8f,0x185ae8f,0x0e62e8f, // pulik pulis pulka pulks pulli pulls pully pulmo
+	0x127ae8f,0x12a2e8f,0x120328f,0x044328f,0x127b28f,0x120368f,0x041368f,0x003368f, // pulps pulus pumas pumie pumps punas punce punga
+	0x123368f,0x084b68f,0x005368f,0x125368f,0x185368f,0x186b68f,0x0e9b68f,0x129b68f, // pungs punji punka punks punky punny punto punts
+	0x189b68f,0x0403e8f,0x1203e8f,0x12a3e8f,0x001c68f,0x032468f,0x122468f,0x0d4468f, // punty pupae pupas pupus purda pured pures purin
+	0x124468f,0x125c68f,0x187c68f,0x128c68f,0x189468f,0x189c68f,0x1224a8f,0x045ca8f, // puris purls purpy purrs pursy purty puses pusle
+	0x1894a8f,0x0344e8f,0x0d74e8f,0x089ce8f,0x0e9ce8f,0x129ce8f,0x0b2668f,0x03236cf, // pussy putid puton putti putto putts puzel pwned
+	0x129830f,0x129930f,0x0b01b0f,0x126a30f,0x0d72f0f,0x032370f,0x122370f,0x0343b0f, // pyats pyets pygal pyins pylon pyned pynes pyoid
+	0x129bb0f,0x0b0470f,0x0d0470f,0x122470f,0x172470f,0x024470f,0x127470f,0x0325f0f, // pyots pyral pyran pyres pyrex pyric pyros pyxed
+	0x1225f0f,0x0445f0f,0x1245f0f,0x19c832f,0x1240c10,0x121a010,0x1002410,0x1303410, // pyxes pyxie pyxis pzazz qadis qaids qajaq qanat
+	0x0a43c10,0x0058510,0x123bdd0,0x00645d0,0x1218290,0x0528290,0x1230290,0x1140290, // qapik qibla qophs qorma quads quaff quags quair
+	0x1240290,0x1850290,0x0458290,0x1368290,0x0488290,0x1290290,0x0498290,0x1298290, // quais quaky quale quant quare quass quate quats
+	0x03c0290,0x12c0290,0x1340690,0x0d01290,0x0461290,0x0069290,0x0d89290,0x0dc1290, // quayd quays qubit quean queme quena quern queyn
+	0x12c1290,0x0712290,0x121a290,0x052a290,0x1262290,0x006a290,0x046a290,0x0e6a290, // queys quich quids quiff quims quina quine quino
+	0x126a290,0x136a290,0x0e7a290,0x127a290,0x147a290,0x048a290,0x138a290,0x1392290, // quins quint quipo quips quipu quire quirt quist
+	0x129a290,0x0303a90,0x121ba90,0x0543a90,0x0d43a90,0x1343a90,0x0b5ba90,0x0a6ba90, // quits quoad quods quoif quoin quoit quoll quonk
+	0x127ba90,0x0794690,0x049e290,0x1300411,0x0240411,0x1240411,0x0320811,0x1220811, // quops qursh quyte rabat rabic rabis raced races
+	0x0438811,0x1250811,0x0d70811,0x0430c11,0x1740c11,0x0d70c11,0x1229411,0x1299411, // rache racks racon radge radix radon raffs rafts
+	0x1201811,0x0419811,0x0321811,0x0421811,0x1121811,0x1221811,0x0031811,0x1231811, // ragas ragde raged ragee rager rages ragga raggs
+	0x1831811,0x1241811,0x12a1811,0x0321c11,0x08a1c11,0x1202011,0x121a011,0x1252011, // raggy ragis ragus rahed rahui raias raids raiks
+	0x045a011,0x125a011,0x046a011,0x126a011,0x038a011,0x009a011,0x129a011,0x1202411, // raile rails raine rains raird raita raits rajas
+	0x1222411,0x0322811,0x0422811,0x1122811,0x1222811,0x0042811,0x1242811,0x12a2811, // rajes raked rakee raker rakes rakia rakis rakus
+	0x1222c11,0x0b03011,0x0423011,0x1323011,0x0443011,0x0d43011,0x1243011,0x1863011, // rales ramal ramee ramet ramie ramin ramis rammy
+	0x127b011,0x12a3011,0x1203411,0x0413411,0x121b411,0x0423411,0x0033411,0x0833411, // ramps ramus ranas rance rands ranee ranga rangi
+	0x1233411,0x1833411,0x0343411,0x1243411,0x0453411,0x1253411,0x129b411,0x0323c11, // rangs rangy ranid ranis ranke ranks rants raped
+	0x1123c11,0x1223c11,0x043bc11,0x047bc11,0x0324411,0x0424411,0x1224411,0x1254411, // raper rapes raphe rappe rared raree rares rarks
+	0x0324811,0x1124811,0x1224811,0x127c811,0x0494811,0x009c811,0x0b04c11,0x0d04c11, // rased raser rases rasps rasse rasta ratal ratan
+	0x1204c11,0x0714c11,0x0324c11,0x0b24c11,0x1124c11,0x1224c11,0x003cc11,0x043cc11, // ratas ratch rated ratel rater rates ratha rathe
+	0x123cc11,0x0e74c11,0x1274c11,0x12a4c11,0x126d011,0x0e7d011,0x0325411,0x0b25411, // raths ratoo ratos ratus rauns raupo raved ravel
+	0x1125411,0x1225411,0x1825411,0x0d45411,0x1125811,0x0d45811,0x185d811,0x126d811, // raver raves ravey ravin rawer rawin rawly rawns
+	0x0325c11,0x1225c11,0x0706011,0x1206011,0x0326011,0x045e011,0x046e011,0x0326411, // raxed raxes rayah rayas rayed rayle rayne razed
+	0x0426411,0x1126411,0x1226411,0x0e76411,0x0318091,0x1218091,0x1240091,0x1250091, // razee razer razes razoo readd reads reais reaks
+	0x0e58091,0x1258091,0x0460091,0x1260091,0x1860091,0x1268091,0x1278091,0x1288091, // realo reals reame reams reamy reans reaps rears
+	0x1390091,0x0098091,0x0498091,0x04a8091,0x0408491,0x0220491,0x0340491,0x1340491, // reast reata reate reave rebbe rebec rebid rebit
+	0x0f70491,0x18a0491,0x0b00891,0x0410891,0x0e10891,0x1810891,0x1340891,0x1250891, // rebop rebuy recal recce recco reccy recit recks
+	0x0d70891,0x0098891,0x0898891,0x0e98891,0x0d00c91,0x1218c91,0x1818c91,0x0320c91, // recon recta recti recto redan redds reddy reded
+	0x1220c91,0x0040c91,0x0340c91,0x0f40c91,0x1858c91,0x0d70c91,0x1270c91,0x1770c91, // redes redia redid redip redly redon redos redox
+	0x1888c91,0x01a0c91,0x17a0c91,0x04c0c91,0x0711091,0x0419091,0x1219091,0x1229091, // redry redub redux redye reech reede reeds reefs
+	0x1829091,0x1251091,0x1851091,0x1259091,0x1269091,0x1391091,0x04a9091,0x0321491, // reefy reeks reeky reels reens reest reeve refed
+	0x0b21491,0x0e29491,0x1241491,0x1741491,0x1859491,0x1889491,0x1101891,0x1221891, // refel reffo refis refix refly refry regar reges
+	0x0e31891,0x0441891,0x0061891,0x0069891,0x1271891,0x11a1891,0x0c21c91,0x122a091, // reggo regie regma regna regos regur rehem reifs
+	0x182a091,0x0852091,0x1252091,0x0a6a091,0x126a091,0x038a091,0x1392091,0x04aa091, // reify reiki reiks reink reins reird reist reive
+	0x0642491,0x0d72491,0x0322891,0x1222891,0x1822891,0x1322c91,0x0442c91,0x1342c91, // rejig rejon reked rekes rekey relet relie relit
+	0x0e5ac91,0x0d03091,0x0f03091,0x0d23091,0x1323091,0x1723091,0x1743091,0x1803491, // rello reman remap remen remet remex remix renay
+	0x121b491,0x1823491,0x0033491,0x0643491,0x0d43491,0x046b491,0x1273491,0x049b491, // rends reney renga renig renin renne renos rente
+	0x129b491,0x0b43891,0x068b891,0x0623c91,0x0d43c91,0x005bc91,0x1273c91,0x1373c91, // rents reoil reorg repeg repin repla repos repot
+	0x127bc91,0x0e8bc91,0x0d04491,0x0644491,0x1304891,0x1604891,0x1804891,0x0424891, // repps repro reran rerig resat resaw resay resee
+	0x1224891,0x1624891,0x0344891,0x1344891,0x0374891,0x1674891,0x0e9c891,0x129c891, // reses resew resid resit resod resow resto rests
+	0x189c891,0x12a4891,0x0604c91,0x1704c91,0x0c24c91,0x0044c91,0x0444c91,0x1774c91, // resty resus retag retax retem retia retie retox
+	0x1325491,0x0445491,0x0d05891,0x1705891,0x0325891,0x1325891,0x0d45891,0x0d75891, // revet revie rewan rewax rewed rewet rewin rewon
+	0x079d891,0x1225c91,0x1226491,0x12010f1,0x04610f1,0x0ca10f1,0x12220f1,0x04620f1, // rewth rexes rezes rheas rheme rheum rhies rhime
+	0x046a0f1,0x181b8f1,0x01638f1,0x046b8f1,0x01650f1,0x046e0f1,0x009e0f1,0x1218111, // rhine rhody rhomb rhone rhumb rhyne rhyta riads
+	0x1258111,0x1368111,0x0098111,0x1200511,0x1808511,0x1220511,0x0320911,0x1120911, // rials riant riata ribas ribby ribes riced ricer
+	0x1220911,0x1820911,0x1338911,0x0d40911,0x1250911,0x1220d11,0x1830d11,0x0240d11, // rices ricey richt ricin ricks rides ridgy ridic
+	0x1259111,0x1261111,0x04a9111,0x1121511,0x1229511,0x0499511,0x1299511,0x1899511, // riels riems rieve rifer riffs rifte rifts rifty
+	0x1231911,0x0b71911,0x0322d11,0x1222d11,0x1822d11,0x045ad11,0x125ad11,0x0403111, // riggs rigol riled riles riley rille rills rimae
+	0x0323111,0x1123111,0x1223111,0x12a3111,0x121b511,0x181b511,0x1223511,0x1233511, // rimed rimer rimes rimus rinds rindy rines rings
+	0x1253511,0x004b911,0x129b911,0x0323d11,0x1223d11,0x127bd11,0x1224911,0x083c911, // rinks rioja riots riped ripes ripps rises rishi
+	0x1254911,0x127c911,0x12a4911,0x1224d11,0x129cd11,0x18ccd11,0x1205511,0x0325511, // risks risps risus rites ritts ritzy rivas rived
+	0x0b25511,0x0d25511,0x1225511,0x0b06111,0x1206511,0x12181d1,0x12601d1,0x12681d1, // rivel riven rives riyal rizas roads roams roans
+	0x12881d1,0x18881d1,0x04981d1,0x03205d1,0x12205d1,0x04585d1,0x12509d1,0x0320dd1, // roars roary roate robed robes roble rocks roded
+	0x1220dd1,0x18a19d1,0x1221dd1,0x121a1d1,0x125a1d1,0x185a1d1,0x126a1d1,0x13921d1, // rodes roguy rohes roids roils roily roins roist
+	0x0a025d1,0x12425d1,0x03229d1,0x11229d1,0x12229d1,0x0602dd1,0x1222dd1,0x122add1, // rojak rojis roked roker rokes rolag roles rolfs
+	0x125add1,0x0b031d1,0x0d031d1,0x0e231d1,0x127b1d1,0x041b5d1,0x0e1b5d1,0x0e235d1, // rolls romal roman romeo romps ronde rondo roneo
+	0x12235d1,0x0d435d1,0x046b5d1,0x049b5d1,0x129b5d1,0x121b9d1,0x122b9d1,0x182b9d1, // rones ronin ronne ronte ronts roods roofs roofy
+	0x12539d1,0x18539d1,0x12639d1,0x126b9d1,0x127b9d1,0x187b9d1,0x00939d1,0x04939d1, // rooks rooky rooms roons roops roopy roosa roose
+	0x129b9d1,0x189b9d1,0x0323dd1,0x1123dd1,0x1223dd1,0x1823dd1,0x04a41d1,0x0b045d1, // roots rooty roped roper ropes ropey roque roral
+	0x12245d1,0x02445d1,0x03445d1,0x04445d1,0x129c5d1,0x189c5d1,0x03249d1,0x12249d1, // rores roric rorid rorie rorts rorty rosed roses
+	0x13249d1,0x083c9d1,0x0d449d1,0x13449d1,0x089c9d1,0x129c9d1,0x0b04dd1,0x0d04dd1, // roset roshi rosin rosit rosti rosts rotal rotan
+	0x1204dd1,0x0714dd1,0x0324dd1,0x1224dd1,0x1244dd1,0x125cdd1,0x0d74dd1,0x1274dd1, // rotas rotch roted rotes rotis rotls roton rotos
+	0x049cdd1,0x0d251d1,0x12251d1,0x045d1d1,0x125d1d1,0x12651d1,0x127d1d1,0x187d1d1, // rotte rouen roues roule rouls roums roups roupy
+	0x13951d1,0x079d1d1,0x129d1d1,0x03255d1,0x0d255d1,0x12255d1,0x0d059d1,0x03259d1, // roust routh routs roved roven roves rowan rowed
+	0x0b259d1,0x0d259d1,0x04459d1,0x04659d1,0x036d9d1,0x079d9d1,0x129d9d1,0x046e1d1, // rowel rowen rowie rowme rownd rowth rowts royne
+	0x13961d1,0x13265d1,0x13465d1,0x0068291,0x0800691,0x1808691,0x0b20691,0x1220691, // royst rozet rozit ruana rubai rubby rubel rubes
+	0x0d40691,0x0458691,0x0858691,0x12a0691,0x0438a91,0x1250a91,0x1200e91,0x1218e91, // rubin ruble rubli rubus ruche rucks rudas rudds
+	0x1220e91,0x0440e91,0x1240e91,0x0019291,0x1289291,0x0429691,0x1229691,0x0401a91, // rudes rudie rudis rueda ruers ruffe ruffs rugae
+	0x0b01a91,0x1831a91,0x066a291,0x126a291,0x123aa91,0x0322e91,0x1222e91,0x0b03291, // rugal ruggy ruing ruins rukhs ruled rules rumal
+	0x0e0b291,0x0d23291,0x1223291,0x185b291,0x1863291,0x0e7b291,0x127b291,0x187b291, // rumbo rumen rumes rumly rummy rumpo rumps rumpy
+	0x0713691,0x121b691,0x0323691,0x1223691,0x1233691,0x0243691,0x186b691,0x129b691, // runch runds runed runes rungs runic runny runts
+	0x189b691,0x0043e91,0x127c691,0x12a4691,0x1204a91,0x1224a91,0x183ca91,0x1254a91, // runty rupia rurps rurus rusas ruses rushy rusks
+	0x0064a91,0x0494a91,0x129ca91,0x123ce91,0x0d44e91,0x189ce91,0x1258311,0x1300711, // rusma russe rusts ruths rutin rutty ryals rybat
+	0x0322b11,0x1222b11,0x0463311,0x121b711,0x129bb11,0x1123f11,0x1230012,0x0b00412, // ryked rykes rymme rynds ryots ryper saags sabal
+	0x0320412,0x1120412,0x1220412,0x0038412,0x0d40412,0x1140412,0x0458412,0x1370412, // sabed saber sabes sabha sabin sabir sable sabot
+	0x0088412,0x0488412,0x1250812,0x0088812,0x0e18c12,0x1220c12,0x0438c12,0x1438c12, // sabra sabre sacks sacra saddo sades sadhe sadhu
+	0x1240c12,0x1270c12,0x00c8c12,0x0321412,0x1221412,0x1201812,0x1121812,0x1221812, // sadis sados sadza safed safes sagas sager sages
+	0x1831812,0x1271812,0x0ca1812,0x0121c12,0x0141c12,0x0412012,0x0a12012,0x1212012, // saggy sagos sagum saheb sahib saice saick saics
+	0x121a012,0x0032012,0x125a012,0x1262012,0x046a012,0x126a012,0x128a012,0x1392012, // saids saiga sails saims saine sains sairs saist
+	0x079a012,0x1472412,0x0802812,0x1122812,0x1222812,0x0042812,0x1242812,0x089a812, // saith sajou sakai saker sakes sakia sakis sakti
+	0x0b02c12,0x1302c12,0x0f22c12,0x1222c12,0x1322c12,0x0242c12,0x1742c12,0x045ac12, // salal salat salep sales salet salic salix salle
+	0x0862c12,0x0b72c12,0x0f72c12,0x007ac12,0x127ac12,0x0492c12,0x0e9ac12,0x129ac12, // salmi salol salop salpa salps salse salto salts
+	0x04a2c12,0x13a2c12,0x0d03012,0x1203012,0x000b012,0x0e0b012,0x0a23012,0x0b23012, // salue salut saman samas samba sambo samek samel
+	0x0d23012,0x1223012,0x1823012,0x142b012,0x1863012,0x087b012,0x127b012,0x121b412, // samen sames samey samfu sammy sampi samps sands
+	0x0323412,0x1223412,0x0033412,0x0733412,0x0e33412,0x1233412,0x0e53412,0x0093412, // saned sanes sanga sangh sango sangs sanko sansa
+	0x0e9b412,0x129b412,0x005b812,0x0d03c12,0x0343c12,0x1173c12,0x0d04412,0x121c412, // santo sants saola sapan sapid sapor saran sards
+	0x0324412,0x0424412,0x0434412,0x0e34412,0x0d44412,0x1244412,0x1254412,0x1854412, // sared saree sarge sargo sarin saris sarks sarky
+	0x0374412,0x1274412,0x12a4412,0x1124812,0x0d44812,0x0494812,0x0804c12,0x1804c12, // sarod saros sarus saser sasin sasse satai satay
+	0x0324c12,0x0c24c12,0x1224c12,0x1244c12,0x000d012,0x0715012,0x0735012,0x125d012, // sated satem sates satis sauba sauch saugh sauls
+	0x135d012,0x136d012,0x188d012,0x129d012,0x0325412,0x1125412,0x1225412,0x1825412, // sault saunt saury sauts saved saver saves savey
+	0x0d45412,0x0705812,0x0325812,0x1125812,0x1225c12,0x0326012,0x1126012,0x0346012, // savin sawah sawed sawer saxes sayed sayer sayid
+	0x046e012,0x0d76012,0x1396012,0x1226412,0x1208052,0x1218052,0x0528052,0x1230052, // sayne sayon sayst sazes scabs scads scaff scags
+	0x0b40052,0x0058052,0x0b58052,0x1260052,0x0368052,0x1268052,0x0078052,0x0478052, // scail scala scall scams scand scans scapa scape
+	0x0878052,0x0f88052,0x1288052,0x1388052,0x0798052,0x1298052,0x1398052,0x03a0052, // scapi scarp scars scart scath scats scatt scaud
+	0x0fa0052,0x11a0052,0x12b0052,0x1301052,0x0069052,0x0369052,0x1501c52,0x0e61c52, // scaup scaur scaws sceat scena scend schav schmo
+	0x0ba1c52,0x00b1c52,0x0c42c52,0x181b852,0x1233852,0x0673852,0x1373852,0x007b852, // schul schwa sclim scody scogs scoog scoot scopa
+	0x127b852,0x129b852,0x06a3852,0x0fa3852,0x0fb3852,0x12b3852,0x0104452,0x0404452, // scops scots scoug scoup scowp scows scrab scrae
+	0x0604452,0x0d04452,0x1304452,0x1604452,0x1804452,0x0c44452,0x0f44452,0x0174452, // scrag scran scrat scraw scray scrim scrip scrob
+	0x0374452,0x0674452,0x1674452,0x081d052,0x0e1d052,0x121d052,0x052d052,0x132d052, // scrod scrog scrow scudi scudo scuds scuff scuft
+	0x1235052,0x0a5d052,0x0b5d052,0x0f5d052,0x125d052,0x1265052,0x127d052,0x058d052, // scugs sculk scull sculp sculs scums scups scurf
+	0x128d052,0x0495052,0x009d052,0x049d052,0x129d052,0x19cd052,0x1226052,0x0dc0072, // scurs scuse scuta scute scuts scuzz scyes sdayn
+	0x0d41072,0x1258092,0x0460092,0x1260092,0x1860092,0x1268092,0x0488092,0x1288092, // sdein seals seame seams seamy seans seare sears
+	0x0490092,0x1298092,0x04c8092,0x0ca0492,0x0e10892,0x1238892,0x1298892,0x1120c92, // sease seats seaze sebum secco sechs sects seder
+	0x1220c92,0x0430c92,0x1830c92,0x0ca0c92,0x1219092,0x1251092,0x0359092,0x1259092, // sedes sedge sedgy sedum seeds seeks seeld seels
+	0x1859092,0x1261092,0x1279092,0x1879092,0x1289092,0x1121492,0x1101892,0x0869892, // seely seems seeps seepy seers sefer segar segni
+	0x0e69892,0x0b71892,0x1271892,0x0889c92,0x122a092,0x125a092,0x046a092,0x128a092, // segno segol segos sehri seifs seils seine seirs
+	0x0492092,0x0c92092,0x189a092,0x00ca092,0x1272892,0x129a892,0x0702c92,0x1222c92, // seise seism seity seiza sekos sekts selah seles
+	0x122ac92,0x005ac92,0x045ac92,0x125ac92,0x00aac92,0x0423092,0x1223092,0x0443092, // selfs sella selle sells selva semee semes semie
+	0x1243092,0x1203492,0x121b492,0x1223492,0x0833492,0x006b492,0x1173492,0x0093492, // semis senas sends senes sengi senna senor sensa
+	0x0893492,0x049b492,0x089b492,0x129b492,0x18ab492,0x00cb492,0x0303c92,0x0b03c92, // sensi sente senti sents senvy senza sepad sepal
+	0x0243c92,0x1873c92,0x009bc92,0x129bc92,0x0204492,0x0804492,0x0b04492,0x0324492, // sepic sepoy septa septs serac serai seral sered
+	0x1124492,0x1224492,0x122c492,0x0434492,0x0244492,0x0d44492,0x1254492,0x0d74492, // serer seres serfs serge seric serin serks seron
+	0x1674492,0x008c492,0x048c492,0x128c492,0x188c492,0x0eac492,0x1824892,0x0094892, // serow serra serre serrs serry servo sesey sessa
+	0x0404c92,0x0b04c92,0x0d74c92,0x129cc92,0x0d05892,0x1105892,0x0325892,0x0b25892, // setae setal seton setts sewan sewar sewed sewel
+	0x0d25892,0x0d45892,0x0325c92,0x1125c92,0x1225c92,0x0e9dc92,0x129dc92,0x0d26092, // sewen sewin sexed sexer sexes sexto sexts seyen
+	0x12180f2,0x12300f2,0x12380f2,0x0e500f2,0x13500f2,0x0c580f2,0x18580f2,0x00600f2, // shads shags shahs shako shakt shalm shaly shama
+	0x12600f2,0x03680f2,0x12680f2,0x12780f2,0x0d880f2,0x07900f2,0x0ba00f2,0x0cb00f2, // shams shand shans shaps sharn shash shaul shawm
+	0x0db00f2,0x12b00f2,0x00c00f2,0x12c00f2,0x08388f2,0x05010f2,0x0b010f2,0x12010f2, // shawn shaws shaya shays shchi sheaf sheal sheas
+	0x12190f2,0x0b210f2,0x03690f2,0x13690f2,0x0b710f2,0x03890f2,0x04890f2,0x0e890f2, // sheds sheel shend shent sheol sherd shere shero
+	0x12990f2,0x00a90f2,0x0db10f2,0x12b10f2,0x08020f2,0x0b220f2,0x11220f2,0x12220f2, // shets sheva shewn shews shiai shiel shier shies
+	0x0b5a0f2,0x185a0f2,0x12620f2,0x126a0f2,0x127a0f2,0x118a0f2,0x128a0f2,0x07920f2, // shill shily shims shins ships shirr shirs shish
+	0x0e920f2,0x13920f2,0x049a0f2,0x129a0f2,0x11a20f2,0x00aa0f2,0x04aa0f2,0x12aa0f2, // shiso shist shite shits shiur shiva shive shivs
+	0x0f22cf2,0x01a2cf2,0x0a230f2,0x04730f2,0x13038f2,0x03238f2,0x11238f2,0x12238f2, // shlep shlub shmek shmoe shoat shoed shoer shoes
+	0x08338f2,0x12338f2,0x084b8f2,0x0e4b8f2,0x005b8f2,0x0b738f2,0x0d738f2,0x12738f2, // shogi shogs shoji shojo shola shool shoon shoos
+	0x047b8f2,0x127b8f2,0x0b8b8f2,0x049b8f2,0x129b8f2,0x139b8f2,0x03b38f2,0x12b38f2, // shope shops shorl shote shots shott showd shows
+	0x14c38f2,0x03244f2,0x12444f2,0x16744f2,0x0a44cf2,0x0ca4cf2,0x0fa4cf2,0x045d0f2, // shoyu shred shris shrow shtik shtum shtup shule
+	0x0d5d0f2,0x125d0f2,0x126d0f2,0x008d0f2,0x049d0f2,0x129d0f2,0x12058f2,0x11260f2, // shuln shuls shuns shura shute shuts shwas shyer
+	0x1258112,0x1208512,0x0bc0512,0x1220912,0x1338912,0x0e50912,0x1250912,0x1850912, // sials sibbs sibyl sices sicht sicko sicks sicky
+	0x1200d12,0x0320d12,0x1120d12,0x1220d12,0x0038d12,0x0438d12,0x0458d12,0x0359112, // sidas sided sider sides sidha sidhe sidle sield
+	0x1269112,0x1369112,0x0799112,0x11a1112,0x1299512,0x1239912,0x0b41912,0x0059912, // siens sient sieth sieur sifts sighs sigil sigla
+	0x0069912,0x1269912,0x1272512,0x1202912,0x1122912,0x1222912,0x121ad12,0x0322d12, // signa signs sijos sikas siker sikes silds siled
+	0x0d22d12,0x1122d12,0x1222d12,0x1722d12,0x1252d12,0x125ad12,0x1272d12,0x129ad12, // silen siler siles silex silks sills silos silts
+	0x189ad12,0x00aad12,0x1103112,0x1203112,0x000b112,0x1243112,0x127b112,0x0ba3112, // silty silva simar simas simba simis simps simul
+	0x121b512,0x0323512,0x1223512,0x1233512,0x123b512,0x1253512,0x1853512,0x12a3512, // sinds sined sines sings sinhs sinks sinky sinus
+	0x0323d12,0x1223d12,0x187bd12,0x0324512,0x0424512,0x1224512,0x0744512,0x1244512, // siped sipes sippy sired siree sires sirih siris
+	0x0274512,0x008c512,0x0fa4512,0x0b04912,0x1224912,0x009c912,0x129c912,0x1104d12, // siroc sirra sirup sisal sises sista sists sitar
+	0x0324d12,0x1224d12,0x043cd12,0x0054d12,0x0fa4d12,0x12a4d12,0x1125512,0x1125d12, // sited sites sithe sitka situp situs siver sixer
+	0x1225d12,0x0e65d12,0x049dd12,0x1106512,0x0326512,0x0b26512,0x1126512,0x1226512, // sixes sixmo sixte sizar sized sizel sizer sizes
+	0x1230152,0x0b40152,0x0358152,0x0a68152,0x1388152,0x1298152,0x1398152,0x12b0152, // skags skail skald skank skart skats skatt skaws
+	0x0d01152,0x1101152,0x1219152,0x0321152,0x0521152,0x0d21152,0x1121152,0x1221152, // skean skear skeds skeed skeef skeen skeer skees
+	0x1321152,0x0631152,0x1231152,0x0d41152,0x0559152,0x0b59152,0x0c59152,0x0f59152, // skeet skegg skegs skein skelf skell skelm skelp
+	0x0469152,0x1269152,0x1271152,0x1279152,0x1289152,0x1299152,0x12b1152,0x121a152, // skene skens skeos skeps skers skets skews skids
+	0x0322152,0x1222152,0x1822152,0x0e62152,0x1262152,0x0a6a152,0x126a152,0x136a152, // skied skies skiey skimo skims skink skins skint
+	0x1272152,0x127a152,0x0b8a152,0x118a152,0x049a152,0x129a152,0x04aa152,0x18aa152, // skios skips skirl skirr skite skits skive skivy
+	0x0c42d52,0x0b03952,0x181b952,0x052b952,0x1233952,0x125b952,0x0b73952,0x138b952, // sklim skoal skody skoff skogs skols skool skort
+	0x0793952,0x0d04552,0x0a44552,0x1205152,0x1235152,0x0326152,0x1126152,0x1826152, // skosh skran skrik skuas skugs skyed skyer skyey
+	0x122e152,0x048e152,0x128e152,0x049e152,0x1208172,0x0418172,0x1220172,0x1230172, // skyfs skyre skyrs skyte slabs slade slaes slags
+	0x0340172,0x0450172,0x1260172,0x0468172,0x0a68172,0x1278172,0x1388172,0x1298172, // slaid slake slams slane slank slaps slart slats
+	0x1898172,0x12b0172,0x12c0172,0x1209172,0x1219172,0x1121172,0x12b1172,0x12c1172, // slaty slaws slays slebs sleds sleer slews sleys
+	0x1122172,0x185a172,0x1262172,0x047a172,0x127a172,0x137a172,0x0792172,0x129a172, // slier slily slims slipe slips slipt slish slits
+	0x04aa172,0x0d03972,0x120b972,0x1223972,0x1233972,0x0343972,0x034b972,0x0e63972, // slive sloan slobs sloes slogs sloid slojd slomo
+	0x0c73972,0x1373972,0x127b972,0x187b972,0x0c8b972,0x129b972,0x04ab972,0x12b3972, // sloom sloot slops slopy slorm slots slove slows
+	0x03c3972,0x010d172,0x120d172,0x0325172,0x1225172,0x052d172,0x1235172,0x1345172, // sloyd slubb slubs slued slues sluff slugs sluit
+	0x1265172,0x018d172,0x128d172,0x0495172,0x129d172,0x1126172,0x047e172,0x0a00192, // slums slurb slurs sluse sluts slyer slype smaak
+	0x0a40192,0x0c58192,0x1358192,0x0c88192,0x04c8192,0x0a21192,0x1221192,0x0a41192, // smaik smalm smalt smarm smaze smeek smees smeik
+	0x0451192,0x0a89192,0x12b1192,0x118a192,0x128a192,0x129a192,0x1233992,0x0e53992, // smeke smerk smews smirr smirs smits smogs smoko
+	0x135b992,0x1173992,0x1373992,0x048b992,0x068b992,0x13a3992,0x13b3992,0x1235192, // smolt smoor smoot smore smorg smout smowt smugs
+	0x128d192,0x0795192,0x129d192,0x12081b2,0x14281b2,0x12301b2,0x12781b2,0x05881b2, // smurs smush smuts snabs snafu snags snaps snarf
+	0x0a881b2,0x12881b2,0x18881b2,0x07901b2,0x07981b2,0x12b01b2,0x03011b2,0x0f011b2, // snark snars snary snash snath snaws snead sneap
+	0x12091b2,0x0a111b2,0x12191b2,0x03211b2,0x12211b2,0x0b591b2,0x120a1b2,0x0a121b2, // snebs sneck sneds sneed snees snell snibs snick
+	0x12221b2,0x132a1b2,0x12321b2,0x127a1b2,0x187a1b2,0x138a1b2,0x129a1b2,0x120b9b2, // snies snift snigs snips snipy snirt snits snobs
+	0x121b9b2,0x0a239b2,0x0f239b2,0x12339b2,0x04539b2,0x03739b2,0x0a739b2,0x0b739b2, // snods snoek snoep snogs snoke snood snook snool
+	0x13739b2,0x129b9b2,0x0ab39b2,0x12b39b2,0x120d1b2,0x12351b2,0x07951b2,0x12261b2, // snoot snots snowk snows snubs snugs snush snyes
+	0x12501d2,0x12781d2,0x04881d2,0x12881d2,0x04a81d2,0x12005d2,0x12009d2,0x12209d2, // soaks soaps soare soars soave sobas socas soces
+	0x0e509d2,0x12509d2,0x04589d2,0x1200dd2,0x1818dd2,0x0240dd2,0x0c70dd2,0x11015d2, // socko socks socle sodas soddy sodic sodom sofar
+	0x12015d2,0x00995d2,0x12995d2,0x18995d2,0x11219d2,0x11a1dd2,0x125a1d2,0x185a1d2, // sofas softa softs softy soger sohur soils soily
+	0x12025d2,0x12a25d2,0x07029d2,0x0d229d2,0x12229d2,0x0b729d2,0x0702dd2,0x0d02dd2, // sojas sojus sokah soken sokes sokol solah solan
+	0x1202dd2,0x041add2,0x081add2,0x0e1add2,0x121add2,0x0322dd2,0x0822dd2,0x1122dd2, // solas solde soldi soldo solds soled solei soler
+	0x1222dd2,0x0d72dd2,0x1272dd2,0x0ca2dd2,0x12a2dd2,0x0d031d2,0x12031d2,0x04135d2, // soles solon solos solum solus soman somas sonce
+	0x041b5d2,0x12235d2,0x12335d2,0x185b5d2,0x046b5d2,0x186b5d2,0x04935d2,0x18935d2, // sonde sones songs sonly sonne sonny sonse sonsy
+	0x18239d2,0x12539d2,0x18539d2,0x045b9d2,0x125b9d2,0x12639d2,0x127b9d2,0x049b9d2, // sooey sooks sooky soole sools sooms soops soote
+	0x129b9d2,0x123bdd2,0x183bdd2,0x1173dd2,0x187bdd2,0x008bdd2,0x0b045d2,0x12045d2, // soots sophs sophy sopor soppy sopra soral soras
+	0x0e0c5d2,0x120c5d2,0x001c5d2,0x0e1c5d2,0x121c5d2,0x03245d2,0x04245d2,0x0b245d2, // sorbo sorbs sorda sordo sords sored soree sorel
+	0x11245d2,0x12245d2,0x17245d2,0x0e345d2,0x126c5d2,0x008c5d2,0x009c5d2,0x129c5d2, // sorer sores sorex sorgo sorns sorra sorta sorts
+	0x12a45d2,0x123cdd2,0x0b74dd2,0x04151d2,0x13151d2,0x07351d2,0x12551d2,0x125d1d2, // sorus soths sotol souce souct sough souks souls
+	0x12651d2,0x127d1d2,0x187d1d2,0x128d1d2,0x04951d2,0x129d1d2,0x11059d2,0x04159d2, // soums soups soupy sours souse souts sowar sowce
+	0x03259d2,0x052d9d2,0x122d9d2,0x045d9d2,0x125d9d2,0x12659d2,0x036d9d2,0x046d9d2, // sowed sowff sowfs sowle sowls sowms sownd sowne
+	0x127d9d2,0x04959d2,0x079d9d2,0x12061d2,0x045e1d2,0x19a61d2,0x0d465d2,0x18101f2, // sowps sowse sowth soyas soyle soyuz sozin spacy
+	0x0e181f2,0x03201f2,0x11201f2,0x12201f2,0x12301f2,0x08381f2,0x0b401f2,0x0d401f2, // spado spaed spaer spaes spags spahi spail spain
+	0x13401f2,0x04501f2,0x03581f2,0x04581f2,0x0b581f2,0x13581f2,0x12601f2,0x04681f2, // spait spake spald spale spall spalt spams spane
+	0x06681f2,0x12681f2,0x03881f2,0x12881f2,0x13881f2,0x04981f2,0x12981f2,0x0ba01f2, // spang spans spard spars spart spate spats spaul
+	0x0bb01f2,0x12b01f2,0x03c01f2,0x12c01f2,0x00c81f2,0x19c81f2,0x0b011f2,0x0d011f2, // spawl spaws spayd spays spaza spazz speal spean
+	0x13011f2,0x12111f2,0x13111f2,0x0b211f2,0x11211f2,0x0b411f2,0x11411f2,0x12511f2, // speat specs spect speel speer speil speir speks
+	0x03591f2,0x0a591f2,0x12711f2,0x12991f2,0x06a11f2,0x12b11f2,0x18b11f2,0x0b021f2, // speld spelk speos spets speug spews spewy spial
+	0x00121f2,0x0a121f2,0x12121f2,0x041a1f2,0x11221f2,0x12221f2,0x052a1f2,0x122a1f2, // spica spick spics spide spier spies spiff spifs
+	0x12521f2,0x045a1f2,0x12621f2,0x006a1f2,0x0a6a1f2,0x126a1f2,0x138a1f2,0x188a1f2, // spiks spile spims spina spink spins spirt spiry
+	0x129a1f2,0x199a1f2,0x12aa1f2,0x1802df2,0x0672df2,0x041b9f2,0x121b9f2,0x0c739f2, // spits spitz spivs splay splog spode spods spoom
+	0x11739f2,0x13739f2,0x0a8b9f2,0x07939f2,0x129b9f2,0x03045f2,0x06045f2,0x13045f2, // spoor spoot spork sposh spots sprad sprag sprat
+	0x03245f2,0x16245f2,0x13445f2,0x03745f2,0x06745f2,0x04a45f2,0x06a45f2,0x121d1f2, // spred sprew sprit sprod sprog sprue sprug spuds
+	0x03251f2,0x11251f2,0x12251f2,0x12351f2,0x045d1f2,0x04651f2,0x18651f2,0x128d1f2, // spued spuer spues spugs spule spume spumy spurs
+	0x009d1f2,0x0b061f2,0x048e1f2,0x0105212,0x1605212,0x0625212,0x0345212,0x1345212, // sputa spyal spyre squab squaw squeg squid squit
+	0x1945212,0x1208272,0x0418272,0x1230272,0x1830272,0x0640272,0x0468272,0x0668272, // squiz stabs stade stags stagy staig stane stang
+	0x0778272,0x1278272,0x0d88272,0x1188272,0x1288272,0x1298272,0x0da0272,0x12b0272, // staph staps starn starr stars stats staun staws
+	0x12c0272,0x0d01272,0x1101272,0x0319272,0x0419272,0x1219272,0x0a21272,0x0c21272, // stays stean stear stedd stede steds steek steem
+	0x0d21272,0x0b41272,0x0059272,0x0459272,0x0b59272,0x0461272,0x1261272,0x0369272, // steen steil stela stele stell steme stems stend
+	0x0e69272,0x1269272,0x1369272,0x1279272,0x1379272,0x0489272,0x1299272,0x12b1272, // steno stens stent steps stept stere stets stews
+	0x18b1272,0x12c1272,0x0712272,0x0322272,0x1222272,0x015a272,0x045a272,0x0462272, // stewy steys stich stied sties stilb stile stime
+	0x1262272,0x1862272,0x007a272,0x047a272,0x048a272,0x0a8a272,0x0f8a272,0x128a272, // stims stimy stipa stipe stire stirk stirp stirs
+	0x04aa272,0x18aa272,0x0403a72,0x0803a72,0x1203a72,0x1303a72,0x120ba72,0x0f23a72, // stive stivy stoae stoai stoas stoat stobs stoep
+	0x1833a72,0x1343a72,0x0d5ba72,0x0063a72,0x036ba72,0x066ba72,0x0a6ba72,0x0d6ba72, // stogy stoit stoln stoma stond stong stonk stonn
+	0x0a73a72,0x1173a72,0x047ba72,0x127ba72,0x137ba72,0x1293a72,0x129ba72,0x139ba72, // stook stoor stope stops stopt stoss stots stott
+	0x0da3a72,0x0fa3a72,0x11a3a72,0x0db3a72,0x0fb3a72,0x12b3a72,0x0304672,0x0404672, // stoun stoup stour stown stowp stows strad strae
+	0x0604672,0x0a04672,0x0f24672,0x1624672,0x0044672,0x0644672,0x0c44672,0x0f74672, // strag strak strep strew stria strig strim strop
+	0x1674672,0x1874672,0x0ca4672,0x120d272,0x041d272,0x121d272,0x0b5d272,0x0c5d272, // strow stroy strum stubs stude studs stull stulm
+	0x0c65272,0x1265272,0x126d272,0x007d272,0x047d272,0x048d272,0x138d272,0x0326272, // stumm stums stuns stupa stupe sture sturt styed
+	0x1226272,0x085e272,0x0e5e272,0x0466272,0x1866272,0x048e272,0x049e272,0x0700692, // styes styli stylo styme stymy styre styte subah
+	0x1200692,0x1808692,0x1120692,0x0038692,0x0810a92,0x1250a92,0x1850a92,0x0488a92, // subas subby suber subha succi sucks sucky sucre
+	0x1218e92,0x1170e92,0x1890e92,0x0419292,0x1369292,0x1289292,0x0499292,0x1299292, // sudds sudor sudsy suede suent suers suete suets
+	0x1899292,0x0d01a92,0x1239a92,0x1271a92,0x11a1e92,0x121a292,0x136a292,0x129a292, // suety sugan sughs sugos suhur suids suint suits
+	0x0422692,0x123aa92,0x0aa2a92,0x0812e92,0x002ae92,0x0e2ae92,0x1252e92,0x077ae92, // sujee sukhs sukuk sulci sulfa sulfo sulks sulph
+	0x12a2e92,0x1243292,0x0063292,0x1273292,0x077b292,0x127b292,0x1243692,0x1253692, // sulus sumis summa sumos sumph sumps sunis sunks
+	0x006b692,0x126b692,0x0fa3692,0x1223e92,0x008be92,0x0704692,0x0b04692,0x1204692, // sunna sunns sunup supes supra surah sural suras
+	0x1304692,0x121c692,0x0324692,0x1224692,0x122c692,0x182c692,0x1834692,0x008c692, // surat surds sured sures surfs surfy surgy surra
+	0x0324a92,0x1224a92,0x12a4a92,0x1174e92,0x008ce92,0x009ce92,0x12082d2,0x0a102d2, // sused suses susus sutor sutra sutta swabs swack
+	0x12182d2,0x04302d2,0x12302d2,0x0b402d2,0x0d402d2,0x04582d2,0x18582d2,0x18602d2, // swads swage swags swail swain swale swaly swamy
+	0x06682d2,0x0a682d2,0x12682d2,0x12782d2,0x13782d2,0x03882d2,0x04882d2,0x05882d2, // swang swank swans swaps swapt sward sware swarf
+	0x13882d2,0x12982d2,0x0bc02d2,0x12c02d2,0x0b012d2,0x04192d2,0x03212d2,0x0b212d2, // swart swats swayl sways sweal swede sweed sweel
+	0x11212d2,0x12212d2,0x11412d2,0x13592d2,0x05892d2,0x12c12d2,0x12222d2,0x12322d2, // sweer swees sweir swelt swerf sweys swies swigs
+	0x045a2d2,0x12622d2,0x0a6a2d2,0x047a2d2,0x048a2d2,0x12922d2,0x079a2d2,0x129a2d2, // swile swims swink swipe swire swiss swith swits
+	0x04aa2d2,0x19ca2d2,0x120bad2,0x045bad2,0x0d5bad2,0x127bad2,0x137bad2,0x129bad2, // swive swizz swobs swole swoln swops swopt swots
+	0x0da3ad2,0x0408712,0x0b40712,0x0470712,0x1670712,0x0420b12,0x1220b12,0x0d70b12, // swoun sybbe sybil syboe sybow sycee syces sycon
+	0x1269312,0x1122b12,0x1222b12,0x1242f12,0x077af12,0x00aaf12,0x1103312,0x0713712, // syens syker sykes sylis sylph sylva symar synch
+	0x1213712,0x121b712,0x0323712,0x1223712,0x079b712,0x0323f12,0x1223f12,0x123bf12, // syncs synds syned synes synth syped sypes syphs
+	0x0704712,0x0d24712,0x0f74b12,0x043cf12,0x1125712,0x1258013,0x0098013,0x1120413, // syrah syren sysop sythe syver taals taata taber
+	0x1220413,0x0340413,0x1240413,0x0058413,0x1170413,0x0da0413,0x12a0413,0x0d00813, // tabes tabid tabis tabla tabor tabun tabus tacan
+	0x1220813,0x1320813,0x0438813,0x0e38813,0x1238813,0x1250813,0x1270813,0x1298813, // taces tacet tache tacho tachs tacks tacos tacts
+	0x1259013,0x0041413,0x1831813,0x0061813,0x1201c13,0x1289c13,0x0032013,0x1232013, // taels tafia taggy tagma tahas tahrs taiga taigs
+	0x0e52013,0x125a013,0x126a013,0x008a013,0x0792013,0x129a013,0x1222413,0x1202813, // taiko tails tains taira taish taits tajes takas
+	0x1222813,0x083a813,0x0d42813,0x1242813,0x1852813,0x0a02c13,0x1002c13,0x1102c13, // takes takhi takin takis takky talak talaq talar
+	0x1202c13,0x1212c13,0x1812c13,0x0022c13,0x1122c13,0x1222c13,0x1252c13,0x1852c13, // talas talcs talcy talea taler tales talks talky
+	0x125ac13,0x0062c13,0x007ac13,0x0aa2c13,0x12a2c13,0x0b03013,0x0323013,0x1223013, // talls talma talpa taluk talus tamal tamed tames
+	0x0d43013,0x1243013,0x1863013,0x127b013,0x1203413,0x0033413,0x0833413,0x1233413, // tamin tamis tammy tamps tanas tanga tangi tangs
+	0x123b413,0x0053413,0x1253413,0x1853413,0x006b413,0x1893413,0x089b413,0x0e9b413, // tanhs tanka tanks tanky tanna tansy tanti tanto
+	0x189b413,0x1203c13,0x0323c13,0x0d23c13,0x1223c13,0x1323c13,0x1243c13,0x007bc13, // tanty tapas taped tapen tapes tapet tapis tappa
+	0x12a3c13,0x1204413,0x0e1c413,0x0324413,0x1224413,0x0034413,0x0434413,0x126c413, // tapus taras tardo tared tares targa targe tarns
+	0x0274413,0x0a74413,0x1274413,0x127c413,0x048c413,0x188c413,0x0894413,0x129c413, // taroc tarok taros tarps tarre tarry tarsi tarts
+	0x189c413,0x1104813,0x0324813,0x1124813,0x1224813,0x1254813,0x0094813,0x0494813, // tarty tasar tased taser tases tasks tassa tasse
+	0x0e94813,0x1104c13,0x1124c13,0x1224c13,0x123cc13,0x0444c13,0x1474c13,0x129cc13, // tasso tatar tater tates taths tatie tatou tatts
+	0x12a4c13,0x040d013,0x035d013,0x0d75013,0x047d013,0x129d013,0x0705413,0x1205413, // tatus taube tauld tauon taupe tauts tavah tavas
+	0x1125413,0x0805813,0x1205813,0x0325813,0x1125813,0x0445813,0x0495813,0x129d813, // taver tawai tawas tawed tawer tawie tawse tawts
+	0x0325c13,0x1125c13,0x1225c13,0x1245c13,0x0b75c13,0x0d75c13,0x1175c13,0x12a5c13, // taxed taxer taxes taxis taxol taxon taxor taxus
+	0x008e013,0x00ce413,0x04ce413,0x0418093,0x1218093,0x0320093,0x1250093,0x1258093, // tayra tazza tazze teade teads teaed teaks teals
+	0x1260093,0x1288093,0x1298093,0x04c8093,0x1238893,0x1838893,0x0098893,0x1259093, // teams tears teats teaze techs techy tecta teels
+	0x1261093,0x0369093,0x0469093,0x1269093,0x1869093,0x1289093,0x1229493,0x1231893, // teems teend teene teens teeny teers teffs teggs
+	0x00a1893,0x12a1893,0x1289c93,0x0342093,0x125a093,0x036a093,0x126a093,0x0402c93, // tegua tegus tehrs teiid teils teind teins telae
+	0x0e12c93,0x1222c93,0x1722c93,0x0042c93,0x0242c93,0x125ac93,0x185ac93,0x0872c93, // telco teles telex telia telic tells telly teloi
+	0x1272c93,0x0323093,0x1223093,0x087b093,0x127b093,0x137b093,0x0493093,0x0713493, // telos temed temes tempi temps tempt temse tench
+	0x121b493,0x141b493,0x1223493,0x0433493,0x0043493,0x046b493,0x0e6b493,0x186b493, // tends tendu tenes tenge tenia tenne tenno tenny
+	0x0d73493,0x129b493,0x189b493,0x04a3493,0x0b03c93,0x1203c93,0x1873c93,0x0804493, // tenon tents tenty tenue tepal tepas tepoy terai
+	0x1204493,0x0414493,0x0a24493,0x1224493,0x042c493,0x122c493,0x0034493,0x1264493, // teras terce terek teres terfe terfs terga terms
+	0x046c493,0x126c493,0x188c493,0x129c493,0x005c893,0x009c893,0x049c893,0x129c893, // terne terns terry terts tesla testa teste tests
+	0x1224c93,0x123cc93,0x008cc93,0x088cc93,0x0715093,0x0735093,0x0325893,0x0b25893, // tetes teths tetra tetri teuch teugh tewed tewel
+	0x1345893,0x1205c93,0x1225c93,0x129dc93,0x0a100f3,0x08300f3,0x0c400f3,0x04580f3, // tewit texas texes texts thack thagi thaim thale
+	0x08580f3,0x00680f3,0x04680f3,0x06680f3,0x12680f3,0x17680f3,0x0c880f3,0x12880f3, // thali thana thane thang thans thanx tharm thars
+	0x12b00f3,0x18b00f3,0x04090f3,0x00110f3,0x03210f3,0x0a210f3,0x12210f3,0x0d310f3, // thaws thawy thebe theca theed theek thees thegn
+	0x02410f3,0x0d410f3,0x05590f3,0x00610f3,0x12690f3,0x16710f3,0x0c890f3,0x0f910f3, // theic thein thelf thema thens theow therm thesp
+	0x04990f3,0x12b10f3,0x18b10f3,0x12320f3,0x0a5a0f3,0x0b5a0f3,0x046a0f3,0x126a0f3, // thete thews thewy thigs thilk thill thine thins
+	0x0b720f3,0x0b8a0f3,0x132b8f3,0x045b8f3,0x085b8f3,0x0e8b8f3,0x0f8b8f3,0x12a38f3, // thiol thirl thoft thole tholi thoro thorp thous
+	0x0bb38f3,0x04044f3,0x16044f3,0x03444f3,0x0f444f3,0x04744f3,0x121d0f3,0x12350f3, // thowl thrae thraw thrid thrip throe thuds thugs
+	0x004d0f3,0x0a6d0f3,0x0b8d0f3,0x00c50f3,0x08660f3,0x18660f3,0x1268113,0x1288113, // thuja thunk thurl thuya thymi thymy tians tiars
+	0x0b00913,0x0010913,0x0320913,0x1220913,0x1838913,0x1250913,0x1850913,0x1818d13, // tical ticca ticed tices tichy ticks ticky tiddy
+	0x0320d13,0x1220d13,0x1289113,0x1229513,0x1271513,0x1299513,0x1221913,0x0d71913, // tided tides tiers tiffs tifos tifts tiges tigon
+	0x1202913,0x1222913,0x1242913,0x0052913,0x0a02d13,0x0322d13,0x1122d13,0x1222d13, // tikas tikes tikis tikka tilak tiled tiler tiles
+	0x125ad13,0x185ad13,0x079ad13,0x129ad13,0x0e0b113,0x0323113,0x1223113,0x0d73113, // tills tilly tilth tilts timbo timed times timon
+	0x127b113,0x1203513,0x1313513,0x121b513,0x0023513,0x0323513,0x1223513,0x0433513, // timps tinas tinct tinds tinea tined tines tinge
+	0x1233513,0x1253513,0x186b513,0x129b513,0x189b513,0x1243d13,0x187bd13,0x0324513, // tings tinks tinny tints tinty tipis tippy tired
+	0x1224513,0x125c513,0x1274513,0x128c513,0x0714d13,0x1124d13,0x1244d13,0x048cd13, // tires tirls tiros tirrs titch titer titis titre
+	0x189cd13,0x0fa4d13,0x0d46113,0x126e113,0x1226513,0x18ce513,0x12181d3,0x18181d3, // titty titup tiyin tiyns tizes tizzy toads toady
+	0x04c81d3,0x12509d3,0x18509d3,0x12709d3,0x0418dd3,0x12011d3,0x12295d3,0x18295d3, // toaze tocks tocky tocos todde toeas toffs toffy
+	0x12995d3,0x12a15d3,0x04019d3,0x12019d3,0x03219d3,0x12219d3,0x04a19d3,0x1271dd3, // tofts tofus togae togas toged toges togue tohos
+	0x045a1d3,0x125a1d3,0x066a1d3,0x04921d3,0x129a1d3,0x18029d3,0x03229d3,0x11229d3, // toile toils toing toise toits tokay toked toker
+	0x12229d3,0x12729d3,0x0d02dd3,0x1102dd3,0x1202dd3,0x0322dd3,0x1222dd3,0x125add3, // tokes tokos tolan tolar tolas toled toles tolls
+	0x185add3,0x129add3,0x12a2dd3,0x0bc2dd3,0x0d031d3,0x120b1d3,0x12231d3,0x00431d3, // tolly tolts tolus tolyl toman tombs tomes tomia
+	0x18631d3,0x12731d3,0x081b5d3,0x0e1b5d3,0x03235d3,0x11235d3,0x12235d3,0x18235d3, // tommy tomos tondi tondo toned toner tones toney
+	0x12335d3,0x00535d3,0x12535d3,0x046b5d3,0x12a35d3,0x125b9d3,0x12639d3,0x126b9d3, // tongs tonka tonks tonne tonus tools tooms toons
+	0x129b9d3,0x0323dd3,0x0423dd3,0x0a23dd3,0x1123dd3,0x1223dd3,0x043bdd3,0x083bdd3, // toots toped topee topek toper topes tophe tophi
+	0x123bdd3,0x1243dd3,0x0873dd3,0x1273dd3,0x187bdd3,0x04a41d3,0x07045d3,0x0d045d3, // tophs topis topoi topos toppy toque torah toran
+	0x12045d3,0x12145d3,0x12245d3,0x02445d3,0x08445d3,0x12745d3,0x13745d3,0x128c5d3, // toras torcs tores toric torii toros torot torrs
+	0x04945d3,0x08945d3,0x0a945d3,0x009c5d3,0x049c5d3,0x129c5d3,0x12049d3,0x03249d3, // torse torsi torsk torta torte torts tosas tosed
+	0x12249d3,0x183c9d3,0x18949d3,0x0324dd3,0x1124dd3,0x1224dd3,0x189cdd3,0x12551d3, // toses toshy tossy toted toter totes totty touks
+	0x126d1d3,0x128d1d3,0x04951d3,0x18951d3,0x129d1d3,0x04cd1d3,0x18cd1d3,0x03259d3, // touns tours touse tousy touts touze touzy towed
+	0x04459d3,0x126d9d3,0x186d9d3,0x04959d3,0x18959d3,0x129d9d3,0x04cd9d3,0x18cd9d3, // towie towns towny towse towsy towts towze towzy
+	0x03261d3,0x11261d3,0x0d761d3,0x12761d3,0x03265d3,0x12265d3,0x04465d3,0x1208233, // toyed toyer toyon toyos tozed tozes tozie trabs
+	0x1218233,0x0830233,0x0a40233,0x1260233,0x0a68233,0x1068233,0x1268233,0x1368233, // trads tragi traik trams trank tranq trans trant
+	0x0478233,0x1278233,0x1378233,0x1290233,0x1298233,0x1398233,0x04a8233,0x05c0233, // trape traps trapt trass trats tratt trave trayf
+	0x12c0233,0x0a11233,0x0321233,0x0d21233,0x1221233,0x0029233,0x0541233,0x1251233, // trays treck treed treen trees trefa treif treks
+	0x0061233,0x1261233,0x1291233,0x1391233,0x1299233,0x12b1233,0x05c1233,0x12c1233, // trema trems tress trest trets trews treyf treys
+	0x0202233,0x041a233,0x1122233,0x1222233,0x052a233,0x0e32233,0x1232233,0x0452233, // triac tride trier tries triff trigo trigs trike
+	0x035a233,0x0b5a233,0x1262233,0x046a233,0x126a233,0x0b72233,0x1172233,0x1272233, // trild trill trims trine trins triol trior trios
+	0x127a233,0x187a233,0x1392233,0x0303a33,0x0a03a33,0x1303a33,0x0a13a33,0x041ba33, // trips tripy trist troad troak troat trock trode
+	0x121ba33,0x1233a33,0x1243a33,0x0453a33,0x0f63a33,0x006ba33,0x026ba33,0x046ba33, // trods trogs trois troke tromp trona tronc trone
+	0x0a6ba33,0x126ba33,0x1973a33,0x079ba33,0x129ba33,0x12b3a33,0x12c3a33,0x0325233, // tronk trons trooz troth trots trows troys trued
+	0x1225233,0x0e35233,0x1235233,0x0b5d233,0x1126233,0x0456233,0x0066233,0x127e233, // trues trugo trugs trull tryer tryke tryma tryps
+	0x0418253,0x0818253,0x1288253,0x0322a53,0x000d253,0x0e0d253,0x1268293,0x1388293, // tsade tsadi tsars tsked tsuba tsubo tuans tuart
+	0x0798293,0x0400693,0x1100693,0x1200693,0x1808693,0x0320693,0x1220693,0x1250a93, // tuath tubae tubar tubas tubby tubed tubes tucks
+	0x1201693,0x0429693,0x1229693,0x1299693,0x1899693,0x0089a93,0x045a293,0x006a293, // tufas tuffe tuffs tufts tufty tugra tuile tuina
+	0x0c92293,0x149aa93,0x1222e93,0x007ae93,0x0892e93,0x0343293,0x1863293,0x127b293, // tuism tuktu tules tulpa tulsi tumid tummy tumps
+	0x187b293,0x1203693,0x121b693,0x0323693,0x1123693,0x1223693,0x1233693,0x186b693, // tumpy tunas tunds tuned tuner tunes tungs tunny
+	0x0a23e93,0x0a43e93,0x045be93,0x04a4293,0x121c693,0x122c693,0x182c693,0x1254693, // tupek tupik tuple tuque turds turfs turfy turks
+	0x0464693,0x1264693,0x126c693,0x136c693,0x127c693,0x128c693,0x183ca93,0x1254a93, // turme turms turns turnt turps turrs tushy tusks
+	0x1854a93,0x0424e93,0x089ce93,0x189ce93,0x12a4e93,0x1225e93,0x1126293,0x12202d3, // tusky tutee tutti tutty tutus tuxes tuyer twaes
+	0x0d402d3,0x12582d3,0x0a682d3,0x12982d3,0x12c02d3,0x0b212d3,0x0d212d3,0x0f212d3, // twain twals twank twats tways tweel tween tweep
+	0x11212d3,0x0a892d3,0x0f892d3,0x11222d3,0x12322d3,0x0b5a2d3,0x135a2d3,0x0a6a2d3, // tweer twerk twerp twier twigs twill twilt twink
+	0x126a2d3,0x186a2d3,0x048a2d3,0x0f8a2d3,0x049a2d3,0x129a2d3,0x1123ad3,0x11262d3, // twins twiny twire twirp twite twits twoer twyer
+	0x1221313,0x1289313,0x0dc2313,0x1222b13,0x1122f13,0x127b313,0x041b713,0x0323713, // tyees tyers tyiyn tykes tyler tymps tynde tyned
+	0x1223713,0x0b03f13,0x0323f13,0x1223f13,0x1823f13,0x0243f13,0x1273f13,0x127bf13, // tynes typal typed types typey typic typos typps
+	0x0e9bf13,0x0d04713,0x0324713,0x1224713,0x1274713,0x043cf13,0x1288333,0x1258074, // typto tyran tyred tyres tyros tythe tzars udals
+	0x126b874,0x08580d4,0x03218d4,0x0d02cf4,0x148d0f4,0x0490154,0x0060174,0x1268174, // udons ugali ugged uhlan uhuru ukase ulama ulans
+	0x0061174,0x0d43174,0x0303574,0x0403574,0x1103574,0x1203574,0x0d03d74,0x1205574, // ulema ulmin ulnad ulnae ulnar ulnas ulpan ulvas
+	0x0446174,0x0446574,0x0860194,0x0b20594,0x1120594,0x0458594,0x1270594,0x0488594, // ulyie ulzie umami umbel umber umble umbos umbre
+	0x0202194,0x0a02194,0x1002194,0x0703194,0x1203194,0x0323194,0x0323d94,0x123bd94, // umiac umiak umiaq ummah ummas ummed umped umphs
+	0x0443d94,0x189bd94,0x0704594,0x1204594,0x12401b4,0x13781b4,0x0c881b4,0x18881b4, // umpie umpty umrah umras unais unapt unarm unary
+	0x12a01b4,0x06005b4,0x0d005b4,0x11005b4,0x03205b4,0x03405b4,0x17705b4,0x0f009b4, // unaus unbag unban unbar unbed unbid unbox uncap
+	0x12209b4,0x00409b4,0x12709b4,0x18709b4,0x12a09b4,0x0c00db4,0x0420db4,0x1270db4, // unces uncia uncos uncoy uncus undam undee undos
+	0x06a0db4,0x07991b4,0x17415b4,0x06019b4,0x13219b4,0x03719b4,0x13719b4,0x0ca19b4, // undug uneth unfix ungag unget ungod ungot ungum
+	0x1301db4,0x0f41db4,0x00121b4,0x129a1b4,0x0c025b4,0x03229b4,0x13229b4,0x03429b4, // unhat unhip unica units unjam unked unket unkid
+	0x1602db4,0x1802db4,0x0322db4,0x1322db4,0x0342db4,0x0d031b4,0x16231b4,0x17431b4, // unlaw unlay unled unlet unlid unman unmew unmix
+	0x1803db4,0x0623db4,0x0d23db4,0x0d43db4,0x03245b4,0x03445b4,0x06445b4,0x0f445b4, // unpay unpeg unpen unpin unred unrid unrig unrip
+	0x16049b4,0x18049b4,0x04249b4,0x16249b4,0x17249b4,0x03749b4,0x1704db4,0x0d44db4, // unsaw unsay unsee unsew unsex unsod untax untin
+	0x13259b4,0x13459b4,0x0d759b4,0x16705f4,0x04c05f4,0x1270df4,0x1888df4,0x03691f4, // unwet unwit unwon upbow upbye updos updry upend
+	0x13225f4,0x1802df4,0x0322df4,0x1342df4,0x0323df4,0x0d045f4,0x0da45f4,0x04249f4, // upjet uplay upled uplit upped upran uprun upsee
+	0x18249f4,0x0a04df4,0x1124df4,0x0444df4,0x0820234,0x0858234,0x1270234,0x0488234, // upsey uptak upter uptie uraei urali uraos urare
+	0x0888234,0x0490234,0x0498234,0x1720634,0x0040634,0x0420e34,0x0b01234,0x1201234, // urari urase urate urbex urbia urdee ureal ureas
+	0x0e19234,0x0241234,0x0069234,0x1369234,0x0321a34,0x1121a34,0x1221a34,0x0b02234, // uredo ureic urena urent urged urger urges urial
+	0x049a234,0x0d03234,0x0b03634,0x0323634,0x0323e34,0x0404a34,0x0344a34,0x0d74a34, // urite urman urnal urned urped ursae ursid urson
+	0x140d234,0x1205634,0x1289254,0x0023654,0x04a4254,0x048d254,0x188d254,0x0889274, // urubu urvas users usnea usque usure usury uteri
+	0x0b012b4,0x12012b4,0x005d2b4,0x00a0815,0x0320c15,0x1220c15,0x0b01815,0x12a1815, // uveal uveas uvula vacua vaded vades vagal vagus
+	0x125a015,0x048a015,0x128a015,0x188a015,0x1202815,0x0b42815,0x1222c15,0x1242c15, // vails vaire vairs vairy vakas vakil vales valis
+	0x0492c15,0x127b015,0x187b015,0x001b415,0x0323415,0x1223415,0x1233415,0x129b415, // valse vamps vampy vanda vaned vanes vangs vants
+	0x0323c15,0x1123c15,0x1223c15,0x0d04415,0x1204415,0x181c415,0x0224415,0x1224415, // vaped vaper vapes varan varas vardy varec vares
+	0x0044415,0x1744415,0x006c415,0x12a4415,0x04ac415,0x0b04815,0x1224815,0x129c815, // varia varix varna varus varve vasal vases vasts
+	0x189c815,0x0244c15,0x12a4c15,0x0715015,0x049d015,0x129d015,0x049d815,0x1225c15, // vasty vatic vatus vauch vaute vauts vawte vaxes
+	0x0458095,0x1258095,0x1858095,0x0069095,0x1279095,0x1289095,0x1889095,0x1201895, // veale veals vealy veena veeps veers veery vegas
+	0x1221895,0x0441895,0x1271895,0x0461c95,0x125a095,0x185a095,0x126a095,0x186a095, // veges vegie vegos vehme veils veily veins veiny
+	0x1102c95,0x121ac95,0x131ac95,0x1222c95,0x125ac95,0x0ca2c95,0x0403495,0x0b03495, // velar velds veldt veles vells velum venae venal
+	0x121b495,0x141b495,0x1823495,0x0433495,0x0d43495,0x129b495,0x12a3495,0x120c495, // vends vendu veney venge venin vents venus verbs
+	0x008c495,0x188c495,0x1394495,0x129c495,0x149c495,0x007c895,0x009c895,0x129c895, // verra verry verst verts vertu vespa vesta vests
+	0x0714c95,0x0325c95,0x1125c95,0x1225c95,0x0b45c95,0x1146495,0x1258115,0x0368115, // vetch vexed vexer vexes vexil vezir vials viand
+	0x1220515,0x1720515,0x1820515,0x0320915,0x1220915,0x1838915,0x1289115,0x12b1115, // vibes vibex vibey viced vices vichy viers views
+	0x18b1115,0x0019515,0x1229515,0x1201915,0x0041915,0x041ad15,0x1122d15,0x085ad15, // viewy vifda viffs vigas vigia vilde viler villi
+	0x125ad15,0x0d23115,0x0b03515,0x1203515,0x0013515,0x0323515,0x1123515,0x1223515, // vills vimen vinal vinas vinca vined viner vines
+	0x1623515,0x0243515,0x1273515,0x129b515,0x035b915,0x125b915,0x0324515,0x0e24515, // vinew vinic vinos vints viold viols vired vireo
+	0x1224515,0x0034515,0x0434515,0x0344515,0x125c515,0x149c515,0x1204915,0x0324915, // vires virga virge virid virls virtu visas vised
+	0x1224915,0x0444915,0x046c915,0x0d74915,0x0e9c915,0x0404d15,0x1204d15,0x1724d15, // vises visie visne vison visto vitae vitas vitex
+	0x0e8cd15,0x009cd15,0x1205515,0x1305515,0x001d515,0x1125515,0x1225515,0x1146515, // vitro vitta vivas vivat vivda viver vives vizir
+	0x1176515,0x1241175,0x1222175,0x1233975,0x12881d5,0x01009d5,0x12209d5,0x1818dd5, // vizor vleis vlies vlogs voars vocab voces voddy
+	0x1470dd5,0x0da0dd5,0x00611d5,0x04419d5,0x121a1d5,0x045a1d5,0x127a1d5,0x0402dd5, // vodou vodun voema vogie voids voile voips volae
+	0x1102dd5,0x0322dd5,0x1222dd5,0x1322dd5,0x1252dd5,0x009add5,0x049add5,0x089add5, // volar voled voles volet volks volta volte volti
+	0x129add5,0x00aadd5,0x04aadd5,0x11231d5,0x0324dd5,0x1224dd5,0x04351d5,0x145d1d5, // volts volva volve vomer voted votes vouge voulu
+	0x03259d5,0x11259d5,0x0b25dd5,0x033e5d5,0x0240235,0x125a235,0x0c73a35,0x12a3a35, // vowed vower voxel vozhd vraic vrils vroom vrous
+	0x16a3a35,0x12b3a35,0x1231a95,0x1831a95,0x1239a95,0x1839a95,0x0e32e95,0x126ae95, // vrouw vrows vuggs vuggy vughs vughy vulgo vulns
+	0x00aae95,0x189ce95,0x1210016,0x0450816,0x0e50816,0x1250816,0x1218c16,0x1818c16, // vulva vutty waacs wacke wacko wacks wadds waddy
+	0x0320c16,0x1120c16,0x1220c16,0x0430c16,0x1240c16,0x1298c16,0x1229416,0x1299416, // waded wader wades wadge wadis wadts waffs wafts
+	0x0321816,0x1221816,0x0031816,0x14c1816,0x0e71c16,0x041a016,0x122a016,0x132a016, // waged wages wagga wagyu wahoo waide waifs waift
+	0x125a016,0x126a016,0x128a016,0x049a016,0x129a016,0x1202816,0x0322816,0x0d22816, // wails wains wairs waite waits wakas waked waken
+	0x1122816,0x1222816,0x122a816,0x0e1ac16,0x121ac16,0x0322c16,0x1122c16,0x1222c16, // waker wakes wakfs waldo walds waled waler wales
+	0x0442c16,0x1242c16,0x1252c16,0x005ac16,0x125ac16,0x185ac16,0x189ac16,0x0323016, // walie walis walks walla walls wally walty wamed
+	0x1223016,0x12a3016,0x121b416,0x0323416,0x1223416,0x1823416,0x1233416,0x1253416, // wames wamus wands waned wanes waney wangs wanks
+	0x1853416,0x045b416,0x185b416,0x006b416,0x129b416,0x189b416,0x04cb416,0x122c016, // wanky wanle wanly wanna wants wanty wanze waqfs
+	0x120c416,0x180c416,0x121c416,0x0324416,0x1224416,0x1924416,0x1254416,0x1264416, // warbs warby wards wared wares warez warks warms
+	0x126c416,0x127c416,0x048c416,0x1394416,0x129c416,0x1224816,0x183c816,0x1264816, // warns warps warre warst warts wases washy wasms
+	0x127c816,0x187c816,0x129c816,0x0f04c16,0x129cc16,0x052d016,0x0735016,0x1255016, // wasps waspy wasts watap watts wauff waugh wauks
+	0x0a5d016,0x125d016,0x128d016,0x0325416,0x1225416,0x1825416,0x1205816,0x1225816, // waulk wauls waurs waved waves wavey wawas wawes
+	0x125d816,0x0325c16,0x1125c16,0x1225c16,0x0326016,0x1146416,0x0e76416,0x0358096, // wawls waxed waxer waxes wayed wazir wazoo weald
+	0x1258096,0x0160096,0x1268096,0x1288096,0x1808496,0x1120496,0x1338896,0x0b20c96, // weals weamb weans wears webby weber wecht wedel
+	0x1830c96,0x1219096,0x0451096,0x1251096,0x1259096,0x1261096,0x1269096,0x1869096, // wedgy weeds weeke weeks weels weems weens weeny
+	0x1279096,0x1879096,0x1391096,0x0499096,0x1299096,0x0499496,0x1299496,0x121a096, // weeps weepy weest weete weets wefte wefts weids
+	0x125a096,0x128a096,0x0492096,0x04ca096,0x1202896,0x121ac96,0x0452c96,0x1252c96, // weils weirs weise weize wekas welds welke welks
+	0x1352c96,0x125ac96,0x185ac96,0x129ac96,0x120b096,0x121b496,0x0433496,0x186b496, // welkt wells welly welts wembs wends wenge wenny
+	0x129b496,0x1274496,0x0794496,0x129c896,0x1204c96,0x185cc96,0x0325c96,0x1225c96, // wents weros wersh wests wetas wetly wexed wexes
+	0x0e600f6,0x12600f6,0x06680f6,0x12780f6,0x04880f6,0x00980f6,0x12980f6,0x0fa00f6, // whamo whams whang whaps whare whata whats whaup
+	0x11a00f6,0x0b010f6,0x11010f6,0x0d210f6,0x0f210f6,0x13290f6,0x0a590f6,0x0c590f6, // whaur wheal whear wheen wheep wheft whelk whelm
+	0x12690f6,0x12990f6,0x12b10f6,0x12c10f6,0x121a0f6,0x132a0f6,0x12320f6,0x0a5a0f6, // whens whets whews wheys whids whift whigs whilk
+	0x12620f6,0x126a0f6,0x12720f6,0x127a0f6,0x137a0f6,0x118a0f6,0x128a0f6,0x07920f6, // whims whins whios whips whipt whirr whirs whish
+	0x12920f6,0x13920f6,0x129a0f6,0x189a0f6,0x19ca0f6,0x0f638f6,0x05738f6,0x13738f6, // whiss whist whits whity whizz whomp whoof whoot
+	0x127b8f6,0x048b8f6,0x0b8b8f6,0x138b8f6,0x0e938f6,0x12b38f6,0x0f650f6,0x127d0f6, // whops whore whorl whort whoso whows whump whups
+	0x001e0f6,0x0010916,0x1250916,0x1850916,0x1818d16,0x1220d16,0x1259116,0x0321516, // whyda wicca wicks wicky widdy wides wiels wifed
+	0x1221516,0x1821516,0x0441516,0x1899516,0x0d01916,0x0031916,0x1831916,0x1242916, // wifes wifey wifie wifty wigan wigga wiggy wikis
+	0x0e12d16,0x121ad16,0x0322d16,0x1222d16,0x0032d16,0x1242d16,0x004ad16,0x125ad16, // wilco wilds wiled wiles wilga wilis wilja wills
+	0x129ad16,0x127b116,0x121b516,0x0323516,0x1223516,0x1823516,0x0433516,0x1233516, // wilts wimps winds wined wines winey winge wings
+	0x1833516,0x1253516,0x006b516,0x126b516,0x1273516,0x04cb516,0x0323d16,0x1123d16, // wingy winks winna winns winos winze wiped wiper
+	0x1223d16,0x0324516,0x1124516,0x1224516,0x008c516,0x0324916,0x1224916,0x003c916, // wipes wired wirer wires wirra wised wises wisha
+	0x133c916,0x127c916,0x129c916,0x0d04d16,0x0324d16,0x1224d16,0x043cd16,0x123cd16, // wisht wisps wists witan wited wites withe withs
+	0x183cd16,0x0325516,0x1125516,0x1225516,0x0d26516,0x1226516,0x12181d6,0x03581d6, // withy wived wiver wives wizen wizes woads woald
+	0x12509d6,0x0430dd6,0x0ba15d6,0x12a25d6,0x11229d6,0x00529d6,0x121add6,0x122add6, // wocks wodge woful wojus woker wokka wolds wolfs
+	0x185add6,0x04aadd6,0x120b1d6,0x180b1d6,0x0dc31d6,0x00335d6,0x08335d6,0x12535d6, // wolly wolve wombs womby womyn wonga wongi wonks
+	0x18535d6,0x129b5d6,0x121b9d6,0x03239d6,0x122b9d6,0x182b9d6,0x035b9d6,0x125b9d6, // wonky wonts woods wooed woofs woofy woold wools
+	0x126b9d6,0x127b9d6,0x187b9d6,0x04939d6,0x07939d6,0x199b9d6,0x121c5d6,0x12545d6, // woons woops woopy woose woosh wootz words works
+	0x12645d6,0x18645d6,0x129c5d6,0x03259d6,0x04259d6,0x0d25dd6,0x0668236,0x1278236, // worms wormy worts wowed wowee woxen wrang wraps
+	0x1378236,0x1390236,0x0498236,0x0bb0236,0x1269236,0x0a12236,0x0322236,0x1122236, // wrapt wrast wrate wrawl wrens wrick wried wrier
+	0x1222236,0x129a236,0x0453a36,0x1373a36,0x079ba36,0x1126236,0x1818e96,0x12a0e96, // wries writs wroke wroot wroth wryer wuddy wudus
+	0x125ae96,0x1394696,0x1224a96,0x143ca96,0x1894a96,0x0045e96,0x0322f16,0x1222f16, // wulls wurst wuses wushu wussy wuxia wyled wyles
+	0x121b716,0x126b716,0x0324f16,0x1224f16,0x0220497,0x0043497,0x0243497,0x0d73497, // wynds wynns wyted wytes xebec xenia xenic xenon
+	0x0244497,0x1774497,0x12a4497,0x00681d7,0x12c0237,0x0d02f17,0x0c22f17,0x0242f17, // xeric xerox xerus xoana xrays xylan xylem xylic
+	0x0b72f17,0x0bc2f17,0x089cb17,0x129cb17,0x1288018,0x1200418,0x0008418,0x1808418, // xylol xylyl xysti xysts yaars yabas yabba yabby
+	0x0010818,0x0050818,0x1250818,0x1229418,0x1121818,0x1221818,0x1241818,0x0e71c18, // yacca yacka yacks yaffs yager yages yagis yahoo
+	0x038a018,0x0052818,0x1672818,0x1222c18,0x0d23018,0x187b018,0x0da3018,0x1233418, // yaird yakka yakow yales yamen yampy yamun yangs
+	0x1253418,0x0a73c18,0x0d73c18,0x127bc18,0x187bc18,0x0a04418,0x0e14418,0x121c418, // yanks yapok yapon yapps yappy yarak yarco yards
+	0x1124418,0x002c418,0x1254418,0x126c418,0x128c418,0x009c418,0x0e9c418,0x1224c18, // yarer yarfa yarks yarns yarrs yarta yarto yates
+	0x121d018,0x035d018,0x127d018,0x0325818,0x1825818,0x125d818,0x126d818,0x186d818, // yauds yauld yaups yawed yawey yawls yawns yawny
+	0x127d818,0x048b838,0x0302c58,0x0322c58,0x036b858,0x0304478,0x0324478,0x1218098, // yawps ybore yclad ycled ycond ydrad ydred yeads
+	0x1238098,0x0c58098,0x1268098,0x0388098,0x1288098,0x0710898,0x1238898,0x1838898, // yeahs yealm yeans yeard years yecch yechs yechy
+	0x1220c98,0x1219098,0x0791098,0x1231898,0x1252c98,0x125ac98,0x1262c98,0x127ac98, // yedes yeeds yeesh yeggs yelks yells yelms yelps
+	0x129ac98,0x009b498,0x049b498,0x000c498,0x121c498,0x1254498,0x1224898,0x1254898, // yelts yenta yente yerba yerds yerks yeses yesks
+	0x129c898,0x189c898,0x1244c98,0x129cc98,0x1255098,0x1855098,0x0d25498,0x1225498, // yests yesty yetis yetts yeuks yeuky yeven yeves
+	0x0d25898,0x0325c98,0x1225c98,0x04890b8,0x0322918,0x1222918,0x125ad18,0x0413518, // yewen yexed yexes yfere yiked yikes yills yince
+	0x1223d18,0x187bd18,0x121c518,0x1254518,0x128c518,0x079c518,0x1224d18,0x0444d18, // yipes yippy yirds yirks yirrs yirth yites yitie
+	0x1261178,0x0452178,0x1222978,0x135b998,0x1223d98,0x0e085d8,0x18085d8,0x12509d8, // ylems ylike ylkes ymolt ympes yobbo yobby yocks
+	0x0b20dd8,0x1238dd8,0x0458dd8,0x12019d8,0x04219d8,0x12399d8,0x02419d8,0x0d419d8, // yodel yodhs yodle yogas yogee yoghs yogic yogin
+	0x12419d8,0x0a121d8,0x0d025d8,0x03229d8,0x0b229d8,0x11229d8,0x12229d8,0x0ba29d8, // yogis yoick yojan yoked yokel yoker yokes yokul
+	0x1252dd8,0x1852dd8,0x0c431d8,0x127b1d8,0x02435d8,0x12435d8,0x12535d8,0x122b9d8, // yolks yolky yomim yomps yonic yonis yonks yoofs
+	0x127b9d8,0x12245d8,0x12545d8,0x127c5d8,0x12551d8,0x0d8d1d8,0x128d1d8,0x138d1d8, // yoops yores yorks yorps youks yourn yours yourt
+	0x04951d8,0x03259d8,0x12259d8,0x04459d8,0x125d9d8,0x00cd9d8,0x1378238,0x1369238, // youse yowed yowes yowie yowls yowza yrapt yrent
+	0x03aa238,0x0723638,0x0460258,0x1393a78,0x1268298,0x1200a98,0x0010a98,0x0710a98, // yrivd yrneh ysame ytost yuans yucas yucca yucch
+	0x0e50a98,0x1250a98,0x1850a98,0x1299698,0x1201a98,0x0322a98,0x1222a98,0x1852a98, // yucko yucks yucky yufts yugas yuked yukes yukky
+	0x1272a98,0x0d02e98,0x1222e98,0x0e63298,0x1863298,0x127b298,0x0d73e98,0x187be98, // yukos yulan yules yummo yummy yumps yupon yuppy
+	0x009c698,0x129c698,0x12a6698,0x0088419,0x1250819,0x001a019,0x181a019,0x048a019, // yurta yurts yuzus zabra zacks zaida zaidy zaire
+	0x1302819,0x0d03019,0x0e0b019,0x0043019,0x004b419,0x049b419,0x00cb419,0x04cb419, // zakat zaman zambo zamia zanja zante zanza zanze
+	0x187bc19,0x122c419,0x1244419,0x1244c19,0x1225c19,0x0d46019,0x0d26419,0x1258099, // zappy zarfs zaris zatis zaxes zayin zazen zeals
+	0x0220499,0x01a0499,0x12a0499,0x1200c99,0x126a099,0x0e1b499,0x001c499,0x1254499, // zebec zebub zebus zedas zeins zendo zerda zerks
+	0x1274499,0x129c899,0x1204c99,0x1225c99,0x1226499,0x0e638f9,0x1320519,0x1229519, // zeros zests zetas zexes zezes zhomo zibet ziffs
+	0x0d01919,0x1202d19,0x0712d19,0x005ad19,0x125ad19,0x080b119,0x120b119,0x0e13519, // zigan zilas zilch zilla zills zimbi zimbs zinco
+	0x1213519,0x1813519,0x0123519,0x1223519,0x1233519,0x1833519,0x0453519,0x1853519, // zincs zincy zineb zines zings zingy zinke zinky
+	0x0e7bd19,0x187bd19,0x0c04519,0x1244d19,0x0b26519,0x1346519,0x049b979,0x189b979, // zippo zippy ziram zitis zizel zizit zlote zloty
+	0x00201d9,0x12705d9,0x12a05d9,0x0e109d9,0x04011d9,0x0b011d9,0x12011d9,0x0c921d9, // zoaea zobos zobus zocco zoeae zoeal zoeas zoism
+	0x13921d9,0x080b1d9,0x04035d9,0x001b5d9,0x03235d9,0x11235d9,0x12235d9,0x12535d9, // zoist zombi zonae zonda zoned zoner zones zonks
+	0x00239d9,0x18239d9,0x03439d9,0x12539d9,0x12639d9,0x126b9d9,0x189b9d9,0x007bdd9, // zooea zooey zooid zooks zooms zoons zooty zoppa
+	0x0e7bdd9,0x0b445d9,0x12445d9,0x0e8c5d9,0x12551d9,0x04259d9,0x04459d9,0x12a2e99, // zoppo zoril zoris zorro zouks zowee zowie zulus
+	0x0d03e99,0x1203e99,0x007be99,0x122c699,0x0c46699,0x0b01b19,0x0d71b19,0x1223319, // zupan zupas zuppa zurfs zuzim zygal zygon zymes
+	0x0243319,0x1101902,0x13a0491,0x1894912,0x077b287,0x04502c0,0x0795161,0x0b009c5, // zymic cigar rebut sissy humph awake blush focal
+	0x04182a4,0x0b0540d,0x04ac492,0x0798087,0x05882c3,0x0b20dcc,0x006440a,0x0a6a272, // evade naval serve heath dwarf model karma stink
+	0x0418226,0x1322290,0x0713481,0x0498020,0x0d32085,0x117240c,0x0798083,0x0791225, // grade quiet bench abate feign major death fresh
+	0x1395222,0x0b73a72,0x0d72dc2,0x0490020,0x188c40c,0x1310091,0x189cc01,0x041a22f, // crust stool colon abase marry react batty pride
+	0x1293965,0x1742c87,0x0a03a22,0x0528272,0x1123c0f,0x03215b4,0x0f590f6,0x0bb0233, // floss helix croak staff paper unfed whelp trawl
+	0x0e1ce8e,0x040b860,0x18c8222,0x11259d2,0x1803c91,0x1341903,0x0498222,0x0a15162, // outdo adobe crazy sower repay digit crate cluck
+	0x04521f2,0x024310c,0x036d1cf,0x0c45c0c,0x0d2350b,0x13231b4,0x0791165,0x180b9c1, // spike mimic pound maxim linen unmet flesh booby
+	0x079c5c5,0x1394505,0x0368272,0x185ac81,0x188baa8,0x1819092,0x136a22f,0x0d88098, // forth first stand belly ivory seedy print yearn
+	0x0d40223,0x040a221,0x13a3a72,0x0b2340f,0x1290222,0x0465165,0x0b014ae,0x04244c0, // drain bribe stout panel crass flume offal agree
+	0x1174624,0x0b8a2d2,0x04a1a20,0x0321161,0x009ac83,0x0a12165,0x0c24dd3,0x11239d6, // error swirl argue bleed delta flick totem wooer
+	0x136ba25,0x01a44f2,0x188c40f,0x0463901,0x0b23c0b,0x1388272,0x1321226,0x11235c6, // front shrub parry biome lapel start greet goner
+	0x0c22dc6,0x189ca8b,0x187b9cb,0x036d1d1,0x1340e80,0x066a30b,0x0063006,0x117040b, // golem lusty loopy round audit lying gamma labor
+	0x1322e48,0x0245502,0x04345c5,0x186c5c2,0x135d1cc,0x0244801,0x0302c12,0x04980c0, // islet civic forge corny moult basic salad agate
+	0x18121f2,0x18045f2,0x1804a44,0x038b925,0x03691f2,0x010048a,0x035a286,0x0a10020, // spicy spray essay fjord spend kebab guild aback
+	0x1174dcc,0x046b960,0x0714c07,0x1123f07,0x01650f3,0x188d9c3,0x1339a8e,0x0712c81, // motor alone hatch hyper thumb dowry ought belch
+	0x0714e83,0x1372d0f,0x03212d3,0x13231c2,0x136d009,0x00611a4,0x0321272,0x1296020, // dutch pilot tweed comet jaunt enema steed abyss
+	0x0bb3a26,0x066a165,0x0d265c3,0x18cb9c1,0x041ba24,0x035c5d6,0x04351c6,0x0a12162, // growl fling dozen boozy erode world gouge click
+	0x1102221,0x1301226,0x1104d60,0x187ae8f,0x138d161,0x13901c2,0x1838a83,0x0d43a26, // briar great altar pulpy blurt coast duchy groin
+	0x1125d05,0x0fa3a26,0x04a19d1,0x1858c01,0x1388192,0x183cd0f,0x181d006,0x0b5a0e2, // fixer group rogue badly smart pithy gaudy chill
+	0x0d74487,0x0050dd5,0x1123505,0x1124692,0x0e40c11,0x04351d1,0x071448f,0x0714c91, // heron vodka finer surer radio rouge perch retch
+	0x049ba36,0x0a13962,0x041ad13,0x048ba72,0x04aba2f,0x066a221,0x04aadd2,0x13010e2, // wrote clock tilde store prove bring solve cheat
+	0x0462226,0x135d2e4,0x1121e54,0x07139e4,0x0302233,0x0a01221,0x0e6a0f1,0x0b04515, // grime exult usher epoch triad break rhino viral
+	0x02435c2,0x049480c,0x02435d2,0x0b04d15,0x0410233,0x066a254,0x071008f,0x0f600e2, // conic masse sonic vital trace using peach champ
+	0x0d74c01,0x0450221,0x0a1516f,0x04c8222,0x047a226,0x1888096,0x185090f,0x049d040, // baton brake pluck craze gripe weary picky acute
+	0x188c485,0x041a240,0x1143c13,0x0b5ba33,0x182a1b4,0x12a0491,0x13939c1,0x1295233, // ferry aside tapir troll unify rebus boost truss
+	0x0431112,0x1121913,0x0b03401,0x0f65172,0x0a68222,0x04345c6,0x1889290,0x0a6a223, // siege tiger banal slump crank gorge query drink
+	0x1175405,0x1820420,0x1833413,0x024340f,0x1102dd2,0x048a0f2,0x18bba2f,0x136a1cf, // favor abbey tangy panic solar shire proxy point
+	0x13705d1,0x0a1222f,0x0413516,0x0f62222,0x0b5b9aa,0x1101a92,0x0a100f6,0x136d1cc, // robot prick wince crimp knoll sugar whack mount
+	0x185448f,0x035d1c2,0x066d236,0x133990b,0x04938f3,0x13921cc,0x03880f2,0x130116f, // perky could wrung light those moist shard pleat
+	0x132b960,0x0b5a152,0x1120d64,0x0460225,0x1173287,0x049500f,0x1120974,0x008cd74, // aloft skill elder frame humor pause ulcer ultra
+	0x0d405d1,0x0243702,0x008b8c0,0x0063a20,0x0a5d002,0x04500f2,0x0b03e8f,0x0430dc3, // robin cynic agora aroma caulk shake pupal dodge
+	0x0b5a2d2,0x1340813,0x1121e6e,0x0d8b8f3,0x04aba33,0x0453961,0x0345515,0x0b5a1f2, // swill tacit other thorn trove bloke vivid spill
+	0x13680e2,0x04538e2,0x0423e91,0x189c80d,0x0d8d1cc,0x03010e0,0x046a221,0x079b962, // chant choke rupee nasty mourn ahead brine cloth
+	0x03881c7,0x13212d2,0x079b5cc,0x0493c0b,0x0714c16,0x1800dd3,0x12a09c5,0x1359192, // hoard sweet month lapse watch today focus smelt
+	0x0490093,0x1124c02,0x04455cc,0x071370b,0x049d012,0x1672d60,0x1623491,0x11410f3, // tease cater movie lynch saute allow renew their
+	0x0793972,0x043468f,0x13910e2,0x1373c83,0x18bb9e4,0x077b30d,0x036d1c5,0x0b580f2, // slosh purge chest depot epoxy nymph found shall
+	0x188c407,0x04aba72,0x185d9cb,0x13a39b2,0x047ba33,0x1125885,0x0bb00f2,0x0b04c0d, // harry stove lowly snout trope fewer shawl natal
+	0x0488505,0x00631c2,0x18045c5,0x0488052,0x1140272,0x0a10161,0x0305212,0x0b061d1, // fibre comma foray scare stair black squad royal
+	0x0a6d0e2,0x041350c,0x04a8172,0x04600f2,0x0a210e2,0x045bd80,0x1140165,0x11261c5, // chunk mince slave shame cheek ample flair foyer
+	0x0e34402,0x041a2ee,0x136816f,0x04aa16e,0x13891a8,0x1622a40,0x1392087,0x0db38f2, // cargo oxide plant olive inert askew heist shown
+	0x189c899,0x189c807,0x0790233,0x005ac85,0x00ac40b,0x0e345c5,0x188ba72,0x188a007, // zesty hasty trash fella larva forgo story hairy
+	0x0d40233,0x11231c7,0x0430c01,0x1390d0c,0x186b402,0x12a4c85,0x0714e81,0x0414405, // train homer badge midst canny fetus butch farce
+	0x066d172,0x1893d13,0x0b04c8c,0x0359118,0x04aac83,0x066a081,0x11a3852,0x1290166, // slung tipsy metal yield delve being scour glass
+	0x1123006,0x0f04452,0x18235cc,0x0433507,0x0ca0560,0x07151d5,0x1324a40,0x0088113, // gamer scrap money hinge album vouch asset tiara
+	0x1379222,0x1476001,0x0b5ba60,0x117340c,0x0a01222,0x18b38f2,0x04900ef,0x079ba25, // crept bayou atoll manor creak showy phase froth
+	0x079bc83,0x0c73966,0x0373965,0x1340233,0x079c506,0x189910f,0x112600f,0x04939c6, // depth gloom flood trait girth piety payer goose
+	0x1303965,0x11735c3,0x046ba60,0x0e6222f,0x0d745e0,0x0db3961,0x0e00802,0x11249cb, // float donor atone primo apron blown cacao loser
+	0x13a3da8,0x1303966,0x0ba16c0,0x0a6a221,0x049a192,0x1818081,0x189ca91,0x0e8cc91, // input gloat awful brink smite beady rusty retro
+	0x0b5ba23,0x1855806,0x0714e87,0x0e9b50f,0x185a006,0x13244c4,0x0202d0b,0x1125492, // droll gawky hutch pinto gaily egret lilac sever
+	0x0359105,0x052d165,0x0e88f07,0x0a10165,0x04780c0,0x0713496,0x04121d5,0x0301272, // field fluff hydro flack agape wench voice stead
+	0x0a58272,0x079c481,0x0c00c0c,0x133990d,0x0368161,0x112550b,0x0430c96,0x11a1a80, // stalk berth madam night bland liver wedge augur
+	0x18639d1,0x1850816,0x0a13965,0x18899a0,0x18085c1,0x049a233,0x0341de0,0x1396233, // roomy wacky flock angry bobby trite aphid tryst
+	0x0430d0c,0x11259cf,0x047b964,0x0713502,0x0e9cdcc,0x0f63a72,0x13249f4,0x052d161, // midge power elope cinch motto stomp upset bluff
+	0x0f60222,0x1388290,0x185e1c2,0x079d1d8,0x04660f1,0x1831a81,0x0d22160,0x1101192, // cramp quart coyly youth rhyme buggy alien smear
+	0x13415b4,0x189cc0f,0x066a162,0x0d01166,0x0b2040b,0x1853687,0x08500ea,0x11229cf, // unfit patty cling glean label hunky khaki poker
+	0x0b25226,0x04122d3,0x06682d3,0x06a44f2,0x1301233,0x1342db4,0x049c816,0x134448c, // gruel twice twang shrug treat unlit waste merit
+	0x0d255d6,0x0b04c4e,0x181908d,0x0db3962,0x1670d16,0x186ba28,0x1120e91,0x04cd006, // woven octal needy clown widow irony ruder gauze
+	0x05220e2,0x13249ae,0x04ca22f,0x0833685,0x0c880e2,0x185ae86,0x1124da8,0x0f738f6, // chief onset prize fungi charm gully inter whoop
+	0x136d013,0x188908b,0x1290162,0x04610f3,0x18995cb,0x0040513,0x04cb9c1,0x003bd60, // taunt leery class theme lofty tibia booze alpha
+	0x04660f3,0x1302c44,0x130d1c3,0x112440f,0x049d0e2,0x0a12272,0x0412233,0x0452160, // thyme eclat doubt parer chute stick trice alike
+	0x079b9d2,0x0f00891,0x136a012,0x043110b,0x188b966,0x0498226,0x1343060,0x0a92221, // sooth recap saint liege glory grate admit brisk
+	0x18319d2,0x0f8d254,0x0358052,0x0d8b852,0x04a808b,0x046a2d3,0x066a272,0x07351c1, // soggy usurp scald scorn leave twine sting bough
+	0x079440c,0x079b972,0x181b403,0x1171915,0x181d9c7,0x18725a4,0x0342c15,0x02435c8, // marsh sloth dandy vigor howdy enjoy valid ionic
+	0x0b05204,0x13249b4,0x1173965,0x0714c02,0x04181f2,0x0d41272,0x13922e4,0x0a8a290, // equal unset floor catch spade stein exist quirk
+	0x0c43483,0x04aba26,0x0b221f2,0x186328c,0x135d005,0x18319c5,0x13a3965,0x188c402, // denim grove spiel mummy fault foggy flout carry
+	0x0a011b2,0x0b2050b,0x199ac16,0x185cde0,0x182350f,0x13791a8,0x03a3960,0x0e9b8ef, // sneak libel waltz aptly piney inept aloud photo
+	0x0c01223,0x0458272,0x13431d5,0x048858e,0x186b405,0x049a1b4,0x0b881b2,0x1122801, // dream stale vomit ombre fanny unite snarl baker
+	0x04890f3,0x077e166,0x07139cf,0x187bd07,0x0b591f2,0x185adc5,0x04951cb,0x0712e86, // there glyph pooch hippy spell folly louse gulch
+	0x135d015,0x1858dc6,0x16244f3,0x1321165,0x04a8226,0x04681a8,0x0a138f2,0x04a8222, // vault godly threw fleet grave inane shock crave
+	0x049a1f2,0x04aac15,0x0f62152,0x0c40162,0x186a011,0x189ca8c,0x04a410f,0x1818c03, // spite valve skimp claim rainy musty pique daddy
+	0x0890290,0x0492220,0x066a0c0,0x1322c15,0x0ca21ee,0x13892a0,0x0a15272,0x13a0891, // quasi arise aging valet opium avert stuck recut
+	0x0712e8c,0x048b486,0x046516f,0x0459511,0x136d1c2,0x11a09a8,0x0b04dd3,0x1391236, // mulch genre plume rifle count incur total wrest
+	0x00389cc,0x1124c83,0x181d272,0x11255cb,0x1121412,0x1325511,0x186b685,0x0453992, // mocha deter study lover safer rivet funny smoke
+	0x036d1cc,0x04a0db4,0x0d00c92,0x0d0180f,0x046a2d2,0x045a286,0x189ca86,0x0f45204, // mound undue sedan pagan swine guile gusty equip
+	0x07351d3,0x0473402,0x12700e2,0x13255c2,0x0d03287,0x1120c74,0x071368b,0x1390161, // tough canoe chaos covet human udder lunch blast
+	0x1804672,0x003340c,0x0422c8c,0x189948b,0x0a12290,0x049c80f,0x0d25506,0x1324c4e, // stray manga melee lefty quick paste given octet
+	0x0d24911,0x0d03a26,0x185008b,0x036a226,0x04ac402,0x04939cb,0x1858c12,0x135a1f2, // risen groan leaky grind carve loose sadly spilt
+	0x045bde0,0x0a10172,0x18235c7,0x0b03505,0x0d210f2,0x0444484,0x189b50c,0x0a12172, // apple slack honey final sheen eerie minty slick
+	0x180c483,0x05880f6,0x13591f2,0x07101c2,0x137d224,0x0433512,0x041222f,0x0db01f2, // derby wharf spelt coach erupt singe price spawn
+	0x188a005,0x1829509,0x1862d05,0x0a10272,0x04938e2,0x0f21172,0x1170e20,0x186b40d, // fairy jiffy filmy stack chose sleep ardor nanny
+	0x041110d,0x18cb9d6,0x181b407,0x0410226,0x0e9cd03,0x0a68272,0x0c01222,0x0b05254, // niece woozy handy grace ditto stank cream usual
+	0x041b903,0x1172c15,0x04599a0,0x004b50d,0x1818e8c,0x04900e2,0x185bc91,0x046ba2f, // diode valor angle ninja muddy chase reply prone
+	0x0b439f2,0x1388087,0x04180f2,0x1123503,0x0d74a20,0x0d721ae,0x1321172,0x0b259c3, // spoil heart shade diner arson onion sleet dowel
+	0x07151c2,0x1892c0f,0x0b259c1,0x045a192,0x0453aa4,0x0a21222,0x041340b,0x0459804, // couch palsy bowel smile evoke creek lance eagle
+	0x1372068,0x0d24512,0x135a281,0x0320584,0x03882c0,0x1293a23,0x0ba35a0,0x181b9c6, // idiot siren built embed award dross annul goody
+	0x0db3a25,0x0e44c0f,0x0d20c0b,0x0343287,0x049a164,0x077b30b,0x182a064,0x133990c, // frown patio laden humid elite lymph edify might
+	0x1324891,0x1344915,0x0e9ca86,0x049468f,0x1173c15,0x0a13a22,0x049a236,0x186b692, // reset visit gusto purse vapor crock write sunny
+	0x07981cb,0x05280e2,0x041a172,0x1121290,0x0c73495,0x0f60272,0x188c5d2,0x0b5a272, // loath chaff slide queer venom stamp sorry still
+	0x0d8b840,0x066a1e0,0x183ca8f,0x1123013,0x1124c07,0x004340c,0x0453ac0,0x0db0221, // acorn aping pushy tamer hater mania awoke brawn
+	0x132a2d2,0x045a2e4,0x0714501,0x1850a8b,0x1121225,0x1854911,0x13938e6,0x112216f, // swift exile birch lucky freer risky ghost plier
+	0x110368b,0x0713516,0x04881b2,0x049468d,0x04951c7,0x17045c1,0x112090d,0x071468b, // lunar winch snare nurse house borax nicer lurch
+	0x13582e4,0x13a3820,0x18ad412,0x0d45dd3,0x0243693,0x032222f,0x1802da8,0x0f650e2, // exalt about savvy toxin tunic pried inlay chump
+	0x185340b,0x1291222,0x1124c04,0x041d164,0x0458b02,0x189cd0a,0x045d1c1,0x0d745cc, // lanky cress eater elude cycle kitty boule moron
+	0x1323493,0x041016f,0x18085cb,0x079516f,0x0b41915,0x1720da8,0x0a6a161,0x066d162, // tenet place lobby plush vigil index blink clung
+	0x0c58290,0x0fa3a22,0x0a6a162,0x1812289,0x0430272,0x1800883,0x04ac48d,0x1122165, // qualm croup clink juicy stage decay nerve flier
+	0x13280f2,0x0a73a22,0x0d01162,0x006a0e2,0x0430d11,0x0b259d5,0x04639a6,0x0a151b2, // shaft crook clean china ridge vowel gnome snuck
+	0x066a048,0x186a1f2,0x1171911,0x0b401b2,0x0db3965,0x0340411,0x0493a2f,0x0a680f3, // icing spiny rigor snail flown rabid prose thank
+	0x187bdcf,0x0430e81,0x1120505,0x181adcc,0x181d9c3,0x0b211aa,0x0a10233,0x1818c02, // poppy budge fiber moldy dowdy kneel track caddy
+	0x0b59290,0x187b283,0x1122c0f,0x048bad2,0x1100491,0x000d052,0x1302df2,0x1126165, // quell dumpy paler swore rebar scuba splat flyer
+	0x186c5c7,0x0d7480c,0x066a1c3,0x046bb2e,0x185bd80,0x1102dcc,0x18882ae,0x1324881, // horny mason doing ozone amply molar ovary beset
+	0x04a1290,0x052a162,0x024180c,0x0415233,0x138b9f2,0x199a225,0x1312064,0x0b8a2d3, // queue cliff magic truce sport fritz edict twirl
+	0x0494495,0x006016b,0x0d24c04,0x0433411,0x0a920f6,0x0b255c7,0x0101c91,0x160080c, // verse llama eaten range whisk hovel rehab macaw
+	0x0061912,0x13a39f2,0x04ac495,0x083ca92,0x066a303,0x0344c85,0x0d40221,0x1818e81, // sigma spout verve sushi dying fetid brain buddy
+	0x0f650f3,0x0d72052,0x181b402,0x038b8e2,0x0d44801,0x071440c,0x03b3a22,0x1170620, // thump scion candy chord basin march crowd arbor
+	0x185e006,0x1854a8c,0x0d40272,0x185ac03,0x1291161,0x0ea8221,0x066d272,0x045cd13, // gayly musky stain dally bless bravo stung title
+	0x1122e91,0x0a9390a,0x036b961,0x08a35a4,0x112600b,0x0345165,0x189cc13,0x048b852, // ruler kiosk blond ennui layer fluid tatty score
+	0x0444e82,0x0088499,0x0434401,0x1824c0c,0x1125161,0x1120d00,0x0a738f2,0x1125511, // cutie zebra barge matey bluer aider shook river
+	0x18aa22f,0x0b24c81,0x0a92225,0x0e335c1,0x0da1881,0x048d320,0x04a8096,0x0443486, // privy betel frisk bongo begun azure weave genie
+	0x036d1d2,0x04ab966,0x0340221,0x047b852,0x185e236,0x11255d1,0x1804a40,0x0d0104e, // sound glove braid scope wryly rover assay ocean
+	0x0c73961,0x0498228,0x1124c0b,0x0d229d6,0x1852d12,0x0a11236,0x13592c3,0x0498172, // bloom irate later woken silky wreck dwelt slate
+	0x0a10192,0x0342dd2,0x04c8180,0x0b26407,0x1392236,0x185adc9,0x040b966,0x136a165, // smack solid amaze hazel wrist jolly globe flint
+	0x04951d1,0x0b45502,0x009c915,0x1702c91,0x11255c2,0x04aa160,0x0711081,0x189cc89, // rouse civil vista relax cover alive beech jetty
+	0x1292161,0x0b009d5,0x0d24cae,0x185adc3,0x1339904,0x11229c9,0x0413512,0x13692a4, // bliss vocal often dolly eight joker since event
+	0x04a49a4,0x136d0f2,0x1125503,0x11249cf,0x13945d6,0x0f212d2,0x1822d60,0x0321222, // ensue shunt diver poser worst sweep alley creed
+	0x04621a0,0x182808b,0x0c749c1,0x0413683,0x0488272,0x1830e8f,0x04aa016,0x11438e2, // anime leafy bosom dunce stare pudgy waive choir
+	0x0373a72,0x04539f2,0x0e34e8e,0x1802c83,0x0432d01,0x0b01068,0x0f90162,0x04ca092, // stood spoke outgo delay bilge ideal clasp seize
+	0x185cdc7,0x073500b,0x04a9112,0x0a13961,0x136808c,0x0478226,0x04939cd,0x181c407, // hotly laugh sieve block meant grape noose hardy
+	0x03220f2,0x0bb0223,0x1892003,0x189ce8f,0x13a4672,0x136c681,0x0f42e93,0x0a12222, // shied drawl daisy putty strut burnt tulip crick
+	0x0b5e068,0x0d25d15,0x1174685,0x1851086,0x07351c2,0x04aa00d,0x0b038f2,0x0a8ba72, // idyll vixen furor geeky cough naive shoal stork
+	0x043cc01,0x189b680,0x0a110e2,0x046222f,0x1290221,0x1124e8e,0x188c685,0x1176411, // bathe aunty check prime brass outer furry razor
+	0x1311164,0x13122a4,0x185bd88,0x11a3083,0x009ba90,0x0d25407,0x0b45402,0x11012d2, // elect evict imply demur quota haven cavil swear
+	0x0f65222,0x07351c3,0x0b25406,0x0d71816,0x0d72c12,0x0430e8d,0x0c24407,0x0714d0f, // crump dough gavel wagon salon nudge harem pitch
+	0x0d8bad2,0x0b43e8f,0x0b20ae4,0x186ba72,0x0d40402,0x0f465b4,0x0d21290,0x13a3a33, // sworn pupil excel stony cabin unzip queen trout
+	0x0fc2dcf,0x079c404,0x0c8ba72,0x0b44db4,0x1123c13,0x1124da4,0x035a0e2,0x137b860, // polyp earth storm until taper enter child adopt
+	0x117350c,0x189cc05,0x1854a87,0x04a8221,0x1322d05,0x0462172,0x136a166,0x0301233, // minor fatty husky brave filet slime glint tread
+	0x0b01272,0x0b01891,0x1391286,0x18892a4,0x185468c,0x04880f2,0x048b9f2,0x13921c7, // steal regal guest every murky share spore hoist
+	0x0c75e81,0x11235a8,0x1124e6e,0x185b103,0x0b2548b,0x0203292,0x13a35c3,0x135a272, // buxom inner otter dimly level sumac donut stilt
+	0x0069220,0x13210f2,0x01a4452,0x1813405,0x1862172,0x0b8808f,0x185ad12,0x07145cf, // arena sheet scrub fancy slimy pearl silly porch
+	0x0e33503,0x0043c92,0x0458580,0x18180f2,0x0301221,0x1102225,0x0d32091,0x188a003, // dingo sepia amble shady bread friar reign dairy
+	0x0b5a290,0x1293a22,0x0373a21,0x1120693,0x11010f2,0x13449cf,0x0a68161,0x005ad15, // quill cross brood tuber shear posit blank villa
+	0x0a680f2,0x183190f,0x0a01225,0x07120f6,0x066b980,0x0b00885,0x0b590f2,0x035d1d6, // shank piggy freak which among fecal shell would
+	0x0401960,0x043440b,0x0808411,0x186b8c0,0x0495180,0x183ca81,0x0493dc2,0x0d73ad2, // algae large rabbi agony amuse bushy copse swoon
+	0x042a1aa,0x07151cf,0x1370a40,0x046816f,0x0db3a22,0x0d00634,0x041a1b2,0x1802c91, // knife pouch ascot plane crown urban snide relay
+	0x041a020,0x005b915,0x0702411,0x1604672,0x185ad03,0x0790222,0x1290180,0x038a0f3, // abide viola rajah straw dilly crash amass third
+	0x0a12233,0x1174e93,0x181b9d6,0x018d161,0x0522226,0x0e14903,0x04890f6,0x1894812, // trick tutor woody blurb grief disco where sassy
+	0x0710081,0x006d012,0x02431c2,0x0325162,0x0f21222,0x049c802,0x04c8226,0x052d1b2, // beach sauna comic clued creep caste graze snuff
+	0x0a13a25,0x03035c6,0x0a6d223,0x066ba2f,0x034468b,0x0b21272,0x04aac07,0x1126281, // frock gonad drunk prong lurid steel halve buyer
+	0x0bc3515,0x045a274,0x0b59192,0x0430060,0x188c5d6,0x189c813,0x0b009cb,0x0418233, // vinyl utile smell adage worry tasty local trade
+	0x0713505,0x0d21e40,0x0b00dcc,0x136d006,0x04ab962,0x13101a4,0x0d8b860,0x13901d1, // finch ashen modal gaunt clove enact adorn roast
+	0x0a111f2,0x0a410f2,0x189490c,0x136d226,0x0f739b2,0x189c40f,0x07151d3,0x004140c, // speck sheik missy grunt snoop party touch mafia
+	0x0420984,0x1804620,0x079d1d2,0x0343c15,0x185ac89,0x0a5d152,0x13919a0,0x0b00693, // emcee array south vapid jelly skulk angst tubal
+	0x11259cb,0x1391222,0x13012d2,0x1120702,0x048b860,0x181c413,0x08602d2,0x0714dcd, // lower crest sweat cyber adore tardy swami notch
+	0x0c73a26,0x07101d1,0x0714d07,0x066d1d8,0x0d32160,0x1818091,0x036ba25,0x0f04672, // groom roach hitch young align ready frond strap
+	0x042468f,0x0c58091,0x04a3495,0x0c882d2,0x11214ae,0x0d25492,0x1126223,0x1888103, // puree realm venue swarm offer seven dryer diary
+	0x185e223,0x0a68223,0x0344440,0x1818087,0x00990f3,0x0e9b689,0x0445d0f,0x079ba90, // dryly drank acrid heady theta junto pixie quoth
+	0x12a35c1,0x13580f2,0x046b48f,0x0369180,0x0ca4c03,0x035a281,0x0e6810f,0x05590f2, // bonus shalt penne amend datum build piano shelf
+	0x0430dcb,0x066a292,0x0c88091,0x0b045c2,0x0d23011,0x079c5d6,0x0c5824f,0x11215a8, // lodge suing rearm coral ramen worth psalm infer
+	0x13892ae,0x117600c,0x0343aae,0x041a166,0x0430254,0x04921cf,0x181b411,0x0a150e2, // overt mayor ovoid glide usage poise randy chuck
+	0x0a6822f,0x183c905,0x079b9d3,0x1121e64,0x04aba23,0x1122c68,0x07982d2,0x136a272, // prank fishy tooth ether drove idler swath stint
+	0x045a0f6,0x1301881,0x185bde0,0x0668172,0x1374413,0x1100c11,0x0e19222,0x04882c0, // while begat apply slang tarot radar credo aware
+	0x0d73402,0x132a0f2,0x1123113,0x1602f01,0x0ca4492,0x04244f3,0x0a01272,0x0202168, // canon shift timer bylaw serum three steak iliac
+	0x0a8a0f2,0x136d161,0x187be8f,0x0b0348f,0x13921c9,0x186b681,0x04780f2,0x1321881, // shirk blunt puppy penal joist bunny shape beget
+	0x0b210f6,0x1379060,0x136d272,0x045ba72,0x1903dd3,0x048b8e2,0x0455165,0x13738a0, // wheel adept stunt stole topaz chore fluke afoot
+	0x1303961,0x185ae81,0x0493483,0x1123c02,0x11211b2,0x1125dc1,0x0e0b289,0x043368b, // bloat bully dense caper sneer boxer jumbo lunge
+	0x04101f2,0x0b402a0,0x138b8f2,0x0f8d172,0x0b061cb,0x138a165,0x00ce50f,0x07135c2, // space avail short slurp loyal flirt pizza conch
+	0x0e7b093,0x0f73a23,0x049816f,0x0458501,0x0a6d16f,0x0ba38a0,0x1875412,0x0f21272, // tempo droop plate bible plunk afoul savoy steep
+	0x045a0c0,0x0450272,0x0b592c3,0x04a81aa,0x0388081,0x0493a20,0x0544dcc,0x0790192, // agile stake dwell knave beard arose motif smash
+	0x0b43a21,0x0488166,0x04ab8f2,0x1831801,0x186300c,0x0f602d2,0x066b960,0x1809a91, // broil glare shove baggy mammy swamp along rugby
+	0x1121816,0x0a10290,0x1305212,0x18501b2,0x1340483,0x043340c,0x0498152,0x079b50d, // wager quack squat snaky debit mange skate ninth
+	0x13951c9,0x0f60233,0x0d8d1f2,0x0b00c8c,0x0e8890c,0x0b20491,0x0a68165,0x0d8808b, // joust tramp spurn medal micro rebel flank learn
+	0x1140c0d,0x045bc0c,0x182b1c2,0x1343091,0x052d226,0x1124e44,0x139008b,0x0ba19cc, // nadir maple comfy remit gruff ester least mogul
+	0x0714c85,0x0495002,0x0d2280e,0x1672cc0,0x189808c,0x0429406,0x185e0f2,0x1120811, // fetch cause oaken aglow meaty gaffe shyly racer
+	0x0bb3a2f,0x05220f3,0x0d89272,0x18911cf,0x18509d1,0x13212d3,0x1392016,0x048a1f2, // prowl thief stern poesy rocky tweet waist spire
+	0x047ba26,0x0275407,0x1894c0f,0x185d233,0x189c5c5,0x189a083,0x04589b4,0x07922d2, // grope havoc patsy truly forty deity uncle swish
+	0x1125506,0x0d2122f,0x0b25481,0x11a308b,0x1328223,0x047b972,0x18735a0,0x0e3350b, // giver preen bevel lemur draft slope annoy lingo
+	0x0a01161,0x189cd03,0x185c682,0x1100c82,0x0434503,0x0db3a26,0x041c5c7,0x0b73a23, // bleak ditty curly cedar dirge grown horde drool
+	0x0a150f2,0x137e222,0x0d43282,0x0a13a72,0x18a8226,0x12a09cb,0x1120d16,0x0321221, // shuck crypt cumin stock gravy locus wider breed
+	0x049a290,0x04280e2,0x0438802,0x0f62161,0x0d32083,0x0369105,0x02419cb,0x0f010e2, // quite chafe cache blimp deign fiend logic cheap
+	0x041a164,0x0341911,0x0492c05,0x0b03491,0x041348f,0x181d9d1,0x13738f2,0x04c8161, // elide rigid false renal pence rowdy shoot blaze
+	0x18755a4,0x04949cf,0x0522221,0x112548d,0x138b820,0x04951cc,0x1850a8c,0x1852e92, // envoy posse brief never abort mouse mucky sulky
+	0x1889105,0x0040c8c,0x0a6d233,0x1390098,0x1101162,0x0a6d152,0x0f58052,0x189cd01, // fiery media trunk yeast clear skunk scalp bitty
+	0x1120d02,0x00581ca,0x1325683,0x04a1892,0x0461222,0x1123e92,0x0b5a226,0x1124ca0, // cider koala duvet segue creme super grill after
+	0x11236ce,0x1120584,0x0710091,0x18585cd,0x189bd84,0x03211f2,0x1893d06,0x11a0891, // owner ember reach nobly empty speed gipsy recur
+	0x0a13992,0x0301223,0x043448c,0x1394681,0x007bc0a,0x189a180,0x18500f2,0x11255c7, // smock dread merge burst kappa amity shaky hover
+	0x0b74402,0x138b9b2,0x0373712,0x136a005,0x136d007,0x11a3965,0x11400e2,0x1774c83, // carol snort synod faint haunt flour chair detox
+	0x16244f2,0x0493493,0x032216f,0x0a88290,0x185c681,0x0b255cd,0x0d25c16,0x0243a72, // shrew tense plied quark burly novel waxen stoic
+	0x1854489,0x199a161,0x1829081,0x024470b,0x1894a87,0x0b259d3,0x135a290,0x1672c81, // jerky blitz beefy lyric hussy towel quilt below
+	0x0e33501,0x187c916,0x0790221,0x046b852,0x13901d3,0x0b24804,0x1815012,0x04a2c15, // bingo wispy brash scone toast easel saucy value
+	0x04121f2,0x11735c7,0x049d1d1,0x0f880f2,0x181d801,0x0840c11,0x0b5d152,0x186b8ef, // spice honor route sharp bawdy radii skull phony
+	0x04a4a48,0x112180b,0x0b592d2,0x046a234,0x1894806,0x0b02233,0x008b965,0x1123df4, // issue lager swell urine gassy trial flora upper
+	0x0714c0b,0x1339916,0x0a12221,0x188cc91,0x185adc7,0x0b00883,0x1290226,0x0a100f2, // latch wight brick retry holly decal grass shack
+	0x00619c3,0x11255cc,0x1121483,0x11205d2,0x0244dee,0x1122222,0x066a315,0x03031cd, // dogma mover defer sober optic crier vying nomad
+	0x049d165,0x0e7bd07,0x0a880f2,0x1122223,0x049102e,0x0459a81,0x186d813,0x0a580e2, // flute hippo shark drier obese bugle tawny chalk
+	0x1390085,0x1818e91,0x0b00c8f,0x0588052,0x0b25222,0x1301161,0x0b00d13,0x0795172, // feast ruddy pedal scarf cruel bleat tidal slush
+	0x0d23092,0x181b516,0x189ca83,0x185ac12,0x0e72cc8,0x181c48d,0x0b25889,0x046b8f2, // semen windy dusty sally igloo nerdy jewel shone
+	0x04580f6,0x0d23307,0x0495020,0x04a1a85,0x1670564,0x0165222,0x189340f,0x0792c96, // whale hymen abuse fugue elbow crumb pansy welsh
+	0x0fa4712,0x0494493,0x04a8292,0x13a3006,0x066d2d2,0x0450223,0x0321225,0x048a0a0, // syrup terse suave gamut swung drake freed afire
+	0x138a0f2,0x13a3a26,0x1858c6e,0x043cd13,0x034016f,0x1863283,0x0c73a21,0x036a161, // shirt grout oddly tithe plaid dummy broom blind
+	0x07145d3,0x18611a4,0x0d400c0,0x066a313,0x185488f,0x1124d60,0x1126406,0x04585cd, // torch enemy again tying pesky alter gazer noble
+	0x1271e64,0x041a221,0x0b74ee4,0x1170883,0x18085c7,0x1390081,0x0c72068,0x1124e74, // ethos bride extol decor hobby beast idiom utter
+	0x04910f3,0x079dd12,0x0c88160,0x0490224,0x1831164,0x0a6d1f2,0x1123d0f,0x1858052, // these sixth alarm erase elegy spunk piper scaly
+	0x035b852,0x1899487,0x0a120e2,0x189b9d2,0x0b03402,0x186a0f6,0x0790172,0x0450290, // scold hefty chick sooty canal whiny slash quake
+	0x136a1c9,0x13792d2,0x041d22f,0x18a8087,0x0359116,0x0463085,0x0e9480b,0x04ca00c, // joint swept prude heavy wield femme lasso maize
+	0x04580f2,0x1624452,0x04245f2,0x1853992,0x052a0f6,0x1369052,0x0418166,0x13691f2, // shale screw spree smoky whiff scent glade spent
+	0x0c9222f,0x0453a72,0x1123d11,0x134062e,0x00709c2,0x135a286,0x12a3287,0x07950f2, // prism stoke riper orbit cocoa guilt humus shush
+	0x0458413,0x0a8a192,0x066ba36,0x18921cd,0x1389160,0x186a0f2,0x0498164,0x0d44891, // table smirk wrong noisy alert shiny elate resin
+	0x045b8f6,0x0713687,0x0b25d0f,0x1102dcf,0x0b24dc7,0x038bad2,0x1301162,0x0e3340c, // whole hunch pixel polar hotel sword cleat mango
+	0x000b291,0x182968f,0x185ad05,0x185ad01,0x079008b,0x13a3962,0x0413403,0x04982ae, // rumba puffy filly billy leash clout dance ovate
+	0x1320805,0x085a0e2,0x136a00f,0x112350b,0x0e44682,0x189ac12,0x0e40e80,0x04501b2, // facet chili paint liner curio salty audio snake
+	0x0458405,0x0a03962,0x0b2540d,0x138d1f2,0x0e9c88f,0x1862c01,0x0790165,0x03259b4, // fable cloak navel spurt pesto balmy flash unwed
+	0x185c404,0x0d8d0e2,0x1819096,0x0f65272,0x049008b,0x189cd16,0x187b116,0x05739f2, // early churn weedy stump lease witty wimpy spoof
+	0x1123412,0x0369161,0x0092c12,0x0a120f3,0x189c416,0x024340c,0x0488161,0x0145212, // saner blend salsa thick warty manic blare squib
+	0x0d739f2,0x040ba2f,0x0479222,0x0a101aa,0x04145c5,0x13a0483,0x1120e2e,0x049c807, // spoon probe crepe knack force debut order haste
+	0x0799093,0x13690c0,0x0d20d16,0x185a048,0x0412172,0x13719a8,0x0790162,0x1174689, // teeth agent widen icily slice ingot clash juror
+	0x0373961,0x041b820,0x16744f3,0x189a1b4,0x137550f,0x1379172,0x0f73a33,0x04881f2, // blood abode throw unity pivot slept troop spare
+	0x1125892,0x049440f,0x077c5cc,0x0898802,0x1850813,0x0b739f2,0x0d73083,0x181b9cc, // sewer parse morph cacti tacky spool demon moody
+	0x17235a0,0x0d41881,0x18ce685,0x0714c0f,0x1124c16,0x187b28b,0x0d43060,0x003118e, // annex begin fuzzy patch water lumpy admin omega
+	0x134310b,0x1808413,0x0e3880c,0x045c900,0x052a152,0x1244801,0x0a6816f,0x0434495, // limit tabby macho aisle skiff basis plank verge
+	0x0714dc1,0x0bb0222,0x18951cb,0x0d40172,0x0240682,0x0492011,0x0a10236,0x041a286, // botch crawl lousy slain cubic raise wrack guide
+	0x13921c5,0x0e23002,0x1120db4,0x1174c40,0x04a5491,0x03a0225,0x187c407,0x0f73852, // foist cameo under actor revue fraud harpy scoop
+	0x0162162,0x1121491,0x0d20d6e,0x0a89162,0x1100483,0x185ac13,0x0241e64,0x0d8a002, // climb refer olden clerk debar tally ethic cairn
+	0x045ae93,0x0ba38e6,0x185ad07,0x041d222,0x13881e0,0x0458052,0x1120d6e,0x0d4016f, // tulle ghoul hilly crude apart scale older plain
+	0x0c891f2,0x186a221,0x1370420,0x0da4491,0x1391290,0x0f92222,0x036d1c1,0x1341481, // sperm briny abbot rerun quest crisp bound befit
+	0x0db0223,0x049a292,0x1838a68,0x11210e2,0x0b21801,0x1291286,0x0303a21,0x0c722e0, // drawn suite itchy cheer bagel guess broad axiom
+	0x03880e2,0x13a3c02,0x136808b,0x0794407,0x0494682,0x03a3a2f,0x066a2d2,0x046a1ee, // chard caput leant harsh curse proud swing opine
+	0x049c813,0x12a3e8b,0x0e0b286,0x112350c,0x0d21226,0x0c900e2,0x0343d0b,0x0243dd3, // taste lupus gumbo miner green chasm lipid topic
+	0x1173220,0x0795221,0x0468222,0x0b0468c,0x0322c20,0x1340407,0x18949c1,0x112280c, // armor brush crane mural abled habit bossy maker
+	0x1854a83,0x18ce503,0x043cd0b,0x0a73a21,0x18ce409,0x1899505,0x0493492,0x1368106, // dusky dizzy lithe brook jazzy fifty sense giant
+	0x185c692,0x0b0188b,0x0b04c05,0x0a6d165,0x0d01881,0x046d22f,0x0b58192,0x1368172, // surly legal fatal flunk began prune small slant
+	0x052b852,0x12a45d3,0x186b50d,0x18255c2,0x1123d15,0x0d22813,0x0b045cc,0x04a19d5, // scoff torus ninny covey viper taken moral vogue
+	0x066a2ce,0x0d229d3,0x188cda4,0x079b9c1,0x1124dd5,0x041a0e2,0x0d41564,0x186b824, // owing token entry booth voter chide elfin ebony
+	0x073208d,0x0c4350c,0x0d72c8c,0x03211aa,0x1870883,0x005a1d5,0x045a9a0,0x1674620, // neigh minim melon kneed decoy voila ankle arrow
+	0x183ca8c,0x040a233,0x0490082,0x1121804,0x079c501,0x0778226,0x1120c6e,0x008c493, // mushy tribe cease eager birth graph odder terra
+	0x038a096,0x0322233,0x0a10162,0x1172dc2,0x07351d1,0x0732096,0x13a09b4,0x0458c0b, // weird tried clack color rough weigh uncut ladle
+	0x0f44672,0x1328222,0x12a350c,0x1820903,0x0d04d13,0x0340a8b,0x1100915,0x1291223, // strip craft minus dicey titan lucid vicar dress
+	0x0714d03,0x1893f06,0x009c80f,0x1829413,0x0460165,0x0f73ad2,0x0573960,0x1339912, // ditch gypsy pasta taffy flame swoop aloof sight
+	0x0453a21,0x1888093,0x13880e2,0x189dd12,0x181c5d6,0x11210f2,0x1123c8b,0x18249cd, // broke teary chart sixty wordy sheer leper nosey
+	0x0432e81,0x1175412,0x0f60162,0x1853685,0x18601c5,0x0245dd3,0x0368221,0x016516f, // bulge savor clamp funky foamy toxic brand plumb
+	0x1833503,0x049ce81,0x0b5a223,0x047a233,0x0f20901,0x1173493,0x0b5a22a,0x04945d6, // dingy butte drill tripe bicep tenor krill worse
+	0x0060223,0x0069307,0x0a6a0f3,0x0e44c11,0x00885c2,0x0b44801,0x0ca4452,0x0324a81, // drama hyena think ratio cobra basil scrum bused
+	0x046b8ef,0x138d1c2,0x0b23002,0x0573a2f,0x0388087,0x0b219a0,0x0b04c8f,0x189d1cf, // phone court camel proof heard angel petal pouty
+	0x01744f3,0x040e00c,0x0b04c85,0x06445f2,0x046a1f2,0x13a38f2,0x1320c02,0x0e8880c, // throb maybe fetal sprig spine shout cadet macro
+	0x1830dc3,0x11c4c12,0x1124411,0x0433501,0x0369233,0x189ce8d,0x137808b,0x1292180, // dodgy satyr rarer binge trend nutty leapt amiss
+	0x1342df2,0x078c70c,0x0798d16,0x11035d2,0x11259d3,0x0d74401,0x1125485,0x1125416, // split myrrh width sonar tower baron fever waver
+	0x0a881f2,0x0442c81,0x0f73972,0x0b23ee4,0x049b992,0x1122c01,0x04ab820,0x079c5cd, // spark belie sloop expel smote baler above north
+	0x1121416,0x1368052,0x0b5a225,0x07902c0,0x0a101b2,0x0bb3852,0x0b40225,0x132a223, // wafer scant frill awash snack scowl frail drift
+	0x0e0b10b,0x0413485,0x0b24dcc,0x041368e,0x0a01236,0x0b25491,0x0d72c13,0x117222f, // limbo fence motel ounce wreak revel talon prior
+	0x13591aa,0x0e5ac82,0x0450165,0x06a0483,0x041b9a0,0x0462222,0x04aac12,0x13a3852, // knelt cello flake debug anode crime salve scout
+	0x04a0588,0x185350f,0x04a8272,0x04a1815,0x0a138e2,0x1339905,0x0e20d15,0x046ba72, // imbue pinky stave vague chock fight video stone
+	0x0710093,0x1329162,0x1393a25,0x0db022f,0x189b9c1,0x13922d3,0x00235e0,0x052a272, // teach cleft frost prawn booty twist apnea stiff
+	0x00c816f,0x0430c8b,0x0a012d3,0x03881c1,0x1368226,0x0240c8c,0x0d70801,0x0458402, // plaza ledge tweak board grant medic bacon cable
+	0x0bb0221,0x0a6d172,0x187c811,0x0ca45c5,0x046ba23,0x0d231d6,0x12a0a8c,0x13901c1, // brawl slunk raspy forum drone women mucus boast
+	0x1818dd3,0x0d255c2,0x1173293,0x1125233,0x0798236,0x0b58272,0x0c01272,0x0b022e0, // toddy coven tumor truer wrath stall steam axial
+	0x112468f,0x185a003,0x0b40233,0x043890d,0x185808c,0x0412289,0x0d72f0d,0x0f6516f, // purer daily trail niche mealy juice nylon plump
+	0x188c48c,0x0b40165,0x0b03c0f,0x13010f6,0x188c481,0x11259c2,0x1311224,0x049d221, // merry flail papal wheat berry cower erect brute
+	0x183188b,0x047a1b2,0x1623512,0x1122152,0x186b48f,0x187b289,0x185ac11,0x0088594, // leggy snipe sinew skier penny jumpy rally umbra
+	0x1888052,0x0c20dcc,0x1293a26,0x0d022a0,0x0321226,0x0d44c12,0x02435d3,0x005440f, // scary modem gross avian greed satin tonic parka
+	0x052a1b2,0x034550b,0x0a88272,0x0f65233,0x1818d06,0x0495091,0x0e70413,0x0343aa0, // sniff livid stark trump giddy reuse taboo avoid
+	0x049ba90,0x0b45483,0x0d2290b,0x1293966,0x1126006,0x1324481,0x04921cd,0x0368166, // quote devil liken gloss gayer beret noise gland
+	0x1358083,0x066a172,0x1173291,0x00891ee,0x07320f3,0x00335d3,0x0488165,0x036d1d6, // dealt sling rumor opera thigh tonga flare wound
+	0x049a0f6,0x1852e81,0x041d264,0x04945c7,0x0014502,0x1818c0f,0x17705a8,0x18ce505, // white bulky etude horse circa paddy inbox fizzy
+	0x0d40226,0x13892e4,0x0434692,0x0c01166,0x045ac81,0x0eaac12,0x0795222,0x1345225, // grain exert surge gleam belle salvo crush fruit
+	0x187bc12,0x1122813,0x1310233,0x046a2ae,0x18521f2,0x0a68225,0x1819091,0x079ad05, // sappy taker tract ovine spiky frank reedy filth
+	0x0c901f2,0x04a8087,0x0e0b00c,0x1339911,0x0a68162,0x1395233,0x0d2328b,0x046c5c1, // spasm heave mambo right clank trust lumen borne
+	0x0a739f2,0x0415012,0x1120580,0x043cc0b,0x1304402,0x11245c2,0x189c503,0x185e172, // spook sauce amber lathe carat corer dirty slyly
+	0x17414a0,0x1872d60,0x136a013,0x0f210f2,0x185350a,0x185b9d6,0x04ad00c,0x066d165, // affix alloy taint sheep kinky wooly mauve flung
+	0x1338818,0x0322225,0x0b40290,0x136d221,0x1862226,0x18ac682,0x1821802,0x0493511, // yacht fried quail brunt grimy curvy cagey rinse
+	0x0415083,0x0498272,0x0f90226,0x1852d0c,0x0d74901,0x1328226,0x181b412,0x049c801, // deuce state grasp milky bison graft sandy baste
+	0x0a90165,0x0430c87,0x185c506,0x07902d2,0x18235c1,0x047d1c2,0x1670da4,0x1171c20, // flask hedge girly swash boney coupe endow abhor
+	0x0712c96,0x0418161,0x1339913,0x0491086,0x112490c,0x079c50c,0x03a3962,0x0b00402, // welch blade tight geese miser mirth cloud cabal
+	0x071108b,0x0493962,0x079b493,0x0d0088f,0x1343a23,0x0b40226,0x046b962,0x0492286, // leech close tenth pecan droit grail clone guise
+	0x077ac11,0x0e33413,0x1818d01,0x079a192,0x11259cc,0x042600f,0x0544492,0x0478223, // ralph tango biddy smith mower payee serif drape
+	0x0799505,0x0a681f2,0x04c8166,0x1372d60,0x0a15233,0x0a0600a,0x12a4515,0x189c893, // fifth spank glaze allot truck kayak virus testy
+	0x0423c93,0x185ae85,0x0b035d9,0x0e8cc8c,0x188c682,0x0368226,0x0e4b401,0x0d722e0, // tepee fully zonal metro curry grand banjo axion
+	0x0b26481,0x11a084e,0x0d400e2,0x0b0480d,0x18239c6,0x1122d05,0x0410221,0x1802d60, // bezel occur chain nasal gooey filer brace allay
+	0x024068f,0x0d25411,0x030116f,0x07901a6,0x1850165,0x071368c,0x185ae83,0x066a144, // pubic raven plead gnash flaky munch dully eking
+	0x066a0f3,0x0a6a172,0x188c687,0x13290f3,0x0d8b8f2,0x1861b0f,0x0713411,0x066a236, // thing slink hurry theft shorn pygmy ranch wring
+	0x0d7308b,0x048b8f2,0x006300c,0x04cba25,0x112588d,0x045e272,0x04939cc,0x0244da0, // lemon shore mamma froze newer style moose antic
+	0x0db3a23,0x0d01895,0x12910e2,0x187be86,0x0d721b4,0x112548b,0x188c5cb,0x0430188, // drown vegan chess guppy union lever lorry image
+	0x1808402,0x0345223,0x13102e4,0x079d233,0x1823dc3,0x11011f2,0x0322222,0x04620e2, // cabby druid exact truth dopey spear cried chime
+	0x186ba22,0x0a6d272,0x0343113,0x0714c01,0x0435006,0x1174dd1,0x0a10222,0x04ac682, // crony stunk timid batch gauge rotor crack curve
+	0x049cc0b,0x0714d16,0x0713681,0x0b23c91,0x0b455a0,0x18781d2,0x1124c8c,0x079ba21, // latte witch bunch repel anvil soapy meter broth
+	0x1858c0c,0x0322223,0x0469052,0x0db39aa,0x006180c,0x13939d1,0x0d031d6,0x066b8f3, // madly dried scene known magma roost woman thong
+	0x071368f,0x189c80f,0x186d9c3,0x03011aa,0x0b8a0f6,0x0343c11,0x0668162,0x11219a0, // punch pasty downy knead whirl rapid clang anger
+	0x04aa223,0x182b9c6,0x0b40184,0x0244a8c,0x052d272,0x0f21161,0x1120d11,0x001088c, // drive goofy email music stuff bleep rider mecca
+	0x0e42dc5,0x0fa4c92,0x0e94495,0x0790290,0x006d005,0x1863286,0x187bc07,0x185d88d, // folio setup verso quash fauna gummy happy newly
+	0x1894a85,0x0242c91,0x00a8286,0x189cc11,0x0430e85,0x11a3085,0x0f8a0e2,0x049c5c5, // fussy relic guava ratty fudge femur chirp forte
+	0x080a160,0x046a0f6,0x189cc8f,0x185adc6,0x134016f,0x0a11165,0x0d72c85,0x038d1c6, // alibi whine petty golly plait fleck felon gourd
+	0x0db3a21,0x0ca44f3,0x12a0905,0x0790272,0x1888883,0x1124916,0x009b689,0x1174915, // brown thrum ficus stash decry wiser junta visor
+	0x136d003,0x0424452,0x0b23d88,0x13402c0,0x129122f,0x04938f6,0x0e0c693,0x0f73a72, // daunt scree impel await press whose turbo stoop
+	0x0a011f2,0x183340c,0x066a304,0x1322da8,0x046ba22,0x0492e8f,0x18949cc,0x0340272, // speak mangy eying inlet crone pulse mossy staid
+	0x0413487,0x071350f,0x1818c93,0x185ae92,0x048b9b2,0x0d23d11,0x18b39b2,0x0244e60, // hence pinch teddy sully snore ripen snowy attic
+	0x066a1c6,0x071008b,0x079d1cc,0x036d1c7,0x0f65162,0x0b035d3,0x1371901,0x0b4448f, // going leach mouth hound clump tonal bigot peril
+	0x041110f,0x0460161,0x049d007,0x03221f2,0x0340db4,0x0e8cda8,0x0b04801,0x046a0f2, // piece blame haute spied undid intro basal shine
+	0x0e50886,0x0e20dd1,0x0388286,0x1121272,0x18601cb,0x0f60052,0x0c04452,0x185b40c, // gecko rodeo guard steer loamy scamp scram manly
+	0x0e5ac87,0x136d015,0x0d01a2e,0x0b04485,0x0a139aa,0x008cee4,0x0e1b5c2,0x1378060, // hello vaunt organ feral knock extra condo adapt
+	0x185ad16,0x0052dcf,0x0d76011,0x138a152,0x079a005,0x0e945d3,0x0714c0c,0x181448c, // willy polka rayon skirt faith torso match mercy
+	0x0343c93,0x0a21172,0x1124911,0x13ba2d3,0x041008f,0x0795165,0x189cc02,0x0d419cb, // tepid sleek riser twixt peace flush catty login
+	0x1311124,0x11219d1,0x0b05511,0x0444db4,0x1341491,0x009c5c0,0x135d060,0x0430e89, // eject roger rival untie refit aorta adult judge
+	0x11259d1,0x1894e20,0x0b04691,0x04a80f2,                                             // rower artsy rural shave
+};
+
+static const uint32_t wordle_letter_masks[12972] = {
+	0x0000099,0x0000901,0x00200c1,0x00a0101,0x0000007,0x0000107,0x0040007,0x0080023,0x0000403,0x0009003,0x000200b,0x0040083,0x0040403,0x1000003,0x0040003,0x000001b,
+	0x0040013,0x0000017,0x0001013,0x0020013,0x0000813,0x0060013,0x00c0013,0x0040113,0x0020813,0x0040813,0x0080813,0x0404803,0x0005083,0x0005083,0x0004903,0x0005003,
+	0x0006003,0x002400b,0x0024013,0x0021003,0x1020003,0x0021103,0x0022103,0x0060103,0x1040013,0x00c0103,0x0102003,0x0102013,0x01c0003,0x2100003,0x1040013,0x1041003,
+	0x0040105,0x0020105,0x0040005,0x1004005,0x0020017,0x0060015,0x0080015,0x0020085,0x000009d,0x0040095,0x0004085,0x004010d,0x100010d,0x0002145,0x0002105,0x0000415,
+	0x0020415,0x0041015,0x0001105,0x000201d,0x0042015,0x0004405,0x000480d,0x002001d,0x0060015,0x0064005,0x008001d,0x0082105,0x0086005,0x1040805,0x0440009,0x1040009,
+	0x008400b,0x0800009,0x0000019,0x0020019,0x0004109,0x0000819,0x0001019,0x0002089,0x0100119,0x0044109,0x00c0109,0x0003009,0x0003019,0x0801109,0x000400b,0x0406009,
+	0x2004019,0x0020009,0x0020019,0x0141009,0x0100509,0x010200d,0x01c0009,0x0600019,0x1080009,0x2000019,0x2040019,0x0000115,0x0040019,0x0040151,0x0046011,0x0020111,
+	0x0064011,0x0060111,0x0000829,0x0020021,0x0060021,0x0020031,0x0000a21,0x0024031,0x00a0121,0x0064021,0x0001041,0x0001141,0x0060041,0x00c0041,0x0200051,0x2000051,
+	0x0002051,0x0060051,0x0020051,0x0000151,0x0020141,0x0024041,0x1020041,0x00400c1,0x0000941,0x0044141,0x0041141,0x00c0141,0x0080141,0x0000851,0x0080851,0x1000851,
+	0x0004841,0x0140841,0x0041041,0x0004051,0x0006051,0x0046041,0x0004049,0x0020141,0x0022141,0x0064041,0x0100059,0x0140051,0x0102041,0x0180141,0x0008091,0x0082091,
+	0x00001c1,0x0002189,0x00021c1,0x0082181,0x0004889,0x0100881,0x0120081,0x0040109,0x0000119,0x0040119,0x0004109,0x0044109,0x1020111,0x0040141,0x00801c1,0x0000919,
+	0x0001119,0x0021111,0x0002111,0x0002141,0x0004901,0x0020119,0x0020111,0x0062101,0x00a0181,0x00e0101,0x0080185,0x01c0101,0x0220111,0x1000111,0x2000911,0x0040311,
+	0x0200301,0x0100241,0x0402201,0x0040411,0x0000c11,0x0002411,0x0002541,0x0080501,0x0040401,0x0008801,0x0000c05,0x0005801,0x0002809,0x0002811,0x0002841,0x0042801,
+	0x0082801,0x0008801,0x0048801,0x1020801,0x0080811,0x1040801,0x0040803,0x0000813,0x000090d,0x0044805,0x0000819,0x0020819,0x0004809,0x0000c15,0x0040815,0x0040831,
+	0x0080831,0x0008891,0x0440811,0x1000811,0x0040821,0x0000841,0x0040841,0x0000949,0x0002941,0x0024841,0x0101841,0x0040901,0x0040921,0x0002911,0x00c0901,0x1000901,
+	0x0000d11,0x0044c01,0x1000c09,0x1000c01,0x0000811,0x0000811,0x0040901,0x0004809,0x1000801,0x0001881,0x0041801,0x0001891,0x0041811,0x0101809,0x0101841,0x0044809,
+	0x0004819,0x0044811,0x0004881,0x0006901,0x0044801,0x0404811,0x0084881,0x00c4801,0x0100801,0x0141801,0x0120811,0x0220801,0x1400801,0x0041081,0x0003101,0x0081011,
+	0x0181001,0x0003003,0x0081103,0x0045003,0x1021003,0x0001013,0x0021011,0x0003011,0x0043011,0x0083011,0x0041101,0x0001115,0x0001105,0x0001119,0x0005109,0x0041109,
+	0x0041111,0x0001141,0x0005141,0x0003111,0x0007101,0x0043101,0x0061101,0x0041801,0x0003001,0x0007001,0x0045001,0x0003101,0x0003105,0x0007101,0x0045401,0x0005811,
+	0x00a5001,0x0125001,0x0205011,0x0485001,0x0009019,0x0109801,0x00a1101,0x0101405,0x1041801,0x0002001,0x0082001,0x0006085,0x0002815,0x0006005,0x0026009,0x0022011,
+	0x0002811,0x0082011,0x0042041,0x0006841,0x00021c1,0x0002911,0x0042901,0x0003101,0x0003101,0x0006101,0x0042111,0x0022411,0x0042481,0x0142401,0x0042801,0x0002801,
+	0x0042001,0x0082001,0x0046001,0x0006811,0x1007001,0x0042011,0x0082011,0x00a2001,0x00c2001,0x0082019,0x00c2011,0x00c2101,0x00a2001,0x00a2011,0x10c2001,0x0122001,
+	0x1006001,0x0008015,0x0008051,0x0008109,0x1008009,0x1048001,0x0008411,0x0008411,0x0068011,0x00a8011,0x1028011,0x0028041,0x0048181,0x000a101,0x000c901,0x0048181,
+	0x0049101,0x000c019,0x004c009,0x000c001,0x00ac001,0x0008801,0x1008001,0x0008811,0x002c001,0x0108101,0x1108001,0x0068011,0x0048011,0x0048101,0x004c001,0x0088019,
+	0x00a8011,0x0110011,0x0150001,0x0020003,0x0060401,0x0021011,0x0060001,0x0060003,0x002001d,0x0020185,0x0064005,0x0160005,0x002001b,0x0020109,0x0020019,0x0020011,
+	0x0020811,0x0020011,0x0060011,0x0020015,0x0020019,0x0020019,0x1020031,0x0020115,0x0022011,0x0028011,0x0020011,0x00a0011,0x00e0011,0x00a0011,0x0020841,0x0022041,
+	0x0020941,0x0020851,0x0024841,0x0026041,0x00a4041,0x0160041,0x00a0081,0x0060101,0x0020911,0x0020501,0x0060901,0x00a4101,0x0060181,0x0020419,0x0020819,0x0060811,
+	0x0021019,0x0021011,0x00a1011,0x0021901,0x0062001,0x01a2001,0x0024003,0x0024081,0x0024109,0x0068001,0x002a011,0x0020081,0x0060001,0x00a0011,0x0060101,0x2024001,
+	0x0060019,0x0060011,0x1060011,0x0060101,0x00a0801,0x00a0811,0x00a0105,0x00e0101,0x0120091,0x0161001,0x0220801,0x0220011,0x0264001,0x1060801,0x0042001,0x0046005,
+	0x0140005,0x004010d,0x0040099,0x0040091,0x00c0091,0x0040419,0x0060411,0x0044501,0x0044401,0x004a011,0x0068011,0x0048105,0x0048111,0x0048101,0x006c001,0x0040101,
+	0x0041001,0x0040011,0x2040011,0x00c4001,0x00e0011,0x00e0101,0x01c2001,0x0160001,0x1440001,0x0441101,0x1040801,0x00c8001,0x1880001,0x0080141,0x0080901,0x1081101,
+	0x00c0801,0x0083001,0x00c1001,0x00c5001,0x00c4005,0x0084411,0x00c4401,0x00c5001,0x1085001,0x1086001,0x108c001,0x00a0101,0x00a8101,0x0088001,0x00a0001,0x01c0001,
+	0x0100009,0x0120051,0x01800c1,0x0140801,0x0100905,0x0104901,0x0144801,0x0101901,0x0142011,0x01c2001,0x0120011,0x0120801,0x0120001,0x0160001,0x0120111,0x0160011,
+	0x0120105,0x0160101,0x0121001,0x01c4001,0x0902101,0x0200811,0x0282001,0x02c0001,0x0240811,0x0242011,0x0260011,0x0240041,0x0202111,0x0206101,0x0240111,0x0244101,
+	0x2200111,0x0644001,0x3200011,0x0422001,0x0484001,0x0600011,0x1440001,0x0440809,0x0400811,0x0484011,0x0402141,0x1421001,0x0402019,0x0422011,0x0444801,0x0424401,
+	0x0840811,0x0800911,0x0840901,0x0802141,0x0880111,0x0800819,0x0840811,0x0803001,0x0803011,0x0804109,0x0806011,0x0846001,0x1040081,0x1000001,0x1008811,0x1020051,
+	0x1042101,0x1086001,0x1060011,0x1020111,0x2042001,0x2000119,0x2004109,0x2002111,0x2006801,0x2004105,0x2004811,0x2046001,0x2084011,0x2084081,0x2100501,0x2122001,
+	0x3120001,0x3000041,0x3001011,0x3041001,0x000001b,0x0040803,0x0040003,0x0000813,0x0040013,0x0000403,0x0004003,0x0100803,0x0140003,0x0000007,0x0004007,0x1000007,
+	0x0000087,0x0040087,0x0040407,0x100000b,0x0040813,0x0040023,0x1000023,0x00c0023,0x00400c3,0x0000153,0x00c0083,0x0140083,0x0180083,0x0040903,0x0022103,0x0040103,
+	0x0080183,0x00c0103,0x2000103,0x2000113,0x0002203,0x0020203,0x0020303,0x0140203,0x000041b,0x0002413,0x0040413,0x0020403,0x0040803,0x004080b,0x100080b,0x000081b,
+	0x0040813,0x0040c03,0x1000c03,0x0040803,0x1000803,0x0041803,0x0004803,0x0040803,0x0080903,0x0102803,0x0140803,0x0001103,0x0002403,0x0006007,0x0042007,0x000200b,
+	0x000208b,0x004200b,0x100200b,0x000201b,0x0042013,0x0042043,0x0002103,0x0042403,0x0042003,0x00c2003,0x0182003,0x1082003,0x1002003,0x0148003,0x0020013,0x0060003,
+	0x1020003,0x0020007,0x002001b,0x002400b,0x006000b,0x102000b,0x002001b,0x0020013,0x0060013,0x0020123,0x0060023,0x0020107,0x0060403,0x1020403,0x0061003,0x1021003,
+	0x0062003,0x1022003,0x0068003,0x0020003,0x0020013,0x0024003,0x1020003,0x1020013,0x0042003,0x004001b,0x0042013,0x0060013,0x0040013,0x0044083,0x0040303,0x0040403,
+	0x0046003,0x0040013,0x0040103,0x0044003,0x1040003,0x00c0003,0x00c0103,0x00c4003,0x00c0003,0x008001b,0x00c0013,0x00c0083,0x0080503,0x0080003,0x00c0003,0x0180003,
+	0x014000b,0x0140403,0x0100c03,0x0160003,0x0202103,0x044000b,0x0440403,0x0440803,0x0442003,0x0460003,0x1480003,0x100001b,0x1020013,0x1040013,0x1000813,0x10c0003,
+	0x2020003,0x2004003,0x004001b,0x0040413,0x1000413,0x0040813,0x0041013,0x1001013,0x0006013,0x0042013,0x1002013,0x0020013,0x0060013,0x0080093,0x00c0013,0x1080013,
+	0x0140013,0x0180013,0x0900013,0x000c012,0x0008017,0x0000416,0x0040416,0x000001b,0x000081a,0x004001a,0x040001a,0x000111a,0x100001a,0x000011a,0x0040032,0x0048012,
+	0x0060012,0x1020012,0x00c0012,0x0004072,0x000005b,0x0020053,0x0001052,0x0084052,0x0101052,0x0000152,0x1000152,0x0042112,0x0000493,0x0000893,0x0020813,0x1000813,
+	0x0000812,0x0000853,0x0040812,0x0006812,0x00c0812,0x000101b,0x0041013,0x0801112,0x010101a,0x004201a,0x100201a,0x0042012,0x0082012,0x0002053,0x0042112,0x0002012,
+	0x0002112,0x1002012,0x0086012,0x00c2012,0x1082012,0x0088013,0x1020013,0x0060012,0x0060052,0x0024412,0x0060412,0x0021012,0x0061012,0x0024012,0x1020812,0x00c0013,
+	0x0440013,0x0040012,0x0040012,0x00c0112,0x0045012,0x00c4012,0x00c0112,0x00c0012,0x00c0013,0x008001a,0x00c0012,0x00c0092,0x008011a,0x0086012,0x0080013,0x1080012,
+	0x0220012,0x0224012,0x0300012,0x1200012,0x0480012,0x0400152,0x2040012,0x2000912,0x3000012,0x0040183,0x0000383,0x00020c3,0x00c0083,0x0040892,0x0084082,0x0102083,
+	0x01c0082,0x0000187,0x0000903,0x1000903,0x0040102,0x0040112,0x1000106,0x0040116,0x000011a,0x002011a,0x004011a,0x008011a,0x004010a,0x000610a,0x000091a,0x0060112,
+	0x0004122,0x0040122,0x1000122,0x000012a,0x0000153,0x0040142,0x1000142,0x00001c3,0x00801c2,0x1000942,0x0044142,0x0104302,0x000051a,0x0020512,0x0040512,0x0000512,
+	0x0004902,0x1000902,0x000091a,0x0040912,0x1000942,0x0040d02,0x0040902,0x0001183,0x0041103,0x0005102,0x0002903,0x000210a,0x004210a,0x0022112,0x0042112,0x0042142,
+	0x1002142,0x0082102,0x0042502,0x00c2102,0x0044142,0x0086102,0x0084103,0x000811a,0x000c10a,0x006010a,0x0060502,0x0020912,0x0060902,0x0064102,0x0060102,0x0060112,
+	0x1060102,0x0040112,0x0040502,0x0045102,0x0080186,0x00a0112,0x00c0112,0x00c4102,0x0184102,0x10c0102,0x0080112,0x00c0102,0x0200103,0x1200102,0x2040112,0x2004102,
+	0x3000102,0x0040803,0x004080b,0x100080b,0x0020813,0x0040813,0x0000823,0x0040843,0x0040883,0x0002903,0x0041803,0x00a0803,0x0040813,0x0040883,0x0080813,0x00c0803,
+	0x0080803,0x010080b,0x0402803,0x0440803,0x1040803,0x0020813,0x0040812,0x0000896,0x0040812,0x0082812,0x00a0812,0x00c0812,0x00c0812,0x1040812,0x1001902,0x0002942,
+	0x0002902,0x0042902,0x1002902,0x0048902,0x00c0902,0x0080912,0x00c0902,0x0200912,0x0044802,0x0044806,0x0044842,0x0004c02,0x000c802,0x0024812,0x00c4802,0x0444802,
+	0x1404802,0x0140802,0x010081a,0x014080a,0x110080a,0x010081a,0x0140812,0x0180812,0x1100812,0x010090a,0x0101812,0x0102c02,0x0160802,0x1008812,0x0044003,0x0044403,
+	0x0064003,0x00a4003,0x00c4003,0x0004007,0x0004403,0x0044003,0x0004802,0x0044002,0x0004007,0x0004016,0x0004106,0x0004096,0x0044406,0x000401a,0x004401a,0x000405a,
+	0x000418a,0x000481a,0x004c012,0x00c4012,0x0104032,0x0004022,0x0044022,0x0006043,0x1004052,0x1004042,0x0004152,0x0004852,0x0104052,0x0144042,0x0004093,0x0044082,
+	0x0044902,0x0006142,0x0006502,0x0084112,0x000441a,0x0004492,0x0044412,0x0044402,0x0024803,0x0044803,0x004480a,0x0044812,0x0804902,0x0044802,0x0044802,0x00c4802,
+	0x0144802,0x0045003,0x0005012,0x0005002,0x0045002,0x0006016,0x004600a,0x000601a,0x0026012,0x0046012,0x0046042,0x0006112,0x0046402,0x0006012,0x1006002,0x2006003,
+	0x2006012,0x0004103,0x1004003,0x0044002,0x100400a,0x000401a,0x1004022,0x1004042,0x0044082,0x0044402,0x1004402,0x0044802,0x0045002,0x1005002,0x0006042,0x0046002,
+	0x002400a,0x0064002,0x0044012,0x00c4002,0x100c002,0x0024403,0x0024803,0x0064003,0x002401a,0x006400a,0x002401a,0x0024012,0x0024812,0x0024012,0x0064012,0x0024042,
+	0x0024106,0x0064402,0x0065002,0x0026003,0x0026002,0x00e4002,0x10a4002,0x20a4002,0x0044112,0x0044402,0x1044402,0x0046002,0x0146002,0x00c4003,0x0084812,0x00c4012,
+	0x1084082,0x0084012,0x00c4002,0x1084002,0x0104052,0x0144402,0x0184802,0x0146002,0x012400a,0x0124042,0x0126002,0x0144012,0x1144002,0x01c4002,0x020410a,0x0484003,
+	0x040401a,0x0424012,0x0444012,0x0484012,0x0404112,0x0444802,0x0406012,0x0464002,0x0444012,0x080401a,0x0806012,0x0844012,0x0804803,0x1884002,0x1024003,0x1104003,
+	0x100401a,0x1044022,0x1044042,0x1004803,0x1044002,0x1044002,0x2044002,0x0020103,0x0020087,0x0020407,0x00a0007,0x006000b,0x0060013,0x0060043,0x0020903,0x0060403,
+	0x1020403,0x0021013,0x0022013,0x0022403,0x0062003,0x00a2003,0x00e0003,0x00e0003,0x0220003,0x0220103,0x0460003,0x1820003,0x1060003,0x2020003,0x2020013,0x0021013,
+	0x002001a,0x006001a,0x0021012,0x0020012,0x0060012,0x002011a,0x0060112,0x0021012,0x0062012,0x00a2012,0x0020012,0x0060012,0x0220012,0x0460012,0x1060012,0x0020112,
+	0x0060112,0x0060142,0x0020502,0x0060502,0x0020902,0x0061102,0x0062102,0x0064102,0x0060112,0x0060102,0x00a0182,0x00e0102,0x00a0102,0x2020112,0x0024086,0x0024406,
+	0x006400a,0x00240c2,0x0064042,0x0025012,0x0025002,0x0026006,0x002600a,0x0024802,0x0064002,0x0064012,0x1064002,0x0464002,0x01200c2,0x0122102,0x01a0102,0x0120812,
+	0x0121012,0x0122042,0x0160402,0x01e0002,0x01e0002,0x01c0003,0x2100013,0x0100803,0x0140003,0x0100003,0x0100012,0x1100002,0x0140002,0x0100086,0x0104406,0x0140406,
+	0x0100406,0x014000b,0x014010a,0x014400a,0x0100023,0x0100032,0x0100122,0x0104022,0x0140022,0x1100022,0x0144022,0x1180022,0x0140882,0x0160082,0x0140502,0x01c0102,
+	0x0140412,0x0140802,0x1100842,0x0140c02,0x0100803,0x0140802,0x0140812,0x0105002,0x0141022,0x0109082,0x0149002,0x1109002,0x0142003,0x0102016,0x0106006,0x010201a,
+	0x010208a,0x014200a,0x018200a,0x010200a,0x110200a,0x0142042,0x1102042,0x0102103,0x0102212,0x1102202,0x0106402,0x0142402,0x0142002,0x01c2002,0x1182002,0x1102003,
+	0x1144002,0x1108002,0x0122003,0x0160003,0x0160002,0x016000a,0x01a0012,0x0120122,0x01200c2,0x0160042,0x0122102,0x0120403,0x0120412,0x0160402,0x0160802,0x0162002,
+	0x0124002,0x0168002,0x0130003,0x0124002,0x0160002,0x1120002,0x0160003,0x0160012,0x1140002,0x0140012,0x0140402,0x1140402,0x0140002,0x01c0102,0x01c0002,0x11c0002,
+	0x0184012,0x01c0012,0x0180812,0x0184082,0x01c0002,0x1180002,0x0180002,0x1180802,0x3100002,0x0402003,0x2400103,0x100001a,0x104001a,0x100041a,0x1040412,0x1060012,
+	0x1060802,0x1040102,0x10c0012,0x1400003,0x000001d,0x0040007,0x0020017,0x0004007,0x0004007,0x0020017,0x0040005,0x0040405,0x1000405,0x000001d,0x004001d,0x000005d,
+	0x100004d,0x000011d,0x004010d,0x002001d,0x0000015,0x0040015,0x0040035,0x0040025,0x000005d,0x0020055,0x0040055,0x0084045,0x0404085,0x004010d,0x0042105,0x002010d,
+	0x0006205,0x0102205,0x000041d,0x0040415,0x1000415,0x0040825,0x000090d,0x0000925,0x0800905,0x0040c05,0x0000805,0x0040805,0x0041805,0x1001805,0x0044805,0x0008805,
+	0x0048805,0x0200815,0x1800805,0x0003005,0x0041005,0x0041015,0x0041105,0x0045005,0x0009105,0x000d005,0x0049005,0x1009005,0x0141005,0x000201d,0x0002095,0x0022015,
+	0x0042015,0x0042045,0x000210d,0x0002005,0x0042005,0x0046005,0x00c2005,0x0086005,0x00c2005,0x1082005,0x0048005,0x000801d,0x0048015,0x0808015,0x0048085,0x2008105,
+	0x0008815,0x000e005,0x004c005,0x008c005,0x0028105,0x0108805,0x0028005,0x0024007,0x0060007,0x1020007,0x002010d,0x006000d,0x102000d,0x002001d,0x0020015,0x0060015,
+	0x00a0015,0x0820015,0x0060405,0x0020815,0x0060805,0x0062005,0x1022005,0x0024007,0x0025005,0x0026005,0x0028105,0x0068005,0x0060005,0x0060015,0x00a0005,0x00a0015,
+	0x00e0005,0x1220005,0x0040005,0x0044005,0x004001d,0x0040015,0x0040405,0x1040405,0x00c0005,0x0140005,0x00c0015,0x010000d,0x0140405,0x010080d,0x0140805,0x0141005,
+	0x0148005,0x0120105,0x0140005,0x0240005,0x020001d,0x0200815,0x0220015,0x0240015,0x0200115,0x040001d,0x0440405,0x0806005,0x2000015,0x000011e,0x0000815,0x0101014,
+	0x000001c,0x002001c,0x004001c,0x004011c,0x0000117,0x0000914,0x0040914,0x0000816,0x0000815,0x0000914,0x0040814,0x0005814,0x00c0814,0x0042014,0x0086014,0x00c2014,
+	0x0182014,0x0024814,0x0048014,0x0020114,0x002001c,0x0060014,0x0020054,0x0020115,0x0020114,0x0022014,0x0024014,0x0064014,0x00e0014,0x10a0014,0x0040014,0x00c0015,
+	0x00c0114,0x00c0014,0x1080814,0x2200014,0x0000095,0x0000485,0x0004085,0x000408d,0x004008d,0x00800a5,0x0040185,0x0040885,0x0041085,0x0002085,0x00020c5,0x0002485,
+	0x0008095,0x0048085,0x0088085,0x0020085,0x0020095,0x0020485,0x0020085,0x0060085,0x1020085,0x00c0085,0x0200095,0x0240085,0x0400485,0x0440085,0x1000085,0x1040085,
+	0x0008094,0x00400b4,0x0000495,0x0000895,0x0008894,0x0005094,0x0041094,0x0020094,0x00a0094,0x0080094,0x1200094,0x0440094,0x1400094,0x0004185,0x0040185,0x0040186,
+	0x0000185,0x0000184,0x0004184,0x0040184,0x0000994,0x0040584,0x0000994,0x0001186,0x0005184,0x0009184,0x0002194,0x00021c4,0x0002584,0x0006184,0x0042184,0x0048184,
+	0x0020584,0x0020984,0x0021184,0x0024184,0x0020184,0x00a0184,0x0120184,0x00c0184,0x0200194,0x0240184,0x1200184,0x2000184,0x0004084,0x0044084,0x000409c,0x00440c4,
+	0x0004984,0x0004484,0x1004484,0x0004885,0x0004984,0x0004884,0x000d084,0x0046084,0x00040a4,0x0004484,0x0005084,0x0006084,0x004c084,0x0084085,0x0084084,0x0184084,
+	0x0904084,0x0404484,0x0444084,0x0140086,0x01000a5,0x01000a4,0x01400c4,0x0141084,0x0120884,0x0120084,0x0140094,0x01c0084,0x1000894,0x1001094,0x100208c,0x0004906,
+	0x000011c,0x004011c,0x0040914,0x1000144,0x0000905,0x0040904,0x0021105,0x0801114,0x0082104,0x0042114,0x0052104,0x0046104,0x0008104,0x0060104,0x0060114,0x0060904,
+	0x0020104,0x0044104,0x1040104,0x00c0104,0x0080905,0x008011c,0x00a0114,0x00c0114,0x0240114,0x0280114,0x0200114,0x1200104,0x0000885,0x000081d,0x004080d,0x0040815,
+	0x0040845,0x0001815,0x0041805,0x0042805,0x0048805,0x0088805,0x0024805,0x00a0805,0x1020805,0x00c0805,0x00c0805,0x0180805,0x0200815,0x0200905,0x0440805,0x1040805,
+	0x0000c14,0x0000c14,0x0008814,0x0040834,0x0040854,0x0000d14,0x0041814,0x0008814,0x0088814,0x0200814,0x0440814,0x000091c,0x0040914,0x0080924,0x0001914,0x0002914,
+	0x0082904,0x0008914,0x0048904,0x0088904,0x00c0904,0x0005805,0x004480c,0x0004824,0x0044844,0x0004c14,0x0005806,0x000d804,0x0006c04,0x0046804,0x000c804,0x0084804,
+	0x004c804,0x0084814,0x00c4804,0x0124804,0x0144804,0x0444804,0x1004814,0x1044804,0x2004814,0x0140806,0x0140814,0x1100814,0x0102c04,0x1008814,0x000210d,0x0084005,
+	0x100400d,0x0004805,0x0044805,0x1004805,0x008c005,0x0024007,0x0084015,0x0084105,0x00c4005,0x0044006,0x1004006,0x0004107,0x0004816,0x2004007,0x0044005,0x0004104,
+	0x0004004,0x0044404,0x1004404,0x0044004,0x004400d,0x000401c,0x000401c,0x000601c,0x002401c,0x004401c,0x080401c,0x000600c,0x004401c,0x0044024,0x0004154,0x0006044,
+	0x0104054,0x0004087,0x0006094,0x0004094,0x00040c4,0x0044084,0x0044124,0x0006144,0x0044904,0x0046104,0x0064104,0x00c4104,0x000441c,0x0044414,0x0044805,0x1004806,
+	0x004480c,0x000481c,0x0044814,0x1004814,0x0004904,0x0006904,0x0044804,0x1004804,0x0004844,0x00c4804,0x2004805,0x0005015,0x0005805,0x0045005,0x0005016,0x0005106,
+	0x0005006,0x0045006,0x1005006,0x0025014,0x0045014,0x0805104,0x0005004,0x0045004,0x1005004,0x000d004,0x004d004,0x008d004,0x0085014,0x0145004,0x000601c,0x0046014,
+	0x1006014,0x0046024,0x0006045,0x0006054,0x0006044,0x0006105,0x0006104,0x0046404,0x1006404,0x0006014,0x0046004,0x0086014,0x0086004,0x0146004,0x0206004,0x0004084,
+	0x000401c,0x0004014,0x0024014,0x1004014,0x0044024,0x0044404,0x1004404,0x0044804,0x1004804,0x0005006,0x0045004,0x1005004,0x0046004,0x004c004,0x008c004,0x00c4004,
+	0x00c4004,0x2004014,0x000c805,0x100c005,0x000c01c,0x000e014,0x002c014,0x004c014,0x100c004,0x002c005,0x104c004,0x0114104,0x0025005,0x0024016,0x1024006,0x006400c,
+	0x002401c,0x0064014,0x1024014,0x0024144,0x0024105,0x0064404,0x1024404,0x0065004,0x0026104,0x0026004,0x0066004,0x0126004,0x006c004,0x0064014,0x0064004,0x0044014,
+	0x004401c,0x0044014,0x00c4014,0x1044014,0x0044114,0x00c4005,0x00c4014,0x00c4004,0x0086005,0x008401c,0x00c4014,0x00c4084,0x0084005,0x00c4004,0x010401c,0x014c004,
+	0x0124006,0x012400c,0x0124014,0x0164004,0x0184005,0x0184084,0x020401c,0x0244014,0x0206104,0x0404805,0x0406005,0x040401c,0x0444404,0x0444804,0x044c004,0x1424004,
+	0x0804015,0x0804805,0x080401c,0x0844014,0x0804106,0x1104005,0x100401c,0x1024014,0x110c004,0x200401c,0x2006014,0x2044014,0x3004014,0x2004114,0x0020805,0x0060007,
+	0x0060045,0x0020105,0x0020145,0x0020415,0x0021015,0x0061005,0x0062005,0x0028015,0x0068005,0x1028005,0x0020015,0x0460005,0x1060005,0x006001c,0x0020814,0x0060014,
+	0x0061014,0x0022015,0x0068014,0x1028014,0x0420014,0x0460014,0x0060105,0x0060106,0x0060114,0x0061104,0x0022114,0x0064104,0x0028114,0x0068104,0x0060114,0x00a0184,
+	0x00e0104,0x0024104,0x0064004,0x00a4024,0x0064044,0x0025006,0x0025014,0x0026404,0x0066004,0x0024804,0x0026004,0x006c004,0x0024014,0x00e4004,0x01a4004,0x0464004,
+	0x2024014,0x0120404,0x012400c,0x016000c,0x112000c,0x0160014,0x01a0014,0x01a0024,0x0122404,0x0124004,0x0120005,0x0160014,0x1160004,0x0320014,0x04a0084,0x1020014,
+	0x0082014,0x1100006,0x0100016,0x010001e,0x0120016,0x0140016,0x0180106,0x110000c,0x0104024,0x0140024,0x0140124,0x0102144,0x0140184,0x01c0104,0x0140414,0x0100884,
+	0x0180814,0x0900814,0x0140804,0x1100804,0x0141804,0x0108805,0x0180904,0x01c0804,0x1180804,0x0101014,0x110200c,0x0102114,0x0182104,0x01c2004,0x0108814,0x010810c,
+	0x0108005,0x1108004,0x01a0005,0x0160006,0x0120084,0x016000c,0x112000c,0x012001c,0x0120014,0x0160014,0x01a0014,0x0160024,0x0120105,0x0120114,0x0120904,0x0160804,
+	0x0162004,0x1122004,0x0160004,0x0160104,0x01e0004,0x0140014,0x1140084,0x0140404,0x0148004,0x1148004,0x0144004,0x0141004,0x0180084,0x01a0014,0x01c0014,0x1180014,
+	0x0182104,0x01c0104,0x0184004,0x1180004,0x0188004,0x0300014,0x2140014,0x0480084,0x1006005,0x1042005,0x100000d,0x1040005,0x1004804,0x102001c,0x1800904,0x1001015,
+	0x1021005,0x1041005,0x1041014,0x1005804,0x10c0004,0x10c0014,0x1086004,0x2060005,0x0040809,0x000000b,0x004001d,0x000008d,0x004040d,0x0000089,0x0040009,0x0044009,
+	0x0040029,0x1000029,0x0000049,0x1000049,0x0044049,0x0040889,0x0004509,0x0002119,0x0082109,0x0020419,0x0000819,0x0040819,0x0040909,0x0000819,0x00c0809,0x0003009,
+	0x0021009,0x0041019,0x0001019,0x0043009,0x0049009,0x1009009,0x100200d,0x0042049,0x0006109,0x0042409,0x1002009,0x00c2009,0x0020029,0x006000b,0x102000d,0x0020019,
+	0x0020019,0x0060019,0x0020049,0x0060049,0x002010d,0x0060109,0x0060409,0x1020409,0x0062009,0x0020019,0x00e0009,0x2020109,0x0040189,0x1040089,0x0080809,0x0080019,
+	0x00a0019,0x00c0019,0x00c4009,0x0084009,0x010001b,0x014000b,0x110000b,0x0140009,0x0180809,0x0160009,0x01c0009,0x0202019,0x0280109,0x0400089,0x0440009,0x0400019,
+	0x0402019,0x0440409,0x0442009,0x04c0009,0x1002009,0x100008d,0x1082009,0x2000019,0x2020019,0x2040019,0x0040019,0x0020119,0x0040819,0x0042019,0x0020019,0x0022019,
+	0x0060019,0x1020019,0x0040099,0x0200019,0x0440019,0x1400019,0x000005b,0x100001a,0x000081a,0x004001a,0x00c001a,0x010001a,0x012001a,0x014001a,0x100001a,0x000001d,
+	0x000003d,0x000201d,0x000441c,0x004041c,0x004401c,0x0000819,0x0040018,0x1000018,0x1000818,0x0041018,0x0042018,0x0048018,0x0020018,0x0060018,0x00c0018,0x0200018,
+	0x0240018,0x0080039,0x0004038,0x0040138,0x0004078,0x0040059,0x0101058,0x0140058,0x000011c,0x0040118,0x1000138,0x0040918,0x0041118,0x00c0118,0x0000418,0x0040418,
+	0x0004418,0x0000818,0x0040818,0x0040838,0x0080838,0x0040918,0x0040818,0x1000818,0x0044818,0x0008898,0x00c0818,0x0003019,0x0041018,0x000111c,0x0081118,0x000501a,
+	0x0005118,0x0045018,0x0089018,0x0022019,0x1002019,0x000209c,0x0042018,0x0082018,0x0042118,0x00c2018,0x1804018,0x00a0019,0x1020019,0x0020018,0x0060018,0x0020158,
+	0x0021019,0x0061018,0x0062018,0x1022018,0x0064018,0x0024018,0x1020018,0x00a0098,0x0260018,0x0840018,0x0040198,0x0040118,0x0040418,0x0040018,0x0240019,0x0200818,
+	0x0240118,0x0206018,0x0244018,0x0284018,0x0402019,0x0420019,0x0c00019,0x0400018,0x0840018,0x0800118,0x000008b,0x0040489,0x0040889,0x0020588,0x000418a,0x0004898,
+	0x0004888,0x0044888,0x0084188,0x0444088,0x0180188,0x008010d,0x0040909,0x0002119,0x2004109,0x004010a,0x000011c,0x002011c,0x004011c,0x008018c,0x004050c,0x100050c,
+	0x008410c,0x008010d,0x00c010c,0x108010c,0x1000108,0x0000118,0x0044108,0x00c0108,0x004011a,0x0040918,0x0002118,0x00c0118,0x0040128,0x00801c8,0x0040509,0x0000518,
+	0x0020518,0x0040518,0x1000518,0x0004908,0x0000908,0x0040908,0x000510a,0x0021118,0x0041118,0x0049108,0x0022109,0x0002118,0x0042118,0x0002158,0x0042148,0x000210c,
+	0x0042508,0x1002508,0x0002109,0x0046108,0x00c2108,0x0044908,0x0084109,0x1008108,0x004c108,0x0021109,0x0020118,0x0020518,0x0060508,0x0060908,0x00e0108,0x0040109,
+	0x004010c,0x004010c,0x1040188,0x0040508,0x0041118,0x0080909,0x00c0109,0x0080118,0x00c0118,0x10c0108,0x00c0108,0x3080108,0x0202109,0x0240109,0x0200118,0x0240118,
+	0x0240108,0x0202109,0x0244108,0x0284108,0x1200108,0x0402109,0x0800118,0x0880108,0x1040109,0x2002118,0x0002308,0x0042308,0x004400b,0x00c4009,0x100400a,0x004401a,
+	0x000411a,0x000480b,0x002400b,0x002400a,0x008408c,0x004440c,0x004400c,0x014400c,0x1004008,0x0044008,0x0044418,0x0064018,0x00c4018,0x0084098,0x0044028,0x0006049,
+	0x0044058,0x1004058,0x0004048,0x1004048,0x0004158,0x1004088,0x0084908,0x1004908,0x00c4108,0x0044208,0x000481c,0x000490c,0x0004818,0x0044818,0x0004909,0x0044808,
+	0x0005809,0x0024808,0x0044808,0x00c4808,0x0005809,0x0005018,0x0045018,0x000510c,0x0006089,0x0046009,0x0006018,0x0026018,0x0006049,0x0046048,0x0006408,0x0006009,
+	0x0006018,0x1006008,0x1046008,0x004400a,0x000401c,0x1004008,0x0044408,0x0004818,0x0044808,0x1004808,0x0045008,0x1005008,0x0006009,0x0026008,0x0064008,0x3004008,
+	0x004c009,0x000c018,0x002c018,0x004c018,0x0024009,0x002400b,0x006400a,0x0024018,0x0064018,0x002410c,0x0064108,0x0064408,0x1024408,0x0065008,0x1025008,0x006c008,
+	0x0064008,0x0064009,0x0064018,0x00e4008,0x10a4008,0x0044109,0x0044009,0x0044018,0x0044098,0x0064018,0x0044018,0x0044089,0x0084809,0x0084018,0x00a4018,0x00c4018,
+	0x1084008,0x0124009,0x010401c,0x014400c,0x0144408,0x0104809,0x0105009,0x0145008,0x014c008,0x0124009,0x0144018,0x01c4008,0x0204018,0x0206018,0x0224018,0x0244018,
+	0x0204118,0x0424009,0x0444008,0x0404018,0x0424018,0x0404118,0x0404818,0x0444808,0x1404808,0x0406009,0x0446008,0x044c008,0x0444018,0x04c4008,0x0804018,0x0844018,
+	0x0804118,0x1006018,0x1004808,0x2004018,0x2024018,0x2044018,0x006000b,0x002040d,0x002400d,0x0020029,0x0060049,0x0020909,0x0061009,0x00a2009,0x0068009,0x00e0009,
+	0x0220019,0x0460009,0x1060009,0x0020019,0x002041c,0x0020018,0x0020018,0x0060018,0x0060058,0x0060418,0x00a2018,0x0020018,0x00e0018,0x1060018,0x006010a,0x002011c,
+	0x0060118,0x1020908,0x0068108,0x00a8108,0x0024108,0x0024908,0x0024418,0x0024818,0x0025018,0x1026008,0x002400a,0x0024048,0x0024408,0x006c008,0x00ac008,0x0124408,
+	0x0464008,0x016000a,0x0160048,0x0161008,0x0128018,0x0160018,0x1160008,0x1920008,0x1020009,0x1060009,0x004400a,0x0045008,0x0140009,0x0140809,0x0142009,0x0160009,
+	0x010400a,0x010080d,0x018000d,0x014001c,0x014040c,0x110040c,0x01c000c,0x1100008,0x0100018,0x0140018,0x0140818,0x01c0018,0x0180018,0x0140028,0x0140028,0x0102148,
+	0x01c0108,0x0140409,0x0100418,0x0140418,0x0100409,0x010081c,0x0140818,0x0100909,0x0140808,0x0140818,0x0141009,0x010500a,0x014100a,0x0101409,0x1101408,0x0149008,
+	0x0103009,0x010208c,0x0142018,0x0142048,0x1102048,0x0142408,0x0106008,0x1102008,0x0142088,0x01c2008,0x0105108,0x0105008,0x0108018,0x0128018,0x0148018,0x0108818,
+	0x1108808,0x1108008,0x0120809,0x0160009,0x0120018,0x0160018,0x1120048,0x0162008,0x012400c,0x0164008,0x1124008,0x0120009,0x0160008,0x1120008,0x01e0008,0x0121008,
+	0x2120108,0x0140408,0x01c0008,0x0940018,0x0400809,0x0400819,0x0401809,0x0441009,0x0402049,0x0501009,0x040001a,0x0400918,0x0402118,0x1040009,0x1060018,0x1000418,
+	0x1040418,0x1000418,0x1006408,0x1002818,0x1042018,0x2044088,0x0020051,0x0000819,0x0040811,0x0002019,0x0060019,0x0020019,0x0060811,0x0062011,0x00a2011,0x00e0011,
+	0x0040019,0x0060011,0x0040011,0x0040811,0x00c0011,0x0080091,0x0200019,0x0240011,0x000001a,0x0080012,0x0046012,0x0004412,0x004001d,0x000009c,0x0040094,0x0044094,
+	0x0160014,0x0001019,0x0000058,0x0020058,0x0040058,0x0000918,0x00c0118,0x010001c,0x018001c,0x0080310,0x1042010,0x0202010,0x0242010,0x0000038,0x0040059,0x0060050,
+	0x00c0050,0x0020051,0x0000058,0x0020050,0x0041051,0x00021d0,0x0020118,0x0044118,0x0002150,0x0000518,0x0006510,0x0040918,0x0040910,0x0004318,0x0040411,0x0002911,
+	0x0002819,0x0042811,0x0000994,0x0002918,0x0001910,0x0000838,0x0000919,0x0082910,0x0003810,0x0004850,0x1004850,0x0006910,0x004c810,0x0008810,0x0042910,0x0180810,
+	0x0202811,0x0202810,0x0220810,0x0240810,0x0041015,0x0021013,0x1001013,0x0005052,0x0405012,0x0805012,0x0141012,0x0021010,0x0003018,0x0021050,0x1021010,0x0141010,
+	0x0041114,0x0061110,0x00c1110,0x0041011,0x0021010,0x0081010,0x0401010,0x1041010,0x0005310,0x0007050,0x0085010,0x0205010,0x00c9010,0x0101810,0x0121010,0x1001018,
+	0x1041018,0x0023011,0x0082011,0x0002018,0x0022018,0x0402018,0x0102018,0x0442010,0x0802130,0x0002115,0x0082910,0x0403010,0x0006050,0x0006510,0x0046810,0x0027010,
+	0x0446010,0x0026810,0x0442010,0x1042410,0x0082111,0x0122010,0x0122010,0x0206110,0x3003010,0x0064810,0x0046110,0x0088015,0x0048010,0x0008091,0x0048091,0x000c098,
+	0x002c090,0x0048114,0x000c018,0x008c010,0x0068110,0x0150010,0x0110118,0x0020113,0x0260010,0x0026050,0x0064050,0x00a4050,0x0160090,0x0020115,0x0020514,0x0060114,
+	0x0022150,0x0022018,0x0062010,0x0064010,0x0020018,0x0060010,0x01a0014,0x0124050,0x0360010,0x0222010,0x0220910,0x0060015,0x00c4014,0x0040910,0x0060411,0x0060410,
+	0x0042010,0x0040010,0x00c4014,0x00cc010,0x00e4010,0x0080051,0x0088011,0x00c0011,0x00c2010,0x0080891,0x0082090,0x1080890,0x00c0114,0x00c2011,0x0082110,0x0080810,
+	0x01c0110,0x0480010,0x1081011,0x01400d0,0x0100418,0x0108019,0x0164010,0x0144810,0x0242010,0x02a0010,0x02c0010,0x0204090,0x0240910,0x0280110,0x0204090,0x0460010,
+	0x04c0010,0x0404090,0x0400418,0x0841011,0x0880011,0x0840014,0x0801010,0x0801010,0x0800930,0x0840110,0x0802110,0x0802150,0x08c0110,0x0804018,0x0805010,0x0846010,
+	0x0888011,0x084c010,0x0900018,0x0940810,0x0920012,0x1040011,0x1060010,0x10c4010,0x1060011,0x1060010,0x1020110,0x1020110,0x2002110,0x1000023,0x000003d,0x0020035,
+	0x0040035,0x0000125,0x0080025,0x00c0025,0x1000029,0x0000039,0x0020039,0x0040039,0x0000079,0x0044029,0x0002031,0x1020031,0x0040021,0x1000021,0x1000061,0x0002161,
+	0x0084061,0x0040521,0x0040921,0x0002131,0x0042121,0x0060121,0x0000439,0x0020431,0x0040431,0x1000431,0x0000531,0x0020521,0x0000a21,0x0040821,0x0001039,0x0041031,
+	0x0002821,0x0042029,0x0042031,0x0002061,0x0006061,0x0042061,0x0042421,0x0006021,0x0046021,0x0103021,0x0030121,0x0020029,0x0020125,0x1020025,0x0060029,0x0020039,
+	0x0020031,0x0060031,0x0020831,0x0060821,0x0061021,0x0064021,0x0024021,0x0060031,0x00e0021,0x0040125,0x00c0121,0x00c0021,0x0080039,0x00c0031,0x1080821,0x00c4021,
+	0x0480021,0x01000e1,0x0100829,0x0142021,0x0120029,0x01c0021,0x0300031,0x0240021,0x0200831,0x0220031,0x0240031,0x0340021,0x0442021,0x1402021,0x0800039,0x0840031,
+	0x1000039,0x1020031,0x1002031,0x1020031,0x2000039,0x2040031,0x0040831,0x0020031,0x0060031,0x00a0031,0x0040031,0x00c0031,0x2000031,0x0040034,0x00800b4,0x0080134,
+	0x0040434,0x0800038,0x0040032,0x0040038,0x0040830,0x0042030,0x0060030,0x0040030,0x2000030,0x00010b0,0x0082130,0x00c0130,0x00008b4,0x0000938,0x0040830,0x1000830,
+	0x00c0830,0x1080830,0x0001831,0x0041030,0x1001030,0x0042038,0x1002038,0x0042130,0x0042430,0x1002030,0x00c2030,0x0044038,0x0004030,0x0020030,0x0060030,0x0020131,
+	0x1020830,0x0021130,0x0061030,0x0062030,0x1022030,0x0040030,0x00c0031,0x00c0030,0x10c0030,0x00c0031,0x0080038,0x00c0030,0x00a4030,0x0080031,0x00c0030,0x0480031,
+	0x0120031,0x0140038,0x0100038,0x1000038,0x1020030,0x1000830,0x2040030,0x3000030,0x0060121,0x00c0121,0x0024122,0x0040134,0x00001b4,0x01001a4,0x0002124,0x0044124,
+	0x0040138,0x0000178,0x0044128,0x0040130,0x0082130,0x0020130,0x0060130,0x00c0130,0x0000138,0x0020130,0x0040130,0x0040120,0x1000160,0x0044160,0x0000538,0x0040530,
+	0x0020921,0x00009a4,0x0000938,0x0040930,0x0000920,0x0040d20,0x0000930,0x0004920,0x0040920,0x0001920,0x0041920,0x0044920,0x0101920,0x0002125,0x0042128,0x0002138,
+	0x0042130,0x0042120,0x0042520,0x1002120,0x0046120,0x0024128,0x00501a0,0x0110130,0x0020138,0x0020130,0x0060130,0x0020130,0x0060520,0x0061120,0x0062120,0x1020120,
+	0x00a01a0,0x0040124,0x0040520,0x00c0120,0x10c0120,0x00801a4,0x1080920,0x0082121,0x0080130,0x00c0120,0x0220130,0x0240130,0x0800138,0x0840130,0x0880120,0x0000a38,
+	0x0040823,0x0000821,0x0040861,0x0040c21,0x0001821,0x0041821,0x1001821,0x0002831,0x0042821,0x0048821,0x1020821,0x00c0821,0x0200821,0x0402821,0x0440821,0x1400821,
+	0x1800821,0x1040821,0x0001831,0x0040831,0x0000c30,0x0020830,0x0040830,0x0040870,0x0001830,0x0120830,0x0440830,0x0800930,0x0804830,0x1040830,0x0040924,0x0000938,
+	0x0040930,0x0009920,0x0041920,0x0048920,0x0060920,0x0040d20,0x0080930,0x00c0920,0x0080920,0x0044822,0x0044824,0x0044830,0x0044860,0x0006860,0x004c820,0x0064820,
+	0x1024820,0x00448a0,0x0084821,0x0084830,0x0444820,0x0140822,0x0100838,0x0140830,0x1100830,0x1100c20,0x0109820,0x0124820,0x0120820,0x1180820,0x1180820,0x1000822,
+	0x1008830,0x1080830,0x0044821,0x0045021,0x00060b0,0x1004070,0x0004170,0x0004870,0x0104060,0x00460a0,0x0044128,0x0044920,0x0046120,0x0044828,0x1004830,0x0004921,
+	0x0004924,0x0004930,0x0044c20,0x1004c20,0x0045030,0x0006029,0x0046028,0x0106028,0x0046030,0x1006820,0x00c6020,0x0044028,0x1004028,0x0044820,0x00c4020,0x1084020,
+	0x0025021,0x0064022,0x1024022,0x0024028,0x0064028,0x0024830,0x0064030,0x0824030,0x0064420,0x1024420,0x0025030,0x0065020,0x00e4020,0x2024021,0x2024030,0x0044021,
+	0x0044030,0x0184021,0x0144028,0x0124030,0x0184030,0x0104830,0x0144820,0x0186020,0x0164020,0x01840a0,0x0204031,0x0444820,0x04840a0,0x0804038,0x0844030,0x0804130,
+	0x1004830,0x1006030,0x0060023,0x0020425,0x00a0025,0x0060061,0x0021121,0x0022025,0x0028031,0x0068021,0x0060021,0x00a0031,0x00a0121,0x00e0021,0x0160021,0x1060021,
+	0x0060030,0x00a0030,0x00a0130,0x0021038,0x0022031,0x0026030,0x0020030,0x00e0030,0x0060122,0x0020130,0x0060130,0x0060160,0x0060130,0x00e0120,0x00a01a0,0x00e0120,
+	0x00a0120,0x2020130,0x2020120,0x0064030,0x0064060,0x0066020,0x0024030,0x0026020,0x1024020,0x00640a0,0x0464020,0x1424020,0x0160060,0x0129020,0x01600a0,0x01e0020,
+	0x1020030,0x0120023,0x1100022,0x1140022,0x0140424,0x0140024,0x1100028,0x1100068,0x0140830,0x0124030,0x0140020,0x1100020,0x0100861,0x1100060,0x0100170,0x0104160,
+	0x0100870,0x1100860,0x0140060,0x0140320,0x0140820,0x0101038,0x0121030,0x0141030,0x0181030,0x0102128,0x0142028,0x1102028,0x0106060,0x0142060,0x0142420,0x0120821,
+	0x0122021,0x0120025,0x0160820,0x0124820,0x0160020,0x01a00a0,0x2120030,0x3120020,0x0140038,0x0140030,0x0140830,0x0140030,0x0140920,0x0140420,0x01c0020,0x11c0020,
+	0x0186020,0x2100038,0x2100030,0x2140030,0x2100920,0x1040034,0x1000438,0x1040430,0x1040830,0x1060028,0x1080030,0x0000043,0x1000043,0x0000853,0x0000149,0x0040059,
+	0x0000059,0x0000149,0x0040149,0x0000259,0x0004249,0x0044049,0x0040061,0x0000059,0x0020051,0x0040051,0x0040149,0x0042141,0x0060141,0x0080141,0x00c0141,0x0080141,
+	0x0044241,0x00008c1,0x0040841,0x0800841,0x0000851,0x0000859,0x0040851,0x0040841,0x1000841,0x000c841,0x0180841,0x0204841,0x0041041,0x1001041,0x0001043,0x0001053,
+	0x0005043,0x0041043,0x0001059,0x0041051,0x1001051,0x0001145,0x0003141,0x0001051,0x1001041,0x0049041,0x00020c5,0x1002049,0x0002071,0x0202051,0x0042041,0x0002241,
+	0x0006061,0x00c2041,0x0044841,0x0008059,0x0028051,0x0048051,0x004c041,0x1008041,0x0020053,0x0024043,0x0060043,0x0020049,0x0060051,0x0060141,0x0061041,0x0022141,
+	0x0020051,0x00a00c1,0x0121041,0x0040051,0x0048041,0x1048041,0x00c0041,0x00800c5,0x0080059,0x00a0051,0x00c0051,0x00c00c1,0x00a4041,0x01000c5,0x1100045,0x0140049,
+	0x0100251,0x0180841,0x0141041,0x1101041,0x0148041,0x0160041,0x0140041,0x3100041,0x0284041,0x1400045,0x0440049,0x0440441,0x0448041,0x1440041,0x1000841,0x2000841,
+	0x2020041,0x2000059,0x2040051,0x2006041,0x2004041,0x0040851,0x0042051,0x0020051,0x0060051,0x00c0051,0x0120052,0x0040454,0x0040450,0x0048050,0x00c0050,0x00c0150,
+	0x00c0150,0x0040858,0x0000850,0x0000958,0x1000850,0x00c0850,0x0001850,0x0001051,0x1001050,0x0085050,0x0002851,0x0042051,0x0042050,0x0082050,0x0002154,0x0002150,
+	0x000a150,0x1002050,0x0006051,0x0007050,0x0026050,0x00c2050,0x1082050,0x0102051,0x0142050,0x0004058,0x0004158,0x00200d1,0x0020052,0x0060050,0x0020850,0x0061050,
+	0x1021050,0x0022050,0x0040050,0x0044050,0x00c0050,0x00c0050,0x00c0051,0x0188050,0x0141050,0x1002051,0x1020050,0x00c00c1,0x00c00c1,0x01800c1,0x20001c1,0x00400d0,
+	0x00c00d0,0x10008c0,0x000015a,0x0000952,0x0020152,0x0040152,0x0000942,0x0140142,0x00c0160,0x0040141,0x00001d0,0x0084140,0x0100150,0x0040941,0x0040948,0x0080950,
+	0x0040940,0x1000940,0x1008940,0x00c0940,0x0001950,0x0001150,0x0049140,0x1009140,0x00021c4,0x0002150,0x0042140,0x0042540,0x1002140,0x2006140,0x000e140,0x000c140,
+	0x1008140,0x0060148,0x0060940,0x0062140,0x0026140,0x0064140,0x0060140,0x00601c0,0x00e0140,0x0045140,0x0041140,0x00c0140,0x00801c4,0x00c0150,0x01c0140,0x0200158,
+	0x0240150,0x2005140,0x0000855,0x0040849,0x1000849,0x0000d41,0x0020941,0x0041841,0x0042841,0x1020841,0x0101841,0x0120841,0x3000841,0x0000853,0x0000852,0x1000852,
+	0x0000858,0x0040858,0x0000858,0x0000c50,0x0040850,0x0080850,0x0040950,0x0042850,0x0082850,0x1040850,0x0000941,0x0040941,0x0040942,0x0000960,0x0080960,0x0000d50,
+	0x0001950,0x0041940,0x0040d40,0x00c0940,0x2080940,0x0005841,0x0004942,0x0044842,0x1004842,0x0004858,0x0004840,0x0045840,0x000c840,0x004c840,0x00c4840,0x0184840,
+	0x0444840,0x2004850,0x0100858,0x0120850,0x0140850,0x1100850,0x0140840,0x0101850,0x0141840,0x0106840,0x0180850,0x01c0840,0x0022841,0x0022041,0x0062041,0x00c2041,
+	0x0402041,0x0442041,0x0446040,0x0044049,0x0044061,0x0044841,0x1024041,0x00c4041,0x1084041,0x0006043,0x0024043,0x0004142,0x0004042,0x1004042,0x0044142,0x0044042,
+	0x0084058,0x0044048,0x0044850,0x0064050,0x00c4050,0x00840d0,0x1084050,0x0024070,0x0044060,0x0004041,0x0044040,0x0024150,0x0044340,0x0044848,0x1004848,0x0044850,
+	0x0044860,0x000c850,0x004c840,0x0005042,0x0025050,0x000d041,0x00060c4,0x0006070,0x0046040,0x0006141,0x0006160,0x0046440,0x0006041,0x0006060,0x1046040,0x2006040,
+	0x1004042,0x0044048,0x0044060,0x0044040,0x0044440,0x1004440,0x0004848,0x0044840,0x1004840,0x0046040,0x1006040,0x004c040,0x100c040,0x0064040,0x1024040,0x1044040,
+	0x000c441,0x000c540,0x0024841,0x0064041,0x0024058,0x0064050,0x0064140,0x0065040,0x1025040,0x006c040,0x0064050,0x1064040,0x00c40c0,0x0044050,0x00840c4,0x00c40c0,
+	0x10840c0,0x0084041,0x01040c4,0x0144440,0x0124041,0x01c4040,0x1184040,0x0406041,0x0444048,0x0444060,0x0444440,0x0444840,0x0446040,0x0844050,0x1005140,0x1004850,
+	0x0020841,0x0060043,0x0060049,0x0020061,0x0028141,0x0021041,0x0021051,0x0029041,0x0061041,0x0022041,0x0062041,0x1028041,0x0260041,0x1060041,0x0020052,0x0024052,
+	0x0020054,0x0020450,0x0060050,0x0020050,0x0024050,0x0022150,0x0062050,0x0060050,0x0220050,0x0460050,0x1060050,0x0020154,0x0020158,0x0060148,0x0020160,0x00a0160,
+	0x0060140,0x0020550,0x0062140,0x00a4140,0x0068140,0x00a8140,0x1028140,0x0060150,0x00e0140,0x1060140,0x00a01c0,0x00e0140,0x2020150,0x00a4041,0x1024048,0x0064040,
+	0x0064440,0x0025041,0x0026050,0x0024060,0x2064040,0x00e4040,0x0124060,0x1224040,0x0464040,0x0060840,0x0020840,0x0160042,0x0120058,0x0160050,0x0120070,0x0121050,
+	0x0129040,0x0122048,0x1020054,0x1020058,0x1020450,0x1028050,0x10a8040,0x0104045,0x0102041,0x0106041,0x0142041,0x0160041,0x0140444,0x1100444,0x0140058,0x0140060,
+	0x0140041,0x0140148,0x0109140,0x0124140,0x0100841,0x0120841,0x0140841,0x0140850,0x0180850,0x0140860,0x1100860,0x0140840,0x01088c0,0x0148840,0x1108840,0x0101041,
+	0x0101140,0x0149040,0x1102048,0x0102050,0x1102040,0x0142440,0x1102440,0x1102040,0x0112140,0x1120048,0x0120050,0x0160840,0x1120840,0x0162040,0x1120040,0x01600c0,
+	0x0160040,0x11400c0,0x0140841,0x0140850,0x0140940,0x1140040,0x01c0040,0x11c0040,0x0180041,0x1180040,0x1100058,0x1100850,0x1184040,0x1140050,0x0402150,0x1040841,
+	0x1042041,0x100005a,0x1040052,0x1000858,0x1049040,0x1002051,0x1002150,0x1002040,0x1046040,0x3004041,0x104c040,0x100c040,0x1008040,0x1020841,0x1020058,0x1060050,
+	0x1026040,0x1064040,0x1160040,0x10c0050,0x1200058,0x1240050,0x00400a1,0x0060081,0x0000893,0x0140083,0x0000495,0x0040485,0x0000889,0x0000099,0x0040099,0x0000389,
+	0x00c0089,0x0041091,0x00c0091,0x00400a1,0x20001a1,0x00c00a1,0x00400c1,0x0040081,0x0000585,0x0000581,0x0040581,0x0100581,0x0040981,0x1000981,0x0042181,0x0082181,
+	0x0060181,0x0080181,0x0040291,0x0040381,0x0000381,0x0001481,0x0040481,0x0000491,0x0040491,0x0001581,0x0140481,0x0000881,0x0000899,0x0020891,0x0040891,0x00008a1,
+	0x00408a1,0x0000989,0x0004881,0x0040881,0x0001881,0x0041881,0x0006881,0x0044881,0x0040891,0x00c0881,0x0200881,0x0400881,0x0001881,0x0001083,0x0001099,0x0041091,
+	0x1001081,0x2001081,0x000a081,0x0002095,0x0002085,0x0042089,0x00021c1,0x00420c1,0x0042481,0x1002481,0x0042081,0x0042091,0x00c2081,0x0004891,0x0005081,0x0808081,
+	0x1008881,0x0008181,0x0148081,0x0021081,0x0060089,0x0020099,0x0060091,0x0021181,0x0060481,0x0060881,0x0061081,0x0062081,0x0064081,0x0068081,0x00e0081,0x1040081,
+	0x0040481,0x0048081,0x00c0081,0x0080099,0x00c0091,0x0080081,0x0140089,0x01400a1,0x01000c1,0x0100889,0x0101881,0x0140881,0x0180881,0x0142081,0x0140091,0x0220091,
+	0x0240091,0x0400099,0x0440481,0x0441081,0x0440091,0x1000099,0x1020091,0x1000091,0x1000891,0x2002081,0x2000099,0x2020091,0x2040091,0x0040099,0x0000899,0x0040891,
+	0x0001091,0x0048091,0x1008091,0x0020091,0x0060091,0x00c0091,0x00c0091,0x0002092,0x0040092,0x0080094,0x0040494,0x0020098,0x10000d8,0x0040098,0x1000098,0x0040890,
+	0x2000090,0x00800b0,0x00c00b0,0x0040198,0x00001d0,0x0040990,0x0060190,0x0000293,0x0020291,0x0000898,0x0040890,0x0004990,0x0040890,0x0041890,0x0044890,0x0084890,
+	0x0048890,0x0200890,0x0001891,0x0041090,0x0001194,0x0003190,0x0049090,0x1009090,0x0002094,0x0042098,0x00020d0,0x0002091,0x1002090,0x1022090,0x00c2090,0x0028091,
+	0x0060092,0x1020092,0x0060098,0x0060090,0x0060890,0x0021091,0x0061090,0x0062090,0x0064090,0x1020090,0x0060090,0x20a0090,0x1020090,0x0048090,0x00c0090,0x00c0090,
+	0x00c0090,0x0100094,0x01000d0,0x0200091,0x0400098,0x0420090,0x04000d0,0x0800099,0x0800098,0x0820090,0x0840090,0x1800890,0x1000098,0x0082181,0x0040584,0x0000198,
+	0x0020198,0x0040198,0x0041190,0x00401c0,0x00801c0,0x0000383,0x0020381,0x0000598,0x0020590,0x0040590,0x0004580,0x0020981,0x0000984,0x0004980,0x0040980,0x00c0980,
+	0x0101980,0x0140980,0x0005182,0x0102181,0x0042188,0x00421c0,0x1002580,0x1002180,0x00c2180,0x0044180,0x1008980,0x0020198,0x0020190,0x0020190,0x0060190,0x1040180,
+	0x00c0180,0x0080190,0x0200198,0x0220190,0x0240190,0x2002190,0x0004099,0x10040c1,0x0064081,0x1024081,0x00c4081,0x0044082,0x0044484,0x0144084,0x0004089,0x0004289,
+	0x0064090,0x00060c1,0x00060d0,0x00440c0,0x00440c0,0x0004098,0x0004584,0x0004198,0x0044580,0x00061c0,0x0044190,0x0044481,0x0004498,0x0044490,0x1004490,0x0044580,
+	0x0104480,0x0105480,0x0044888,0x0004898,0x0044890,0x1004890,0x0044c80,0x0004881,0x0004880,0x0005890,0x0045880,0x0006880,0x0044880,0x00c4880,0x0045081,0x0005098,
+	0x0045090,0x1005090,0x0005190,0x0005090,0x0045080,0x0006081,0x0006089,0x0046088,0x0006098,0x0026090,0x0046090,0x00061c0,0x00460c0,0x0046480,0x1006480,0x0004084,
+	0x0044088,0x1004088,0x1004090,0x00440a0,0x0004481,0x0044480,0x1004480,0x1004880,0x0046080,0x004c080,0x0024088,0x0064080,0x0044080,0x00c4080,0x1084080,0x0204090,
+	0x000c481,0x000c098,0x002c090,0x004c090,0x100c080,0x0024081,0x0024881,0x0064081,0x0064180,0x0064480,0x0025090,0x0066080,0x00e4080,0x1064080,0x0044098,0x0044890,
+	0x0046090,0x0064090,0x0044090,0x1044090,0x00c4081,0x00c4080,0x0084084,0x0086090,0x1084080,0x01040a0,0x01440a0,0x01040c0,0x0124180,0x0164080,0x01c4080,0x0204091,
+	0x0204098,0x0206090,0x0244090,0x0404092,0x0444090,0x04040a0,0x04440a0,0x0444480,0x0444880,0x0424090,0x0444080,0x0804098,0x0844090,0x1044081,0x1004098,0x1004890,
+	0x1100082,0x0140484,0x0102089,0x0100088,0x0160090,0x01400a0,0x11000a0,0x01200d0,0x11000c0,0x0140080,0x0140181,0x0140881,0x0140890,0x0140c80,0x1100c80,0x0104880,
+	0x0140880,0x1100880,0x0141081,0x01410a0,0x0101184,0x0149080,0x1109080,0x0142480,0x01c2080,0x0160088,0x0160880,0x1120880,0x0120081,0x01e0080,0x01e0080,0x1140080,
+	0x0140480,0x0144080,0x0180181,0x2100081,0x3100080,0x1440880,0x1020089,0x1042090,0x10000d0,0x10021c0,0x1040490,0x1040881,0x10008d0,0x1040890,0x1000984,0x1043080,
+	0x1002098,0x1004188,0x1008098,0x1048090,0x1008081,0x1008080,0x104c080,0x1820081,0x1046080,0x1080090,0x0001103,0x0041103,0x0020502,0x0060114,0x000019c,0x0040194,
+	0x0024184,0x0020114,0x0020514,0x0000d14,0x0046104,0x0080905,0x0080104,0x01c0104,0x0082109,0x0040119,0x0040118,0x0082118,0x0000918,0x0040918,0x0004909,0x0044908,
+	0x1040908,0x00a0121,0x000c141,0x0000158,0x0140940,0x0021181,0x0042501,0x00c0501,0x0046500,0x0000915,0x0000911,0x0101910,0x0140910,0x0000909,0x0000901,0x0101900,
+	0x0020910,0x0080980,0x0005141,0x0041101,0x0021101,0x0101101,0x0021103,0x000111a,0x0001118,0x0005108,0x0041108,0x0003110,0x0007100,0x0401110,0x0081100,0x0801100,
+	0x0009118,0x0049100,0x008d100,0x002d100,0x0041180,0x1041180,0x008a101,0x0023101,0x1002112,0x0002914,0x0002914,0x0006144,0x0142104,0x0182104,0x0402118,0x0002109,
+	0x0002118,0x0006908,0x0406108,0x0022108,0x0102118,0x0023110,0x0802120,0x0046120,0x0022121,0x0002141,0x0002950,0x0006100,0x0002518,0x0022510,0x0002d10,0x0002118,
+	0x0082100,0x0026102,0x0122100,0x00c2110,0x004e100,0x0082910,0x0082900,0x00c2100,0x00a2101,0x0102901,0x0122110,0x0122100,0x01c2100,0x0222101,0x0482100,0x000410c,
+	0x0004108,0x0006108,0x00c4101,0x000e100,0x0020119,0x0060108,0x0022140,0x0020518,0x0024500,0x0026110,0x0066100,0x0040103,0x0040190,0x0040918,0x0040910,0x0042111,
+	0x0040110,0x00c0910,0x00c1110,0x00a0190,0x0200118,0x0240110,0x0840101,0x1802101,0x0824101,0x0880910,0x2020109,0x2060101,0x2080101,0x0048201,0x0084203,0x0000a05,
+	0x0040605,0x1000605,0x0000219,0x0040219,0x0040221,0x0000221,0x0040241,0x0020251,0x0040241,0x1000241,0x0020341,0x0020241,0x0040b01,0x0020611,0x0040611,0x1000611,
+	0x0008a01,0x000ca01,0x0001213,0x0005203,0x0041203,0x0101203,0x0041211,0x1001201,0x0007201,0x0042211,0x0042201,0x1002201,0x1082201,0x000a201,0x0008219,0x0028211,
+	0x0048211,0x0060601,0x0060a01,0x0068201,0x00a0201,0x0120a01,0x1040211,0x0048211,0x0048201,0x00c4201,0x0140601,0x0148201,0x0240201,0x0200a11,0x0402201,0x0400219,
+	0x0800311,0x0042211,0x00c0211,0x0000a12,0x0040318,0x0040a10,0x1000a10,0x0048210,0x0060210,0x2000210,0x0040230,0x0040230,0x0000299,0x0140290,0x0000a13,0x0004a10,
+	0x0040a10,0x0001212,0x1001210,0x1002210,0x0046210,0x0020318,0x0060610,0x1020210,0x0040210,0x00c0210,0x0140210,0x00c0210,0x0086210,0x0102210,0x0400218,0x0400310,
+	0x0000a81,0x0044301,0x0000303,0x0040302,0x000031a,0x0020312,0x0040312,0x0040320,0x1000340,0x0084340,0x0000389,0x0040b00,0x00c0b00,0x1001300,0x1009300,0x0006340,
+	0x0042700,0x0002310,0x0002300,0x0042300,0x0060308,0x0020341,0x0020310,0x0041300,0x0200318,0x0220310,0x0240310,0x1200310,0x0002201,0x000421a,0x0044212,0x0004604,
+	0x0044604,0x1004604,0x0044204,0x0004a18,0x1044210,0x0046280,0x0046300,0x0004618,0x0044610,0x1004610,0x0004e00,0x0004a18,0x0044a10,0x0044a00,0x00c4a00,0x1084a00,
+	0x0007200,0x0045200,0x0046210,0x0046240,0x1086200,0x0044600,0x0025201,0x0125200,0x00c4201,0x1084200,0x0186200,0x0104a01,0x0144240,0x0144600,0x0104a10,0x0164200,
+	0x0424201,0x0404218,0x0444a00,0x1404a00,0x1004218,0x0140203,0x0140212,0x0144204,0x0140209,0x1100248,0x0144208,0x0100a41,0x0101240,0x0140200,0x0100618,0x0140610,
+	0x0140600,0x0108a10,0x0121201,0x1101202,0x0149200,0x0106204,0x0142600,0x1102600,0x0148210,0x010e200,0x0120a01,0x01a0201,0x0120a10,0x0160210,0x01c0200,0x01c0210,
+	0x1180200,0x0340210,0x0300310,0x0001401,0x0000403,0x0020403,0x0004403,0x0000485,0x0040405,0x0000509,0x0040419,0x0040509,0x0020521,0x0044441,0x0140441,0x0000c81,
+	0x0000501,0x0040509,0x0040511,0x0040521,0x0000501,0x0040501,0x0040d01,0x0041501,0x0002541,0x0042501,0x0040401,0x0040501,0x0001c01,0x0040c11,0x0000d21,0x0040d01,
+	0x0008c01,0x0041401,0x0041411,0x0001501,0x0041501,0x0001411,0x0002411,0x0042401,0x1002409,0x0002491,0x0042411,0x0002441,0x0042441,0x0002701,0x00c2401,0x2102401,
+	0x0046401,0x0048401,0x0048481,0x000c401,0x040c401,0x0148401,0x0188401,0x0060401,0x00a0401,0x0060401,0x0062401,0x0024401,0x0064401,0x0020501,0x00e0401,0x1060401,
+	0x00e0401,0x3020401,0x0040481,0x0041411,0x0080c01,0x00c0401,0x00c0501,0x0080501,0x01004c1,0x0120501,0x0120401,0x1120401,0x0200c01,0x0240401,0x0440401,0x0500401,
+	0x0400419,0x1000c11,0x1044401,0x2040501,0x2004401,0x0060403,0x0020413,0x0004412,0x0040414,0x0000458,0x1000458,0x0000494,0x0040430,0x0040410,0x0040c10,0x0001411,
+	0x0006410,0x0042410,0x0048410,0x00c0410,0x0200410,0x0020530,0x0100491,0x0060510,0x0008c10,0x0001d10,0x0040c10,0x1000c10,0x0048c10,0x1008c10,0x00c0c10,0x1080c10,
+	0x0005412,0x0041412,0x0049410,0x0089410,0x1009410,0x0002431,0x0002494,0x0006418,0x0046410,0x0082410,0x00c2410,0x0048510,0x0060412,0x0020c10,0x0060430,0x1020410,
+	0x0021411,0x0022410,0x0062410,0x0064410,0x1020410,0x0220410,0x0060411,0x00c0410,0x00c0411,0x0080494,0x00c0410,0x0084c10,0x0200c10,0x0200d10,0x0840410,0x1000418,
+	0x1020410,0x0000589,0x00404a1,0x0042481,0x0008481,0x00c0481,0x1000481,0x2000581,0x0000499,0x0080490,0x00c0490,0x0004681,0x0064480,0x0105480,0x0140488,0x0080501,
+	0x0000505,0x0002541,0x0000512,0x0000502,0x0000512,0x0040512,0x0000d03,0x0040504,0x1000504,0x0004508,0x1000508,0x0000d18,0x0000558,0x0040530,0x0060510,0x0200510,
+	0x0240510,0x00805c0,0x0040510,0x0004500,0x1000d10,0x0001d00,0x0040d00,0x0042d00,0x0044d00,0x0048d00,0x00c0d00,0x1080d00,0x0005502,0x0042501,0x0002509,0x0042508,
+	0x1002508,0x0042510,0x0042540,0x0002500,0x0042500,0x0046500,0x0024510,0x0048510,0x0008501,0x0048500,0x1020502,0x0060500,0x0062500,0x0020500,0x0042501,0x1040500,
+	0x00c0500,0x0080518,0x00a0510,0x00c0510,0x0080590,0x00c0580,0x0180d00,0x0240501,0x0440500,0x0002c41,0x0048c01,0x0080c10,0x0000d04,0x0000d50,0x0040d00,0x0006c40,
+	0x0004c20,0x0100c50,0x2180c00,0x0042441,0x004a401,0x0022c01,0x0062401,0x0122401,0x0402411,0x0042410,0x0002c10,0x0042580,0x00c2500,0x0202510,0x0046402,0x004e400,
+	0x004e400,0x00c6400,0x0186400,0x0406410,0x0446400,0x0142402,0x0122c00,0x0122400,0x0162400,0x01c2400,0x0046401,0x004c401,0x0006403,0x0044402,0x0044c10,0x0044420,
+	0x0084421,0x0004c41,0x0044481,0x0006490,0x0044c80,0x0006510,0x0044700,0x0005401,0x0044401,0x0024410,0x0024401,0x0105400,0x0044c01,0x0044c00,0x0105402,0x0106402,
+	0x0006408,0x0046400,0x0044400,0x1004400,0x0024500,0x000c410,0x004c480,0x000c610,0x000c401,0x0024501,0x0064401,0x00a4401,0x0064410,0x0025401,0x0064400,0x0126400,
+	0x0164400,0x0044410,0x0084484,0x00c4400,0x0484400,0x0124401,0x0020c01,0x0060403,0x00a0421,0x0060501,0x00a0501,0x0022441,0x0062401,0x2022401,0x01a0401,0x1060401,
+	0x0028410,0x0022450,0x0420410,0x0026401,0x0026410,0x0026400,0x0120502,0x0122400,0x0060401,0x0100512,0x0144408,0x0140408,0x2100408,0x0140520,0x0100c50,0x0140501,
+	0x0120500,0x0140400,0x0100c01,0x0102c01,0x0140c01,0x0100d20,0x0141500,0x1141400,0x0160500,0x0120410,0x01a0401,0x0160400,0x0144400,0x01c0401,0x0180484,0x01c0500,
+	0x01c0400,0x2140400,0x0240401,0x0200c10,0x0400c11,0x1000405,0x1040401,0x1002441,0x1060401,0x10c0401,0x1044402,0x10c0408,0x1040c10,0x1000d10,0x1002d00,0x1800d00,
+	0x1004c10,0x1002418,0x1042408,0x1048410,0x1020510,0x10c0410,0x1080490,0x0020901,0x000080b,0x0000903,0x0040903,0x0020803,0x000081d,0x0020815,0x0040815,0x0080815,
+	0x1000815,0x0040c05,0x1000809,0x0000819,0x0020819,0x0040819,0x0060811,0x0204811,0x0002841,0x0000881,0x0020881,0x0000985,0x0040905,0x0040909,0x00009c1,0x0000d01,
+	0x0040d01,0x0020909,0x0060901,0x1020901,0x0080981,0x1080901,0x0000c19,0x0020c11,0x0040c11,0x0040c81,0x0002d01,0x0040c01,0x1000809,0x0040801,0x0041801,0x0041803,
+	0x1001803,0x0001819,0x0021811,0x0041811,0x0001901,0x1001801,0x0049801,0x0002901,0x0042801,0x0002885,0x0002819,0x0042809,0x0042811,0x0042c01,0x00c2801,0x000a901,
+	0x0048901,0x0008a11,0x0020885,0x0060809,0x1020809,0x0020811,0x0060811,0x0024841,0x0060901,0x0060c01,0x1020c01,0x0062801,0x00a2801,0x0121801,0x0040819,0x0060811,
+	0x0040811,0x0040901,0x0140801,0x1040801,0x00c0801,0x0080881,0x0080819,0x0082811,0x0880811,0x0080981,0x00c0881,0x1080881,0x0080c11,0x01c0801,0x0102801,0x0100885,
+	0x0140809,0x0140821,0x0102809,0x0120801,0x0200801,0x0240801,0x0200819,0x0220811,0x0240811,0x0220801,0x1200801,0x0400819,0x0420811,0x0402901,0x0440c01,0x0442801,
+	0x1402801,0x0800819,0x0820811,0x0840811,0x1800801,0x1000819,0x1002901,0x1108801,0x2020801,0x2000819,0x2040811,0x2044801,0x2000901,0x2004801,0x0040819,0x1000819,
+	0x0040831,0x0040c11,0x0041811,0x0042811,0x1002811,0x0048811,0x0020811,0x0060811,0x1020811,0x00c0811,0x1200811,0x2000811,0x0002812,0x1000814,0x0040818,0x1000858,
+	0x0101818,0x0020811,0x0040c10,0x0048810,0x0060810,0x0040810,0x00c0810,0x2000810,0x0080830,0x00c0830,0x0020850,0x0040850,0x0000850,0x0004850,0x0080950,0x0060890,
+	0x0100891,0x0060910,0x0040990,0x0003811,0x0001818,0x0001810,0x0041810,0x0001811,0x0001810,0x0042818,0x0042810,0x0042850,0x0042910,0x0046810,0x0042810,0x0082910,
+	0x0086810,0x0006810,0x0008918,0x0028811,0x0088811,0x0020818,0x0060810,0x0068810,0x0044812,0x0040810,0x00c0810,0x0080894,0x0080890,0x0188810,0x0100894,0x0104814,
+	0x0140818,0x01008d0,0x0240811,0x0200810,0x0240810,0x0202910,0x0240910,0x0440910,0x0840810,0x0840910,0x2040810,0x2000811,0x3000810,0x0002901,0x0002911,0x0002941,
+	0x0020909,0x0060901,0x00a0901,0x0020912,0x0020903,0x0020902,0x0000984,0x0080984,0x0080904,0x0040d04,0x0020909,0x0044908,0x0040930,0x0042910,0x0060910,0x0140910,
+	0x0200910,0x0020930,0x0040930,0x00c0920,0x0002941,0x0020950,0x0000950,0x0002950,0x0000d18,0x0020d10,0x0040d10,0x0002d00,0x0040900,0x0044900,0x00c0900,0x0003901,
+	0x0041901,0x0801901,0x0001903,0x0001902,0x0041902,0x1001902,0x0001918,0x0003910,0x0041910,0x1001910,0x0001901,0x0043900,0x0045900,0x0009901,0x0049900,0x0002905,
+	0x0002984,0x0042908,0x1002908,0x0002918,0x0042910,0x1002910,0x0002941,0x0042940,0x1002940,0x0002900,0x0042d00,0x1002d00,0x0042900,0x1002900,0x0046900,0x00c2900,
+	0x1082900,0x0103900,0x0902900,0x0046900,0x0048901,0x0048910,0x000a900,0x004c900,0x1008900,0x0060901,0x0060d00,0x00a4900,0x0040d00,0x0040910,0x0048900,0x00c0900,
+	0x0080901,0x00c0901,0x0080918,0x00a0910,0x00c0910,0x0084980,0x00c0980,0x00a0910,0x0200918,0x0202910,0x0240910,0x0224900,0x0220910,0x0006801,0x0004885,0x0044809,
+	0x0044821,0x0045801,0x0046801,0x00c4801,0x0204811,0x0024803,0x000481a,0x0044812,0x0044802,0x0144802,0x0004894,0x0044884,0x0004914,0x0044904,0x0044c04,0x0044804,
+	0x0105804,0x0006818,0x0044818,0x0044810,0x00c4820,0x0006841,0x0044850,0x1004840,0x0004941,0x0004950,0x0004940,0x0006840,0x0044840,0x0006881,0x0044908,0x0046900,
+	0x000c910,0x0064900,0x0044c10,0x0044800,0x1004800,0x0004840,0x0045801,0x0005818,0x0045810,0x0026810,0x0006841,0x0006850,0x0046840,0x1004802,0x0004818,0x1004810,
+	0x0004821,0x0044820,0x0004910,0x0044c00,0x1004c00,0x0045800,0x0046800,0x1006800,0x004c800,0x0024808,0x00c4800,0x000c818,0x002c810,0x004c810,0x100c800,0x0024801,
+	0x0026801,0x0064808,0x1024808,0x0024810,0x0064810,0x0024904,0x0064900,0x0044818,0x0044810,0x0046810,0x0044810,0x1044800,0x0084881,0x00c4801,0x00c4810,0x0084904,
+	0x00c4800,0x00c4801,0x0084801,0x0084810,0x0084800,0x01c4800,0x0104818,0x01048c0,0x0104910,0x0144900,0x0105801,0x0106808,0x0146800,0x010c810,0x014c800,0x0124810,
+	0x0164800,0x1124800,0x01c4800,0x0284801,0x0204818,0x0244810,0x1204810,0x0204910,0x0406801,0x0404818,0x0444810,0x0406808,0x0406810,0x0446800,0x044c800,0x1424800,
+	0x0444810,0x04c4800,0x0804818,0x0844810,0x2006810,0x0100885,0x0140801,0x010081a,0x0140812,0x0120803,0x0140814,0x0140c04,0x0120814,0x0140818,0x010090c,0x0144808,
+	0x0100821,0x0140820,0x0100858,0x0120850,0x0140850,0x0140800,0x0140800,0x0141801,0x0101902,0x0101810,0x1101800,0x0149800,0x0142801,0x0142810,0x0182810,0x0102940,
+	0x0142840,0x0142c00,0x01c2800,0x010a900,0x0120818,0x0120810,0x0160810,0x0920810,0x0120940,0x1120840,0x0160c00,0x1120800,0x0320810,0x0160810,0x1140880,0x0140c00,
+	0x01c0800,0x0140800,0x0180811,0x0180818,0x01a0810,0x01c0810,0x1300800,0x0900818,0x0920810,0x0940810,0x0440910,0x1041801,0x1020809,0x10a0801,0x1040811,0x1000815,
+	0x1000814,0x1020805,0x1041810,0x1042810,0x1060810,0x1040818,0x1040810,0x1042900,0x1040900,0x1044800,0x1040801,0x1080818,0x10c0810,0x1080890,0x1080904,0x1080801,
+	0x0001019,0x0021011,0x0061001,0x0041013,0x0041005,0x000101d,0x0021015,0x0041015,0x0001095,0x0001185,0x0041085,0x0041405,0x0001815,0x0007005,0x0001059,0x0001109,
+	0x0021019,0x0021811,0x0001125,0x0041051,0x0041041,0x0085041,0x0141041,0x0005091,0x0101081,0x0401081,0x0041109,0x0005501,0x0041501,0x0001911,0x0001901,0x0041901,
+	0x0041101,0x0043101,0x0021111,0x0061101,0x0041111,0x00c1101,0x0021401,0x0041411,0x0041501,0x0045401,0x0001801,0x0021801,0x0041801,0x0801801,0x0041811,0x0001905,
+	0x0001d01,0x0041901,0x0041801,0x0041801,0x1001801,0x00c1801,0x1081801,0x0141801,0x0201801,0x0401801,0x0041001,0x0001003,0x0001011,0x1001011,0x0001111,0x0043001,
+	0x0083001,0x0003109,0x0003013,0x0003019,0x0003091,0x0043011,0x0083011,0x0043041,0x0043101,0x1003401,0x0003001,0x0047001,0x0043011,0x0083001,0x0087001,0x1083001,
+	0x0103801,0x0143001,0x0109001,0x0111101,0x0021011,0x0021081,0x0061001,0x0061005,0x1021009,0x0061011,0x0021051,0x0061041,0x0021101,0x0021109,0x0021401,0x0061401,
+	0x0021811,0x0061801,0x1021801,0x0061001,0x0027001,0x0025001,0x0021001,0x0021101,0x0061011,0x00e1001,0x1221001,0x0041001,0x0041019,0x0061011,0x0041011,0x1041081,
+	0x0041401,0x0041001,0x1041001,0x00c1001,0x10c1001,0x0141001,0x0081101,0x0081019,0x00a1011,0x00c1011,0x00c1081,0x0083101,0x0085801,0x0081011,0x00c1001,0x2081001,
+	0x2085001,0x1101003,0x0141009,0x0141801,0x0103009,0x0121101,0x1141001,0x01c1001,0x3101001,0x0203011,0x0201111,0x0203101,0x0241101,0x0401019,0x0441401,0x1401401,
+	0x0443001,0x0461001,0x0801019,0x0841011,0x0841101,0x1003001,0x1041001,0x1001019,0x1045001,0x10c1001,0x2001019,0x2021011,0x2041011,0x3001011,0x2181001,0x0021103,
+	0x0041019,0x0041811,0x0003011,0x0043011,0x1003011,0x0021011,0x0041011,0x0081091,0x00c1011,0x0045012,0x0041094,0x0041414,0x0001118,0x0001818,0x0041018,0x0061010,
+	0x00c1010,0x0041030,0x0043110,0x0083110,0x1003110,0x0081190,0x0001411,0x0041811,0x0001813,0x0041818,0x0001914,0x0001d10,0x0041810,0x00c1810,0x1081810,0x0041010,
+	0x0045010,0x0003019,0x0043018,0x0003018,0x0043010,0x0003050,0x0043050,0x0043011,0x0043010,0x0043090,0x0083011,0x0087010,0x0143010,0x0145010,0x0445010,0x0021094,
+	0x0061014,0x0021018,0x0021018,0x0021810,0x0021010,0x0061010,0x0021910,0x0061110,0x0061410,0x0021810,0x0061810,0x0061010,0x0041811,0x0041011,0x0041810,0x0041010,
+	0x1041090,0x0041114,0x0043010,0x0047010,0x1041010,0x00c5010,0x0081018,0x00c1010,0x0085090,0x00c1090,0x0081114,0x0081130,0x00c1110,0x0085810,0x00a1010,0x0141010,
+	0x0201018,0x0241010,0x0401018,0x0441810,0x1083010,0x2041010,0x2001010,0x2005010,0x0025080,0x0105101,0x0405101,0x0041101,0x0101901,0x0041105,0x0001194,0x0081184,
+	0x0041504,0x1001504,0x0045104,0x0021105,0x1001108,0x1001148,0x0041108,0x0043110,0x0201110,0x0041120,0x1001120,0x1081120,0x0041140,0x0041181,0x0041180,0x0001518,
+	0x0041510,0x0021501,0x0201501,0x0001984,0x0041908,0x0021910,0x0041910,0x0041920,0x0001901,0x0005d00,0x0041d00,0x0001910,0x0041900,0x0025900,0x0045900,0x0009901,
+	0x00c1900,0x1081900,0x2081900,0x0001118,0x0005110,0x0021110,0x0041110,0x1041100,0x0003111,0x0023101,0x0043101,0x1003104,0x0043108,0x0003118,0x0043110,0x0003150,
+	0x0043140,0x1003140,0x0043100,0x0003510,0x0043500,0x1003100,0x0047100,0x00c3100,0x0021118,0x0061110,0x0821110,0x0021108,0x0023100,0x0061500,0x1021500,0x1021900,
+	0x0065100,0x0261100,0x2021101,0x0041184,0x0045108,0x0041110,0x0045140,0x0045100,0x0041101,0x00c1100,0x10c1100,0x0081184,0x00a1110,0x00c1110,0x00c1100,0x00a1110,
+	0x00c1100,0x0801118,0x0803110,0x0821110,0x0841110,0x0881110,0x0909100,0x2003110,0x3001100,0x0003010,0x0047001,0x00c5001,0x1005002,0x0045012,0x1005012,0x0005112,
+	0x0005812,0x0005184,0x0045084,0x1005084,0x0045404,0x0025018,0x0045018,0x0005058,0x0005108,0x0145008,0x0065010,0x0045020,0x1005040,0x0005890,0x0045080,0x0065080,
+	0x0105081,0x0125080,0x0005910,0x0045900,0x0025101,0x0025110,0x00c5100,0x0045200,0x0045410,0x0045500,0x0045400,0x0005801,0x0045801,0x0045808,0x0005818,0x0045810,
+	0x0005801,0x0045800,0x1005800,0x0085800,0x00c5800,0x1045800,0x0045010,0x0005001,0x1005000,0x0145000,0x0007009,0x0007801,0x0047001,0x0007018,0x0007008,0x0027010,
+	0x0007040,0x0047040,0x0007104,0x0007110,0x0047400,0x0047000,0x0087010,0x1087000,0x0045002,0x0005084,0x0045008,0x0005018,0x0045400,0x0005801,0x0005900,0x0045800,
+	0x1005800,0x0007040,0x0047000,0x1007000,0x004d000,0x0065000,0x1025000,0x00c5000,0x0205010,0x000d018,0x002d010,0x004d010,0x100d010,0x100d000,0x104d000,0x014d000,
+	0x0025011,0x0065001,0x00a5001,0x1025001,0x0025810,0x0065010,0x0025101,0x0027010,0x0067000,0x0025001,0x0025000,0x0065010,0x00e5000,0x0045018,0x0045010,0x1045010,
+	0x0045400,0x0045000,0x00c5010,0x00c5000,0x0085018,0x0087010,0x00c5010,0x0085010,0x1085010,0x00c5080,0x1085080,0x00c5100,0x0085010,0x00c5000,0x1085000,0x01c5000,
+	0x2085001,0x0105084,0x0145010,0x0105808,0x0145800,0x014d000,0x01c5000,0x1145000,0x0205018,0x0245010,0x0445001,0x0405018,0x0425001,0x0845001,0x0805110,0x1045001,
+	0x1005810,0x1045800,0x2005018,0x2045010,0x2045000,0x00a9010,0x0105084,0x0101104,0x010110c,0x0103104,0x0141404,0x0125004,0x0125004,0x0101058,0x0121108,0x0121009,
+	0x0141020,0x0181120,0x0101041,0x0141040,0x1101040,0x1101880,0x0141108,0x0141900,0x0161100,0x01c1100,0x0101700,0x0181804,0x0101818,0x0141810,0x1101810,0x0101841,
+	0x0101910,0x0101801,0x0141800,0x0141810,0x0141880,0x0141000,0x0149000,0x1141000,0x0141000,0x0103041,0x0103050,0x0107040,0x0143040,0x0143100,0x01c3000,0x0183000,
+	0x0147000,0x0161001,0x0121018,0x0161010,0x0921010,0x0121108,0x0161400,0x0161800,0x1121800,0x0121001,0x0121010,0x0121100,0x0161000,0x1121000,0x01a1100,0x0321001,
+	0x0161001,0x0141005,0x0141018,0x0161010,0x0141010,0x01c1010,0x0141081,0x01c1100,0x0141400,0x0145000,0x0141010,0x1141000,0x01c1080,0x01c1000,0x0181084,0x0181018,
+	0x01a1010,0x01c1010,0x0181081,0x01c1100,0x0187000,0x01c1000,0x0901018,0x0941010,0x2101401,0x3101000,0x0301810,0x1001801,0x1021801,0x1003081,0x1043001,0x1005108,
+	0x1005001,0x100d010,0x104d000,0x100d000,0x1041108,0x1081180,0x10c1080,0x1081080,0x1845000,0x2041010,0x0043001,0x0042001,0x0042013,0x0042103,0x0042403,0x0002803,
+	0x0006003,0x0002095,0x0006085,0x0022015,0x0042009,0x0202011,0x0202111,0x0042021,0x0042041,0x1002041,0x0026041,0x0002881,0x0002109,0x0042121,0x0042501,0x0042901,
+	0x0022101,0x0122101,0x0002419,0x0022411,0x0002421,0x0042801,0x0002819,0x0002801,0x0003019,0x0023011,0x0043011,0x0003001,0x0143001,0x0042001,0x0002015,0x1002005,
+	0x0102009,0x0002001,0x0046001,0x0102001,0x004a001,0x000a019,0x004a011,0x000e001,0x000a001,0x000a011,0x100a001,0x0062001,0x0026005,0x0062005,0x0062009,0x0062011,
+	0x0022105,0x0062101,0x0062401,0x1022401,0x0022011,0x0042181,0x0082085,0x00c2011,0x00c2101,0x1082001,0x0102085,0x0182001,0x0222001,0x0242011,0x0602011,0x1202001,
+	0x0402003,0x2042011,0x2022101,0x2042101,0x0102209,0x0002031,0x0042811,0x004a011,0x0062011,0x0082091,0x00c2011,0x0002412,0x0002812,0x0042414,0x1002018,0x0042018,
+	0x0002818,0x0002810,0x0003012,0x0043010,0x004a010,0x0042010,0x2002010,0x0026050,0x0142050,0x0042130,0x00c2110,0x0202110,0x0042910,0x1002810,0x0043011,0x0043010,
+	0x008b010,0x0042010,0x0046010,0x002a010,0x008a110,0x0022811,0x0062018,0x0022411,0x0062410,0x0026810,0x00e2010,0x20a2010,0x1222010,0x00c2010,0x00c2010,0x008e010,
+	0x00c2010,0x1082010,0x0142410,0x0103010,0x0143010,0x0202810,0x0242010,0x0342010,0x0442012,0x0402018,0x0402810,0x0402110,0x1442010,0x04c2010,0x08c2010,0x0942010,
+	0x0006141,0x0002041,0x0082141,0x0007041,0x0402050,0x000210d,0x0082184,0x0042504,0x0006904,0x0002909,0x0002118,0x0042118,0x0026108,0x0142108,0x0042130,0x0202110,
+	0x0042130,0x0042120,0x1002120,0x1082120,0x0022150,0x00421c0,0x0002980,0x0002503,0x0002581,0x0102501,0x0042900,0x0003102,0x0043102,0x004b100,0x0022110,0x0042110,
+	0x0006100,0x004a101,0x100a100,0x0012103,0x0062900,0x1022900,0x0042110,0x0042110,0x0142100,0x00a2110,0x00c2110,0x0082108,0x0086100,0x00a2110,0x00a6100,0x10a2100,
+	0x1082100,0x0202901,0x0802118,0x0822110,0x0842110,0x0802110,0x2003101,0x0046500,0x0046081,0x1006002,0x0046404,0x0006809,0x1006008,0x0046018,0x0146008,0x0046810,
+	0x0046040,0x0406080,0x0046900,0x1006900,0x0086100,0x0066100,0x0046810,0x0046800,0x0046800,0x0047001,0x0007010,0x0047010,0x0007104,0x0007100,0x0047000,0x0046001,
+	0x0006014,0x0046010,0x0086010,0x0046040,0x0046100,0x1006000,0x1006800,0x0046002,0x0086100,0x0046400,0x1006400,0x0046000,0x004e000,0x000e801,0x0026101,0x0066100,
+	0x0066400,0x0027001,0x0067000,0x0046018,0x0066010,0x0046010,0x0086801,0x0086018,0x00a6010,0x00c6010,0x0187000,0x0106808,0x0106810,0x0146800,0x0146000,0x1106000,
+	0x014e000,0x0206011,0x0246001,0x0307000,0x1406001,0x0406018,0x0446800,0x04c6000,0x1486000,0x0806801,0x0846010,0x1106001,0x1006018,0x1046010,0x1102002,0x0102103,
+	0x0102085,0x1102008,0x0122018,0x0142018,0x0102118,0x2102088,0x0142020,0x0102051,0x0102418,0x0142410,0x0102801,0x0142800,0x0143002,0x0103010,0x1103000,0x1102000,
+	0x0162008,0x1122008,0x0162800,0x0162000,0x01c6000,0x11c2000,0x1002021,0x1002801,0x1002140,0x1042001,0x0004419,0x0024411,0x0105401,0x0024019,0x0044011,0x0044101,
+	0x00c4001,0x0086011,0x00a4011,0x00c4081,0x0244011,0x0006043,0x0004093,0x0004912,0x1044012,0x0044103,0x000411a,0x0084102,0x00c4102,0x0084212,0x0044012,0x0004812,
+	0x0004902,0x0044802,0x0005005,0x0024094,0x0044094,0x0024094,0x1024084,0x0024414,0x0024015,0x008400d,0x0086005,0x00c4005,0x1084804,0x0104904,0x0044089,0x0044809,
+	0x0006018,0x0105018,0x0045108,0x00c4108,0x0105108,0x0064008,0x0124008,0x1004818,0x1044808,0x1044021,0x0004038,0x0004130,0x0004861,0x00a4030,0x0045041,0x0004058,
+	0x0044050,0x0006140,0x00050c1,0x0204150,0x0004858,0x0024850,0x0044850,0x0005144,0x0064050,0x0044181,0x00061c0,0x0005184,0x0006090,0x0004109,0x0004918,0x0024910,
+	0x0046500,0x00c6100,0x0005310,0x000c501,0x1044401,0x0044490,0x0064401,0x00c4401,0x0004918,0x0004914,0x0006910,0x0086810,0x0044810,0x0105810,0x0044900,0x0044801,
+	0x0204801,0x0024810,0x0004910,0x1004840,0x000c811,0x004c810,0x0045001,0x0025012,0x0145002,0x0047010,0x0065010,0x00c5100,0x0005881,0x0245000,0x0025081,0x0026014,
+	0x0046014,0x0086014,0x0146004,0x1006810,0x0066010,0x1026010,0x0107100,0x0146400,0x1006801,0x0006018,0x0086104,0x0084102,0x0004098,0x000d080,0x00c6000,0x000c018,
+	0x0024110,0x0044010,0x0084108,0x2004018,0x2044010,0x004c081,0x004c801,0x004e010,0x000c010,0x000e140,0x004c000,0x004e100,0x008c018,0x00ac010,0x0024085,0x1024005,
+	0x0064801,0x0026041,0x00a6001,0x00a4011,0x002401a,0x0064005,0x0026104,0x0064008,0x0024019,0x0064030,0x0024141,0x0024144,0x0124050,0x0024102,0x0024910,0x0824101,
+	0x0064810,0x0026800,0x002c800,0x0025010,0x0066100,0x002e100,0x0064100,0x00a4080,0x0224801,0x2064000,0x0064005,0x0044085,0x0064110,0x0045104,0x0045800,0x0044101,
+	0x00c4101,0x0184401,0x10a4001,0x00a4001,0x00c4000,0x0184102,0x0184084,0x0146010,0x0104301,0x0144c00,0x0145001,0x1106008,0x014c001,0x010c018,0x010c090,0x014c080,
+	0x0124110,0x0144810,0x01c4000,0x1184002,0x0184018,0x01a4010,0x01a4000,0x0184001,0x2104810,0x2144000,0x0244801,0x0244810,0x0246010,0x0264010,0x02c4100,0x0204900,
+	0x0204800,0x0304810,0x0404094,0x0444110,0x0404818,0x0424810,0x0484810,0x0406018,0x0464010,0x0424110,0x0446010,0x0c04002,0x0864010,0x1804010,0x0844108,0x0844110,
+	0x0805110,0x0845100,0x080c900,0x08a4010,0x1064010,0x2004510,0x2004110,0x0048801,0x004a001,0x0048005,0x000801d,0x0028015,0x0048015,0x1008015,0x0008085,0x0048405,
+	0x004c005,0x0088005,0x00c8005,0x0048109,0x0008819,0x0009009,0x0028019,0x0028109,0x000a011,0x000c019,0x000e011,0x0008059,0x0028051,0x0048051,0x0008851,0x000c049,
+	0x0028141,0x0048501,0x0048901,0x004a101,0x0028111,0x0068101,0x0048101,0x0048111,0x0008401,0x0048801,0x1008801,0x0008811,0x0008819,0x0048811,0x0088811,0x0048901,
+	0x0008d01,0x0008801,0x0048801,0x1008801,0x0049801,0x1009801,0x0008901,0x0048801,0x0048801,0x0009001,0x080a001,0x000a015,0x000a009,0x004a009,0x100a009,0x000a019,
+	0x004a011,0x000a041,0x004a041,0x000b101,0x000e401,0x000a011,0x000a101,0x008e001,0x00ca001,0x108a001,0x000c901,0x000c801,0x0048001,0x0408001,0x0048011,0x0008101,
+	0x1008001,0x0028011,0x0068001,0x0028085,0x0028109,0x0068009,0x1028009,0x0028019,0x002a011,0x002c011,0x0068011,0x0128011,0x0228011,0x0028051,0x002c041,0x0068101,
+	0x0028501,0x0068401,0x1028401,0x0028811,0x1028801,0x0029001,0x002c801,0x0068001,0x0028001,0x0068001,0x00a8101,0x00e8001,0x0228011,0x022c001,0x004c011,0x0048011,
+	0x0048081,0x0049081,0x0048401,0x1048001,0x0048011,0x00c8001,0x0088019,0x008a011,0x00a8011,0x00c8011,0x00c8081,0x008a101,0x0088401,0x1088801,0x0088011,0x01c8001,
+	0x0148001,0x0148801,0x020a001,0x0208019,0x020a011,0x0228011,0x0248011,0x0208109,0x020a101,0x0248101,0x0448001,0x0408001,0x0408019,0x0428011,0x0448401,0x1408401,
+	0x0448801,0x044a001,0x0848011,0x1008019,0x102c001,0x1048009,0x0008051,0x0048051,0x0048411,0x1008411,0x0048811,0x004a011,0x0028011,0x0068011,0x00a8011,0x0048011,
+	0x00c8011,0x1088011,0x1208011,0x2008011,0x0048013,0x0048094,0x0008414,0x0048414,0x1008414,0x0048018,0x0048118,0x002c018,0x0008014,0x0048410,0x0048810,0x004a010,
+	0x100c010,0x0008010,0x0048010,0x0068010,0x1028010,0x0208010,0x1008050,0x00480d0,0x004a110,0x0048110,0x2008110,0x000a411,0x0048410,0x000a510,0x000c410,0x0048811,
+	0x0108811,0x0048810,0x0048830,0x0048810,0x0009811,0x000e810,0x0088811,0x00c8810,0x004a018,0x010a018,0x000a018,0x004a010,0x000e050,0x000a110,0x004a110,0x004a410,
+	0x000a011,0x000a110,0x00ca010,0x004e010,0x100e010,0x0008811,0x004c010,0x1008010,0x0048110,0x0028111,0x0028014,0x0068014,0x0128018,0x1028018,0x0028011,0x0068010,
+	0x0068110,0x0068410,0x0069010,0x006a010,0x002c050,0x0068010,0x1028010,0x0068010,0x00e8010,0x00e8010,0x0228010,0x022c010,0x0268010,0x1228010,0x004c010,0x00c8010,
+	0x10c8010,0x00a8011,0x00a8010,0x0088110,0x00a8010,0x00a8110,0x0088110,0x008c010,0x0408010,0x0488110,0x1048010,0x00080d1,0x000a0c1,0x0028091,0x0029081,0x0028090,
+	0x000a090,0x000e090,0x0048090,0x0008981,0x0048180,0x2008180,0x080c880,0x000c085,0x000e080,0x004e080,0x00cc080,0x0088080,0x01c8080,0x1008881,0x1008890,0x000a101,
+	0x004a101,0x0008903,0x0008905,0x0048105,0x1008104,0x0048504,0x008c104,0x0028105,0x0108904,0x000a118,0x0068110,0x00a8110,0x0088111,0x00c8110,0x200c110,0x00881c0,
+	0x1009140,0x000a140,0x0048501,0x0108501,0x0008518,0x0028510,0x0048510,0x1008510,0x0048500,0x0108d00,0x0008911,0x0008921,0x000c901,0x0028901,0x0108901,0x0408901,
+	0x0008984,0x0008911,0x0008918,0x0008910,0x0028910,0x0048910,0x0048900,0x0048900,0x040c900,0x0109900,0x0148900,0x0049101,0x0049100,0x004a101,0x000a118,0x004a110,
+	0x000e140,0x004a140,0x000e500,0x004a500,0x000a101,0x100a100,0x000e100,0x008e100,0x008a101,0x00ca100,0x010a100,0x004e100,0x100e100,0x014c100,0x100c110,0x104c100,
+	0x0008901,0x0048101,0x0008118,0x0048110,0x0088110,0x0048100,0x0088100,0x1008100,0x0108900,0x0028101,0x0068900,0x006a100,0x002c140,0x004c104,0x0048110,0x1048500,
+	0x004c100,0x1048100,0x00c8110,0x00c8101,0x00c8180,0x008e100,0x008c100,0x0088101,0x0149100,0x0848110,0x2008118,0x2048110,0x0048801,0x0008c05,0x0008851,0x004a801,
+	0x0048801,0x0048881,0x0049801,0x00c8801,0x00c8801,0x0088801,0x1088801,0x1008801,0x1048801,0x0048811,0x0008812,0x0048812,0x000a811,0x000e810,0x0048890,0x0448810,
+	0x0008905,0x0048910,0x0049900,0x000a940,0x000ad00,0x008c801,0x004c808,0x000e840,0x000ec00,0x000cc00,0x004c800,0x00cc800,0x208c800,0x010cc00,0x044c800,0x100c810,
+	0x104c800,0x0148810,0x0108820,0x0148840,0x0149800,0x1109800,0x018c800,0x018c800,0x1028810,0x000c085,0x000c401,0x000c411,0x100c002,0x004c404,0x100c404,0x000c809,
+	0x100c008,0x080c018,0x000c058,0x100c048,0x000c109,0x004d010,0x004c010,0x00cc010,0x100c050,0x000c050,0x004c040,0x000c098,0x010c900,0x000e108,0x000cc01,0x000c418,
+	0x004c410,0x100c410,0x000c510,0x000c818,0x002c810,0x004c810,0x100c810,0x000c900,0x004c900,0x000ca10,0x004cc00,0x004c800,0x100c800,0x004c800,0x00cc800,0x104c800,
+	0x000d012,0x004d010,0x100d000,0x004d000,0x004d000,0x000e014,0x100e004,0x004e008,0x004e010,0x100e010,0x000e041,0x000e040,0x004e040,0x100e040,0x004e400,0x00ce000,
+	0x108e000,0x210e000,0x004c008,0x000c018,0x004c020,0x100c020,0x004c080,0x000c201,0x000c401,0x004c400,0x004c800,0x004e000,0x004c000,0x100c000,0x002c100,0x00ac000,
+	0x00cc000,0x020c010,0x120c000,0x004c010,0x000c001,0x104c000,0x002c011,0x002c801,0x002c018,0x002c010,0x006c010,0x002c050,0x102c040,0x002e100,0x006c400,0x102c400,
+	0x002e000,0x006e000,0x102e000,0x00ac001,0x00ec000,0x10ac000,0x004c018,0x004c010,0x104c010,0x004c080,0x00cc000,0x008c011,0x008c084,0x008c018,0x00cc010,0x008e100,
+	0x008c000,0x10cc000,0x008c000,0x00cc000,0x108c000,0x010c020,0x014c020,0x010c410,0x014c400,0x010c810,0x010c800,0x018c800,0x010c010,0x018c000,0x016c000,0x01cc000,
+	0x040e001,0x040e100,0x040e008,0x044e000,0x140e000,0x042c010,0x080c018,0x084c010,0x108e000,0x110c000,0x104c010,0x300c000,0x0029001,0x0068009,0x0128081,0x0069001,
+	0x002a001,0x002a041,0x006c001,0x0068011,0x00a8011,0x00e8001,0x00a8001,0x10a8001,0x0168001,0x1068001,0x1028018,0x0028018,0x0068010,0x0028130,0x0069010,0x1029010,
+	0x00aa010,0x002e010,0x002c010,0x0068010,0x0068011,0x0068010,0x00e8010,0x0228010,0x1828010,0x1068010,0x0028901,0x1028104,0x0028130,0x0028110,0x0068110,0x0068140,
+	0x0028900,0x0029101,0x0029100,0x0029100,0x0069100,0x1029100,0x002a500,0x002e100,0x0068110,0x0068100,0x006c001,0x006c002,0x006c008,0x002d010,0x006c020,0x006c040,
+	0x002e100,0x002c410,0x002c810,0x002c800,0x002d000,0x006d000,0x002e400,0x006c000,0x002c010,0x006c000,0x006c000,0x00ec000,0x106c000,0x00ac000,0x012c800,0x046c000,
+	0x102e000,0x01aa000,0x01a8001,0x1028010,0x1068010,0x0148018,0x0448081,0x004e100,0x004c011,0x004c101,0x004c001,0x006c001,0x1048084,0x104c000,0x010c006,0x0148012,
+	0x0148102,0x010a005,0x0128014,0x0148014,0x0108405,0x0148404,0x1108008,0x0108058,0x010810c,0x012c008,0x1148008,0x0148008,0x0168010,0x0108021,0x0148020,0x1108040,
+	0x0108940,0x0148081,0x0108281,0x0148201,0x0148401,0x0108418,0x0128410,0x0148410,0x1108410,0x0108401,0x0148400,0x010c801,0x0148801,0x0108818,0x0128810,0x0148810,
+	0x0108d00,0x0148900,0x0108c01,0x0148c00,0x0108900,0x0148800,0x1108800,0x010d800,0x0148800,0x0148800,0x0149001,0x0109110,0x0149000,0x014a001,0x010a014,0x010a041,
+	0x014a040,0x010a300,0x010a401,0x014a400,0x110a400,0x110a000,0x018e000,0x01ca000,0x118a000,0x0108011,0x0148001,0x0148000,0x0128009,0x0128018,0x0168010,0x012a100,
+	0x0168100,0x0168800,0x1128000,0x0168000,0x1168000,0x11a8000,0x0148010,0x0148810,0x1148000,0x0188108,0x018e000,0x0188100,0x018c000,0x01c8000,0x2108810,0x040a018,
+	0x10c8001,0x10c8010,0x1008841,0x104a100,0x100e800,0x100a018,0x104a010,0x100c108,0x10cc000,0x1028801,0x102a001,0x1068010,0x1828010,0x1028104,0x106c000,0x1808018,
+	0x1848010,0x1808110,0x1848100,0x2008001,0x0050109,0x0050109,0x0010201,0x0092001,0x0018501,0x0010903,0x005c080,0x0035001,0x0150009,0x0110021,0x0150041,0x0130101,
+	0x0150101,0x1110401,0x0110811,0x0192001,0x0130011,0x0150001,0x0190011,0x01d0001,0x1110009,0x1150001,0x0190102,0x0112011,0x0111010,0x0112011,0x0132010,0x1112010,
+	0x1150010,0x0110184,0x0150108,0x0110120,0x0151100,0x0112101,0x0112110,0x0116100,0x0152100,0x0192100,0x011c100,0x0158100,0x0118100,0x0130110,0x01b0100,0x01d0100,
+	0x01d0100,0x0114009,0x0154008,0x0114120,0x0116100,0x0194100,0x0114800,0x0116400,0x015c000,0x0170080,0x1190010,0x00a0003,0x0020107,0x0060103,0x002001d,0x0060015,
+	0x0020095,0x0060405,0x0026005,0x0020059,0x0820109,0x0026009,0x0060021,0x00e0021,0x0060041,0x0020059,0x0020059,0x0020051,0x0020051,0x0060051,0x0020041,0x0060041,
+	0x1020041,0x0060141,0x0160041,0x0020099,0x0120181,0x0060101,0x0060109,0x0060501,0x0020911,0x0060901,0x0022111,0x0062101,0x0020109,0x00a0101,0x00e0101,0x0060201,
+	0x0060211,0x0020419,0x0020411,0x0020411,0x0060411,0x0020501,0x0060501,0x0160401,0x0060811,0x0021801,0x0021011,0x00a1011,0x0021111,0x0023101,0x0061101,0x1021001,
+	0x0069001,0x0161001,0x0062001,0x0022015,0x0062009,0x0022011,0x0022041,0x0022141,0x0062041,0x1022041,0x0022109,0x0062101,0x0022411,0x0062401,0x00e2001,0x0028019,
+	0x0028011,0x0068011,0x0028091,0x0028011,0x0020019,0x0020011,0x0060011,0x0060401,0x0060019,0x0060011,0x0060011,0x0068001,0x0060011,0x00e0001,0x00a0801,0x00a2001,
+	0x00e0001,0x00a0085,0x00a0019,0x00a0811,0x00a0011,0x00e0011,0x00a0081,0x00a0091,0x00e0081,0x00a4001,0x00e4001,0x01e0001,0x0162001,0x012c001,0x0220019,0x0220811,
+	0x0220011,0x0260011,0x1220011,0x0222101,0x0420011,0x0422101,0x1420801,0x0462001,0x0820019,0x0860011,0x1020081,0x1060001,0x1020019,0x1020811,0x1022011,0x2020019,
+	0x2020011,0x2020011,0x2060011,0x2024001,0x0020019,0x0060019,0x0060111,0x0060411,0x0024811,0x0060811,0x0021011,0x0061011,0x1021011,0x0062011,0x0068011,0x0060011,
+	0x00e0011,0x00a0011,0x00a0011,0x0220011,0x0020012,0x0020016,0x002011a,0x00a0112,0x002c012,0x1120012,0x0020815,0x0020014,0x0024014,0x1020014,0x00a0114,0x0060414,
+	0x0026014,0x00a0015,0x00a0114,0x00a4014,0x0022019,0x0060018,0x1020018,0x0020018,0x0060018,0x0020119,0x0020118,0x0028118,0x1020818,0x0026018,0x0064018,0x0824018,
+	0x1020018,0x012001a,0x0920018,0x1020018,0x0020094,0x0020018,0x0060018,0x0060030,0x1020030,0x0060410,0x1020410,0x0060810,0x0062010,0x00e0010,0x0220010,0x0020038,
+	0x0020830,0x0024030,0x0060130,0x0820130,0x1020830,0x1020030,0x0020051,0x0060050,0x0024050,0x0020150,0x0021051,0x0022051,0x0064050,0x0120050,0x0021090,0x0060130,
+	0x1020130,0x0020510,0x0060510,0x0022510,0x0062110,0x0020118,0x00e0110,0x0220110,0x0020350,0x0026210,0x0020418,0x0060410,0x1020410,0x00a0810,0x0020910,0x00a0910,
+	0x0024810,0x0023011,0x0029011,0x0023010,0x00a1010,0x0821010,0x0821110,0x1022011,0x0062018,0x1022010,0x0022051,0x0022150,0x0022110,0x0022010,0x0066010,0x00a2010,
+	0x00e2010,0x0024910,0x0024050,0x0028050,0x002a110,0x0028811,0x006c010,0x00ac010,0x0068010,0x002c010,0x0022011,0x0020150,0x00e0011,0x0460011,0x1060011,0x0060010,
+	0x0060010,0x0460010,0x0060118,0x00e0110,0x0064018,0x0464010,0x00e4010,0x00e0010,0x10e0010,0x0160010,0x00a0051,0x08a0011,0x00a1010,0x00a0111,0x00a0110,0x08a4010,
+	0x02a0010,0x0220110,0x0422011,0x0c20011,0x0420018,0x04a0010,0x0422110,0x0426010,0x04a0090,0x0860010,0x2060010,0x0060091,0x0021090,0x0121090,0x0060190,0x0021190,
+	0x0022190,0x1024088,0x0025082,0x0026090,0x0121082,0x1022090,0x10a0081,0x0060109,0x0060901,0x00a2101,0x00a0101,0x0060103,0x1020102,0x0060112,0x002011c,0x0020114,
+	0x0060114,0x1020114,0x00a0184,0x0022104,0x0060504,0x0060118,0x1020148,0x002010c,0x0060910,0x0061110,0x0220110,0x0020130,0x0060120,0x00a0130,0x00e0120,0x10a0120,
+	0x0060140,0x0024940,0x0020918,0x0060910,0x1020910,0x0020910,0x0060900,0x0021111,0x0021118,0x0021110,0x0061110,0x0161100,0x0062108,0x1022108,0x0062110,0x0062140,
+	0x0062500,0x0024301,0x00e4100,0x0028118,0x0068110,0x0068100,0x0060110,0x0060180,0x0060500,0x0068100,0x0160100,0x00e0110,0x00e0100,0x30a0100,0x0260101,0x0220118,
+	0x0220910,0x0222110,0x0260110,0x1020901,0x2060101,0x0064009,0x0065001,0x0066001,0x0064001,0x1024001,0x00a4011,0x002401a,0x0064012,0x0024812,0x0064404,0x0024018,
+	0x0064018,0x1124040,0x0064090,0x0064108,0x0064900,0x1024900,0x0066100,0x00e4100,0x0024601,0x0064300,0x0024418,0x0024410,0x0064410,0x0024841,0x0064810,0x0064820,
+	0x0064800,0x0025801,0x0027001,0x0025010,0x006d000,0x0026018,0x0026008,0x0026010,0x0066010,0x0026100,0x0026010,0x00a6010,0x00e6000,0x0064008,0x0064020,0x1024020,
+	0x0064400,0x1024400,0x0065000,0x0066000,0x006c000,0x102c000,0x0064001,0x0064010,0x00e4000,0x10a4000,0x002c018,0x002c010,0x006c010,0x102c010,0x0134010,0x0024801,
+	0x0064010,0x0024104,0x0024108,0x0024110,0x00e4000,0x10a4000,0x0064018,0x0064010,0x00e4010,0x0064180,0x0066100,0x00e4100,0x00e4100,0x00e4000,0x00a4801,0x00a6001,
+	0x00e4001,0x00a4084,0x00a4018,0x00e4010,0x00e4100,0x00e4800,0x00a6000,0x00e4000,0x00a4010,0x0126010,0x0164010,0x0124810,0x0164800,0x0165000,0x016c000,0x112c000,
+	0x01e4000,0x01a4080,0x01e4000,0x0224018,0x0226010,0x0264010,0x0426001,0x0424018,0x0424810,0x0426010,0x0424110,0x0425010,0x0426008,0x04a4080,0x04e4000,0x1026010,
+	0x10e4000,0x20a4010,0x20a4100,0x0122001,0x0120103,0x1120002,0x0120812,0x0160012,0x0122102,0x0120812,0x0120902,0x0160002,0x0120094,0x0160404,0x0160009,0x0160008,
+	0x0160018,0x0120118,0x0160108,0x0120019,0x0160010,0x0120030,0x0160020,0x0120051,0x0120841,0x1120040,0x0122140,0x0162100,0x0160480,0x0120818,0x0160810,0x0121801,
+	0x0125002,0x0123010,0x0161010,0x1121800,0x1121000,0x012d000,0x0169000,0x1129000,0x0122084,0x0162008,0x0122018,0x0162010,0x0162040,0x0122104,0x1122000,0x01e2000,
+	0x11a2000,0x0128101,0x0168000,0x0160000,0x0160001,0x0160010,0x1160080,0x0160400,0x0161001,0x0160010,0x01e0000,0x01e0080,0x01a2100,0x11a0000,0x1060801,0x10a0003,
+	0x1020418,0x1060410,0x1021010,0x1062008,0x10e4000,0x1028010,0x0040041,0x0040803,0x004001b,0x0060013,0x0040013,0x0040083,0x0042103,0x0060103,0x0040813,0x00c4003,
+	0x0060003,0x0060013,0x0040405,0x0060005,0x0044009,0x0040019,0x0040099,0x0140089,0x0040109,0x0044009,0x2040009,0x0040039,0x0040031,0x0040041,0x0060051,0x0040051,
+	0x1040041,0x0044041,0x0141041,0x0040093,0x0040183,0x0040115,0x0040505,0x0040105,0x0040109,0x0040141,0x0040901,0x0041101,0x0042111,0x0042101,0x0060101,0x00c0101,
+	0x00c0181,0x0144201,0x0040501,0x0060411,0x0040411,0x0040501,0x0040501,0x00c0501,0x0040801,0x00c0801,0x0048811,0x0040811,0x00c0811,0x0040905,0x0840901,0x0040811,
+	0x0041901,0x0044801,0x004c801,0x0048801,0x0048801,0x0040811,0x00c4801,0x00c0801,0x0140811,0x01c0801,0x0043001,0x0041001,0x0041003,0x0045003,0x0041411,0x0041811,
+	0x0043011,0x0041011,0x1041011,0x0141021,0x1041001,0x0049101,0x0049001,0x0042009,0x0042019,0x0042011,0x0042041,0x00420c1,0x0046041,0x0042041,0x0046401,0x0042001,
+	0x00c6001,0x00c2001,0x0044801,0x004a001,0x0048109,0x006c001,0x0062001,0x0060009,0x0060019,0x0060011,0x0060051,0x0064041,0x0062101,0x0060101,0x0060401,0x1060401,
+	0x0064009,0x0064001,0x0160001,0x0060011,0x0042101,0x0040011,0x00c0101,0x10c0001,0x00c0019,0x00c1011,0x00c0011,0x00c0101,0x0140003,0x0140085,0x01400c1,0x0140801,
+	0x01c0801,0x01c2001,0x1160001,0x01c0001,0x0240019,0x0260011,0x0240011,0x1240011,0x0242101,0x0440081,0x0440019,0x0460011,0x0840011,0x1040019,0x1060011,0x1040109,
+	0x1042011,0x1046001,0x10c0001,0x2040011,0x0040007,0x004000d,0x0040025,0x0040045,0x0040905,0x0040805,0x0040805,0x0041005,0x004200d,0x0042005,0x0048005,0x0048015,
+	0x0048105,0x0068005,0x0060005,0x00e0005,0x00c0085,0x00c0005,0x00c0005,0x014000d,0x0148005,0x0160005,0x0440005,0x00c0015,0x0042015,0x004201c,0x0240085,0x0045084,
+	0x0140884,0x0440085,0x0041904,0x104400c,0x0044044,0x0044044,0x00c4004,0x004c005,0x004c004,0x00c4004,0x0144044,0x014c004,0x044c004,0x0444004,0x0060007,0x0060015,
+	0x0060045,0x0062005,0x00e0005,0x0460005,0x1060005,0x0061104,0x0068104,0x0064006,0x006400c,0x0064044,0x0464004,0x014010c,0x014400c,0x014000c,0x0140024,0x01c0024,
+	0x0140044,0x0140c04,0x0140804,0x0148804,0x0140804,0x0141004,0x0148004,0x0160024,0x0160004,0x0140014,0x01c0005,0x01c0014,0x01c0004,0x2140004,0x1040014,0x1042009,
+	0x0042118,0x0040811,0x0041011,0x0041011,0x1041011,0x0042011,0x0060011,0x0060011,0x0040011,0x00c0011,0x2040011,0x0141012,0x0044014,0x0040094,0x00c0014,0x0060018,
+	0x0040018,0x0040058,0x1040058,0x0141018,0x0040018,0x0040410,0x0040818,0x0040810,0x1040810,0x0041010,0x0048010,0x1048010,0x0060010,0x0060030,0x0060051,0x0042150,
+	0x0046050,0x0044850,0x0044050,0x0060190,0x0040130,0x0040910,0x0042110,0x0060110,0x0040110,0x0041110,0x10c0110,0x2040111,0x0044410,0x00c0410,0x0040891,0x0040810,
+	0x0040830,0x0040811,0x0040810,0x0040810,0x0240811,0x0041010,0x0041010,0x0041110,0x0041110,0x0042011,0x0042018,0x0042010,0x0042150,0x0042011,0x0066010,0x0042011,
+	0x0042110,0x00c2010,0x00c2110,0x00c2010,0x1242010,0x2042011,0x0048019,0x0048811,0x0048114,0x104c010,0x00c8011,0x00c8010,0x0060015,0x0060111,0x0060811,0x0060018,
+	0x0060010,0x0060010,0x0060030,0x0060050,0x0060114,0x0062110,0x0060410,0x0066010,0x0464010,0x0060011,0x0060010,0x0060010,0x1060010,0x0264010,0x1040010,0x0040011,
+	0x00c0011,0x00c0811,0x00c6010,0x00c0010,0x0442011,0x0460011,0x0440018,0x0440810,0x0442010,0x0442110,0x0840018,0x0860010,0x0840010,0x08c4010,0x08c0010,0x1042010,
+	0x0040089,0x00400c1,0x0040081,0x0044481,0x00c0481,0x0041881,0x1040881,0x0041081,0x0041081,0x0042089,0x0042081,0x0048081,0x0062081,0x0040081,0x0140881,0x0441081,
+	0x0442081,0x0440081,0x1040081,0x1040081,0x0040184,0x00400b1,0x0040891,0x0040091,0x0040098,0x0040890,0x0042098,0x00c2090,0x0044890,0x0060098,0x0060090,0x0064090,
+	0x00c0090,0x0240091,0x0442090,0x0440090,0x0040181,0x0040990,0x0060190,0x0040190,0x0040980,0x1040980,0x0041180,0x0042180,0x0048180,0x0060180,0x0060180,0x0040180,
+	0x0044180,0x00c0180,0x00c0190,0x00c0180,0x0160180,0x0240181,0x0240190,0x0240180,0x0048890,0x0140882,0x0041490,0x0045090,0x00c4081,0x0044098,0x0064090,0x0044090,
+	0x00441c0,0x00440c0,0x0044380,0x0044280,0x0044881,0x0044880,0x0046080,0x0044080,0x004c090,0x004c080,0x0064880,0x00c4090,0x00c4080,0x00c4080,0x0444088,0x0444080,
+	0x1144080,0x0060098,0x0060180,0x0464080,0x00c0580,0x01c1080,0x01c8080,0x0140890,0x0142880,0x0140880,0x0142080,0x0160081,0x01c0090,0x01c0080,0x0440081,0x1060090,
+	0x0040901,0x0040102,0x1040902,0x0040114,0x00c0184,0x0044504,0x0040504,0x1040504,0x0040109,0x0040118,0x0060118,0x0040118,0x0040189,0x0040198,0x0040918,0x0040918,
+	0x0042110,0x00c2110,0x00c0190,0x0160110,0x00c0120,0x00401c0,0x0040940,0x0040941,0x0042141,0x0042140,0x0044300,0x0040501,0x0060510,0x0040510,0x0040908,0x0040918,
+	0x0042910,0x0060910,0x0040910,0x0840910,0x0040d00,0x0040900,0x0044900,0x00c0900,0x10c0900,0x0240901,0x0061101,0x0041101,0x0041103,0x0041100,0x0049100,0x0141900,
+	0x0042108,0x0042118,0x0042110,0x0042140,0x0042180,0x0042500,0x1042500,0x0142100,0x0048118,0x0048110,0x1048100,0x0060118,0x0060110,0x0060110,0x0060180,0x0060100,
+	0x0064104,0x0060101,0x0168100,0x0040901,0x0040110,0x00c0101,0x00c0100,0x00e0101,0x00c0118,0x00c0110,0x00c0190,0x00c0501,0x01c8100,0x01c0100,0x0260110,0x0860110,
+	0x0840110,0x0845100,0x08c0110,0x2060101,0x2040118,0x2040910,0x2060110,0x2040110,0x0040441,0x0040d01,0x0040c09,0x0042401,0x00e0401,0x00c0401,0x00c0401,0x0440401,
+	0x0042411,0x0060411,0x0040418,0x0040418,0x0040430,0x0042410,0x0060410,0x0040410,0x00c0410,0x0040450,0x0040450,0x0042510,0x0040c30,0x0040c10,0x0041c10,0x0048c10,
+	0x0042410,0x0042410,0x0044410,0x0048410,0x0060410,0x00c0410,0x0440410,0x0040508,0x0040518,0x0040510,0x1040510,0x0045500,0x0041500,0x0042500,0x0042500,0x00c2500,
+	0x0044500,0x0048500,0x0060d00,0x0060500,0x00c0510,0x00c0500,0x0240510,0x1240500,0x0041d00,0x0044c01,0x1044408,0x0044420,0x0044440,0x0044c00,0x0044c00,0x00e4400,
+	0x0044480,0x0062401,0x0060500,0x0140401,0x0140440,0x1040418,0x1060410,0x1040410,0x1040420,0x1060410,0x1060400,0x10c0410,0x0040803,0x0040819,0x0040811,0x0040841,
+	0x0040909,0x0040c11,0x0041801,0x0042811,0x0042c01,0x0048801,0x00e0801,0x00c0801,0x10c0801,0x0440801,0x1040801,0x0040812,0x0040818,0x0060810,0x0440810,0x1040810,
+	0x0060910,0x1040900,0x0041900,0x0048910,0x0048900,0x00c8900,0x0040980,0x00c0900,0x0240910,0x0046801,0x0044802,0x0044810,0x0044840,0x0044908,0x0044a08,0x0045800,
+	0x0045800,0x00c4800,0x004c800,0x104c800,0x0065800,0x00c4800,0x0244810,0x0444800,0x1044808,0x0140802,0x0140802,0x0140818,0x0140810,0x0140820,0x0140840,0x01c0900,
+	0x0141800,0x0160802,0x0160800,0x0140810,0x01c0800,0x1060810,0x1048810,0x0041401,0x0041501,0x0041801,0x00c1801,0x0061001,0x2041011,0x0041410,0x0041010,0x0041510,
+	0x0041410,0x0061410,0x0441010,0x0061100,0x0061100,0x00c1100,0x0045040,0x0045400,0x00c5800,0x0065000,0x00c5000,0x0065010,0x0065040,0x01c5000,0x04c5000,0x0141040,
+	0x0161000,0x0141080,0x01c1000,0x0042003,0x0142021,0x0042041,0x004a001,0x0062021,0x0062401,0x0062001,0x1062001,0x0042081,0x00c2081,0x0442001,0x0042019,0x004a011,
+	0x0042012,0x0042414,0x0042018,0x0042018,0x0042010,0x0042810,0x0042102,0x0042504,0x0042110,0x00c2120,0x0042140,0x004a100,0x104a100,0x00e2100,0x00c2100,0x0046002,
+	0x0046008,0x0046410,0x004e010,0x0046040,0x0046410,0x0046008,0x0046400,0x0046800,0x00c6000,0x00c6000,0x0446400,0x0446000,0x0142002,0x0142040,0x0142080,0x1042010,
+	0x0044401,0x004c001,0x0064011,0x0064001,0x0244011,0x0044003,0x0044005,0x0044014,0x0044404,0x0044404,0x0044814,0x0044009,0x1044008,0x004410c,0x0045008,0x0064021,
+	0x0044021,0x00c4021,0x00c4020,0x10c4020,0x0064050,0x0164080,0x0044900,0x1044900,0x0044201,0x0144200,0x0044481,0x0046410,0x0044410,0x0044c00,0x0044881,0x0046801,
+	0x0044801,0x0044818,0x0044908,0x0044808,0x0044808,0x0044818,0x0044910,0x0064810,0x0044810,0x0046800,0x0044800,0x0145800,0x0144800,0x0047001,0x0045001,0x0046014,
+	0x0046018,0x0046010,0x0046040,0x1046800,0x0046010,0x1046000,0x0046010,0x1046000,0x1044010,0x0044400,0x1044400,0x0044810,0x0044800,0x0045000,0x004c000,0x00c4010,
+	0x00c4000,0x004c080,0x104c080,0x006c000,0x104c000,0x006c001,0x0064801,0x0064001,0x0064002,0x0064002,0x0064009,0x0064008,0x0064008,0x0064018,0x0064010,0x0064810,
+	0x0064010,0x0064010,0x0864010,0x0064040,0x0066000,0x0064001,0x00e4001,0x00e4000,0x0164000,0x00c4080,0x00c4800,0x0144014,0x01c4004,0x01440c0,0x0144400,0x0144800,
+	0x0145000,0x014c000,0x114c000,0x0164000,0x0144010,0x01c4000,0x0464001,0x0444014,0x0444018,0x0444020,0x0444020,0x0444810,0x0444800,0x0445000,0x0446008,0x0446010,
+	0x044c000,0x0444010,0x04c4080,0x1044001,0x1044810,0x3144000,0x2046100,0x1048005,0x004c009,0x0048019,0x0068011,0x0048011,0x0048041,0x0048181,0x0048901,0x004a101,
+	0x00c8101,0x0048411,0x0048809,0x0048811,0x0048801,0x00c8801,0x0049001,0x004a011,0x004a041,0x004a001,0x0068009,0x0068001,0x00e8001,0x00c8011,0x00c8001,0x0148801,
+	0x0448801,0x0448001,0x1048009,0x1048001,0x2048001,0x2048001,0x0048811,0x004a011,0x00c8011,0x0048014,0x00c8014,0x0048810,0x0068010,0x0048910,0x0068110,0x0048410,
+	0x0048818,0x0048c10,0x004c010,0x00c8010,0x0148050,0x0448010,0x1448010,0x0048901,0x0048105,0x0048504,0x0048104,0x0048118,0x0068110,0x0048110,0x0048120,0x0048120,
+	0x0048500,0x0048910,0x0049100,0x004a101,0x004a500,0x004a100,0x00e8100,0x1068100,0x00c8100,0x20c8100,0x0248100,0x1048801,0x004c840,0x004c018,0x004c008,0x004d000,
+	0x006c000,0x00cc000,0x006c400,0x004c080,0x00cc000,0x0068009,0x0068041,0x00e8001,0x0068018,0x0468010,0x00e8100,0x006c008,0x006c040,0x0168010,0x0168040,0x0148008,
+	0x0148018,0x0168010,0x0148010,0x0148040,0x0148810,0x0149010,0x1149000,0x0168000,0x01c8001,0x1048801,0x1068010,0x0150003,0x0550001,0x0150050,0x0150108,0x01d0100,
+	0x2150100,0x00c0003,0x00c0019,0x00c0041,0x10c0041,0x00c0141,0x00c2011,0x00c2041,0x00c8081,0x00c8001,0x00e2001,0x00e0001,0x00e0001,0x00c0001,0x01c2001,0x04c0001,
+	0x10c0001,0x00c2011,0x00e0011,0x00c0018,0x00c0018,0x00c0018,0x00c0410,0x00c1010,0x00c2010,0x00c0910,0x00c0811,0x00c0810,0x00c0810,0x00c1010,0x00c1010,0x00c2018,
+	0x00c6010,0x00c2010,0x00c2010,0x00c8010,0x00c8010,0x00e0010,0x00c0010,0x04c0010,0x14c0010,0x10c0010,0x00c0184,0x00c0118,0x00c0110,0x00c0902,0x00c0910,0x00c1110,
+	0x00c1100,0x10c1100,0x00c8101,0x00c8110,0x00e0110,0x00e0500,0x00e8100,0x00e0100,0x02c0110,0x12c0100,0x00c4011,0x00c4101,0x00c4001,0x00c4001,0x00c4002,0x00cc010,
+	0x10c4040,0x00c4100,0x00c6800,0x00c5001,0x00c6008,0x00c6040,0x00c6400,0x00c6000,0x00c4400,0x00e4000,0x00cc010,0x00cc000,0x00cc000,0x00c4000,0x00c4000,0x00c4000,
+	0x01c6000,0x01cc000,0x01e4000,0x04c6000,0x04cc000,0x04c4000,0x00e0009,0x00e0011,0x00e0041,0x00e0401,0x00e8010,0x04e0010,0x00e0101,0x00e0140,0x00e1100,0x00ec000,
+	0x04e4000,0x10e4000,0x01e1000,0x01c0002,0x01c0018,0x01c0008,0x01c0800,0x01c1800,0x01c1000,0x01c1000,0x01c2000,0x01c8001,0x01c8010,0x01e0010,0x01e0000,0x10c0018,
+	0x10c0010,0x10c0900,0x10c4800,0x10c1010,0x10c1000,0x10e0010,0x10c0010,0x0140083,0x0140003,0x1140002,0x0160012,0x0140083,0x0140104,0x0140404,0x1140404,0x0160014,
+	0x0140008,0x0164008,0x1140008,0x0140018,0x01c2010,0x0160010,0x01c0010,0x01c0010,0x11c0010,0x0142041,0x01400c0,0x0144040,0x0160080,0x0140108,0x01c2100,0x01c0100,
+	0x0140210,0x0140480,0x0140400,0x0140904,0x0140821,0x0144820,0x0140c00,0x0148880,0x0140800,0x0141100,0x0141001,0x0145000,0x0149080,0x0149000,0x0142100,0x0142400,
+	0x0142001,0x0142000,0x014a000,0x0148010,0x0168001,0x0160081,0x0160801,0x0160001,0x01e0001,0x0160008,0x0160018,0x0160010,0x0160020,0x1160020,0x1160040,0x0160001,
+	0x0140018,0x0140010,0x0140000,0x01e4000,0x01e0001,0x01c0001,0x0440003,0x0440405,0x0440009,0x0440051,0x0440041,0x0440901,0x0442101,0x0440811,0x1440801,0x1441001,
+	0x0442041,0x0442401,0x0442001,0x0448001,0x04c8001,0x0460009,0x0460011,0x0460021,0x04e0001,0x04c0001,0x1440801,0x1440001,0x0440811,0x0440018,0x0440018,0x0440810,
+	0x0460010,0x0440010,0x0460110,0x04c0810,0x0460030,0x1440010,0x0440110,0x0440140,0x0440910,0x0441100,0x0442500,0x0448110,0x0460110,0x0440100,0x04c0180,0x04c0100,
+	0x0640110,0x2440100,0x0444002,0x0444810,0x0446800,0x044c000,0x04cc000,0x04c4000,0x0546000,0x1040012,0x1040902,0x1044012,0x1444002,0x1040014,0x1040014,0x1046004,
+	0x1042010,0x1060410,0x1040410,0x1040900,0x1048880,0x1240801,0x1061001,0x1042084,0x1042004,0x1042008,0x1042018,0x1042010,0x10c2080,0x1048018,0x1048010,0x1048080,
+	0x1060081,0x1062010,0x104c000,0x10c0090,0x1260010,0x00c0801,0x0080001,0x00a0013,0x00c0013,0x008010b,0x00c0103,0x0080803,0x00a4003,0x0182003,0x01c0003,0x0082005,
+	0x00c0015,0x0080015,0x0080095,0x0084085,0x00c0085,0x00c0405,0x00c4005,0x00c0005,0x00c0811,0x0080121,0x1080041,0x0081041,0x00c0081,0x00e0081,0x0080141,0x00c0141,
+	0x0084501,0x00c0901,0x00c2101,0x00a0101,0x00c0181,0x00c0101,0x00c0211,0x00c0401,0x00c0411,0x0080581,0x0082501,0x00c0501,0x1080401,0x0080c01,0x0090801,0x00a0801,
+	0x00c0801,0x00c0805,0x1080805,0x0080811,0x00a0811,0x00c0811,0x00c0c01,0x1080c01,0x00c0801,0x0081801,0x0088801,0x0180c01,0x01c0801,0x0081801,0x0081019,0x00c1011,
+	0x0083101,0x00c1101,0x1081001,0x00c9001,0x00c2001,0x0082041,0x0082141,0x00c2041,0x00c2081,0x0082401,0x00c2401,0x1082401,0x0082001,0x10c2001,0x0082101,0x0086001,
+	0x1082001,0x00c8001,0x0088019,0x008a011,0x00c8011,0x0088011,0x00c8101,0x0088001,0x01c8001,0x00e0001,0x00a4009,0x00a0019,0x00e0011,0x00a0041,0x00a0051,0x00e2001,
+	0x00a4005,0x00a4401,0x00e4001,0x00e8001,0x00a0011,0x10a0001,0x00e0101,0x00e0001,0x10a0001,0x00e0001,0x00c0019,0x00e0011,0x00c0011,0x00c0401,0x00c0001,0x00c0011,
+	0x00c4001,0x00a0001,0x00a0011,0x00c0011,0x00c0081,0x0080111,0x0184001,0x00c0001,0x01c0001,0x0180013,0x0180809,0x0186001,0x0188011,0x01c0001,0x0280081,0x02c0001,
+	0x02a0011,0x0480101,0x04c0001,0x0480019,0x04a0011,0x0480111,0x04c0011,0x04c0001,0x0880019,0x08a0011,0x08c0011,0x08c0101,0x0884801,0x0886001,0x08a4001,0x09c0001,
+	0x10a0001,0x2080001,0x2080011,0x0080019,0x00c0019,0x0080019,0x00c0411,0x00c0811,0x00c1011,0x00e0011,0x00c0011,0x2080011,0x00c0094,0x1080094,0x0080015,0x00c0810,
+	0x00c1010,0x0082018,0x0082010,0x00c2010,0x1082010,0x00e0010,0x00c0030,0x00c0050,0x0180051,0x01c0050,0x00e0090,0x0080118,0x00c0910,0x0082118,0x00c2110,0x0080811,
+	0x0084814,0x00c0810,0x0880810,0x0080911,0x0080914,0x00c0810,0x1080810,0x0084910,0x00c4810,0x0081018,0x00c1010,0x0089110,0x00c9010,0x0089010,0x00c1010,0x0082094,
+	0x00c2018,0x0182018,0x00c2010,0x0082050,0x0082111,0x0082010,0x0086010,0x1082010,0x0086010,0x00c2010,0x1082010,0x0182010,0x0088811,0x00c8011,0x108c010,0x00a0111,
+	0x00e0011,0x00a0014,0x00a0410,0x00e0010,0x00a0030,0x00e0030,0x00a0051,0x00e1010,0x00a2010,0x00e2010,0x10a0010,0x00e0010,0x00c0811,0x00c0011,0x00c0010,0x00c0010,
+	0x00c0010,0x00c0090,0x00a0011,0x00a0110,0x0180094,0x01800d0,0x0480018,0x0480810,0x0480110,0x08c0011,0x08c0010,0x08c0010,0x0080485,0x00801c1,0x0081181,0x0080891,
+	0x0080981,0x0082081,0x0082091,0x00820c1,0x00c2081,0x0882081,0x00a1081,0x00e0081,0x04c0081,0x1480081,0x0080092,0x0080095,0x0080098,0x0080490,0x00c0090,0x00820d0,
+	0x0080194,0x0082190,0x00808b0,0x0081091,0x00c2090,0x0484090,0x00a1090,0x00c8090,0x0080090,0x04c0090,0x1480090,0x00c01c0,0x0080d80,0x0080980,0x0082190,0x00c2180,
+	0x0084980,0x00a0980,0x00840a0,0x0084890,0x0084980,0x00a4080,0x00ac080,0x01c4080,0x0484880,0x00a0091,0x04a0081,0x00a0188,0x00a8180,0x00a4090,0x01c0088,0x01c00c0,
+	0x0180281,0x0182480,0x01a0880,0x1180081,0x1081180,0x1081080,0x00c2101,0x00e0101,0x0080905,0x0080105,0x008011c,0x00c0114,0x1080184,0x00c0504,0x1080504,0x1080108,
+	0x0080118,0x00c0118,0x00e0110,0x00c0120,0x00c4120,0x00c0120,0x00c0150,0x0086140,0x00c0501,0x00c0510,0x00c0500,0x0080501,0x0080d01,0x0080918,0x00a0910,0x00c0910,
+	0x00c0900,0x1080900,0x0080980,0x00c0900,0x0085102,0x0081118,0x00c1110,0x0087100,0x00c9100,0x00c2101,0x0082104,0x00c2108,0x0082111,0x0082118,0x00c2110,0x0082150,
+	0x00c2140,0x00c2500,0x1082100,0x00c2100,0x1082100,0x00c8100,0x1088100,0x00a0118,0x00e0110,0x00e0900,0x00e4100,0x00e0100,0x0080184,0x00a0110,0x00c0100,0x00a0110,
+	0x1080100,0x0188100,0x1082100,0x10c2100,0x20c0110,0x3080100,0x00c4009,0x1084009,0x2084011,0x00c4404,0x1084404,0x00c4004,0x0084018,0x00c4011,0x00c4020,0x1084020,
+	0x00c4020,0x01c4020,0x0084051,0x00c4041,0x0084058,0x00c4050,0x0184050,0x00c4080,0x0084910,0x00c4900,0x0086140,0x00c4110,0x00c4100,0x1084401,0x0084418,0x00a4410,
+	0x00c4410,0x00c4400,0x0086801,0x00a4801,0x00c4801,0x0084818,0x00c4810,0x00c4800,0x1084800,0x00c4800,0x01c4800,0x1084800,0x0087001,0x00c5002,0x00c5010,0x0085101,
+	0x1085000,0x00c5000,0x0086108,0x0086008,0x0086018,0x00a6010,0x00c6010,0x1086010,0x00c6040,0x0086401,0x00c6400,0x0086010,0x01c6000,0x00c4800,0x00c5000,0x00c6000,
+	0x00c4000,0x008c018,0x008c010,0x008c410,0x00ac010,0x00cc010,0x008c090,0x008c180,0x00cc080,0x00cc100,0x008c100,0x00cc000,0x108c000,0x0194010,0x00a4081,0x00a6001,
+	0x00e4001,0x00e4004,0x00e4010,0x00a4104,0x00a4100,0x00e4000,0x00a4000,0x00e4000,0x00e4010,0x00e4100,0x00e4400,0x00a4001,0x00a4010,0x00e4000,0x00c4001,0x00c4018,
+	0x00c4010,0x10c4080,0x10c4000,0x0084018,0x00a4010,0x00c4010,0x1084000,0x01c4400,0x01c6000,0x01e4000,0x01c4010,0x11c4000,0x01c4000,0x2184010,0x3184000,0x0484018,
+	0x0484110,0x04c6000,0x1486000,0x04c4010,0x14c4000,0x04c4000,0x2484010,0x3484000,0x1084018,0x10a4010,0x1086000,0x10c4000,0x2084018,0x20c4010,0x2084110,0x00e0003,
+	0x00e0009,0x00a0141,0x00a0501,0x00e1001,0x00a2401,0x00b2001,0x00e2001,0x00a2001,0x00a8011,0x00e8001,0x00a8001,0x00e0001,0x00e0001,0x00a0001,0x02a0011,0x10a0021,
+	0x10e0001,0x00a0414,0x00a0018,0x00a2010,0x00e0010,0x00a0031,0x00a0130,0x00e0410,0x00a1011,0x00e1010,0x00e0010,0x00e0010,0x00e0010,0x04e0010,0x10a0030,0x10e0010,
+	0x00a0105,0x00a0118,0x00a0110,0x00e0110,0x00a0120,0x00a4140,0x00e0140,0x00a0510,0x00a0908,0x00a0900,0x00e1100,0x00a2110,0x00e2100,0x00a4900,0x00a4100,0x00e4100,
+	0x00e8100,0x10a8100,0x00e0100,0x00a4009,0x00a4401,0x00a4001,0x00a4404,0x00a4018,0x00e4008,0x00e4040,0x00e4100,0x00a4410,0x00ad000,0x00a6001,0x00a6004,0x00a6010,
+	0x00a6400,0x00e6000,0x20a4000,0x00a4080,0x00e4000,0x04e4000,0x10e4000,0x01a0018,0x01e0010,0x01a4040,0x01e0040,0x01a0800,0x10a0010,0x10a0410,0x10a1001,0x10e8000,
+	0x00c0019,0x00c0109,0x00e0001,0x00c0418,0x01c0003,0x01c4002,0x01c2001,0x01a0001,0x0180081,0x0180013,0x01a0003,0x01c0003,0x1180002,0x018001a,0x01c0012,0x01c0404,
+	0x01c0021,0x0180030,0x01c0020,0x01c0020,0x1180020,0x01a0041,0x0180910,0x0182101,0x01c1100,0x0180400,0x01c0810,0x0188801,0x01c0900,0x0181108,0x1181000,0x01c9000,
+	0x1189000,0x01c2001,0x01c2008,0x0182018,0x01a2010,0x01c2010,0x01c2040,0x1182000,0x0188410,0x0188500,0x0188810,0x0190010,0x01e0008,0x01e0020,0x11a0020,0x01e0400,
+	0x01a1010,0x01e1000,0x01e2000,0x01a2000,0x01e8000,0x01e0000,0x11c0080,0x01c0400,0x11c0400,0x0180010,0x0180100,0x1180000,0x01c0000,0x09c0010,0x11a0010,0x04c0011,
+	0x0482101,0x04c0801,0x0482401,0x04c0001,0x14c0001,0x0480810,0x0482010,0x0488010,0x04a0010,0x04a0410,0x04a8010,0x04a0110,0x04c0140,0x0480900,0x0480900,0x0482500,
+	0x04c2100,0x1482100,0x04a0110,0x04a8100,0x0480110,0x04c0100,0x04a4010,0x14a0010,0x10c0010,0x10e0010,0x1082100,0x10c0410,0x10a0810,0x10c9000,0x1082018,0x1082018,
+	0x10c2010,0x1088801,0x1088018,0x10c8010,0x1088010,0x1088104,0x10cc000,0x10c8000,0x108c000,0x10a2001,0x10a0018,0x10e0010,0x10e4000,0x1080090,0x20e0001,0x0140809,
+	0x0146008,0x0100941,0x0100058,0x0102881,0x0120080,0x0140411,0x0101801,0x0142801,0x0101811,0x0103900,0x0102809,0x0102811,0x0122801,0x0142801,0x010a801,0x0340801,
+	0x1100910,0x2100910,0x0101101,0x0101812,0x0121012,0x0101812,0x0145002,0x0121012,0x0101105,0x0101501,0x0111101,0x0101081,0x0141001,0x0101018,0x0109018,0x0149080,
+	0x0109110,0x1189000,0x0121081,0x0161001,0x0142101,0x018a001,0x0123001,0x1122001,0x0142001,0x0102043,0x0102003,0x0122003,0x010201a,0x010210a,0x0906002,0x010a005,
+	0x0142014,0x0102105,0x0146004,0x1106004,0x0142004,0x0103009,0x0102018,0x0146008,0x0102048,0x0182090,0x0902120,0x0102041,0x0182050,0x0106048,0x0186040,0x0103040,
+	0x0182081,0x010a180,0x0102105,0x01c2100,0x0103201,0x0102418,0x0182410,0x0102508,0x0502801,0x1102801,0x0102818,0x0182810,0x0102908,0x0103001,0x0503010,0x0903100,
+	0x110a001,0x010a050,0x010a010,0x010a100,0x0122018,0x0122108,0x0122140,0x012a100,0x0542001,0x1142001,0x0142010,0x0542010,0x0942010,0x0146008,0x0982001,0x0182100,
+	0x0582010,0x0582100,0x0506000,0x050c002,0x1108012,0x014c008,0x1128008,0x010a018,0x0188210,0x1108801,0x0108818,0x0188900,0x0108018,0x012a001,0x012a000,0x0148010,
+	0x1148010,0x0188401,0x01a8010,0x0188110,0x0120111,0x0120901,0x0164001,0x0120011,0x0120101,0x0160011,0x01a0011,0x0920012,0x0120103,0x0120018,0x0120811,0x0160011,
+	0x0124018,0x0120114,0x0122011,0x01a2010,0x0120058,0x0120050,0x0160050,0x0120901,0x01a0110,0x0123001,0x0122801,0x0122018,0x0128018,0x0160011,0x0160108,0x0166000,
+	0x0120002,0x0360001,0x0160010,0x0142011,0x0150010,0x0160010,0x1160000,0x01a0110,0x0300811,0x0340011,0x0300801,0x0300005,0x0200019,0x0240019,0x0200841,0x0340041,
+	0x0240901,0x0220111,0x0260101,0x1220101,0x0240401,0x0200d01,0x0240811,0x0240901,0x0240811,0x0249001,0x1209001,0x0202009,0x0202019,0x0242011,0x0242041,0x02c2001,
+	0x0208019,0x0228011,0x0248011,0x0222001,0x0260001,0x1220009,0x0220015,0x0260011,0x0220101,0x0a20101,0x0222001,0x0360001,0x0220011,0x0240801,0x0240011,0x02c0001,
+	0x12c0001,0x0280105,0x03c0001,0x0300085,0x0380011,0x03c0001,0x0680011,0x0a40011,0x0200811,0x0240811,0x1200811,0x0202011,0x0248010,0x0260010,0x1220010,0x0240051,
+	0x0240050,0x0200150,0x0244050,0x0201090,0x0240910,0x1200910,0x0242110,0x1202110,0x0220811,0x0240818,0x0280818,0x0240810,0x0240810,0x0301810,0x0202011,0x0202811,
+	0x0242018,0x0302018,0x1202010,0x0202050,0x0202110,0x02c2010,0x0342010,0x0260012,0x0220011,0x1220010,0x02e0010,0x02e0010,0x03a0010,0x0248011,0x02c0011,0x02c0010,
+	0x0280094,0x0a00018,0x0a20010,0x0a40010,0x0a00910,0x2220110,0x0240901,0x0202109,0x0240112,0x0a00112,0x1200112,0x020011c,0x0240114,0x1200184,0x0260110,0x0640110,
+	0x1600110,0x0200129,0x0240120,0x0240141,0x0200141,0x0200918,0x0220910,0x0200900,0x0240900,0x0203110,0x0202901,0x0242101,0x0202105,0x0202118,0x0222110,0x0242110,
+	0x0602110,0x0202104,0x0246100,0x02c2100,0x0204908,0x0244900,0x0220118,0x0224110,0x0260110,0x0220141,0x0220150,0x0220108,0x0260900,0x03a0100,0x0240101,0x0240118,
+	0x0240110,0x0240110,0x0242110,0x0246100,0x02c4100,0x0280111,0x02c0101,0x0a80110,0x02a4100,0x0280101,0x0240101,0x0280101,0x0200109,0x0220110,0x0240110,0x2220100,
+	0x2224100,0x0240910,0x0240910,0x0244840,0x0264001,0x0204007,0x0244014,0x1204008,0x0304008,0x0306008,0x0205011,0x0204150,0x0244108,0x0204910,0x024c100,0x0204811,
+	0x0224801,0x0204818,0x0244810,0x0284810,0x0244c00,0x0284801,0x0284810,0x0284900,0x02c4800,0x0204801,0x0204810,0x0225010,0x0284018,0x02c4010,0x0304050,0x0304800,
+	0x0604018,0x0624010,0x0a04810,0x2204088,0x0220105,0x0260900,0x0225000,0x0364000,0x0724000,0x0664000,0x0340040,0x1300040,0x03400c0,0x13000c0,0x0304840,0x0342800,
+	0x0300801,0x1380000,0x0440005,0x0400415,0x0404405,0x0440405,0x0440009,0x1400009,0x0400019,0x0420019,0x0440019,0x0400059,0x0440109,0x04c0009,0x0440021,0x04c0021,
+	0x0400059,0x0440051,0x0400041,0x1500041,0x0404081,0x0400119,0x0440121,0x0480121,0x0440901,0x0442101,0x0460101,0x0480111,0x04c0101,0x0440401,0x0400419,0x0402411,
+	0x0420411,0x0440411,0x0440421,0x0404809,0x0440809,0x0400819,0x0420811,0x0440811,0x0400911,0x0440901,0x0440c01,0x0400801,0x0440801,0x1400801,0x1480801,0x0401019,
+	0x0441011,0x0541001,0x0442009,0x0402019,0x0442011,0x1402011,0x0442041,0x0442401,0x1402401,0x0402811,0x1402801,0x0402001,0x04c2001,0x1482001,0x2402011,0x0450021,
+	0x0460003,0x1420003,0x0460009,0x0420019,0x0460011,0x2420011,0x0460401,0x0461001,0x0462001,0x0468001,0x0420011,0x04e0001,0x04e0001,0x0440011,0x1440081,0x0441001,
+	0x0448001,0x1448001,0x04c0001,0x0488001,0x04c0001,0x0500021,0x05000c1,0x0540401,0x0500c01,0x0540801,0x0560001,0x0600019,0x0640011,0x1600011,0x0440001,0x0440011,
+	0x0440801,0x0c00019,0x0c20011,0x0c40011,0x1400019,0x2420101,0x2404001,0x0400819,0x0440811,0x0401013,0x0442011,0x0460011,0x1400012,0x0420012,0x0480094,0x0400818,
+	0x1400058,0x0440018,0x0400410,0x0440410,0x0440810,0x0441010,0x0442010,0x1402010,0x0448010,0x1408010,0x04c0010,0x0480010,0x04c0010,0x0480030,0x04c0030,0x0440118,
+	0x0440910,0x0460110,0x0440110,0x2400110,0x0440411,0x0440818,0x0400c10,0x0440c10,0x0480c10,0x0440810,0x1400810,0x04c0810,0x0441012,0x0442018,0x0402050,0x1402010,
+	0x04c2010,0x0464010,0x0460090,0x04c0010,0x04c0011,0x1480810,0x0c00018,0x0c40010,0x0405081,0x0441081,0x04020c1,0x0448081,0x0420091,0x0480081,0x04c0081,0x0508081,
+	0x0520081,0x0400891,0x0420091,0x0402090,0x0408090,0x04800b0,0x0400c90,0x0401890,0x0442090,0x04c0090,0x0440090,0x1440090,0x0440188,0x04801a0,0x04401c0,0x0400d80,
+	0x0441180,0x0442180,0x0444180,0x0448180,0x0488180,0x0420180,0x0460180,0x0440180,0x0440180,0x04c0180,0x04c0180,0x1480180,0x2400180,0x040d080,0x04040a0,0x0484080,
+	0x044c080,0x0424090,0x0424880,0x04a4080,0x0444080,0x0444080,0x0509080,0x0548080,0x1400089,0x0400105,0x0440504,0x1400504,0x1400108,0x0440118,0x0440910,0x0400138,
+	0x0440130,0x1400130,0x0400130,0x1480120,0x0402141,0x0400141,0x1400140,0x0440500,0x0404904,0x0440908,0x0400918,0x0440910,0x0400941,0x0440900,0x0400b01,0x0440900,
+	0x04c0900,0x0449100,0x0442108,0x0402118,0x0442110,0x1402110,0x0402150,0x0442140,0x1402140,0x0442500,0x0402101,0x0442100,0x0446100,0x2402110,0x0408118,0x0428110,
+	0x0448110,0x0420118,0x0420110,0x0460110,0x0420101,0x0440118,0x0440110,0x0440181,0x04c0180,0x0448100,0x04c0100,0x0482101,0x0480118,0x04c0110,0x0480190,0x04c0180,
+	0x1480180,0x0600118,0x0620110,0x0640110,0x2402110,0x2440110,0x0444009,0x0404809,0x0444404,0x0404058,0x0504820,0x0544200,0x0424410,0x0404401,0x0444808,0x0444820,
+	0x1404800,0x0604810,0x0445002,0x1405002,0x1407000,0x0406041,0x0406140,0x0446400,0x1406400,0x04c6000,0x0444008,0x0404018,0x0444020,0x1404020,0x0404808,0x0444800,
+	0x0446000,0x044c000,0x140c000,0x0444010,0x0444080,0x2484000,0x0464008,0x0464400,0x0465000,0x1425000,0x04e4000,0x0404018,0x0404010,0x0c06010,0x0422041,0x0468001,
+	0x04a8001,0x04e0001,0x04a0011,0x0420801,0x0462010,0x0420504,0x0420118,0x0420110,0x0460110,0x04e0100,0x0424410,0x04a4000,0x04a4080,0x1420010,0x1500008,0x0540008,
+	0x0540800,0x05e0000,0x0540010,0x0540080,0x1540000,0x0d00101,0x1400818,0x1440810,0x1442008,0x1442000,0x1480018,0x14c0010,0x0800016,0x0802111,0x0802114,0x0806010,
+	0x0820114,0x0824010,0x0960010,0x0806001,0x1860001,0x1802801,0x1801810,0x1800904,0x1804800,0x1800800,0x18c0100,0x18c0000,0x1060001,0x1040003,0x1000003,0x1000003,
+	0x1000005,0x1000405,0x1040405,0x1040021,0x1020051,0x1040051,0x1040141,0x1004081,0x1020109,0x1000401,0x1404401,0x1040811,0x1003011,0x1009001,0x1103001,0x1042041,
+	0x1042401,0x100c401,0x100e001,0x1048001,0x1008001,0x1020401,0x1024005,0x1060009,0x1020011,0x1020021,0x1060401,0x1062001,0x1060001,0x10a0001,0x10a4001,0x10c0011,
+	0x1140009,0x1100809,0x1148001,0x1400019,0x1400011,0x1440801,0x1442001,0x1402001,0x1448001,0x1024012,0x100080d,0x100081c,0x100600c,0x1020009,0x1020018,0x1040019,
+	0x1040091,0x1001811,0x1042011,0x1020019,0x1060011,0x1000094,0x1040094,0x1000094,0x1040018,0x1040018,0x1040090,0x1040050,0x1040c10,0x1040810,0x1041810,0x1048810,
+	0x10c0810,0x1082011,0x1082010,0x1020013,0x1060018,0x1060410,0x1040010,0x1040410,0x10c0010,0x10c0010,0x10c0110,0x10c0010,0x1140410,0x1100410,0x1202010,0x1240010,
+	0x1402010,0x1800018,0x1840010,0x1020030,0x1000518,0x1040510,0x1040900,0x1002114,0x1048110,0x1008100,0x1060108,0x1060500,0x1060100,0x10a0180,0x10c0110,0x1080110,
+	0x1041810,0x1000d10,0x1040c10,0x1085800,0x1049010,0x1004002,0x1004002,0x1044404,0x1004818,0x1044088,0x1004818,0x1044041,0x1004050,0x10440c0,0x1004144,0x1006140,
+	0x1044140,0x1004504,0x1006201,0x1004418,0x1004c10,0x1024410,0x1044410,0x1104c00,0x1044c00,0x1004c00,0x1005100,0x104d000,0x1006104,0x1046100,0x1046400,0x1044020,
+	0x104c000,0x1064010,0x1064400,0x106c000,0x1144400,0x1126000,0x1164000,0x11a4000,0x1144010,0x1404018,0x1444010,0x1404110,0x1444800,0x3404001,0x10a8001,0x10a2010,
+	0x1220108,0x1022090,0x1041011,0x10c4000,0x1142001,0x1140005,0x1100005,0x1100084,0x1104404,0x1140404,0x1100404,0x11c0020,0x1140041,0x1100418,0x1140410,0x1100400,
+	0x1144400,0x1102801,0x1140810,0x1105000,0x1101000,0x1149000,0x110e000,0x1108000,0x11a0001,0x11e0000,0x3140000,0x2020003,0x2040405,0x2000109,0x3000109,0x2020111,
+	0x2080401,0x2003001,0x2005003,0x2001101,0x2002201,0x2082011,0x2002001,0x2002011,0x3008001,0x2060021,0x2060101,0x20c0101,0x2840011,0x3002101,0x2002011,0x2040811,
+	0x2000016,0x2100012,0x2140012,0x2040019,0x2042110,0x2006018,0x2020019,0x2060410,0x2064010,0x20c0010,0x20c0011,0x2840010,0x2040010,0x2005080,0x2080112,0x2040120,
+	0x2002141,0x2040901,0x2000984,0x2000901,0x2040900,0x2001102,0x2041102,0x2006104,0x2042104,0x3002104,0x2002112,0x2042110,0x2042140,0x3002140,0x2002510,0x3002500,
+	0x200c100,0x3008100,0x2021101,0x20c0100,0x2000910,0x2080100,0x2084810,0x3084800,0x2004011,0x2044002,0x2144002,0x2004004,0x2004011,0x2004811,0x2044011,0x2045100,
+	0x20c4100,0x2005102,0x2006011,0x2006009,0x2006018,0x2026010,0x2046010,0x2046400,0x2004011,0x3004010,0x2004108,0x2044400,0x2045000,0x2046000,0x3084000,0x200c001,
+	0x200c000,0x2024900,0x2064100,0x2024000,0x2144400,0x2404010,0x2404110,0x2140800,0x210a001,0x2148001,0x2108001,0x2160020,0x2101100,0x3000841,0x3006040,0x3041010,
+	0x3001104,0x0020145,0x01a0012,0x1040100,0x0109080,0x0400411,0x0140882,0x0004825,0x0200019,0x0202801,0x0260010,0x0080091,0x0420029,0x0005818,0x0021401,0x00c2500,
+	0x0020059,0x0190110,0x0002096,0x0080013,0x0002170,0x0025201,0x0080099,0x00600b0,0x01e0004,0x00c4800,0x0006804,0x0040013,0x1021001,0x00a0015,0x1080003,0x0028118,
+	0x0044820,0x0800990,0x0024405,0x00c0021,0x0028011,0x0102038,0x0408890,0x04a0801,0x0184008,0x000401b,0x3020005,0x0464010,0x1028011,0x0080148,0x00a0015,0x0100c04,
+	0x0048510,0x0001104,0x010e008,0x0801101,0x0002910,0x0183010,0x00408b0,0x1004002,0x00a40a0,0x00e0120,0x00c2009,0x1000812,0x1224100,0x1040018,0x00aa100,0x1022011,
+	0x0022109,0x0020112,0x01c4000,0x000a811,0x0060005,0x0101830,0x0004821,0x0020051,0x0024010,0x0460900,0x0120051,0x000081a,0x0080819,0x0000d24,0x0085010,0x0424010,
+	0x00a6020,0x0160082,0x1028001,0x0005112,0x0008811,0x00e0001,0x00a0050,0x0026050,0x0005850,0x11c0800,0x100c800,0x0126008,0x0180109,0x1002940,0x0001041,0x0024803,
+	0x00c0910,0x0200104,0x0024070,0x1026004,0x0185800,0x0040107,0x0040809,0x0080051,0x1048104,0x1068001,0x1040011,0x0024228,0x004a018,0x0000413,0x0100948,0x0000407,
+	0x00a5000,0x0006811,0x0080085,0x1028090,0x0181082,0x1424008,0x01840c0,0x0000896,0x018008c,0x008c900,0x0480018,0x0085014,0x0182201,0x0003011,0x00c0018,0x1040003,
+	0x0424840,0x0002960,0x2006018,0x3004002,0x0024018,0x0424808,0x0104050,0x0000d04,0x0020103,0x00a0051,0x00a0801,0x1108800,0x01a0802,0x00c4005,0x110008c,0x0026140,
+	0x0820130,0x012c040,0x0124050,0x100080b,0x00e1001,0x1088180,0x1100049,0x0000984,0x0026090,0x0204409,0x0022130,0x0160010,0x0024109,0x0124050,0x0028094,0x00a0094,
+	0x04a4010,0x0004c04,0x0080918,0x00e4010,0x022c010,0x0022142,0x0244810,0x0080095,0x0021150,0x0980810,0x0160090,0x000c094,0x00a0109,0x0020413,0x0026180,0x0220901,
+	0x0006104,0x0041011,0x0046104,0x0280901,0x00a0015,0x0142140,0x0008095,0x0009085,0x0086003,0x0020413,0x0108c04,0x2020015,0x0028150,0x1420011,0x1008504,0x0180015,
+	0x1020030,0x0040119,0x00a8101,0x00a4800,0x1102120,0x0160012,0x00c4002,0x01e0000,0x0040150,0x00a0150,0x0002803,0x0149800,0x0022405,0x0024050,0x1130010,0x0022508,
+	0x0224021,0x1000013,0x1082041,0x000a105,0x0064801,0x0060190,0x182c000,0x008e100,0x00a4002,0x0028504,0x0402114,0x0029104,0x0006c00,0x0160041,0x0400485,0x0187000,
+	0x1028410,0x010480c,0x0522040,0x00809c0,0x00c4090,0x00c5100,0x0060089,0x0088811,0x0084821,0x0040d00,0x0020818,0x0021031,0x0125080,0x0148011,0x0120814,0x01a0801,
+	0x0026102,0x1002104,0x0024041,0x0025001,0x0100c05,0x0040491,0x0108801,0x0004058,0x0440900,0x0080105,0x00a4090,0x00a6080,0x02a4010,0x0004c12,0x0200108,0x0048900,
+	0x0082085,0x0004494,0x0128010,0x10c2001,0x0127000,0x0000099,0x0022112,0x0084884,0x0024089,0x04c0010,0x0087080,0x0048811,0x0480085,0x1084009,0x0144024,0x00c1810,
+	0x00c0011,0x00a0015,0x0205110,0x1002884,0x01c0011,0x0404801,0x0422010,0x00a0190,0x0044880,0x0128050,0x00c0094,0x008c018,0x180c010,0x100b080,0x0106028,0x0040881,
+	0x1020081,0x02c4010,0x1404800,0x01c6000,0x00ac010,0x0420030,0x0440881,0x0082801,0x0020132,0x0005005,0x1024021,0x0060015,0x00e0101,0x0000c07,0x0150009,0x1024801,
+	0x0102484,0x0003114,0x0240811,0x0041091,0x0000494,0x0009811,0x0020921,0x1024030,0x0024045,0x0804118,0x008a801,0x0204910,0x00a2110,0x0440411,0x00c0190,0x0446080,
+	0x30c0010,0x10c0081,0x00e0081,0x0000831,0x0220801,0x0024060,0x10e4000,0x1020181,0x00a2101,0x0025090,0x000005b,0x00c1108,0x1002005,0x01c0030,0x0180086,0x0020035,
+	0x0142840,0x10c8100,0x0081811,0x1000918,0x0200818,0x0002152,0x0164004,0x0040841,0x0021051,0x0068005,0x1007010,0x00021d0,0x0101803,0x0304084,0x00c0011,0x00a0101,
+	0x00a8014,0x1104003,0x0084801,0x0027001,0x0020415,0x1444080,0x0048091,0x00a40a0,0x0088098,0x0005840,0x0004828,0x00a0101,0x00a01c0,0x1088110,0x1028011,0x0044050,
+	0x0084821,0x0026008,0x0086011,0x002d100,0x002e001,0x0406802,0x0004005,0x0064810,0x018a100,0x0084841,0x0500821,0x0022502,0x00c1110,0x100001b,0x11e0000,0x00a4010,
+	0x0024808,0x1400441,0x0180084,0x008e100,0x1000941,0x00a0050,0x0000905,0x0260010,0x0000938,0x0100820,0x1024088,0x0000c25,0x0008051,0x0402094,0x0204114,0x00c0019,
+	0x00c0c01,0x00a0092,0x0001009,0x00821c0,0x000280b,0x0220910,0x0400058,0x0120041,0x1025000,0x1400405,0x0004c24,0x1022041,0x1004002,0x00a0110,0x0008189,0x10e0000,
+	0x0001158,0x042c010,0x000c810,0x0002184,0x0085000,0x00cd000,0x01c8010,0x0100822,0x0029005,0x01b0001,0x1004804,0x1184080,0x1021090,0x1100042,0x0002911,0x0061011,
+	0x0182120,0x1088001,0x0002944,0x0002851,0x0000813,0x1102480,0x0000581,0x002c410,0x0120850,0x0480114,0x0482041,0x01600c0,0x00a0011,0x0182900,0x04c0011,0x00a1110,
+	0x0606010,0x0084805,0x1002018,0x0406804,0x0404108,0x1026100,0x0120018,0x2100051,0x00001b4,0x00c6010,0x2028110,0x0102160,0x0021085,0x1100840,0x00a2110,0x040c080,
+	0x0182001,0x1020810,0x0040805,0x0081090,0x1084820,0x0080103,0x2004012,0x0008881,0x1081090,0x0080815,0x018400a,0x0028011,0x0180094,0x00c0504,0x00a0114,0x0000d11,
+	0x00c4080,0x0028015,0x00c2101,0x0000950,0x1024840,0x00a0051,0x0081109,0x0060502,0x1044040,0x0168000,0x004080d,0x0066004,0x0200811,0x0482110,0x00c2140,0x01040c2,
+	0x0061081,0x00c4880,0x1002009,0x0224140,0x1404088,0x1006210,0x0200909,0x0006104,0x0110811,0x01c2010,0x0024820,0x0080085,0x0048019,0x00c2110,0x08c0110,0x0130500,
+	0x0003118,0x0224050,0x0048910,0x1101000,0x0180821,0x1004060,0x0184820,0x1020005,0x0042411,0x0000912,0x2480801,0x1088801,0x100a110,0x008a110,0x0104809,0x008c080,
+	0x0021019,0x00c0811,0x0285100,0x0025012,0x1002021,0x0182110,0x0062801,0x0020413,0x00a0090,0x10088c0,0x000c084,0x1008180,0x0048810,0x1004820,0x0144810,0x01008c4,
+	0x0380801,0x1004848,0x04a0090,0x0080830,0x0220051,0x0002111,0x0044484,0x0220015,0x00c8110,0x0200811,0x0049500,0x0001905,0x1022101,0x11c1000,0x0118110,0x1000009,
+	0x0150101,0x0060111,0x0002141,0x0280811,0x010d100,0x02a0011,0x01c0404,0x01a0014,0x0101884,0x0022050,0x0109810,0x0020930,0x0186004,0x0122104,0x0084801,0x04e0010,
+	0x0005085,0x00a0018,0x11c0008,0x0224810,0x0060031,0x02a0110,0x1102020,0x0045410,0x0107008,0x0102018,0x0042019,0x000a041,0x0442110,0x0100950,0x11c0040,0x0118110,
+	0x01840c0,0x0006015,0x0044085,0x0284014,0x0103081,0x0120018,0x0102884,0x00c0803,0x10e0001,0x0003041,0x0001810,0x1080830,0x0110504,0x00c8011,0x0202150,0x0084014,
+	0x0062110,0x0026041,0x1000c11,0x0022148,0x0220015,0x0044810,0x1040809,0x00c8900,0x0008811,0x0040c05,0x1006090,0x0002921,0x0042090,0x0020110,0x1083100,0x0040d04,
+	0x102001a,0x04200a1,0x00c8810,0x0004085,0x01a8010,0x0042150,0x0028114,0x044a001,0x1020121,0x1000320,0x1001920,0x00c0405,0x0044094,0x0048810,0x0024009,0x1002001,
+	0x0002114,0x3404000,0x1002089,0x0020055,0x0084108,0x00c2401,0x0021015,0x0140801,0x0004118,0x0224801,0x0002851,0x0002301,0x1101008,0x0040095,0x1028810,0x002e010,
+	0x004c900,0x00a0091,0x0040099,0x0022118,0x0066001,0x0006100,0x00c0810,0x0404818,0x0104084,0x1048801,0x0404812,0x0041910,0x0204410,0x0020414,0x0002815,0x0000851,
+	0x0084108,0x0062110,0x0180902,0x000101a,0x0420009,0x0064008,0x0102801,0x1004048,0x0426020,0x008c101,0x0002819,0x0101188,0x0080910,0x1009880,0x1000138,0x00811c0,
+	0x00e0010,0x02c0100,0x01c4040,0x0168010,0x022c001,0x0024404,0x04a0110,0x1142000,0x0084881,0x00000a5,0x0040918,0x0130010,0x0207010,0x00c9001,0x1064000,0x00c0900,
+	0x0026005,0x000a141,0x1148080,0x00a1011,0x00a0091,0x0003101,0x0404411,0x0422003,0x04c0120,0x0800910,0x0020186,0x1100c04,0x0020030,0x1060500,0x00c40c0,0x0028910,
+	0x0122801,0x0402184,0x0062011,0x0162010,0x0144090,0x0824003,0x0022114,0x0120884,0x0880811,0x0184003,0x1240001,0x0886100,0x0182104,0x0028118,0x1002901,0x0109084,
+	0x1002c01,0x0060014,0x00a0011,0x0100818,0x1000814,0x1080500,0x0104812,0x0027000,0x0082010,0x0008815,0x1004802,0x0148880,0x0200940,0x0802118,0x0002d02,0x0102844,
+	0x0111801,0x012c004,0x0002d04,0x1100304,0x00c0051,0x100001d,0x0222010,0x0020930,0x00c00a1,0x0024404,0x0002815,0x0002185,0x0020158,0x0604810,0x0007050,0x0142404,
+	0x0002144,0x104a100,0x0024140,0x0042901,0x0406820,0x002010b,0x006c010,0x0082481,0x100c000,0x010005a,0x0020132,0x1005808,0x1404008,0x0002c10,0x00a0405,0x100000d,
+	0x0110810,0x1109008,0x0028811,0x0464010,0x0020013,0x0140007,0x00c8801,0x1020830,0x1026080,0x0047001,0x0006148,0x2006010,0x1009801,0x0025801,0x1224001,0x00c0012,
+	0x0110010,0x0000924,0x0001145,0x01a0014,0x00ec000,0x20a0120,0x008011c,0x04a0900,0x0260010,0x0001801,0x0082011,0x0022051,0x0440580,0x0204890,0x0020093,0x0401005,
+	0x0041141,0x01cc000,0x0220010,0x0140180,0x1002148,0x0080138,0x0022103,0x110000a,0x0189080,0x0046104,0x100200d,0x002408c,0x0042103,0x0021085,0x042400c,0x0024003,
+	0x1000841,0x1141400,0x00c2101,0x1000809,0x0040812,0x0224003,0x01c2040,0x0080910,0x0120810,0x0044500,0x000680a,0x0102110,0x1020811,0x0100928,0x1080001,0x0064014,
+	0x0180114,0x2020013,0x0020053,0x1081011,0x0120812,0x0020119,0x0044480,0x0220110,0x1228100,0x0080812,0x0060520,0x0006042,0x0102052,0x2120011,0x0600011,0x0002150,
+	0x0146008,0x0204850,0x002010b,0x004c014,0x1420800,0x0224010,0x1040001,0x0006015,0x0005802,0x00a0111,0x00a0811,0x0406410,0x1040d00,0x0420414,0x0480818,0x00c0811,
+	0x0041405,0x0044908,0x2001011,0x2000891,0x04e0100,0x1004a00,0x0004852,0x0082920,0x0164010,0x0200904,0x02c0101,0x0820811,0x0224014,0x0200911,0x0000096,0x1080210,
+	0x0040902,0x0204805,0x0086030,0x1004808,0x00801d0,0x0024610,0x0042114,0x0282010,0x0142010,0x01c2080,0x0220118,0x006c010,0x04e4000,0x0448010,0x1000811,0x002001c,
+	0x0003111,0x1000831,0x0045002,0x010201c,0x00e0011,0x1108048,0x0600111,0x0024184,0x00c4008,0x004c410,0x0184040,0x1000819,0x0000952,0x0000919,0x0048805,0x2040110,
+	0x1084880,0x01008c1,0x0240110,0x0004c06,0x0083011,0x0028051,0x0046010,0x1020089,0x0040198,0x0420809,0x1040109,0x1188000,0x01e0000,0x01a2002,0x0188900,0x0020504,
+	0x1000908,0x0a02110,0x0124020,0x1000450,0x01040c4,0x0202111,0x0044881,0x00e4400,0x0080093,0x1182001,0x0000494,0x0029110,0x0060003,0x01a4010,0x1120020,0x2024001,
+	0x0080814,0x0280114,0x1009900,0x0121018,0x0194001,0x0202091,0x0200905,0x0460011,0x0129004,0x01040c8,0x0200851,0x0406041,0x0046801,0x0102058,0x0021091,0x0088184,
+	0x0466000,0x0108900,0x0800814,0x10c6000,0x0002107,0x210a100,0x0112010,0x01a4000,0x100c800,0x00a0091,0x00e5000,0x0182900,0x00a8011,0x00a2010,0x000098c,0x008c009,
+	0x0027100,0x1080021,0x1140480,0x0220013,0x0080930,0x0041910,0x0082940,0x00a0019,0x00c0811,0x0020851,0x01c0050,0x1220010,0x1121400,0x0060091,0x006c010,0x00c4180,
+	0x0905002,0x0022110,0x00a4010,0x1001908,0x0200810,0x0141005,0x0186008,0x00c0900,0x0022011,0x00c0090,0x0160006,0x1002025,0x1041900,0x0028811,0x1040900,0x002c084,
+	0x0006148,0x0048111,0x0001813,0x1040089,0x002001b,0x0020121,0x0022150,0x1020109,0x0110900,0x0064004,0x002400a,0x01a0012,0x0060091,0x00cc100,0x0002c03,0x0200901,
+	0x0042481,0x1008140,0x0020431,0x0400184,0x0007041,0x0000835,0x0040890,0x0504808,0x0000851,0x0020851,0x0020103,0x1006041,0x0141011,0x1140082,0x004c014,0x0446000,
+	0x0002530,0x010c084,0x00c4005,0x000a811,0x0426004,0x0122003,0x0042118,0x1020811,0x000011b,0x0204901,0x0020281,0x04e0001,0x1000908,0x0060085,0x0041001,0x00a0188,
+	0x00a0504,0x01a4000,0x1404008,0x0120802,0x0020170,0x004410c,0x0420090,0x1040001,0x0000097,0x0142001,0x0005104,0x010081c,0x0028014,0x00c0015,0x2020051,0x0142020,
+	0x0024424,0x0006049,0x0122408,0x002e040,0x0120908,0x00c0810,0x0200891,0x1120012,0x1202900,0x0180910,0x0041810,0x0000059,0x1424000,0x10c0001,0x0004805,0x00a0019,
+	0x00021a4,0x0042091,0x0005809,0x0182041,0x0204814,0x0082015,0x0026009,0x00e4001,0x0048414,0x0040590,0x1041100,0x01a2040,0x004e000,0x10a8001,0x0184084,0x0001121,
+	0x0001014,0x1020001,0x01c4080,0x0208109,0x1000a10,0x0140c00,0x00c2041,0x0180803,0x0424810,0x00e0014,0x04c0011,0x1020016,0x0024019,0x10a0009,0x0441101,0x0086084,
+	0x0025040,0x0024085,0x0080184,0x1106040,0x0002941,0x1020019,0x0026028,0x00e8001,0x0128010,0x0021811,0x0302010,0x0461001,0x0024030,0x0242010,0x1020018,0x1020109,
+	0x1020808,0x0022409,0x002010d,0x1000099,0x0080091,0x0186200,0x0808110,0x0194080,0x0146002,0x00c0881,0x000a010,0x0003019,0x0181009,0x010090a,0x000e101,0x00408b0,
+	0x0004858,0x0142140,0x0021011,0x0024805,0x0023011,0x04a4080,0x0049801,0x0022130,0x02a4010,0x1025001,0x0204108,0x0000958,0x0140051,0x004c110,0x1022009,0x0100484,
+	0x002a401,0x10401a0,0x0084080,0x00a0090,0x0224018,0x0020918,0x04c0081,0x00c2100,0x0400990,0x0080053,0x1008801,0x0042841,0x00a4001,0x0020009,0x002401c,0x0420011,
+	0x0006005,0x00c01a0,0x00a1110,0x1400803,0x0161010,0x00a0090,0x00c0411,0x0000905,0x0060580,0x0182802,0x1108000,0x000a811,0x00c4300,0x1102002,0x0048091,0x0080052,
+	0x0400890,0x0088019,0x01c2000,0x00c4810,0x208c001,0x0024094,0x0100c30,0x0084021,0x0084803,0x1100802,0x0042018,0x0028015,0x0062010,0x0824012,0x0105202,0x0102850,
+	0x0048015,0x0200901,0x00e4080,0x0168800,0x1004801,0x00a0920,0x2008101,0x0006084,0x008d010,0x002c008,0x0088811,0x0000912,0x010ac00,0x0104821,0x1244001,0x00c8010,
+	0x0000951,0x00c0411,0x0400818,0x0202411,0x002001b,0x0064011,0x0085120,0x0041081,0x0024902,0x0020851,0x0244090,0x1000043,0x1001001,0x0449001,0x0006841,0x1120042,
+	0x0420051,0x0110405,0x01d0001,0x1042401,0x008011a,0x0003051,0x00c0411,0x0082180,0x01c4200,0x00a9001,0x016a000,0x0001819,0x0025104,0x0020812,0x0002c21,0x0022811,
+	0x0022109,0x0009811,0x1005024,0x00a1110,0x0120060,0x00e0010,0x00c0811,0x0105840,0x00800b4,0x0140015,0x0006411,0x0404841,0x1081011,0x0000071,0x1040880,0x0020015,
+	0x042c800,0x00801b0,0x00e2010,0x104c010,0x1024404,0x0480010,0x04c0101,0x0068110,0x002c050,0x0204085,0x10c8001,0x11a0800,0x10a4020,0x1080118,0x0102814,0x0440180,
+	0x0220150,0x002a010,0x0200812,0x0121810,0x00a0029,0x004c810,0x1006001,0x0006940,0x0000c13,0x1080108,0x1120804,0x002001d,0x0020158,0x0426040,0x0024098,0x0024808,
+	0x0140484,0x10a8004,0x0103104,0x00c4404,0x1220041,0x0144804,0x0420118,0x002001a,0x0190110,0x00000b5,0x0000095,0x0009902,0x0002158,0x0002138,0x0004944,0x0008095,
+	0x0000918,0x0020148,0x0040831,0x0022811,0x000a014,0x1424008,0x00c4080,0x2000813,0x1206010,0x004c010,0x0020132,0x0222010,0x00a4003,0x0145010,0x1101404,0x1140c00,
+	0x1020130,0x0001119,0x01a2400,0x10c0011,0x0020815,0x0142400,0x0048805,0x1080102,0x002011c,0x0004c01,0x0380018,0x0140050,0x0021014,0x0168010,0x0020940,0x00a0031,
+	0x0426010,0x0021012,0x0020095,0x1006802,0x1089010,0x0048018,0x1048140,0x0120014,0x0045404,0x0020019,0x0021050,0x01e0002,0x0008401,0x1081101,0x1040481,0x0224090,
+	0x0024805,0x00e6000,0x1046008,0x0082121,0x0182081,0x0124820,0x0020185,0x0884018,0x0460090,0x00c2010,0x0008918,0x0130401,0x1120802,0x0206810,0x0c02011,0x00c4104,
+	0x1020610,0x2080902,0x1000032,0x1020904,0x1140080,0x0484810,0x0190900,0x0404812,0x0006142,0x1448100,0x0060083,0x0046014,0x00c4001,0x0040811,0x1140005,0x0300811,
+	0x0048114,0x0026080,0x01a4010,0x0068081,0x140000b,0x0020109,0x0140c00,0x100e080,0x0140110,0x0020851,0x0440810,0x0122110,0x1040041,0x00a0901,0x0024821,0x0128010,
+	0x0080885,0x04801c0,0x0020506,0x10a0010,0x1004880,0x000081d,0x0060041,0x0040485,0x0005049,0x0225010,0x0020038,0x0064012,0x008c104,0x0020114,0x1202140,0x0007009,
+	0x0180830,0x000c180,0x0060481,0x0020118,0x0044012,0x0100852,0x1482001,0x0000c85,0x00c0031,0x1120008,0x0008819,0x0060025,0x0120814,0x0080813,0x0080909,0x0140880,
+	0x0043010,0x1402108,0x11c0008,0x1040801,0x0004940,0x1022018,0x0400a10,0x0046090,0x0400891,0x1003090,0x0140013,0x0100070,0x0404812,0x0121006,0x104a001,0x0440890,
+	0x1168000,0x00e0010,0x0340011,0x0181041,0x0542040,0x0020419,0x0020038,0x0020131,0x00e0180,0x01a4040,0x1004808,0x0080190,0x0008909,0x1101008,0x0025002,0x000290a,
+	0x00a4084,0x1003010,0x0002141,0x1082140,0x1048410,0x00a0811,0x2020051,0x0006812,0x00c4090,0x002011a,0x0884810,0x002401c,0x1004082,0x00c0013,0x0005108,0x01a0010,
+	0x00c0090,0x08c0180,0x0021801,0x0060011,0x1000850,0x014a400,0x0028110,0x1040805,0x004480c,0x10800b0,0x0000584,0x10c4000,0x0002805,0x1402180,0x0040881,0x0110411,
+	0x0086300,0x04c8010,0x0128018,0x1200091,0x0400918,0x0001030,0x0044801,0x2001111,0x0040891,0x0460014,0x0068010,0x1045400,0x04001a0,0x00c2014,0x0000859,0x00ca010,
+	0x0069100,0x00c4410,0x0028110,0x00a4102,0x0004005,0x0180940,0x0141080,0x0140080,0x0080813,0x0061500,0x0426040,0x1046100,0x00a0811,0x1042180,0x0080811,0x0062110,
+	0x0404890,0x0102084,0x0808910,0x002c801,0x0084890,0x0464008,0x0080815,0x0007041,0x0121003,0x1108020,0x1000920,0x1000902,0x0040891,0x0184804,0x000201d,0x0284011,
+	0x0080035,0x0000984,0x008a101,0x0022910,0x0124104,0x10c0801,0x0104109,0x0042411,0x0000833,0x0004c05,0x0202811,0x01e8000,0x00cc010,0x1001803,0x00408a1,0x0502018,
+	0x1020811,0x0122084,0x1400018,0x01c9000,0x0040811,0x1480100,0x1409100,0x004c020,0x0062011,0x000281a,0x0040801,0x0080584,0x14a0001,0x0003105,0x0020813,0x0150102,
+	0x004e000,0x002c012,0x0028014,0x0002405,0x0024034,0x018001a,0x0024018,0x00c0091,0x0080090,0x0082051,0x0402118,0x1000904,0x0040914,0x0086140,0x0040885,0x0124200,
+	0x000480a,0x000401b,0x04a4080,0x1182100,0x028c100,0x00c8810,0x00ac000,0x0068011,0x0460010,0x0068011,0x002d080,0x0080105,0x1080405,0x004c800,0x0007018,0x1005008,
+	0x0802011,0x0002152,0x3100020,0x0088085,0x04a0011,0x1109800,0x0003109,0x0005051,0x0081900,0x1080003,0x0005085,0x0040911,0x0040520,0x0040103,0x000ac01,0x0220050,
+	0x0084086,0x0420805,0x1144800,0x0042901,0x0100106,0x0060111,0x0420405,0x0100158,0x00c4120,0x0005015,0x0122018,0x00a4005,0x0320010,0x0120029,0x1028081,0x004c004,
+	0x0001906,0x0020030,0x0006818,0x0020c14,0x002001b,0x1080801,0x0080194,0x0022105,0x0180810,0x01048c0,0x1000980,0x012001c,0x00a8001,0x0040815,0x0024818,0x000a901,
+	0x0069010,0x1022102,0x0084003,0x0122010,0x01d0010,0x0068104,0x010600a,0x0080132,0x0422009,0x01c0110,0x1080184,0x0020094,0x0000853,0x0140050,0x002400b,0x0805101,
+	0x002008d,0x0188005,0x0082811,0x0060081,0x0160014,0x012c008,0x0442140,0x000e110,0x00c0011,0x0148800,0x0105042,0x0023110,0x0022050,0x0041085,0x0008908,0x008c104,
+	0x0025001,0x0160082,0x0022015,0x0121801,0x000081b,0x0080183,0x1044002,0x0021411,0x1140408,0x3000108,0x0080990,0x0024402,0x3000201,0x1080120,0x0042010,0x0082141,
+	0x1160800,0x0000851,0x0080821,0x0102c20,0x0002053,0x012a010,0x0041801,0x00c2801,0x0044024,0x01e4000,0x1002100,0x1204014,0x0228110,0x0082411,0x0025801,0x0304050,
+	0x0406140,0x0086410,0x10a2010,0x0084082,0x02a4010,0x000019c,0x0002930,0x1006012,0x00021d0,0x0003100,0x0007810,0x0002418,0x100401c,0x0204901,0x0002c11,0x0424001,
+	0x1141080,0x00a0112,0x0040015,0x0020051,0x00a0182,0x00280c1,0x0024018,0x00a0011,0x0420118,0x00a0118,0x0000c05,0x0024804,0x01240c0,0x04001d0,0x0182004,0x0000819,
+	0x00e8100,0x00a0025,0x0143100,0x100011c,0x0082101,0x010090c,0x0220105,0x0060018,0x008018c,0x1048040,0x00c8001,0x1080021,0x0001831,0x044c000,0x0004821,0x00c01c0,
+	0x0024412,0x10a0011,0x00a0085,0x18c0100,0x1424008,0x0060090,0x0028810,0x1046010,0x0100852,0x0264001,0x0009805,0x1102420,0x1005021,0x0884104,0x002200b,0x0109802,
+	0x1002148,0x0180012,0x0020908,0x00a8110,0x0008116,0x00a6010,0x0020d00,0x0464010,0x0021009,0x1002091,0x0082580,0x00a4101,0x0024007,0x0040903,0x0161004,0x014001a,
+	0x000e090,0x01a4004,0x0001815,0x002c020,0x0020099,0x0002851,0x0088811,0x118c000,0x00a4082,0x1001013,0x0080831,0x0068140,0x004a110,0x01c4080,0x008001d,0x0025005,
+	0x1004048,0x10e0001,0x0020011,0x0002152,0x00a2018,0x1182000,0x0088811,0x0041101,0x00c8900,0x1021080,0x0480188,0x0066001,0x04a4010,0x0026003,0x0220030,0x0620011,
+	0x0068401,0x0000912,0x004c800,0x0808810,0x00c5010,0x0020813,0x0204013,0x00a6080,0x0420031,0x00c2005,0x0020920,0x0440081,0x0042405,0x0444804,0x0020921,0x00a0128,
+	0x0005902,0x0002034,0x0085810,0x0106014,0x0420411,0x0220810,0x0086801,0x002c100,0x0082c10,0x0004814,0x0000c31,0x010005a,0x0006019,0x0021114,0x0240811,0x01c4004,
+	0x0101112,0x100a500,0x02c0011,0x0300051,0x0004484,0x00801e0,0x0204118,0x00c6010,0x0080095,0x0080834,0x00e4020,0x042a001,0x1084002,0x04c0100,0x000a011,0x00c0120,
+	0x2008801,0x0000858,0x0480411,0x002400b,0x00a2041,0x000111c,0x0006007,0x0000817,0x0420803,0x0142c00,0x1068001,0x0125020,0x0026018,0x0407010,0x0141004,0x00c4003,
+	0x1084008,0x0206014,0x01a5000,0x01a0010,0x04a0081,0x00c0801,0x00c1011,0x0800901,0x0128010,0x1000909,0x00a0901,0x0002194,0x1001811,0x0100314,0x1006800,0x0109800,
+	0x1021010,0x0000921,0x0008801,0x0480091,0x1020012,0x0424014,0x00a0014,0x01a0012,0x1000850,0x004a110,0x0442110,0x0060510,0x100a010,0x1109200,0x1020801,0x0121003,
+	0x1060005,0x0005018,0x0064040,0x0202101,0x0020058,0x00c2101,0x0086104,0x0028401,0x0042120,0x0200908,0x00e0401,0x01a9000,0x1000148,0x0160010,0x0084003,0x0204109,
+	0x0194010,0x0200918,0x0002d10,0x0044840,0x1020051,0x00a0012,0x0046110,0x0002849,0x0080819,0x0042940,0x0125000,0x002c011,0x00801c0,0x0086041,0x0020831,0x0506008,
+	0x0480190,0x1100c02,0x0180018,0x0064090,0x0020105,0x1008009,0x0806102,0x3000120,0x0022141,0x08a0010,0x0160050,0x0001851,0x0000812,0x0244801,0x0160084,0x01a0120,
+	0x1048001,0x00a0411,0x00a0005,0x0206110,0x1048500,0x0022421,0x1020018,0x00809a0,0x0049001,0x0200091,0x0005003,0x00a01c0,0x0002c05,0x01e0000,0x0103810,0x0026012,
+	0x004c400,0x0140015,0x0021013,0x0080891,0x00a0005,0x0024014,0x10a0108,0x1040800,0x0800121,0x1004801,0x0082101,0x0048090,0x1002500,0x1404800,0x0301011,0x0102860,
+	0x1080085,0x0020138,0x0110901,0x01a2002,0x1021140,0x1320004,0x1000055,0x0062110,0x010001c,0x00c0011,0x0068041,0x1001d00,0x0046102,0x00a0061,0x1042009,0x00c0013,
+	0x0040c21,0x00000d8,0x1020940,0x0440081,0x1006012,0x010c014,0x0406018,0x0024083,0x0400894,0x000081b,0x00801c0,0x0040050,0x0061110,0x00a1180,0x010480c,0x0000807,
+	0x0000894,0x0044814,0x0082090,0x000a015,0x00a4108,0x0020941,0x0006814,0x0140150,0x0028881,0x0086041,0x100010a,0x00c1180,0x0425010,0x1008011,0x0060130,0x0028019,
+	0x00801a0,0x004a401,0x2000851,0x0084801,0x01a0404,0x1000401,0x0360100,0x10c0010,0x0088010,0x1100820,0x2006801,0x00a5010,0x1120004,0x0022049,0x0006203,0x0806101,
+	0x2000812,0x0124004,0x0002185,0x0042801,0x1004050,0x0020930,0x0020017,0x1000801,0x0108106,0x0222011,0x0008819,0x00420c1,0x1000c21,0x0103084,0x1100808,0x0002550,
+	0x00821c0,0x0042d00,0x1120080,0x00800b0,0x0066080,0x1009040,0x0022085,0x0422140,0x0007810,0x0064090,0x0001001,0x2024030,0x0422010,0x10c0810,0x0045010,0x0082105,
+	0x0426008,0x0202051,0x0040094,0x1108040,0x0106100,0x0220810,0x1024800,0x0001151,0x1000007,0x0120108,0x0880015,0x01a0080,0x100c018,0x0068011,0x002011c,0x0001194,
+	0x1026004,0x01c2400,0x0081108,0x0080087,0x0100051,0x00a4000,0x0020405,0x0320014,0x0080811,0x0480184,0x0102086,0x0028810,0x0202901,0x104c001,0x00a1010,0x00a4082,
+	0x1001809,0x0020118,0x0042014,0x0406400,0x0001041,0x00e4000,0x0407001,0x00860c0,0x010a084,0x10c8001,0x1406008,0x0002419,0x0420980,0x0028109,0x0002845,0x0022051,
+	0x0220118,0x1004060,0x0001911,0x0141104,0x01c0020,0x0008812,0x0020118,0x0001015,0x0004920,0x01c8010,0x0264010,0x0150081,0x0102021,0x1101040,0x1008081,0x1402810,
+	0x1140020,0x0020914,0x0300041,0x10a0001,0x0100078,0x0121030,0x0028184,0x00a4030,0x0000903,0x0402190,0x1088010,0x1004840,0x0088901,0x0000c34,0x0006830,0x0124048,
+	0x0426002,0x01a1080,0x0140124,0x00c0081,0x102001c,0x0460110,0x0182201,0x0264100,0x0182009,0x0060014,0x0009910,0x0480101,0x0068010,0x0444090,0x01a4002,0x00cc000,
+	0x0048411,0x1003041,0x1002150,0x0082910,0x0026014,0x0148810,0x1045000,0x00c0109,0x0002094,0x000a184,0x1080018,0x1140800,0x0066010,0x002a110,0x1446000,0x0080105,
+	0x0006140,0x0000895,0x0185080,0x0106088,0x0109804,0x0086801,0x0084142,0x0028910,0x0008114,0x0001813,0x0180091,0x0048118,0x0102108,0x00a6100,0x0040803,0x0042190,
+	0x0004454,0x0024018,0x0120049,0x00e0010,0x1005801,0x0049005,0x0061005,0x1003801,0x0004890,0x0382001,0x0026041,0x0020831,0x0006404,0x08a0011,0x000600c,0x0088009,
+	0x1400900,0x000cc01,0x1026001,0x00e0500,0x00801a1,0x00e4000,0x0081085,0x1021014,0x0088118,0x0040c10,0x0060110,0x0c80100,0x0008015,0x01408a0,0x1080005,0x0006940,
+	0x0080214,0x0024050,0x0220901,0x0182110,0x00a0130,0x00a4001,0x0180809,0x0100258,0x0424010,0x10e0001,0x0120801,0x0240091,
+};
+
+static const uint8_t wordle_flags[12972] = {
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+	3,3,3,3,3,3,3,3,3,3,3,3,
+};
+
+static const uint32_t wordle_answers[2315] = {
+	10657,10658,10659,10660,10661,10662,10663,10664,10665,10666,10667,10668,10669,10670,10671,10672,
+	10673,10674,10675,10676,10677,10678,10679,10680,10681,10682,10683,10684,10685,10686,10687,10688,
+	10689,10690,10691,10692,10693,10694,10695,10696,10697,10698,10699,10700,10701,10702,10703,10704,
+	10705,10706,10707,10708,10709,10710,10711,10712,10713,10714,10715,10716,10717,10718,10719,10720,
+	10721,10722,10723,10724,10725,10726,10727,10728,10729,10730,10731,10732,10733,10734,10735,10736,
+	10737,10738,10739,10740,10741,10742,10743,10744,10745,10746,10747,10748,10749,10750,10751,10752,
+	10753,10754,10755,10756,10757,10758,10759,10760,10761,10762,10763,10764,10765,10766,10767,10768,
+	10769,10770,10771,10772,10773,10774,10775,10776,10777,10778,10779,10780,10781,10782,10783,10784,
+	10785,10786,10787,10788,10789,10790,10791,10792,10793,10794,10795,10796,10797,10798,10799,10800,
+	10801,10802,10803,10804,10805,10806,10807,10808,10809,10810,10811,10812,10813,10814,10815,10816,
+	10817,10818,10819,10820,10821,10822,10823,10824,10825,10826,10827,10828,10829,10830,10831,10832,
+	10833,10834,10835,10836,10837,10838,10839,10840,10841,10842,10843,10844,10845,10846,10847,10848,
+	10849,10850,10851,10852,10853,10854,10855,10856,10857,10858,10859,10860,10861,10862,10863,10864,
+	10865,10866,10867,10868,10869,10870,10871,10872,10873,10874,10875,10876,10877,10878,10879,10880,
+	10881,10882,10883,10884,10885,10886,10887,10888,10889,10890,10891,10892,10893,10894,10895,10896,
+	10897,10898,10899,10900,10901,10902,10903,10904,10905,10906,10907,10908,10909,10910,10911,10912,
+	10913,10914,10915,10916,10917,10918,10919,10920,10921,10922,10923,10924,10925,10926,10927,10928,
+	10929,10930,10931,10932,10933,10934,10935,10936,10937,10938,10939,10940,10941,10942,10943,10944,
+	10945,10946,10947,10948,10949,10950,10951,10952,10953,10954,10955,10956,10957,10958,10959,10960,
+	10961,10962,10963,10964,10965,10966,10967,10968,10969,10970,10971,10972,10973,10974,10975,10976,
+	10977,10978,10979,10980,10981,10982,10983,10984,10985,10986,10987,10988,10989,10990,10991,10992,
+	10993,10994,10995,10996,10997,10998,10999,11000,11001,11002,11003,11004,11005,11006,11007,11008,
+	11009,11010,11011,11012,11013,11014,11015,11016,11017,11018,11019,11020,11021,11022,11023,11024,
+	11025,11026,11027,11028,11029,11030,11031,11032,11033,11034,11035,11036,11037,11038,11039,11040,
+	11041,11042,11043,11044,11045,11046,11047,11048,11049,11050,11051,11052,11053,11054,11055,11056,
+	11057,11058,11059,11060,11061,11062,11063,11064,11065,11066,11067,11068,11069,11070,11071,11072,
+	11073,11074,11075,11076,11077,11078,11079,11080,11081,11082,11083,11084,11085,11086,11087,11088,
+	11089,11090,11091,11092,11093,11094,11095,11096,11097,11098,11099,11100,11101,11102,11103,11104,
+	11105,11106,11107,11108,11109,11110,11111,11112,11113,11114,11115,11116,11117,11118,11119,11120,
+	11121,11122,11123,11124,11125,11126,11127,11128,11129,11130,11131,11132,11133,11134,11135,11136,
+	11137,11138,11139,11140,11141,11142,11143,11144,11145,11146,11147,11148,11149,11150,11151,11152,
+	11153,11154,11155,11156,11157,11158,11159,11160,11161,11162,11163,11164,11165,11166,11167,11168,
+	11169,11170,11171,11172,11173,11174,11175,11176,11177,11178,11179,11180,11181,11182,11183,11184,
+	11185,11186,11187,11188,11189,11190,11191,11192,11193,11194,11195,11196,11197,11198,11199,11200,
+	11201,11202,11203,11204,11205,11206,11207,11208,11209,11210,11211,11212,11213,11214,11215,11216,
+	11217,11218,11219,11220,11221,11222,11223,11224,11225,11226,11227,11228,11229,11230,11231,11232,
+	11233,11234,11235,11236,11237,11238,11239,11240,11241,11242,11243,11244,11245,11246,11247,11248,
+	11249,11250,11251,11252,11253,11254,11255,11256,11257,11258,11259,11260,11261,11262,11263,11264,
+	11265,11266,11267,11268,11269,11270,11271,11272,11273,11274,11275,11276,11277,11278,11279,11280,
+	11281,11282,11283,11284,11285,11286,11287,11288,11289,11290,11291,11292,11293,11294,11295,11296,
+	11297,11298,11299,11300,11301,11302,11303,11304,11305,11306,11307,11308,11309,11310,11311,11312,
+	11313,11314,11315,11316,11317,11318,11319,11320,11321,11322,11323,11324,11325,11326,11327,11328,
+	11329,11330,11331,11332,11333,11334,11335,11336,11337,11338,11339,11340,11341,11342,11343,11344,
+	11345,11346,11347,11348,11349,11350,11351,11352,11353,11354,11355,11356,11357,11358,11359,11360,
+	11361,11362,11363,11364,11365,11366,11367,11368,11369,11370,11371,11372,11373,11374,11375,11376,
+	11377,11378,11379,11380,11381,11382,11383,11384,11385,11386,11387,11388,11389,11390,11391,11392,
+	11393,11394,11395,11396,11397,11398,11399,11400,11401,11402,11403,11404,11405,11406,11407,11408,
+	11409,11410,11411,11412,11413,11414,11415,11416,11417,11418,11419,11420,11421,11422,11423,11424,
+	11425,11426,11427,11428,11429,11430,11431,11432,11433,11434,11435,11436,11437,11438,11439,11440,
+	11441,11442,11443,11444,11445,11446,11447,11448,11449,11450,11451,11452,11453,11454,11455,11456,
+	11457,11458,11459,11460,11461,11462,11463,11464,11465,11466,11467,11468,11469,11470,11471,11472,
+	11473,11474,11475,11476,11477,11478,11479,11480,11481,11482,11483,11484,11485,11486,11487,11488,
+	11489,11490,11491,11492,11493,11494,11495,11496,11497,11498,11499,11500,11501,11502,11503,11504,
+	11505,11506,11507,11508,11509,11510,11511,11512,11513,11514,11515,11516,11517,11518,11519,11520,
+	11521,11522,11523,11524,11525,11526,11527,11528,11529,11530,11531,11532,11533,11534,11535,11536,
+	11537,11538,11539,11540,11541,11542,11543,11544,11545,11546,11547,11548,11549,11550,11551,11552,
+	11553,11554,11555,11556,11557,11558,11559,11560,11561,11562,11563,11564,11565,11566,11567,11568,
+	11569,11570,11571,11572,11573,11574,11575,11576,11577,11578,11579,11580,11581,11582,11583,11584,
+	11585,11586,11587,11588,11589,11590,11591,11592,11593,11594,11595,11596,11597,11598,11599,11600,
+	11601,11602,11603,11604,11605,11606,11607,11608,11609,11610,11611,11612,11613,11614,11615,11616,
+	11617,11618,11619,11620,11621,11622,11623,11624,11625,11626,11627,11628,11629,11630,11631,11632,
+	11633,11634,11635,11636,11637,11638,11639,11640,11641,11642,11643,11644,11645,11646,11647,11648,
+	11649,11650,11651,11652,11653,11654,11655,11656,11657,11658,11659,11660,11661,11662,11663,11664,
+	11665,11666,11667,11668,11669,11670,11671,11672,11673,11674,11675,11676,11677,11678,11679,11680,
+	11681,11682,11683,11684,11685,11686,11687,11688,11689,11690,11691,11692,11693,11694,11695,11696,
+	11697,11698,11699,11700,11701,11702,11703,11704,11705,11706,11707,11708,11709,11710,11711,11712,
+	11713,11714,11715,11716,11717,11718,11719,11720,11721,11722,11723,11724,11725,11726,11727,11728,
+	11729,11730,11731,11732,11733,11734,11735,11736,11737,11738,11739,11740,11741,11742,11743,11744,
+	11745,11746,11747,11748,11749,11750,11751,11752,11753,11754,11755,11756,11757,11758,11759,11760,
+	11761,11762,11763,11764,11765,11766,11767,11768,11769,11770,11771,11772,11773,11774,11775,11776,
+	11777,11778,11779,11780,11781,11782,11783,11784,11785,11786,11787,11788,11789,11790,11791,11792,
+	11793,11794,11795,11796,11797,11798,11799,11800,11801,11802,11803,11804,11805,11806,11807,11808,
+	11809,11810,11811,11812,11813,11814,11815,11816,11817,11818,11819,11820,11821,11822,11823,11824,
+	11825,11826,11827,11828,11829,11830,11831,11832,11833,11834,11835,11836,11837,11838,11839,11840,
+	11841,11842,11843,11844,11845,11846,11847,11848,11849,11850,11851,11852,11853,11854,11855,11856,
+	11857,11858,11859,11860,11861,11862,11863,11864,11865,11866,11867,11868,11869,11870,11871,11872,
+	11873,11874,11875,11876,11877,11878,11879,11880,11881,11882,11883,11884,11885,11886,11887,11888,
+	11889,11890,11891,11892,11893,11894,11895,11896,11897,11898,11899,11900,11901,11902,11903,11904,
+	11905,11906,11907,11908,11909,11910,11911,11912,11913,11914,11915,11916,11917,11918,11919,11920,
+	11921,11922,11923,11924,11925,11926,11927,11928,11929,11930,11931,11932,11933,11934,11935,11936,
+	11937,11938,11939,11940,11941,11942,11943,11944,11945,11946,11947,11948,11949,11950,11951,11952,
+	11953,11954,11955,11956,11957,11958,11959,11960,11961,11962,11963,11964,11965,11966,11967,11968,
+	11969,11970,11971,11972,11973,11974,11975,11976,11977,11978,11979,11980,11981,11982,11983,11984,
+	11985,11986,11987,11988,11989,11990,11991,11992,11993,11994,11995,11996,11997,11998,11999,12000,
+	12001,12002,12003,12004,12005,12006,12007,12008,12009,12010,12011,12012,12013,12014,12015,12016,
+	12017,12018,12019,12020,12021,12022,12023,12024,12025,12026,12027,12028,12029,12030,12031,12032,
+	12033,12034,12035,12036,12037,12038,12039,12040,12041,12042,12043,12044,12045,12046,12047,12048,
+	12049,12050,12051,12052,12053,12054,12055,12056,12057,12058,12059,12060,12061,12062,12063,12064,
+	12065,12066,12067,12068,12069,12070,12071,12072,12073,12074,12075,12076,12077,12078,12079,12080,
+	12081,12082,12083,12084,12085,12086,12087,12088,12089,12090,12091,12092,12093,12094,12095,12096,
+	12097,12098,12099,12100,12101,12102,12103,12104,12105,12106,12107,12108,12109,12110,12111,12112,
+	12113,12114,12115,12116,12117,12118,12119,12120,12121,12122,12123,12124,12125,12126,12127,12128,
+	12129,12130,12131,12132,12133,12134,12135,12136,12137,12138,12139,12140,12141,12142,12143,12144,
+	12145,12146,12147,12148,12149,12150,12151,12152,12153,12154,12155,12156,12157,12158,12159,12160,
+	12161,12162,12163,12164,12165,12166,12167,12168,12169,12170,12171,12172,12173,12174,12175,12176,
+	12177,12178,12179,12180,12181,12182,12183,12184,12185,12186,12187,12188,12189,12190,12191,12192,
+	12193,12194,12195,12196,12197,12198,12199,12200,12201,12202,12203,12204,12205,12206,12207,12208,
+	12209,12210,12211,12212,12213,12214,12215,12216,12217,12218,12219,12220,12221,12222,12223,12224,
+	12225,12226,12227,12228,12229,12230,12231,12232,12233,12234,12235,12236,12237,12238,12239,12240,
+	12241,12242,12243,12244,12245,12246,12247,12248,12249,12250,12251,12252,12253,12254,12255,12256,
+	12257,12258,12259,12260,12261,12262,12263,12264,12265,12266,12267,12268,12269,12270,12271,12272,
+	12273,12274,12275,12276,12277,12278,12279,12280,12281,12282,12283,12284,12285,12286,12287,12288,
+	12289,12290,12291,12292,12293,12294,12295,12296,12297,12298,12299,12300,12301,12302,12303,12304,
+	12305,12306,12307,12308,12309,12310,12311,12312,12313,12314,12315,12316,12317,12318,12319,12320,
+	12321,12322,12323,12324,12325,12326,12327,12328,12329,12330,12331,12332,12333,12334,12335,12336,
+	12337,12338,12339,12340,12341,12342,12343,12344,12345,12346,12347,12348,12349,12350,12351,12352,
+	12353,12354,12355,12356,12357,12358,12359,12360,12361,12362,12363,12364,12365,12366,12367,12368,
+	12369,12370,12371,12372,12373,12374,12375,12376,12377,12378,12379,12380,12381,12382,12383,12384,
+	12385,12386,12387,12388,12389,12390,12391,12392,12393,12394,12395,12396,12397,12398,12399,12400,
+	12401,12402,12403,12404,12405,12406,12407,12408,12409,12410,12411,12412,12413,12414,12415,12416,
+	12417,12418,12419,12420,12421,12422,12423,12424,12425,12426,12427,12428,12429,12430,12431,12432,
+	12433,12434,12435,12436,12437,12438,12439,12440,12441,12442,12443,12444,12445,12446,12447,12448,
+	12449,12450,12451,12452,12453,12454,12455,12456,12457,12458,12459,12460,12461,12462,12463,12464,
+	12465,12466,12467,12468,12469,12470,12471,12472,12473,12474,12475,12476,12477,12478,12479,12480,
+	12481,12482,12483,12484,12485,12486,12487,12488,12489,12490,12491,12492,12493,12494,12495,12496,
+	12497,12498,12499,12500,12501,12502,12503,12504,12505,12506,12507,12508,12509,12510,12511,12512,
+	12513,12514,12515,12516,12517,12518,12519,12520,12521,12522,12523,12524,12525,12526,12527,12528,
+	12529,12530,12531,12532,12533,12534,12535,12536,12537,12538,12539,12540,12541,12542,12543,12544,
+	12545,12546,12547,12548,12549,12550,12551,12552,12553,12554,12555,12556,12557,12558,12559,12560,
+	12561,12562,12563,12564,12565,12566,12567,12568,12569,12570,12571,12572,12573,12574,12575,12576,
+	12577,12578,12579,12580,12581,12582,12583,12584,12585,12586,12587,12588,12589,12590,12591,12592,
+	12593,12594,12595,12596,12597,12598,12599,12600,12601,12602,12603,12604,12605,12606,12607,12608,
+	12609,12610,12611,12612,12613,12614,12615,12616,12617,12618,12619,12620,12621,12622,12623,12624,
+	12625,12626,12627,12628,12629,12630,12631,12632,12633,12634,12635,12636,12637,12638,12639,12640,
+	12641,12642,12643,12644,12645,12646,12647,12648,12649,12650,12651,12652,12653,12654,12655,12656,
+	12657,12658,12659,12660,12661,12662,12663,12664,12665,12666,12667,12668,12669,12670,12671,12672,
+	12673,12674,12675,12676,12677,12678,12679,12680,12681,12682,12683,12684,12685,12686,12687,12688,
+	12689,12690,12691,12692,12693,12694,12695,12696,12697,12698,12699,12700,12701,12702,12703,12704,
+	12705,12706,12707,12708,12709,12710,12711,12712,12713,12714,12715,12716,12717,12718,12719,12720,
+	12721,12722,12723,12724,12725,12726,12727,12728,12729,12730,12731,12732,12733,12734,12735,12736,
+	12737,12738,12739,12740,12741,12742,12743,12744,12745,12746,12747,12748,12749,12750,12751,12752,
+	12753,12754,12755,12756,12757,12758,12759,12760,12761,12762,12763,12764,12765,12766,12767,12768,
+	12769,12770,12771,12772,12773,12774,12775,12776,12777,12778,12779,12780,12781,12782,12783,12784,
+	12785,12786,12787,12788,12789,12790,12791,12792,12793,12794,12795,12796,12797,12798,12799,12800,
+	12801,12802,12803,12804,12805,12806,12807,12808,12809,12810,12811,12812,12813,12814,12815,12816,
+	12817,12818,12819,12820,12821,12822,12823,12824,12825,12826,12827,12828,12829,12830,12831,12832,
+	12833,12834,12835,12836,12837,12838,12839,12840,12841,12842,12843,12844,12845,12846,12847,12848,
+	12849,12850,12851,12852,12853,12854,12855,12856,12857,12858,12859,12860,12861,12862,12863,12864,
+	12865,12866,12867,12868,12869,12870,12871,12872,12873,12874,12875,12876,12877,12878,12879,12880,
+	12881,12882,12883,12884,12885,12886,12887,12888,12889,12890,12891,12892,12893,12894,12895,12896,
+	12897,12898,12899,12900,12901,12902,12903,12904,12905,12906,12907,12908,12909,12910,12911,12912,
+	12913,12914,12915,12916,12917,12918,12919,12920,12921,12922,12923,12924,12925,12926,12927,12928,
+	12929,12930,12931,12932,12933,12934,12935,12936,12937,12938,12939,12940,12941,12942,12943,12944,
+	12945,12946,12947,12948,12949,12950,12951,12952,12953,12954,12955,12956,12957,12958,12959,12960,
+	12961,12962,12963,12964,12965,12966,12967,12968,12969,12970,12971,
+};
+
+const s_wordle_dictionary wordle_builtin_dictionary = {
+	.entries = 12972,
+	.answer_entries = 2315,
+	.words = wordle_words,
+	.letter_masks = wordle_letter_masks,
+	.flags = wordle_flags,
+	.answers = wordle_answers,
+	.hash = 0xd0a3a8030cd89305ull,
+};
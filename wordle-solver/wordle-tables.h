@@ -0,0 +1,17 @@
+//
+//  wordle-tables.h
+//  wordle-solver
+//
+//  The built in Wordle word lists as a prepared dictionary.  wordle-tables.c is generated from
+//  wordle-words.h by wordle-tables-gen so the words and their tables are const data.  The bitset index
+//  isn't part of it and is built at startup.
+//
+
+#ifndef wordle_tables_h
+#define wordle_tables_h
+
+#include "wordle-solver.h"
+
+extern const s_wordle_dictionary wordle_builtin_dictionary;
+
+#endif /* wordle_tables_h */
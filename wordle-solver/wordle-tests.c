@@ -0,0 +1,50 @@
+//
+//  wordle-tests.c
+//  wordle-solver
+//
+//  Test runner for the "wordle-tests" target: fuzzes the optimized engines against the reference code in
+//  wordle-verify.c and replays the golden file on the built in Wordle lists, exiting nonzero if anything
+//  failed.  Built from every solver source but main.c, e.g.
+//
+//      cc -O2 -pthread -o wordle-tests wordle-tests.c $(ls wordle-*.c | grep -v -e tests -e tables-gen) -lm
+//      ./wordle-tests wordle-golden.txt
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wordle-verify.h"
+#include "wordle-tables.h"
+
+// rounds and seed when none are given, fixed so every run checks the same dictionaries
+#define TESTS_FUZZ_ROUNDS           200
+#define TESTS_FUZZ_SEED             1
+
+int main(int argc, const char * argv[])
+{
+    if(argc < 2 || argc > 4)
+    {
+        printf("usage: %s wordle-golden.txt [fuzz rounds [fuzz seed]]\n", argv[0]);
+        return 1;
+    }
+    int rounds = argc > 2 ? atoi(argv[2]) : TESTS_FUZZ_ROUNDS;
+    unsigned int seed = argc > 3 ? (unsigned int)strtoul(argv[3], NULL, 10) : TESTS_FUZZ_SEED;
+    if(rounds < 1)
+    {
+        printf("invalid number of fuzz rounds; exiting...\n");
+        return 1;
+    }
+    
+    s_wordle_dictionary dictionary = wordle_builtin_dictionary;
+    if(ws_index_build(&dictionary.index, dictionary.words, dictionary.entries))
+    {
+        printf("couldn't prepare dictionary; exiting...\n");
+        return 1;
+    }
+    
+    int failed = ws_verify_fuzz(&dictionary, rounds, seed, false);
+    failed |= ws_golden_check(&dictionary, argv[1]);
+    printf("%s\n", failed ? "FAILED" : "passed");
+    return failed;
+}
@@ -0,0 +1,220 @@
+//
+//  wordle-tournament.c
+//  wordle-solver
+//
+//  Strategy tournament, see wordle-tournament.h.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "wordle-tournament.h"
+
+typedef struct s_tournament_job
+{
+    const s_wordle_strategy *const *strategies;
+    int                           strategy_count;
+    const uint32_t                *targets;
+    int                           games;
+    const s_wordle_dictionary     *dictionary;
+    const char                    *start_word;
+    bool                          hard_mode;
+    const s_search_budget         *search_budget;
+    int                           thread;
+    int                           threads;
+    void                          *scratch;
+    int                           *guesses;     // [strategy*games + game]
+    uint64_t                      *ns;          // same layout
+} s_tournament_job;
+
+static void *tournament_thread(void *arg)
+{
+    s_tournament_job *job = arg;
+    
+    // every strategy plays a target back to back so they all see the same machine load
+    for(int g=job->thread; g<job->games; g+=job->threads)
+    {
+        for(int s=0; s<job->strategy_count; s++)
+        {
+            s_wordle_state wordle_state;
+            uint64_t start = ws_now_ns();
+            ws_init(&wordle_state, job->start_word, job->hard_mode);
+            wordle_state.search_budget = *job->search_budget;
+            WS_TRACE_EVENT(false, WS_TRACE_GAME_BEGIN, job->targets[g]);
+            int guess_count = ws_strategy_play(job->strategies[s],
+                                               &wordle_state,
+                                               job->dictionary,
+                                               job->targets[g],
+                                               job->scratch,
+                                               false);
+            WS_TRACE_EVENT(false, WS_TRACE_GAME_END, (uint32_t)guess_count);
+            job->guesses[s*job->games + g] = guess_count;
+            job->ns[s*job->games + g] = ws_now_ns() - start;
+        }
+    }
+    ws_stats_flush();
+    return NULL;
+}
+
+/*
+ *  play every target with every strategy, spreading targets across threads, and summarize into results[].
+ *  returns nonzero if out of memory.
+ */
+int ws_tournament_run(const s_wordle_strategy *const *strategies,
+                      int                           strategy_count,
+                      const uint32_t                *targets,
+                      int                           games,
+                      const s_wordle_dictionary     *dictionary,
+                      const char                    *start_word,
+                      bool                          hard_mode,
+                      const s_search_budget         *search_budget,
+                      int                           threads,
+                      s_tournament_result           *results)
+{
+    size_t scratch_size = 0;
+    for(int s=0; s<strategy_count; s++)
+    {
+        if(strategies[s]->scratch_size > scratch_size)
+        {
+            scratch_size = strategies[s]->scratch_size;
+        }
+    }
+    if(threads > games)
+    {
+        threads = games > 0 ? games : 1;
+    }
+    
+    int *guesses = malloc(sizeof(int)*(size_t)strategy_count*(size_t)games);
+    uint64_t *ns = malloc(sizeof(uint64_t)*(size_t)strategy_count*(size_t)games);
+    char *scratch = calloc((size_t)threads, scratch_size ? scratch_size : 1);
+    if(!guesses || !ns || !scratch)
+    {
+        free(guesses);
+        free(ns);
+        free(scratch);
+        return 1;
+    }
+    
+    pthread_t thread_ids[threads];
+    s_tournament_job jobs[threads];
+    bool started[threads];
+    for(int t=0; t<threads; t++)
+    {
+        jobs[t] = (s_tournament_job){strategies, strategy_count, targets, games, dictionary, start_word, hard_mode,
+                                     search_budget, t, threads, scratch + (size_t)t*scratch_size, guesses, ns};
+    }
+    for(int t=1; t<threads; t++)
+    {
+        started[t] = pthread_create(&thread_ids[t], NULL, tournament_thread, &jobs[t]) == 0;
+    }
+    
+    // every game has to be played before the summary reads it, so a thread that couldn't be started leaves
+    // its share to this one
+    tournament_thread(&jobs[0]);
+    for(int t=1; t<threads; t++)
+    {
+        if(!started[t])
+        {
+            tournament_thread(&jobs[t]);
+        }
+    }
+    for(int t=1; t<threads; t++)
+    {
+        if(started[t])
+        {
+            pthread_join(thread_ids[t], NULL);
+        }
+    }
+    
+    for(int s=0; s<strategy_count; s++)
+    {
+        s_tournament_result *result = &results[s];
+        const int *strategy_guesses = &guesses[s*games];
+        int histogram[WS_STRATEGY_MAX_GUESSES+2] = {0};
+        uint64_t total_guesses = 0, total_ns = 0;
+        int wins = 0;
+        double diff_sum = 0.0, diff_squares = 0.0;
+        
+        memset(result, 0, sizeof(s_tournament_result));
+        result->strategy = strategies[s];
+        result->games = games;
+        for(int g=0; g<games; g++)
+        {
+            int count = strategy_guesses[g];
+            histogram[count]++;
+            total_guesses += (uint64_t)count;
+            total_ns += ns[s*games + g];
+            wins += count <= 6;
+            if(count > result->max_guesses)
+            {
+                result->max_guesses = count;
+            }
+            
+            int diff = count - guesses[g];
+            diff_sum += diff;
+            diff_squares += (double)diff*diff;
+            result->better += diff < 0;
+            result->worse += diff > 0;
+        }
+        if(games == 0)
+        {
+            continue;
+        }
+        
+        // guess counts are small so the percentile comes straight from the histogram
+        int rank = (99*games + 99)/100, seen = 0;
+        for(int c=0; c<WS_STRATEGY_MAX_GUESSES+2; c++)
+        {
+            seen += histogram[c];
+            if(seen >= rank)
+            {
+                result->p99_guesses = c;
+                break;
+            }
+        }
+        
+        result->mean_guesses = (double)total_guesses/games;
+        result->win_rate = (double)wins/games;
+        result->us_per_game = (double)total_ns/games/1000.0;
+        result->paired_diff = diff_sum/games;
+        if(games > 1)
+        {
+            double variance = (diff_squares - diff_sum*diff_sum/games)/(games - 1);
+            result->paired_ci = 1.96*sqrt(variance > 0.0 ? variance : 0.0)/sqrt((double)games);
+        }
+    }
+    
+    free(guesses);
+    free(ns);
+    free(scratch);
+    return 0;
+}
+
+void ws_tournament_report(FILE                      *fp,
+                          const s_tournament_result *results,
+                          int                       strategy_count)
+{
+    if(strategy_count == 0)
+    {
+        return;
+    }
+    
+    fprintf(fp, "%d games per strategy, paired against %s on the same targets\n", results[0].games,
+            results[0].strategy->name);
+    fprintf(fp, "%-12s %8s %8s %5s %5s %10s %18s %8s %8s\n", "strategy", "mean", "win%", "p99", "max", "us/game",
+            "paired diff", "better", "worse");
+    for(int s=0; s<strategy_count; s++)
+    {
+        const s_tournament_result *result = &results[s];
+        char paired[32] = "-";
+        if(s > 0)
+        {
+            snprintf(paired, sizeof(paired), "%+.4f +/- %.4f", result->paired_diff, result->paired_ci);
+        }
+        fprintf(fp, "%-12s %8.4f %7.2f%% %5d %5d %10.1f %18s %8d %8d\n", result->strategy->name, result->mean_guesses,
+                100.0*result->win_rate, result->p99_guesses, result->max_guesses, result->us_per_game, paired,
+                result->better, result->worse);
+    }
+}
@@ -0,0 +1,46 @@
+//
+//  wordle-tournament.h
+//  wordle-solver
+//
+//  Strategy tournament: several strategies play the same targets in parallel and are reported side by side,
+//  both on their own and paired against the first strategy target by target.
+//
+
+#ifndef wordle_tournament_h
+#define wordle_tournament_h
+
+#include "wordle-strategy.h"
+
+#define WS_MAX_STRATEGIES           8
+
+typedef struct s_tournament_result
+{
+    const s_wordle_strategy *strategy;
+    int                     games;
+    double                  mean_guesses;
+    double                  win_rate;       // fraction of games won in six guesses or fewer
+    int                     p99_guesses;
+    int                     max_guesses;
+    double                  us_per_game;    // wall clock, measured per game on the thread that played it
+    double                  paired_diff;    // mean guesses minus the first strategy's on the same targets
+    double                  paired_ci;      // 95% confidence half width of paired_diff
+    int                     better;         // targets solved in fewer guesses than the first strategy
+    int                     worse;          // and in more
+} s_tournament_result;
+
+int ws_tournament_run(const s_wordle_strategy *const *strategies,
+                      int                           strategy_count,
+                      const uint32_t                *targets,
+                      int                           games,
+                      const s_wordle_dictionary     *dictionary,
+                      const char                    *start_word,
+                      bool                          hard_mode,
+                      const s_search_budget         *search_budget,
+                      int                           threads,
+                      s_tournament_result           *results);
+
+void ws_tournament_report(FILE                      *fp,
+                          const s_tournament_result *results,
+                          int                       strategy_count);
+
+#endif /* wordle_tournament_h */
@@ -0,0 +1,268 @@
+//
+//  wordle-trace.c
+//  wordle-solver
+//
+//  Structured tracing, see wordle-trace.h.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "wordle-trace.h"
+#include "wordle-stats.h"
+#include "wordle-alphabet.h"
+
+#define WS_TRACE_MAGIC              "WSTRACE1"
+#define WS_TRACE_VERSION            1
+
+typedef struct s_trace_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t event_size;
+    uint64_t events;
+    uint64_t dropped;
+} s_trace_header;
+
+static const char *phase_names[WS_PHASES] = {"load", "score", "filter", "feedback"};
+static const char *event_names[] = {"", "game", "game", "guess", "candidates", "eliminate at", "eliminate all", "board solved", "host keeps", "phase", "phase"};
+
+/*
+ *  render a single event as the line the solver used to print, words and letters in the current alphabet
+ */
+void ws_trace_print(FILE                *fp,
+                    const s_trace_event *event)
+{
+    char word[WORDLE_WORD_SIZE+1], text[WS_ALPHABET_TEXT_SIZE];
+    
+    switch(event->type)
+    {
+        case WS_TRACE_GAME_BEGIN:
+            ws_word_decode(event->arg, word);
+            fprintf(fp, "searching for word %s\n", ws_alphabet_text(word, text));
+            break;
+        case WS_TRACE_GAME_END:
+            fprintf(fp, "found word in %u tries\n", event->arg);
+            break;
+        case WS_TRACE_GUESS:
+            ws_word_decode(event->arg, word);
+            fprintf(fp, "best guess is %s\n", ws_alphabet_text(word, text));
+            break;
+        case WS_TRACE_CANDIDATES:
+            fprintf(fp, "picked from %u candidates\n", event->arg);
+            break;
+        case WS_TRACE_ELIMINATE_AT:
+            fprintf(fp, "eliminating %s from location %u\n", ws_alphabet_letter((char)(event->arg & 0xff), text),
+                    event->arg >> 8);
+            break;
+        case WS_TRACE_ELIMINATE_ALL:
+            fprintf(fp, "eliminating %s from all locations\n", ws_alphabet_letter((char)event->arg, text));
+            break;
+        case WS_TRACE_BOARD_SOLVED:
+            fprintf(fp, "solved board %u\n", event->arg);
+            break;
+        case WS_TRACE_HOST_KEEPS:
+            fprintf(fp, "host keeps %u answers\n", event->arg);
+            break;
+        case WS_TRACE_PHASE_BEGIN:
+        case WS_TRACE_PHASE_END:
+            fprintf(fp, "%s %s\n", event->type == WS_TRACE_PHASE_BEGIN ? "begin" : "end",
+                    event->arg < WS_PHASES ? phase_names[event->arg] : "?");
+            break;
+        default:
+            fprintf(fp, "unknown event %u (%u)\n", event->type, event->arg);
+            break;
+    }
+}
+
+#if WS_TRACE
+
+bool ws_trace_enabled = false;
+_Thread_local s_trace_ring *ws_thread_trace_ring = NULL;
+
+static s_trace_ring *trace_rings = NULL;
+static uint16_t trace_threads = 0;
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ *  first event on a thread allocates its ring, rings outlive their threads so they can be written at exit.
+ *  returns NULL if the ring couldn't be allocated, which turns tracing off and leaves the thread without one.
+ */
+s_trace_ring *ws_trace_register_thread(void)
+{
+    s_trace_ring *ring = calloc(1, sizeof(s_trace_ring));
+    if(ring != NULL)
+    {
+        ring->events = malloc(sizeof(s_trace_event)*WS_TRACE_RING_EVENTS);
+    }
+    if(ring == NULL || ring->events == NULL)
+    {
+        fprintf(stderr, "couldn't allocate trace buffer, tracing disabled\n");
+        ws_trace_enabled = false;
+        free(ring);
+        return NULL;
+    }
+    
+    pthread_mutex_lock(&trace_lock);
+    ring->thread = trace_threads++;
+    ring->next = trace_rings;
+    trace_rings = ring;
+    pthread_mutex_unlock(&trace_lock);
+    
+    ws_thread_trace_ring = ring;
+    return ring;
+}
+
+/*
+ *  dump every thread's ring, oldest events first.  only call once the traced threads are done.
+ */
+int ws_trace_write(const char *path)
+{
+    FILE *fp = fopen(path, "wb");
+    if(!fp)
+    {
+        printf("couldn't write trace %s\n", path);
+        return 1;
+    }
+    
+    s_trace_header header = {WS_TRACE_MAGIC, WS_TRACE_VERSION, sizeof(s_trace_event), 0, 0};
+    for(s_trace_ring *ring=trace_rings; ring; ring=ring->next)
+    {
+        uint64_t kept = ring->head < WS_TRACE_RING_EVENTS ? ring->head : WS_TRACE_RING_EVENTS;
+        header.events += kept;
+        header.dropped += ring->head - kept;
+    }
+    fwrite(&header, sizeof(header), 1, fp);
+    
+    for(s_trace_ring *ring=trace_rings; ring; ring=ring->next)
+    {
+        uint64_t first = ring->head < WS_TRACE_RING_EVENTS ? 0 : ring->head - WS_TRACE_RING_EVENTS;
+        uint64_t start = first & (WS_TRACE_RING_EVENTS-1);
+        uint64_t kept = ring->head - first;
+        
+        // the ring may wrap, write the tail end first
+        uint64_t tail = kept < WS_TRACE_RING_EVENTS - start ? kept : WS_TRACE_RING_EVENTS - start;
+        fwrite(&ring->events[start], sizeof(s_trace_event), tail, fp);
+        fwrite(&ring->events[0], sizeof(s_trace_event), kept - tail, fp);
+    }
+    fclose(fp);
+    
+    printf("wrote %llu trace events to %s", (unsigned long long)header.events, path);
+    if(header.dropped)
+    {
+        printf(" (%llu oldest events overwritten)", (unsigned long long)header.dropped);
+    }
+    printf("\n");
+    return 0;
+}
+
+#endif /* WS_TRACE */
+
+static int compare_events(const void *a, const void *b)
+{
+    const s_trace_event *event_a = a, *event_b = b;
+    if(event_a->time_ns != event_b->time_ns)
+    {
+        return event_a->time_ns < event_b->time_ns ? -1 : 1;
+    }
+    return (int)event_a->thread - (int)event_b->thread;
+}
+
+/*
+ *  render a trace file as text or as Chrome trace JSON (load in chrome://tracing or Perfetto)
+ */
+int ws_trace_decode(const char *path,
+                    bool       json,
+                    FILE       *out)
+{
+    FILE *fp = fopen(path, "rb");
+    if(!fp)
+    {
+        printf("couldn't load trace %s\n", path);
+        return 1;
+    }
+    
+    s_trace_header header;
+    if(fread(&header, sizeof(header), 1, fp) != 1 ||
+       memcmp(header.magic, WS_TRACE_MAGIC, sizeof(header.magic)) ||
+       header.version != WS_TRACE_VERSION ||
+       header.event_size != sizeof(s_trace_event))
+    {
+        printf("%s is not a trace file from this build\n", path);
+        fclose(fp);
+        return 1;
+    }
+    
+    s_trace_event *events = malloc(sizeof(s_trace_event)*(header.events ? header.events : 1));
+    if(!events || fread(events, sizeof(s_trace_event), header.events, fp) != header.events)
+    {
+        printf("trace %s is truncated\n", path);
+        free(events);
+        fclose(fp);
+        return 1;
+    }
+    fclose(fp);
+    
+    qsort(events, header.events, sizeof(s_trace_event), compare_events);
+    uint64_t base_ns = header.events ? events[0].time_ns : 0;
+    
+    if(json)
+    {
+        fprintf(out, "{\"traceEvents\":[\n");
+    }
+    else if(header.dropped)
+    {
+        fprintf(out, "# %llu oldest events were overwritten\n", (unsigned long long)header.dropped);
+    }
+    
+    for(uint64_t i=0; i<header.events; i++)
+    {
+        s_trace_event *event = &events[i];
+        double time_us = (double)(event->time_ns - base_ns)/1000.0;
+        
+        if(!json)
+        {
+            fprintf(out, "%14.3f us [%u] ", time_us, event->thread);
+            ws_trace_print(out, event);
+            continue;
+        }
+        
+        const char *separator = i+1 < header.events ? "," : "";
+        char word[WORDLE_WORD_SIZE+1];
+        switch(event->type)
+        {
+            case WS_TRACE_GAME_BEGIN:
+                ws_word_decode(event->arg, word);
+                fprintf(out, "{\"name\":\"game\",\"ph\":\"B\",\"ts\":%.3f,\"pid\":0,\"tid\":%u,\"args\":{\"target\":\"%s\"}}%s\n",
+                        time_us, event->thread, word, separator);
+                break;
+            case WS_TRACE_GAME_END:
+                fprintf(out, "{\"name\":\"game\",\"ph\":\"E\",\"ts\":%.3f,\"pid\":0,\"tid\":%u,\"args\":{\"guesses\":%u}}%s\n",
+                        time_us, event->thread, event->arg, separator);
+                break;
+            case WS_TRACE_PHASE_BEGIN:
+            case WS_TRACE_PHASE_END:
+                fprintf(out, "{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":0,\"tid\":%u}%s\n",
+                        event->arg < WS_PHASES ? phase_names[event->arg] : "?",
+                        event->type == WS_TRACE_PHASE_BEGIN ? "B" : "E", time_us, event->thread, separator);
+                break;
+            case WS_TRACE_GUESS:
+                ws_word_decode(event->arg, word);
+                fprintf(out, "{\"name\":\"guess\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":0,\"tid\":%u,\"args\":{\"word\":\"%s\"}}%s\n",
+                        time_us, event->thread, word, separator);
+                break;
+            default:
+                fprintf(out, "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":0,\"tid\":%u,\"args\":{\"arg\":%u}}%s\n",
+                        event->type <= WS_TRACE_PHASE_END ? event_names[event->type] : "unknown", time_us, event->thread, event->arg, separator);
+                break;
+        }
+    }
+    
+    if(json)
+    {
+        fprintf(out, "]}\n");
+    }
+    free(events);
+    return 0;
+}
@@ -0,0 +1,115 @@
+//
+//  wordle-trace.h
+//  wordle-solver
+//
+//  Structured tracing.  Trace points write fixed size binary events into a per-thread ring buffer that only
+//  its own thread touches, so recording is a few stores with no locks or formatting.  The rings are written
+//  to a file at exit (-trace=file) and decoded offline to text or a Chrome trace timeline (-trace-decode=file,
+//  -trace-json=file).  With -v the same events are also rendered to stderr as they happen.
+//  Build with WS_TRACE=0 to compile recording out, leaving only the verbose printing.
+//
+
+#ifndef wordle_trace_h
+#define wordle_trace_h
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "wordle-word.h"
+#include "wordle-stats.h"
+
+#ifndef WS_TRACE
+#define WS_TRACE                    1
+#endif
+
+// events per thread, must be a power of two.  oldest events are overwritten once a ring fills.
+#define WS_TRACE_RING_EVENTS        (1 << 18)
+
+#define WS_TRACE_GAME_BEGIN         1       // arg: packed target word
+#define WS_TRACE_GAME_END           2       // arg: guesses
+#define WS_TRACE_GUESS              3       // arg: packed guess word
+#define WS_TRACE_CANDIDATES         4       // arg: candidates the guess was picked from
+#define WS_TRACE_ELIMINATE_AT       5       // arg: letter | location << 8
+#define WS_TRACE_ELIMINATE_ALL      6       // arg: letter
+#define WS_TRACE_BOARD_SOLVED       7       // arg: board
+#define WS_TRACE_HOST_KEEPS         8       // arg: answers the adversarial host kept
+#define WS_TRACE_PHASE_BEGIN        9       // arg: WS_PHASE_*
+#define WS_TRACE_PHASE_END          10      // arg: WS_PHASE_*
+
+typedef struct s_trace_event
+{
+    uint64_t time_ns;
+    uint16_t type;
+    uint16_t thread;
+    uint32_t arg;
+} s_trace_event;
+
+typedef struct s_trace_ring
+{
+    s_trace_event       *events;
+    uint64_t            head;               // events ever written, the ring holds the last WS_TRACE_RING_EVENTS
+    uint16_t            thread;
+    struct s_trace_ring *next;
+} s_trace_ring;
+
+void ws_trace_print(FILE                *fp,
+                    const s_trace_event *event);
+
+#if WS_TRACE
+
+extern bool ws_trace_enabled;
+extern _Thread_local s_trace_ring *ws_thread_trace_ring;
+
+s_trace_ring *ws_trace_register_thread(void);
+
+static inline void ws_trace_record(uint16_t type,
+                                   uint32_t arg)
+{
+    s_trace_ring *ring = ws_thread_trace_ring;
+    if(ring == NULL && (ring = ws_trace_register_thread()) == NULL)
+    {
+        return;
+    }
+    
+    s_trace_event *event = &ring->events[ring->head & (WS_TRACE_RING_EVENTS-1)];
+    event->time_ns = ws_now_ns();
+    event->type = type;
+    event->thread = ring->thread;
+    event->arg = arg;
+    ring->head++;
+}
+
+#define WS_TRACE_EVENT(verbose, type, arg)                                      \
+    do                                                                          \
+    {                                                                           \
+        if(ws_trace_enabled)                                                    \
+        {                                                                       \
+            ws_trace_record((type), (arg));                                     \
+        }                                                                       \
+        if(verbose)                                                             \
+        {                                                                       \
+            ws_trace_print(stderr, &(s_trace_event){0, (type), 0, (arg)});      \
+        }                                                                       \
+    } while(0)
+
+int ws_trace_write(const char *path);
+
+#else
+
+#define WS_TRACE_EVENT(verbose, type, arg)                                      \
+    do                                                                          \
+    {                                                                           \
+        if(verbose)                                                             \
+        {                                                                       \
+            ws_trace_print(stderr, &(s_trace_event){0, (type), 0, (arg)});      \
+        }                                                                       \
+    } while(0)
+
+#endif /* WS_TRACE */
+
+int ws_trace_decode(const char *path,
+                    bool       json,
+                    FILE       *out);
+
+#endif /* wordle_trace_h */
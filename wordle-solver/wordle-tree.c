@@ -0,0 +1,303 @@
+//
+//  wordle-tree.c
+//  wordle-solver
+//
+//  Greedy decision tree, see wordle-tree.h.
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "wordle-tree.h"
+#include "wordle-matrix.h"
+#include "wordle-partition.h"
+
+typedef struct s_tree_context
+{
+    const s_wordle_dictionary *dictionary;
+    int                       threads;
+    uint8_t                   *in_node;         // answers of the node being scored, by dictionary entry
+    s_partition_classes       *classes;         // guesses already scored at a small node
+    s_tree_result             *result;
+    size_t                    index_bytes;      // answer indexes held right now
+    bool                      failed;           // out of memory somewhere down the tree
+} s_tree_context;
+
+/*
+ *  lower sum of squared bucket sizes wins, and on a tie a guess that might be the answer
+ */
+static inline bool better_split(int64_t score,
+                                bool    in_node,
+                                int64_t best_score,
+                                bool    best_in_node)
+{
+    return score < best_score || (score == best_score && in_node && !best_in_node);
+}
+
+/*
+ *  pick the best guess for a node from its index, filling members/offsets with its split, returns the guess
+ */
+static int split_indexed(s_tree_context       *context,
+                         const s_answer_index *index,
+                         uint16_t             *members,
+                         uint16_t             offsets[WS_ANSWER_INDEX_OFFSETS])
+{
+    // bucket sizes are free, so scoring every guess is a walk over its offset table
+    int best = 0;
+    int64_t best_score = INT64_MAX;
+    for(int g=0; g<index->guesses; g++)
+    {
+        int64_t score = ws_answer_index_sum_squares(index, g);
+        if(better_split(score, context->in_node[g], best_score, context->in_node[best]))
+        {
+            best = g;
+            best_score = score;
+        }
+    }
+    
+    memcpy(offsets, index->offsets + (size_t)best*WS_ANSWER_INDEX_OFFSETS, sizeof(uint16_t)*WS_ANSWER_INDEX_OFFSETS);
+    memcpy(members, ws_answer_index_bucket(index, best, 0), sizeof(uint16_t)*(size_t)index->answers);
+    if(context->result->nodes == 0)
+    {
+        context->result->root_entropy = ws_answer_index_entropy(index, best);
+    }
+    context->result->indexed_nodes++;
+    return best;
+}
+
+/*
+ *  count index bytes held, a negative count for released ones
+ */
+static void hold_index_bytes(s_tree_context *context,
+                             int64_t        bytes)
+{
+    context->index_bytes += bytes;
+    if(context->index_bytes > context->result->peak_index_bytes)
+    {
+        context->result->peak_index_bytes = context->index_bytes;
+    }
+}
+
+/*
+ *  done with a node's index
+ */
+static void release_index(s_tree_context *context,
+                          s_answer_index *index)
+{
+    if(index)
+    {
+        hold_index_bytes(context, -(int64_t)index->bytes);
+        ws_answer_index_release(index);
+    }
+}
+
+/*
+ *  same for a small node, scoring each guess straight from its patterns
+ */
+static int split_direct(s_tree_context *context,
+                        const uint16_t *answers,
+                        int            count,
+                        uint16_t       *members,
+                        uint16_t       offsets[WS_ANSWER_INDEX_OFFSETS])
+{
+    const s_wordle_dictionary *dictionary = context->dictionary;
+    uint32_t answer_words[WS_TREE_INDEX_MIN_ANSWERS], answer_masks[WS_TREE_INDEX_MIN_ANSWERS];
+    uint8_t patterns[WS_TREE_INDEX_MIN_ANSWERS];
+    int counts[WS_FEEDBACK_PATTERNS] = {0};
+    uint32_t live_letters = 0;
+    ws_partition_classes_clear(context->classes);
+    for(int a=0; a<count; a++)
+    {
+        answer_words[a] = dictionary->words[answers[a]];
+        answer_masks[a] = dictionary->letter_masks[answers[a]];
+        live_letters |= answer_masks[a];
+        ws_partition_classes_add(context->classes, answer_words[a]);
+    }
+    
+    int best = 0;
+    int64_t best_score = INT64_MAX;
+    for(int g=0; g<dictionary->entries; g++)
+    {
+        // a guess splitting the answers just like an answer or an earlier guess can't win the tie with it
+        uint32_t key = ws_partition_key(dictionary->words[g], live_letters);
+        if(!context->in_node[g] && (key == WS_PARTITION_NO_INFORMATION || !ws_partition_classes_add(context->classes, key)))
+        {
+            context->result->deduplicated++;
+            continue;
+        }
+        context->result->scored++;
+        
+        ws_pattern_row(dictionary->words[g], answer_words, answer_masks, count, patterns);
+        int64_t score = 0;
+        for(int a=0; a<count; a++)
+        {
+            score += 2*counts[patterns[a]]++ + 1;
+        }
+        for(int a=0; a<count; a++)
+        {
+            counts[patterns[a]] = 0;
+        }
+        if(better_split(score, context->in_node[g], best_score, context->in_node[best]))
+        {
+            best = g;
+            best_score = score;
+            
+            // every answer alone and the guess one of them, nothing splits better
+            if(score == count && context->in_node[g])
+            {
+                break;
+            }
+        }
+    }
+    
+    ws_pattern_row(dictionary->words[best], answer_words, answer_masks, count, patterns);
+    for(int a=0; a<count; a++)
+    {
+        counts[patterns[a]]++;
+    }
+    int offset = 0;
+    for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+    {
+        offsets[p] = (uint16_t)offset;
+        offset += counts[p];
+        counts[p] = offsets[p];
+    }
+    offsets[WS_FEEDBACK_PATTERNS] = (uint16_t)offset;
+    for(int a=0; a<count; a++)
+    {
+        members[counts[patterns[a]]++] = answers[a];
+    }
+    return best;
+}
+
+/*
+ *  everything below a node whose answers are all depth guesses in.  a large node comes with its index, split
+ *  off its parent's, except the root which builds its own, and releases it before going down
+ */
+static void tree_node(s_tree_context *context,
+                      const uint16_t *answers,
+                      int            count,
+                      int            depth,
+                      s_answer_index *index)
+{
+    s_tree_result *result = context->result;
+    if(context->failed)
+    {
+        release_index(context, index);
+        return;
+    }
+    if(count <= 2)
+    {
+        // guess one, and if that wasn't it the other
+        for(int a=0; a<count; a++)
+        {
+            result->total_guesses += depth + 1 + a;
+            if(depth + 1 + a > result->max_guesses)
+            {
+                result->max_guesses = depth + 1 + a;
+            }
+        }
+        return;
+    }
+    
+    s_answer_index root_index;
+    if(!index && count >= WS_TREE_INDEX_MIN_ANSWERS)
+    {
+        if(ws_answer_index_build(&root_index, context->dictionary, answers, count, context->threads))
+        {
+            context->failed = true;
+            return;
+        }
+        index = &root_index;
+        hold_index_bytes(context, (int64_t)index->bytes);
+    }
+    uint16_t *members = malloc(sizeof(uint16_t)*(size_t)count);
+    uint16_t offsets[WS_ANSWER_INDEX_OFFSETS];
+    if(!members)
+    {
+        release_index(context, index);
+        context->failed = true;
+        return;
+    }
+    for(int a=0; a<count; a++)
+    {
+        context->in_node[answers[a]] = 1;
+    }
+    int guess = index ? split_indexed(context, index, members, offsets) :
+                        split_direct(context, answers, count, members, offsets);
+    for(int a=0; a<count; a++)
+    {
+        context->in_node[answers[a]] = 0;
+    }
+    if(result->nodes++ == 0)
+    {
+        result->root_guess = guess;
+    }
+    
+    // the large children's indexes come out of this one, which isn't needed after
+    s_answer_index children[WS_FEEDBACK_PATTERNS];
+    memset(children, 0, sizeof(children));
+    if(index)
+    {
+        if(ws_answer_index_split(index, guess, WS_TREE_INDEX_MIN_ANSWERS, children, context->threads))
+        {
+            context->failed = true;
+        }
+        for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+        {
+            hold_index_bytes(context, (int64_t)children[p].bytes);
+        }
+        release_index(context, index);
+    }
+    
+    // children are contiguous runs of the split, the solved bucket is the guess itself
+    for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+    {
+        int size = offsets[p+1] - offsets[p];
+        if(p == WS_FEEDBACK_SOLVED && size)
+        {
+            result->total_guesses += depth + 1;
+        }
+        else if(size)
+        {
+            tree_node(context, members + offsets[p], size, depth + 1, children[p].answers ? &children[p] : NULL);
+        }
+    }
+    free(members);
+}
+
+/*
+ *  build the tree over every answer, returns nonzero if out of memory
+ */
+int ws_tree_build(const s_wordle_dictionary *dictionary,
+                  int                       threads,
+                  s_tree_result             *result)
+{
+    uint64_t start = ws_now_ns();
+    memset(result, 0, sizeof(s_tree_result));
+    result->answers = dictionary->answer_entries;
+    
+    uint16_t *answers = malloc(sizeof(uint16_t)*(size_t)(result->answers ? result->answers : 1));
+    uint8_t *in_node = calloc((size_t)(dictionary->entries ? dictionary->entries : 1), 1);
+    s_partition_classes *classes = calloc(1, sizeof(s_partition_classes));
+    if(!answers || !in_node || !classes)
+    {
+        free(answers);
+        free(in_node);
+        free(classes);
+        return 1;
+    }
+    for(int a=0; a<result->answers; a++)
+    {
+        answers[a] = (uint16_t)dictionary->answers[a];
+    }
+    
+    s_tree_context context = {dictionary, threads, in_node, classes, result, 0, false};
+    tree_node(&context, answers, result->answers, 0, NULL);
+    
+    free(answers);
+    free(in_node);
+    free(classes);
+    result->build_ns = ws_now_ns() - start;
+    return context.failed;
+}
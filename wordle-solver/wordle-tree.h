@@ -0,0 +1,38 @@
+//
+//  wordle-tree.h
+//  wordle-solver
+//
+//  Greedy decision tree over the answers: every node guesses whichever word splits its answers most evenly
+//  and every feedback pattern leads to a child node, so the tree is a complete strategy and its average
+//  depth is the average number of guesses.  Large nodes are split with the per guess answer index, built
+//  once at the root and split down the tree along with the answers.
+//
+
+#ifndef wordle_tree_h
+#define wordle_tree_h
+
+#include "wordle-answer-index.h"
+
+// nodes with fewer answers are scored directly, the index's offset tables would outweigh them
+#define WS_TREE_INDEX_MIN_ANSWERS   32
+
+typedef struct s_tree_result
+{
+    int      answers;
+    int64_t  total_guesses;                 // over every answer, average is total_guesses/answers
+    int      max_guesses;
+    int      nodes;                         // nodes that had to pick a guess
+    int      indexed_nodes;                 // of which split with the answer index
+    int64_t  scored;                        // guesses scored at the other nodes
+    int64_t  deduplicated;                  // and dropped there as splitting the answers like another
+    size_t   peak_index_bytes;              // most answer index bytes held at once
+    int      root_guess;                    // dictionary entry
+    double   root_entropy;                  // bits
+    uint64_t build_ns;
+} s_tree_result;
+
+int ws_tree_build(const s_wordle_dictionary *dictionary,
+                  int                       threads,
+                  s_tree_result             *result);
+
+#endif /* wordle_tree_h */
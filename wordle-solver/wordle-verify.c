@@ -0,0 +1,713 @@
+//
+//  wordle-verify.c
+//  wordle-solver
+//
+//  Differential fuzzing and golden files, see wordle-verify.h.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <inttypes.h>
+
+#include "wordle-verify.h"
+#include "wordle-dictionary.h"
+#include "wordle-query.h"
+#include "wordle-search.h"
+#include "wordle-strategy.h"
+#include "wordle-matrix.h"
+#include "wordle-answer-index.h"
+#include "wordle-multi.h"
+
+#define VERIFY_FEEDBACK             0
+#define VERIFY_CANDIDATES           1
+#define VERIFY_QUERY                2
+#define VERIFY_INDEX                3
+#define VERIFY_SEARCH               4
+#define VERIFY_STRATEGY             5
+#define VERIFY_REORDER              6
+#define VERIFY_CHECKS               7
+
+// failures printed per check, the rest are only counted
+#define VERIFY_PRINTED              8
+
+#define GOLDEN_PRINTED              20
+
+static const char *verify_names[VERIFY_CHECKS] = {"feedback", "candidates", "query", "answer index", "search", "strategy",
+                                                  "reorder"};
+
+typedef struct s_verify_context
+{
+    int      round;
+    uint64_t checks[VERIFY_CHECKS];
+    uint64_t failures[VERIFY_CHECKS];
+} s_verify_context;
+
+/*
+ *  count a check, printing what went wrong if it failed.  returns the result so callers can stop early
+ */
+static bool verify(s_verify_context *context,
+                   int              check,
+                   bool             passed,
+                   const char       *fmt,
+                   ...)
+{
+    context->checks[check]++;
+    if(!passed && context->failures[check]++ < VERIFY_PRINTED)
+    {
+        va_list args;
+        va_start(args, fmt);
+        printf("%s mismatch in round %d: ", verify_names[check], context->round);
+        vprintf(fmt, args);
+        printf("\n");
+        va_end(args);
+    }
+    return passed;
+}
+
+/*
+ *  feedback straight from the rules, one letter at a time: placed if it's in the same location, in
+ *  the word if the target has it anywhere else, otherwise absent.  first location is the least significant
+ *  digit.
+ */
+static int reference_feedback(const char *guess,
+                              const char *target)
+{
+    int pattern = 0, digit_scale = 1;
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        int digit = WS_FEEDBACK_ABSENT;
+        if(guess[j] == target[j])
+        {
+            digit = WS_FEEDBACK_PLACED;
+        }
+        else if(memchr(target, guess[j], WORDLE_WORD_SIZE))
+        {
+            digit = WS_FEEDBACK_IN_WORD;
+        }
+        pattern += digit*digit_scale;
+        digit_scale *= 3;
+    }
+    return pattern;
+}
+
+/*
+ *  random subset of the dictionary in dictionary order, keeping answer flags.  a subset without answers
+ *  makes every word an answer.
+ */
+static int random_dictionary(const s_wordle_dictionary *dictionary,
+                             s_wordle_dictionary       *subset,
+                             char                      words[][WORDLE_WORD_SIZE+1],
+                             char                      answers[][WORDLE_WORD_SIZE+1])
+{
+    int limit = dictionary->entries < WS_VERIFY_MAX_WORDS ? dictionary->entries : WS_VERIFY_MAX_WORDS;
+    int size = limit > 2 ? 2 + rand()%(limit-1) : limit;
+    int chosen = 0, answer_count = 0;
+    for(int i=0; i<dictionary->entries && chosen<size; i++)
+    {
+        // selection sampling, every subset of the size is equally likely
+        if(rand()%(dictionary->entries - i) < size - chosen)
+        {
+            ws_word_decode(dictionary->words[i], words[chosen]);
+            if(dictionary->flags[i] & WS_WORD_ANSWER)
+            {
+                strcpy(answers[answer_count++], words[chosen]);
+            }
+            chosen++;
+        }
+    }
+    return ws_dictionary_build(subset, words, chosen, answer_count ? answers : NULL, answer_count);
+}
+
+static void check_feedback(s_verify_context          *context,
+                           const s_wordle_dictionary *dictionary,
+                           const char                words[][WORDLE_WORD_SIZE+1])
+{
+    static uint32_t answer_words[WS_VERIFY_MAX_WORDS], answer_masks[WS_VERIFY_MAX_WORDS];
+    static uint8_t patterns[WS_VERIFY_MAX_WORDS];
+    for(int a=0; a<dictionary->answer_entries; a++)
+    {
+        answer_words[a] = dictionary->words[dictionary->answers[a]];
+        answer_masks[a] = dictionary->letter_masks[dictionary->answers[a]];
+    }
+    
+    // every engine for one random guess against every answer
+    int guess = rand()%dictionary->entries;
+    ws_pattern_row(dictionary->words[guess], answer_words, answer_masks, dictionary->answer_entries, patterns);
+    for(int a=0; a<dictionary->answer_entries; a++)
+    {
+        int entry = (int)dictionary->answers[a];
+        int expected = reference_feedback(words[guess], words[entry]);
+        int packed = ws_entry_feedback(dictionary->words[guess], dictionary, entry);
+        int text = ws_feedback(words[guess], words[entry]);
+        if(!verify(context, VERIFY_FEEDBACK, packed == expected && text == expected && patterns[a] == expected,
+                   "%s against %s is %d, packed %d, text %d, row %d", words[guess], words[entry], expected, packed,
+                   text, patterns[a]))
+        {
+            break;
+        }
+    }
+}
+
+/*
+ *  the candidates have to be exactly the words giving the same feedback as the target for every guess played
+ */
+static void check_candidates(s_verify_context          *context,
+                             const s_wordle_dictionary *dictionary,
+                             const char                words[][WORDLE_WORD_SIZE+1],
+                             s_wordle_state            *wordle_state,
+                             const char                *target)
+{
+    int count = ws_sync_candidates(wordle_state, dictionary);
+    int expected_count = 0;
+    int letter_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE] = {0};
+    for(int i=0; i<dictionary->entries; i++)
+    {
+        bool consistent = true;
+        for(int t=0; t<wordle_state->turn && consistent; t++)
+        {
+            consistent = reference_feedback(wordle_state->history[t], words[i]) ==
+                         reference_feedback(wordle_state->history[t], target);
+        }
+        bool candidate = (wordle_state->candidates[i/64] >> (i%64)) & 1;
+        if(!verify(context, VERIFY_CANDIDATES, candidate == consistent, "%s is %sa candidate after %d guesses for %s",
+                   words[i], candidate ? "" : "not ", wordle_state->turn, target))
+        {
+            return;
+        }
+        if(consistent)
+        {
+            expected_count++;
+            for(int j=0; j<WORDLE_WORD_SIZE; j++)
+            {
+                letter_count[words[i][j]-'a'][j]++;
+            }
+        }
+    }
+    verify(context, VERIFY_CANDIDATES, count == expected_count, "%d candidates, expected %d", count, expected_count);
+    verify(context, VERIFY_CANDIDATES, !memcmp(letter_count, wordle_state->letter_count, sizeof(letter_count)),
+           "letter histogram out of step with the candidates");
+    int query_count = ws_query_count(wordle_state, dictionary);
+    verify(context, VERIFY_QUERY, query_count == expected_count, "query counts %d, expected %d", query_count, expected_count);
+}
+
+/*
+ *  the first ranked hint has to be the guess the solver plays next, in either mode
+ */
+static void check_query(s_verify_context          *context,
+                        const s_wordle_dictionary *dictionary,
+                        const s_wordle_state      *wordle_state)
+{
+    static s_wordle_state state;
+    for(int hard_mode=0; hard_mode<2; hard_mode++)
+    {
+        state = *wordle_state;
+        state.hard_mode = hard_mode;
+        char guess[WORDLE_WORD_SIZE+1];
+        s_query_word page[1];
+        ws_choose_guess(&state, dictionary, guess, false);
+        int count = ws_query_page(&state, dictionary, WS_QUERY_RANKED, 0, 1, page);
+        verify(context, VERIFY_QUERY, count == 1 && !strcmp(page[0].word, guess),
+               "first ranked hint %s, the solver guesses %s%s", count ? page[0].word : "(none)", guess,
+               hard_mode ? " in hard mode" : "");
+    }
+}
+
+/*
+ *  index a few random answers and check every bucket of a few random guesses
+ */
+static void check_answer_index(s_verify_context          *context,
+                               const s_wordle_dictionary *dictionary,
+                               const char                words[][WORDLE_WORD_SIZE+1])
+{
+    uint16_t answers[64];
+    int answer_count = 1 + rand()%64;
+    for(int a=0; a<answer_count; a++)
+    {
+        answers[a] = (uint16_t)dictionary->answers[rand()%dictionary->answer_entries];
+    }
+    s_answer_index index;
+    if(ws_answer_index_build(&index, dictionary, answers, answer_count, 1))
+    {
+        return;
+    }
+    for(int i=0; i<4; i++)
+    {
+        int guess = rand()%dictionary->entries, total = 0;
+        int64_t sum_squares = 0;
+        for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+        {
+            int size = ws_answer_index_bucket_size(&index, guess, p);
+            const uint16_t *members = ws_answer_index_bucket(&index, guess, p);
+            for(int m=0; m<size; m++)
+            {
+                int expected = reference_feedback(words[guess], words[members[m]]);
+                verify(context, VERIFY_INDEX, expected == p, "%s against %s filed under %d, expected %d",
+                       words[guess], words[members[m]], p, expected);
+            }
+            total += size;
+            sum_squares += (int64_t)size*size;
+        }
+        verify(context, VERIFY_INDEX, total == answer_count, "%s buckets hold %d of %d answers", words[guess], total, answer_count);
+        verify(context, VERIFY_INDEX, sum_squares == ws_answer_index_sum_squares(&index, guess),
+               "%s sum of squares %" PRId64 ", expected %" PRId64, words[guess], ws_answer_index_sum_squares(&index, guess),
+               sum_squares);
+    }
+    
+    // splitting by a guess has to give each big enough bucket an index of its own answers
+    int split_guess = rand()%dictionary->entries, min_answers = 1 + rand()%4;
+    s_answer_index children[WS_FEEDBACK_PATTERNS];
+    if(ws_answer_index_split(&index, split_guess, min_answers, children, 1))
+    {
+        ws_answer_index_release(&index);
+        return;
+    }
+    for(int p=0; p<WS_FEEDBACK_PATTERNS; p++)
+    {
+        int size = ws_answer_index_bucket_size(&index, split_guess, p);
+        verify(context, VERIFY_INDEX, children[p].answers == (size >= min_answers ? size : 0),
+               "%s split holds %d answers for %d, expected %d", words[split_guess], children[p].answers, p, size);
+        if(!children[p].answers)
+        {
+            continue;
+        }
+        int guess = rand()%dictionary->entries;
+        for(int q=0; q<WS_FEEDBACK_PATTERNS; q++)
+        {
+            const uint16_t *members = ws_answer_index_bucket(&children[p], guess, q);
+            for(int m=0; m<ws_answer_index_bucket_size(&children[p], guess, q); m++)
+            {
+                verify(context, VERIFY_INDEX, reference_feedback(words[split_guess], words[members[m]]) == p &&
+                                              reference_feedback(words[guess], words[members[m]]) == q,
+                       "%s split by %s filed %s under %d, %d", words[guess], words[split_guess], words[members[m]], p, q);
+            }
+        }
+        ws_answer_index_release(&children[p]);
+    }
+    ws_answer_index_release(&index);
+}
+
+/*
+ *  the search without a budget has to find the best split there is, and a candidate if one splits as well
+ */
+static void check_search(s_verify_context          *context,
+                         const s_wordle_dictionary *dictionary,
+                         const char                words[][WORDLE_WORD_SIZE+1],
+                         const s_wordle_state      *wordle_state)
+{
+    static s_wordle_state search_state;
+    static int candidates[WS_VERIFY_MAX_SEARCHED];
+    static int buckets[WS_FEEDBACK_PATTERNS];
+    int candidate_count = 0;
+    for(int i=0; i<dictionary->entries && candidate_count<WS_VERIFY_MAX_SEARCHED; i++)
+    {
+        if((wordle_state->candidates[i/64] >> (i%64)) & 1)
+        {
+            candidates[candidate_count++] = i;
+        }
+    }
+    if(candidate_count < 3 || candidate_count != wordle_state->candidate_count)
+    {
+        return;
+    }
+    
+    search_state = *wordle_state;
+    s_search_budget budget = {0};
+    s_search_result result;
+    if(ws_search_guess(&search_state, dictionary, &budget, &result, false))
+    {
+        return;
+    }
+    
+    int64_t best = INT64_MAX, best_candidate = INT64_MAX, chosen = -1;
+    bool chosen_candidate = false;
+    for(int i=0; i<dictionary->entries; i++)
+    {
+        bool candidate = (wordle_state->candidates[i/64] >> (i%64)) & 1;
+        if(wordle_state->hard_mode && !candidate)
+        {
+            continue;
+        }
+        memset(buckets, 0, sizeof(buckets));
+        int64_t score = 0;
+        for(int c=0; c<candidate_count; c++)
+        {
+            score += 2*buckets[reference_feedback(words[i], words[candidates[c]])]++ + 1;
+        }
+        best = score < best ? score : best;
+        best_candidate = candidate && score < best_candidate ? score : best_candidate;
+        if(!strcmp(words[i], result.guess))
+        {
+            chosen = score;
+            chosen_candidate = candidate;
+        }
+    }
+    verify(context, VERIFY_SEARCH, chosen == best, "picked %s scoring %" PRId64 ", best is %" PRId64 " over %d candidates",
+           result.guess, chosen, best, candidate_count);
+    verify(context, VERIFY_SEARCH, chosen_candidate || best_candidate > best,
+           "picked %s over a candidate splitting as well", result.guess);
+}
+
+static int play_game(const s_wordle_dictionary *dictionary,
+                     const char                *start_word,
+                     bool                      hard_mode,
+                     uint32_t                  target_word,
+                     s_wordle_state            *wordle_state)
+{
+    ws_init(wordle_state, start_word, hard_mode);
+    int guess_count = 1;
+    while(!ws_make_guess(wordle_state, target_word, dictionary, false) && guess_count <= WS_STRATEGY_MAX_GUESSES)
+    {
+        guess_count++;
+    }
+    return guess_count;
+}
+
+/*
+ *  the solver's original picker, on text words and without any of the engine's tables: the candidates are
+ *  the words giving the target's feedback to every guess so far, and the guess is the first candidate whose
+ *  letters are most common in their locations, counted over the whole word list in normal mode and over the
+ *  candidates in hard mode.  returns the number of guesses, recorded in history up to WS_MAX_HISTORY.
+ */
+static int reference_game(const s_wordle_dictionary *dictionary,
+                          const char                words[][WORDLE_WORD_SIZE+1],
+                          const char                *start_word,
+                          bool                      hard_mode,
+                          const char                *target,
+                          char                      history[WS_MAX_HISTORY][WORDLE_WORD_SIZE+1])
+{
+    static bool candidate[WS_VERIFY_MAX_WORDS];
+    strcpy(history[0], start_word);
+    int guess_count = 1;
+    while(strcmp(history[guess_count-1], target) && guess_count < WS_MAX_HISTORY)
+    {
+        int letter_count[WS_WORD_LETTERS][WORDLE_WORD_SIZE] = {0};
+        for(int i=0; i<dictionary->entries; i++)
+        {
+            candidate[i] = true;
+            for(int t=0; t<guess_count && candidate[i]; t++)
+            {
+                candidate[i] = reference_feedback(history[t], words[i]) == reference_feedback(history[t], target);
+            }
+            if(candidate[i] || !hard_mode)
+            {
+                for(int j=0; j<WORDLE_WORD_SIZE; j++)
+                {
+                    letter_count[words[i][j]-'a'][j]++;
+                }
+            }
+        }
+        
+        int best = -1, best_score = -1;
+        for(int i=0; i<dictionary->entries; i++)
+        {
+            int score = 0;
+            for(int j=0; j<WORDLE_WORD_SIZE; j++)
+            {
+                score += letter_count[words[i][j]-'a'][j];
+            }
+            if(candidate[i] && score > best_score)
+            {
+                best_score = score;
+                best = i;
+            }
+        }
+        strcpy(history[guess_count++], words[best]);
+    }
+    return guess_count;
+}
+
+/*
+ *  the default picker, played directly and through the strategy interface, has to make the same guesses as
+ *  the reference one
+ */
+static void check_strategy(s_verify_context          *context,
+                           const s_wordle_dictionary *dictionary,
+                           const char                words[][WORDLE_WORD_SIZE+1],
+                           const char                *start_word,
+                           bool                      hard_mode,
+                           uint32_t                  target_word)
+{
+    static s_wordle_state direct_state, strategy_state;
+    static char expected[WS_MAX_HISTORY][WORDLE_WORD_SIZE+1];
+    char target[WORDLE_WORD_SIZE+1];
+    ws_word_decode(target_word, target);
+    int reference = reference_game(dictionary, words, start_word, hard_mode, target, expected);
+    int direct = play_game(dictionary, start_word, hard_mode, target_word, &direct_state);
+    ws_init(&strategy_state, start_word, hard_mode);
+    int played = ws_strategy_play(ws_strategy_find("letters"), &strategy_state, dictionary, target_word, NULL, false);
+    
+    const s_wordle_state *states[2] = {&direct_state, &strategy_state};
+    const char *paths[2] = {"ws_make_guess()", "the strategy"};
+    int counts[2] = {direct, played};
+    int recorded = reference < WS_MAX_HISTORY ? reference : WS_MAX_HISTORY;
+    for(int p=0; p<2; p++)
+    {
+        if(!verify(context, VERIFY_STRATEGY, counts[p] == reference, "%s%s took %d guesses through %s, %d in the reference",
+                   target, hard_mode ? " hard" : "", counts[p], paths[p], reference))
+        {
+            continue;
+        }
+        for(int t=0; t<recorded; t++)
+        {
+            if(!verify(context, VERIFY_STRATEGY, !strcmp(states[p]->history[t], expected[t]),
+                       "%s%s guess %d was %s through %s, %s in the reference", target, hard_mode ? " hard" : "", t+1,
+                       states[p]->history[t], paths[p], expected[t]))
+            {
+                break;
+            }
+        }
+    }
+}
+
+/*
+ *  guesses one state played that another didn't, -1 if both played the same ones
+ */
+static int history_differs(const s_wordle_state *a,
+                           const s_wordle_state *b)
+{
+    int recorded = a->turn < WS_MAX_HISTORY ? a->turn : WS_MAX_HISTORY;
+    for(int t=0; t<recorded; t++)
+    {
+        if(strcmp(a->history[t], b->history[t]))
+        {
+            return t;
+        }
+    }
+    return a->turn == b->turn ? -1 : recorded;
+}
+
+/*
+ *  a reordered dictionary (-reorder) has to play the same games as the word list in its own order, on one
+ *  board in both modes and on several boards at once.  -reorder groups words by their feedback to the start
+ *  word, which keeps every later candidate set in list order, so reordering around some other pivot is what
+ *  shows up a tie broken by entry instead of by ws_entry_original().
+ */
+static void check_reorder(s_verify_context          *context,
+                          const s_wordle_dictionary *dictionary,
+                          const char                *start_word,
+                          uint32_t                  pivot,
+                          uint32_t                  target_word)
+{
+    static s_wordle_state state, reordered_state;
+    static s_multi_wordle_state multi_state, reordered_multi_state;
+    s_wordle_dictionary reordered;
+    char pivot_word[WORDLE_WORD_SIZE+1];
+    ws_word_decode(pivot, pivot_word);
+    if(!verify(context, VERIFY_REORDER, !ws_dictionary_reorder(&reordered, dictionary, pivot),
+               "couldn't reorder around %s", pivot_word))
+    {
+        return;
+    }
+    
+    char target[WORDLE_WORD_SIZE+1];
+    ws_word_decode(target_word, target);
+    for(int hard_mode=0; hard_mode<2; hard_mode++)
+    {
+        play_game(dictionary, start_word, hard_mode, target_word, &state);
+        play_game(&reordered, start_word, hard_mode, target_word, &reordered_state);
+        int t = history_differs(&state, &reordered_state);
+        verify(context, VERIFY_REORDER, t < 0, "%s%s guess %d was %s, %s reordered around %s", target,
+               hard_mode ? " hard" : "", t+1, t < 0 ? "" : state.history[t], t < 0 ? "" : reordered_state.history[t],
+               pivot_word);
+    }
+    
+    // the multi-board game guesses the same way whichever board order the targets come in
+    uint32_t targets[WS_MAX_BOARDS];
+    int boards = 2 + rand()%3;
+    targets[0] = target_word;
+    for(int b=1; b<boards; b++)
+    {
+        targets[b] = dictionary->words[dictionary->answers[rand()%dictionary->answer_entries]];
+    }
+    ws_multi_init(&multi_state, boards, start_word);
+    ws_multi_init(&reordered_multi_state, boards, start_word);
+    bool solved = false, reordered_solved = false;
+    for(int g=0; g<WS_STRATEGY_MAX_GUESSES && !(solved && reordered_solved); g++)
+    {
+        solved = solved || ws_multi_make_guess(&multi_state, targets, dictionary, false);
+        reordered_solved = reordered_solved || ws_multi_make_guess(&reordered_multi_state, targets, &reordered, false);
+    }
+    for(int b=0; b<boards; b++)
+    {
+        int t = history_differs(&multi_state.board[b], &reordered_multi_state.board[b]);
+        if(!verify(context, VERIFY_REORDER, t < 0, "%d boards, board %d guess %d was %s, %s reordered around %s", boards,
+                   b+1, t+1, t < 0 ? "" : multi_state.board[b].history[t],
+                   t < 0 ? "" : reordered_multi_state.board[b].history[t], pivot_word))
+        {
+            break;
+        }
+    }
+    ws_dictionary_release(&reordered);
+}
+
+/*
+ *  run rounds of random dictionaries and states through every check, returns the number of failures
+ */
+int ws_verify_fuzz(const s_wordle_dictionary *dictionary,
+                   int                       rounds,
+                   unsigned int              seed,
+                   bool                      verbose)
+{
+    static char words[WS_VERIFY_MAX_WORDS][WORDLE_WORD_SIZE+1];
+    static char answers[WS_VERIFY_MAX_WORDS][WORDLE_WORD_SIZE+1];
+    static s_wordle_state wordle_state;
+    s_verify_context context;
+    memset(&context, 0, sizeof(context));
+    
+    printf("fuzzing %d rounds with seed %u\n", rounds, seed);
+    srand(seed);
+    for(context.round=0; context.round<rounds; context.round++)
+    {
+        s_wordle_dictionary subset;
+        if(random_dictionary(dictionary, &subset, words, answers))
+        {
+            printf("couldn't build a random dictionary; exiting...\n");
+            return 1;
+        }
+        
+        // a random target and a few random guesses at it, none of them the target
+        uint32_t target_entry = subset.answers[rand()%subset.answer_entries];
+        const char *target = words[target_entry];
+        bool hard_mode = rand() & 1;
+        ws_init(&wordle_state, NULL, hard_mode);
+        int turns = rand()%4;
+        for(int t=0; t<turns; t++)
+        {
+            int guess = rand()%subset.entries;
+            if(guess != (int)target_entry)
+            {
+                ws_apply_guess(&wordle_state, words[guess], subset.words[target_entry], false);
+            }
+        }
+        ws_debug_print(verbose, "round %d: %d words, %d answers, target %s, %d guesses%s\n", context.round, subset.entries,
+                       subset.answer_entries, target, wordle_state.turn, hard_mode ? ", hard mode" : "");
+        
+        check_feedback(&context, &subset, words);
+        check_candidates(&context, &subset, words, &wordle_state, target);
+        check_query(&context, &subset, &wordle_state);
+        check_answer_index(&context, &subset, words);
+        check_search(&context, &subset, words, &wordle_state);
+        check_strategy(&context, &subset, words, words[rand()%subset.entries], hard_mode, subset.words[target_entry]);
+        check_reorder(&context, &subset, words[rand()%subset.entries], subset.words[rand()%subset.entries],
+                      subset.words[target_entry]);
+        ws_dictionary_release(&subset);
+    }
+    
+    uint64_t failures = 0;
+    for(int c=0; c<VERIFY_CHECKS; c++)
+    {
+        printf("    %-14s %10" PRIu64 " checks, %" PRIu64 " failed\n", verify_names[c], context.checks[c], context.failures[c]);
+        failures += context.failures[c];
+    }
+    return failures ? 1 : 0;
+}
+
+/*
+ *  record the guess count of every dictionary word as the target, in normal and hard mode, returns nonzero
+ *  on failure
+ */
+int ws_golden_write(const s_wordle_dictionary *dictionary,
+                    const char                *start_word,
+                    const char                *path)
+{
+    FILE *fp = fopen(path, "w");
+    if(fp == NULL)
+    {
+        printf("couldn't open golden file %s\n", path);
+        return 1;
+    }
+    
+    static s_wordle_state wordle_state;
+    fprintf(fp, WS_GOLDEN_MAGIC "\n");
+    fprintf(fp, "# start %s\n", start_word);
+    fprintf(fp, "# dictionary %016" PRIx64 "\n", dictionary->hash);
+    fprintf(fp, "# target normal hard\n");
+    for(int i=0; i<dictionary->entries; i++)
+    {
+        char target[WORDLE_WORD_SIZE+1];
+        ws_word_decode(dictionary->words[i], target);
+        int normal = play_game(dictionary, start_word, false, dictionary->words[i], &wordle_state);
+        int hard = play_game(dictionary, start_word, true, dictionary->words[i], &wordle_state);
+        fprintf(fp, "%s %d %d\n", target, normal, hard);
+    }
+    
+    if(fclose(fp))
+    {
+        printf("couldn't write golden file %s\n", path);
+        return 1;
+    }
+    printf("recorded %d targets starting with %s to %s\n", dictionary->entries, start_word, path);
+    return 0;
+}
+
+/*
+ *  replay every target in a golden file and compare, returns nonzero if anything differs
+ */
+int ws_golden_check(const s_wordle_dictionary *dictionary,
+                    const char                *path)
+{
+    FILE *fp = fopen(path, "r");
+    if(fp == NULL)
+    {
+        printf("couldn't open golden file %s\n", path);
+        return 1;
+    }
+    
+    char line[128], start_word[WORDLE_WORD_SIZE+2] = "";
+    uint64_t hash = 0;
+    if(!fgets(line, sizeof(line), fp) || strncmp(line, WS_GOLDEN_MAGIC, strlen(WS_GOLDEN_MAGIC)) ||
+       !fgets(line, sizeof(line), fp) || sscanf(line, "# start %6s", start_word) != 1 || strlen(start_word) != WORDLE_WORD_SIZE ||
+       !fgets(line, sizeof(line), fp) || sscanf(line, "# dictionary %" SCNx64, &hash) != 1)
+    {
+        printf("%s is not a golden file\n", path);
+        fclose(fp);
+        return 1;
+    }
+    if(hash != dictionary->hash)
+    {
+        printf("golden file %s was recorded with a different word list\n", path);
+        fclose(fp);
+        return 1;
+    }
+    
+    static s_wordle_state wordle_state;
+    int checked = 0, differ = 0;
+    while(fgets(line, sizeof(line), fp))
+    {
+        char target[WORDLE_WORD_SIZE+2];
+        int normal, hard;
+        if(line[0] == '#')
+        {
+            continue;
+        }
+        if(sscanf(line, "%6s %d %d", target, &normal, &hard) != 3 || checked >= dictionary->entries ||
+           ws_word_encode(target) != dictionary->words[checked])
+        {
+            printf("golden file %s doesn't match the dictionary at target %d\n", path, checked+1);
+            fclose(fp);
+            return 1;
+        }
+        int played_normal = play_game(dictionary, start_word, false, dictionary->words[checked], &wordle_state);
+        int played_hard = play_game(dictionary, start_word, true, dictionary->words[checked], &wordle_state);
+        if(played_normal != normal || played_hard != hard)
+        {
+            if(differ++ < GOLDEN_PRINTED)
+            {
+                printf("    %s took %d guesses (%d hard), recorded %d (%d hard)\n", target, played_normal, played_hard,
+                       normal, hard);
+            }
+        }
+        checked++;
+    }
+    fclose(fp);
+    
+    if(checked != dictionary->entries)
+    {
+        printf("golden file %s has %d of %d targets\n", path, checked, dictionary->entries);
+        return 1;
+    }
+    printf("checked %d targets starting with %s against %s, %d differ\n", checked, start_word, path, differ);
+    return differ ? 1 : 0;
+}
@@ -0,0 +1,39 @@
+//
+//  wordle-verify.h
+//  wordle-solver
+//
+//  Differential checks for the optimized engines.  The fuzzer builds random dictionaries from a word list,
+//  plays random hints into random states and checks each engine against a plain reference written straight
+//  from the rules: feedback, candidate filtering, the candidate query, the answer index, the guess search,
+//  the default picker against a slow copy of the solver's original one and games on a reordered dictionary
+//  against the word list's own order.  Golden files lock the guess count of every target in normal and hard
+//  mode, so a change that moves any game shows up as a diff against the recorded file.  wordle-tests.c runs
+//  both as a test executable of its own.
+//
+
+#ifndef wordle_verify_h
+#define wordle_verify_h
+
+#include "wordle-solver.h"
+
+// random dictionaries are up to this many words, big enough for real candidate sets, small enough to fuzz fast
+#define WS_VERIFY_MAX_WORDS         2048
+
+// the guess search is only checked against exhaustive reference scoring with at most this many candidates
+#define WS_VERIFY_MAX_SEARCHED      256
+
+#define WS_GOLDEN_MAGIC             "# wordle-solver golden guess counts"
+
+int ws_verify_fuzz(const s_wordle_dictionary *dictionary,
+                   int                       rounds,
+                   unsigned int              seed,
+                   bool                      verbose);
+
+int ws_golden_write(const s_wordle_dictionary *dictionary,
+                    const char                *start_word,
+                    const char                *path);
+
+int ws_golden_check(const s_wordle_dictionary *dictionary,
+                    const char                *path);
+
+#endif /* wordle_verify_h */
@@ -0,0 +1,82 @@
+//
+//  wordle-word.h
+//  wordle-solver
+//
+//  Packed word encoding: five letter indices at five bits each, first letter in the low bits.  A word fits
+//  in a uint32_t, so dictionary tables are 4 bytes a word and comparing words is an integer compare.  Letters
+//  are indices into the alphabet (wordle-alphabet.h), 0-25 for English, and the solver's text form of a
+//  word is 'a'+index.
+//
+
+#ifndef wordle_word_h
+#define wordle_word_h
+
+#include <stdint.h>
+
+#define WORDLE_WORD_SIZE            5
+
+#define WS_WORD_LETTER_BITS         5
+#define WS_WORD_LETTER_MASK         0x1fu
+
+// letter indices 0-30 size every per letter table, 31 is kept free to mark "no letter" (WS_PARTITION_DEAD_LETTER)
+#define WS_WORD_LETTERS             31
+
+/*
+ *  pack a word in solver text, anything else is masked into range so check the word first if it matters
+ */
+static inline uint32_t ws_word_encode(const char *word)
+{
+    uint32_t packed = 0;
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        packed |= ((uint32_t)(word[j]-'a') & WS_WORD_LETTER_MASK) << (WS_WORD_LETTER_BITS*j);
+    }
+    return packed;
+}
+
+static inline void ws_word_decode(uint32_t word,
+                                  char     text[WORDLE_WORD_SIZE+1])
+{
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        text[j] = (char)('a' + ((word >> (WS_WORD_LETTER_BITS*j)) & WS_WORD_LETTER_MASK));
+    }
+    text[WORDLE_WORD_SIZE] = 0;
+}
+
+/*
+ *  letter index at a location
+ */
+static inline int ws_word_letter(uint32_t word,
+                                 int      location)
+{
+    return (int)((word >> (WS_WORD_LETTER_BITS*location)) & WS_WORD_LETTER_MASK);
+}
+
+/*
+ *  letters used by the word, one bit per letter
+ */
+static inline uint32_t ws_word_letter_mask(uint32_t word)
+{
+    uint32_t mask = 0;
+    for(int j=0; j<WORDLE_WORD_SIZE; j++)
+    {
+        mask |= 1u << ws_word_letter(word, j);
+    }
+    return mask;
+}
+
+/*
+ *  well mixed hash for hash tables keyed by word (murmur3 finalizer)
+ */
+static inline uint32_t ws_word_hash(uint32_t word)
+{
+    word ^= word >> 16;
+    word *= 0x85ebca6bu;
+    word ^= word >> 13;
+    word *= 0xc2b2ae35u;
+    word ^= word >> 16;
+    return word;
+}
+
+#endif /* wordle_word_h */
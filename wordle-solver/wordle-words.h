@@ -13,7 +13,7 @@
 #define LEN_WORDLE_TARGET_WORDS      2315
 #define LEN_WORDLE_DICTIONARY        12972
 
-char wordle_target_words[LEN_WORDLE_TARGET_WORDS][WORDLE_WORD_SIZE+1] = {
+static const char wordle_target_words[LEN_WORDLE_TARGET_WORDS][WORDLE_WORD_SIZE+1] = {
 	"cigar","rebut","sissy","humph","awake","blush","focal","evade","naval","serve","heath","dwarf","model","karma","stink","grade","quiet","bench","abate"
 	,"feign","major","death","fresh","crust","stool","colon","abase","marry","react","batty","pride","floss","helix","croak","staff","paper","unfed","whelp"
 	,"trawl","outdo","adobe","crazy","sower","repay","digit","crate","cluck","spike","mimic","pound","maxim","linen","unmet","flesh","booby","forth","first"
@@ -138,7 +138,7 @@ char wordle_target_words[LEN_WORDLE_TARGET_WORDS][WORDLE_WORD_SIZE+1] = {
 	,"peace","flush","catty","login","eject","roger","rival","untie","refit","aorta","adult","judge","rower","artsy","rural","shave"};
 
 
-char wordle_full_dictionary[LEN_WORDLE_DICTIONARY][WORDLE_WORD_SIZE+1] = {
+static const char wordle_full_dictionary[LEN_WORDLE_DICTIONARY][WORDLE_WORD_SIZE+1] = {
 	"aahed","aalii","aargh","aarti","abaca","abaci","abacs","abaft","abaka","abamp","aband","abash","abask","abaya","abbas","abbed","abbes","abcee","abeam"
 	,"abear","abele","abers","abets","abies","abler","ables","ablet","ablow","abmho","abohm","aboil","aboma","aboon","abord","abore","abram","abray","abrim"
 	,"abrin","abris","absey","absit","abuna","abune","abuts","abuzz","abyes","abysm","acais","acari","accas","accoy","acerb","acers","aceta","achar","ached"